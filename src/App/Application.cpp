@@ -74,6 +74,7 @@
 #include <Base/PrecisionPy.h>
 #include <Base/ProgressIndicatorPy.h>
 #include <Base/RotationPy.h>
+#include <Base/StartupProfiler.h>
 #include <Base/Tools.h>
 #include <Base/Translate.h>
 #include <Base/Type.h>
@@ -1916,10 +1917,18 @@ void Application::init(int argc, char ** argv)
 #if defined(FC_SE_TRANSLATOR)
         _set_se_translator(my_se_translator_filter);
 #endif
-        initTypes();
-
-        initConfig(argc,argv);
-        initApplication();
+        {
+            Base::StartupProfiler::Phase phase("initTypes");
+            initTypes();
+        }
+        {
+            Base::StartupProfiler::Phase phase("initConfig");
+            initConfig(argc,argv);
+        }
+        {
+            Base::StartupProfiler::Phase phase("initApplication");
+            initApplication();
+        }
     }
     catch (...) {
         // force the log to flush
@@ -2215,12 +2224,14 @@ void parseProgramOptions(int ac, char ** av, const string& exe, variables_map& v
     config.add_options()
     ("write-log,l", descr.str().c_str())
     ("log-file", value<string>(), "Unlike --write-log this allows logging to an arbitrary file")
+    ("trace-startup", value<string>(), "Writes a timeline of the start-up to the given file")
     ("user-cfg,u", value<string>(),"User config file to load/save user settings")
     ("system-cfg,s", value<string>(),"System config file to load/save system settings")
     ("run-test,t", value<string>()->implicit_value(""),"Run a given test case (use 0 (zero) to run all tests). If no argument is provided then return list of all available tests.")
     ("module-path,M", value< vector<string> >()->composing(),"Additional module paths")
     ("python-path,P", value< vector<string> >()->composing(),"Additional python paths")
     ("single-instance", "Allow to run a single instance of the application")
+    ("worker", value<string>()->implicit_value("-"), "Runs as worker serving batch jobs read from stdin or from the given local socket or <host>:<port>")
     ("pass", value< vector<string> >()->multitoken(), "Ignores the following arguments and pass them through to be used by a script")
     ;
 
@@ -2434,6 +2445,11 @@ void processProgramOptions(const variables_map& vm, std::map<std::string,std::st
         mConfig["LoggingFileName"] = vm["log-file"].as<string>();
     }
 
+    if (vm.count("trace-startup")) {
+        mConfig["StartupTraceFile"] = vm["trace-startup"].as<string>();
+        Base::StartupProfiler::setOutputFile(mConfig["StartupTraceFile"]);
+    }
+
     if (vm.count("user-cfg")) {
         mConfig["UserParameter"] = vm["user-cfg"].as<string>();
     }
@@ -2459,6 +2475,11 @@ void processProgramOptions(const variables_map& vm, std::map<std::string,std::st
         mConfig["SingleInstance"] = "1";
     }
 
+    if (vm.count("worker")) {
+        mConfig["WorkerAddress"] = vm["worker"].as<string>();
+        mConfig["RunMode"] = "Worker";
+    }
+
     if (vm.count("dump-config")) {
         std::stringstream str;
         for (const auto & it : mConfig) {
@@ -2581,7 +2602,11 @@ void Application::initConfig(int argc, char ** argv)
         Py_DECREF(pyModule);
     }
 
-    const char* pythonpath = Base::Interpreter().init(argc,argv);
+    const char* pythonpath = nullptr;
+    {
+        Base::StartupProfiler::Phase phase("Interpreter");
+        pythonpath = Base::Interpreter().init(argc,argv);
+    }
     if (pythonpath)
         mConfig["PythonSearchPath"] = pythonpath;
     else
@@ -2612,9 +2637,9 @@ void Application::initConfig(int argc, char ** argv)
         _pConsoleObserverFile = nullptr;
 
     // Banner ===========================================================
-    if (!(mConfig["RunMode"] == "Cmd")) {
+    if (!(mConfig["RunMode"] == "Cmd") && !(mConfig["RunMode"] == "Worker")) {
         // Remove banner if FreeCAD is invoked via the -c command as regular
-        // Python interpreter
+        // Python interpreter or as a worker that replies on stdout
         if (!(mConfig["Verbose"] == "Strict"))
             Base::Console().Message("%s %s, Libs: %s.%s.%s%sR%s\n%s",
                               mConfig["ExeName"].c_str(),
@@ -2635,7 +2660,10 @@ void Application::initConfig(int argc, char ** argv)
                               mConfig["BuildVersionSuffix"].c_str(),
                               mConfig["BuildRevision"].c_str());
     }
-    LoadParameters();
+    {
+        Base::StartupProfiler::Phase phase("LoadParameters");
+        LoadParameters();
+    }
 
     auto loglevelParam = _pcUserParamMngr->GetGroup("BaseApp/LogLevels");
     const auto &loglevels = loglevelParam->GetIntMap();
@@ -2757,6 +2785,7 @@ void Application::initApplication()
     // starting the init script
     Base::Console().Log("Run App init script\n");
     try {
+        Base::StartupProfiler::Phase phase("FreeCADInit");
         Base::Interpreter().runString(Base::ScriptFactory().ProduceScript("CMakeVariables"));
         Base::Interpreter().runString(Base::ScriptFactory().ProduceScript("FreeCADInit"));
     }
@@ -2904,6 +2933,9 @@ void Application::processCmdLineFiles()
 
 void Application::runApplication()
 {
+    // the start-up ends before the files and scripts given through command line are processed
+    Base::StartupProfiler::finish();
+
     // process all files given through command line interface
     processCmdLineFiles();
 
@@ -2916,6 +2948,11 @@ void Application::runApplication()
         Base::Console().Log("Running internal script:\n");
         Base::Interpreter().runString(Base::ScriptFactory().ProduceScript(mConfig["ScriptFileName"].c_str()));
     }
+    else if (mConfig["RunMode"] == "Worker") {
+        // serve batch jobs until the input ends or a shutdown is requested
+        Base::Console().Log("Running as worker\n");
+        Base::Interpreter().runString("from freecad import worker\nworker.run()");
+    }
     else if (mConfig["RunMode"] == "Exit") {
         // getting out
         Base::Console().Log("Exiting on purpose\n");
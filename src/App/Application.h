@@ -536,6 +536,8 @@ private:
     static PyObject* sGetUserMacroPath  (PyObject *self, PyObject *args);
     static PyObject* sGetHelpPath       (PyObject *self, PyObject *args);
     static PyObject* sGetHomePath       (PyObject *self, PyObject *args);
+    static PyObject* sBeginStartupPhase (PyObject *self, PyObject *args);
+    static PyObject* sEndStartupPhase   (PyObject *self, PyObject *args);
 
     static PyObject* sLoadFile          (PyObject *self,PyObject *args);
     static PyObject* sOpenDocument      (PyObject *self,PyObject *args, PyObject *kwd);
@@ -31,6 +31,7 @@
 #include <Base/Parameter.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Sequencer.h>
+#include <Base/StartupProfiler.h>
 
 #include "Application.h"
 #include "DocumentPy.h"
@@ -94,6 +95,12 @@ PyMethodDef Application::Methods[] = {
      "Get the directory of the documentation"},
     {"getHomePath",    (PyCFunction) Application::sGetHomePath, METH_VARARGS,
      "Get the home path, i.e. the parent directory of the executable"},
+    {"beginStartupPhase", (PyCFunction) Application::sBeginStartupPhase, METH_VARARGS,
+     "beginStartupPhase(string, [string='phase']) -> None\n\n"
+     "Starts a named phase of the start-up timeline. Used by the init scripts."},
+    {"endStartupPhase", (PyCFunction) Application::sEndStartupPhase, METH_VARARGS,
+     "endStartupPhase() -> None\n\n"
+     "Ends the phase started last with beginStartupPhase()."},
 
     {"loadFile",       (PyCFunction) Application::sLoadFile, METH_VARARGS,
      "loadFile(string=filename,[string=module]) -> None\n\n"
@@ -669,6 +676,26 @@ PyObject* Application::sGetUserCachePath(PyObject * /*self*/, PyObject *args)
     return Py::new_reference_to(datadir);
 }
 
+PyObject* Application::sBeginStartupPhase(PyObject * /*self*/, PyObject *args)
+{
+    const char* name = nullptr;
+    const char* category = "phase";
+    if (!PyArg_ParseTuple(args, "s|s", &name, &category))
+        return nullptr;
+
+    Base::StartupProfiler::begin(name, category);
+    Py_Return;
+}
+
+PyObject* Application::sEndStartupPhase(PyObject * /*self*/, PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return nullptr;
+
+    Base::StartupProfiler::end();
+    Py_Return;
+}
+
 PyObject* Application::sGetUserConfigPath(PyObject * /*self*/, PyObject *args)
 {
     if (!PyArg_ParseTuple(args, ""))
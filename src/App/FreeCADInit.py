@@ -72,6 +72,27 @@ def setupSearchPaths(PathExtension):
 
 FreeCAD._importFromFreeCAD = removeFromPath
 
+def packagePath(module_name):
+    """returns the directories of a package of the freecad namespace without importing
+        it, so that packages without an init module are only imported when they are used.
+        As for the import a regular package is taken from the first portion of the
+        freecad namespace that has it, otherwise all portions make up the package."""
+    import importlib
+    import freecad
+    name = module_name.rpartition('.')[2]
+    paths = []
+    for path in freecad.__path__:
+        package = os.path.join(path, name)
+        if os.path.isfile(os.path.join(package, "__init__.py")):
+            return [package]
+        if os.path.isdir(package):
+            paths.append(package)
+    if paths:
+        return paths
+    return importlib.import_module(module_name).__path__
+
+FreeCAD._packagePath = packagePath
+
 
 def InitApplications():
     # Checking on FreeCAD module path ++++++++++++++++++++++++++++++++++++++++++
@@ -177,6 +198,7 @@ def InitApplications():
     def RunInitPy(Dir):
         InstallFile = os.path.join(Dir,"Init.py")
         if (os.path.exists(InstallFile)):
+            FreeCAD.beginStartupPhase(os.path.basename(Dir), "module")
             try:
                 with open(InstallFile, 'rt', encoding='utf-8') as f:
                     exec(compile(f.read(), InstallFile, 'exec'))
@@ -189,6 +211,8 @@ def InitApplications():
                 Err('Please look into the log file for further information\n')
             else:
                 Log('Init:      Initializing ' + Dir + '... done\n')
+            finally:
+                FreeCAD.endStartupPhase()
         else:
             Log('Init:      Initializing ' + Dir + '(Init.py not found)... ignore\n')
 
@@ -256,13 +280,16 @@ def InitApplications():
                             Msg(f'NOTICE: Addon "{freecad_module_name}" does not support this version of FreeCAD, so is being skipped\n')
                             continue
 
-                    freecad_module = importlib.import_module(freecad_module_name)
-                    extension_modules += [freecad_module_name]
-                    if any (module_name == 'init' for _, module_name, ispkg in pkgutil.iter_modules(freecad_module.__path__)):
-                        importlib.import_module(freecad_module_name + '.init')
+                    if any (module_name == 'init' for _, module_name, ispkg in pkgutil.iter_modules(packagePath(freecad_module_name))):
+                        FreeCAD.beginStartupPhase(freecad_module_name, "module")
+                        try:
+                            importlib.import_module(freecad_module_name + '.init')
+                        finally:
+                            FreeCAD.endStartupPhase()
+                        extension_modules += [freecad_module_name]
                         Log('Init: Initializing ' + freecad_module_name + '... done\n')
                     else:
-                        Log('Init: No init module found in ' + freecad_module_name + ', skipping\n')
+                        Log('Init: No init module found in ' + freecad_module_name + ', it is imported when used\n')
                 except Exception as inst:
                     Err('During initialization the error "' + str(inst) + '" occurred in ' + freecad_module_name + '\n')
                     Err('-'*80+'\n')
@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#endif
+
+#include "StartupProfiler.h"
+#include "Console.h"
+#include "FileInfo.h"
+#include "Stream.h"
+
+
+using namespace Base;
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct ProfilerData
+{
+    Clock::time_point origin {Clock::now()};
+    std::vector<StartupProfiler::Event> events;
+    std::vector<std::size_t> open;
+    std::string outputFile;
+    bool finished {false};
+
+    double now() const
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - origin).count();
+    }
+};
+
+ProfilerData& data()
+{
+    static ProfilerData profiler;
+    return profiler;
+}
+
+std::string escapeJson(const std::string& str)
+{
+    std::string result;
+    result.reserve(str.size());
+    for (char ch : str) {
+        switch (ch) {
+            case '"':
+                result += "\\\"";
+                break;
+            case '\\':
+                result += "\\\\";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            case '\t':
+                result += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(ch) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", ch);
+                    result += buf;
+                }
+                else {
+                    result += ch;
+                }
+                break;
+        }
+    }
+    return result;
+}
+}  // namespace
+
+void StartupProfiler::begin(const char* name, const char* category)
+{
+    ProfilerData& profiler = data();
+    if (profiler.finished) {
+        return;
+    }
+
+    Event event;
+    event.name = name;
+    event.category = category;
+    event.start = profiler.now();
+    event.depth = static_cast<int>(profiler.open.size());
+    profiler.open.push_back(profiler.events.size());
+    profiler.events.push_back(event);
+}
+
+void StartupProfiler::end()
+{
+    ProfilerData& profiler = data();
+    if (profiler.finished || profiler.open.empty()) {
+        return;
+    }
+
+    Event& event = profiler.events[profiler.open.back()];
+    event.duration = profiler.now() - event.start;
+    profiler.open.pop_back();
+}
+
+void StartupProfiler::finish()
+{
+    ProfilerData& profiler = data();
+    if (profiler.finished) {
+        return;
+    }
+
+    while (!profiler.open.empty()) {
+        end();
+    }
+
+    Event total;
+    total.name = "Startup";
+    total.category = "total";
+    total.duration = profiler.now();
+    total.depth = -1;
+    profiler.events.insert(profiler.events.begin(), total);
+    profiler.finished = true;
+
+    logSummary();
+    if (!profiler.outputFile.empty()) {
+        writeTrace(profiler.outputFile);
+    }
+}
+
+bool StartupProfiler::isFinished()
+{
+    return data().finished;
+}
+
+void StartupProfiler::setOutputFile(const std::string& fileName)
+{
+    data().outputFile = fileName;
+}
+
+const std::vector<StartupProfiler::Event>& StartupProfiler::getEvents()
+{
+    return data().events;
+}
+
+void StartupProfiler::logSummary()
+{
+    const std::vector<Event>& events = data().events;
+    Console().Log("Startup: %.1f ms\n", events.front().duration);
+
+    // The top-level phases in their order
+    for (const auto& event : events) {
+        if (event.depth == 0) {
+            Console().Log("Startup:   %-30s %8.1f ms\n", event.name.c_str(), event.duration);
+        }
+    }
+
+    // The slowest modules
+    std::vector<const Event*> modules;
+    for (const auto& event : events) {
+        if (event.category == "module") {
+            modules.push_back(&event);
+        }
+    }
+    std::sort(modules.begin(), modules.end(), [](const Event* ev1, const Event* ev2) {
+        return ev1->duration > ev2->duration;
+    });
+    const std::size_t maxModules = 10;
+    for (std::size_t i = 0; i < std::min(modules.size(), maxModules); i++) {
+        Console().Log("Startup:   module %-23s %8.1f ms\n",
+                      modules[i]->name.c_str(),
+                      modules[i]->duration);
+    }
+}
+
+void StartupProfiler::writeTrace(const std::string& fileName)
+{
+    Base::FileInfo fi(fileName);
+    Base::ofstream str(fi, std::ios::out | std::ios::binary);
+    if (!str) {
+        Console().Warning("Cannot write start-up trace to '%s'\n", fileName.c_str());
+        return;
+    }
+
+    // Complete events ("X") with time stamps in microseconds
+    str << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (const auto& event : data().events) {
+        if (!first) {
+            str << ",\n";
+        }
+        first = false;
+        str << "{\"name\":\"" << escapeJson(event.name) << "\",\"cat\":\""
+            << escapeJson(event.category) << "\",\"ph\":\"X\",\"ts\":"
+            << static_cast<long long>(event.start * 1000.0)
+            << ",\"dur\":" << static_cast<long long>(event.duration * 1000.0)
+            << ",\"pid\":1,\"tid\":1}";
+    }
+    str << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    Console().Log("Start-up trace written to '%s'\n", fileName.c_str());
+}
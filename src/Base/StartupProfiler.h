@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef BASE_STARTUPPROFILER_H
+#define BASE_STARTUPPROFILER_H
+
+#include <string>
+#include <vector>
+#include <FCGlobal.h>
+
+namespace Base
+{
+
+/**
+ * The StartupProfiler records the phases of the application start-up as a timeline.
+ * Phases are nested by calling begin() and end() in pairs, the init scripts record an
+ * entry for each module and modules loaded through a type lookup are recorded, too.
+ *
+ * finish() marks the end of the start-up: it stops the recording, writes a summary to
+ * the log and, if an output file is set, writes the timeline in the trace event format
+ * that can be opened with chrome://tracing or https://ui.perfetto.dev.
+ * @note The profiler must only be used from the main thread.
+ */
+class BaseExport StartupProfiler
+{
+public:
+    struct Event
+    {
+        std::string name;
+        std::string category;
+        double start {0.0};     // milliseconds since the profiler was loaded
+        double duration {0.0};  // milliseconds
+        int depth {0};
+    };
+
+    /// Scoped phase
+    class Phase
+    {
+    public:
+        explicit Phase(const char* name, const char* category = "phase")
+        {
+            StartupProfiler::begin(name, category);
+        }
+        ~Phase()
+        {
+            StartupProfiler::end();
+        }
+        Phase(const Phase&) = delete;
+        Phase& operator=(const Phase&) = delete;
+    };
+
+    static void begin(const char* name, const char* category = "phase");
+    static void end();
+    /// Ends all open phases and reports the timeline
+    static void finish();
+    static bool isFinished();
+
+    /// Sets the file the timeline is written to by finish()
+    static void setOutputFile(const std::string& fileName);
+    static const std::vector<Event>& getEvents();
+
+private:
+    static void writeTrace(const std::string& fileName);
+    static void logSummary();
+};
+
+}  // namespace Base
+
+#endif  // BASE_STARTUPPROFILER_H
@@ -31,6 +31,7 @@
 #include "Exception.h"
 #include "Interpreter.h"
 #include "Console.h"
+#include "StartupProfiler.h"
 
 
 using namespace Base;
@@ -96,6 +97,7 @@ void Type::importModule(const char* TypeName)
         // remember already loaded modules
         set<string>::const_iterator pos = loadModuleSet.find(Mod);
         if (pos == loadModuleSet.end()) {
+            StartupProfiler::Phase phase(Mod.c_str(), "module");
             Interpreter().loadModule(Mod.c_str());
 #ifdef FC_LOGLOADMODULE
             Console().Log("Act: Module %s loaded through class %s \n", Mod.c_str(), TypeName);
@@ -0,0 +1,274 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# (c) 2024 The FreeCAD Project Association AISBL
+
+__title__ = "Batch worker module"
+__url__ = "https://www.freecad.org"
+__doc__ = """Persistent worker that runs batch jobs in one FreeCAD process
+
+Started with 'FreeCADCmd --worker' the worker reads jobs from stdin and writes
+the replies to stdout. With 'FreeCADCmd --worker <path>' it listens on a local
+(Unix domain) socket, with 'FreeCADCmd --worker <host>:<port>' on a TCP socket.
+The jobs are not authenticated, so the TCP socket only accepts loopback
+addresses and the local socket is only accessible by the user.
+
+The protocol is line based, every request and every reply is a JSON object on
+a single line:
+
+  {"id": 1, "script": "import Part\\nresult = Part.__file__", "args": {}}
+  {"id": 2, "file": "/path/to/job.py", "args": {"input": "a.step"}}
+  {"id": 3, "command": "ping" | "status" | "shutdown"}
+
+A job runs in its own namespace where 'args' holds the given arguments and
+where the job can store a JSON serializable 'result'. Documents opened by a
+job are closed when it is done, while imported modules and caches like the
+material libraries are kept for the next jobs. The reply contains 'ok',
+'result', the captured 'output', 'error' and 'traceback' on failure, the wall
+and CPU 'time' in seconds and the 'peak_memory' in bytes.
+"""
+
+
+import contextlib
+import gc
+import io
+import ipaddress
+import json
+import os
+import socket
+import stat
+import sys
+import time
+import traceback
+
+import FreeCAD
+
+
+class _Memory:
+    """ Peak memory usage of the process """
+    def __init__(self):
+        # Since Linux 4.0 the peak resident set size can be reset, so that the
+        # peak of each single job can be measured
+        self.resettable = self.reset()
+
+    @staticmethod
+    def reset():
+        try:
+            with open("/proc/self/clear_refs", "w") as f:
+                f.write("5")
+            return True
+        except OSError:
+            return False
+
+    @staticmethod
+    def peak():
+        try:
+            with open("/proc/self/status") as f:
+                for line in f:
+                    if line.startswith("VmHWM:"):
+                        return int(line.split()[1]) * 1024
+        except OSError:
+            pass
+        try:
+            import resource
+            usage = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+            return usage if sys.platform == "darwin" else usage * 1024
+        except ImportError:
+            return None
+
+
+class Worker:
+    """ Runs the jobs and keeps track of the statistics """
+    def __init__(self):
+        self.started = time.time()
+        self.jobs = 0
+        self.failed = 0
+        self.running = True
+        self.memory = _Memory()
+
+    def handle(self, request):
+        """ Handle a single request and return the reply """
+        if not isinstance(request, dict):
+            return {"ok": False, "error": "Request must be a JSON object"}
+        reply = {"id": request.get("id")}
+        command = request.get("command")
+        if command is not None:
+            reply.update(self.command(command))
+        elif "script" in request or "file" in request:
+            reply.update(self.run(request))
+        else:
+            reply.update({"ok": False, "error": "Request needs 'script', 'file' or 'command'"})
+        return reply
+
+    def command(self, command):
+        if command == "ping":
+            return {"ok": True}
+        if command == "status":
+            return {"ok": True,
+                    "result": {"pid": os.getpid(),
+                               "uptime": time.time() - self.started,
+                               "jobs": self.jobs,
+                               "failed": self.failed,
+                               "modules": len(sys.modules),
+                               "peak_memory": self.memory.peak()}}
+        if command == "shutdown":
+            self.running = False
+            return {"ok": True}
+        return {"ok": False, "error": "Unknown command '{}'".format(command)}
+
+    def run(self, request):
+        """ Run a job and clean up the documents it has opened """
+        filename = request.get("file", "<job>")
+        namespace = {"__name__": "__job__", "__file__": filename,
+                     "args": request.get("args", {}), "result": None}
+        documents = set(FreeCAD.listDocuments())
+        active = FreeCAD.ActiveDocument
+        cwd = os.getcwd()
+        argv = sys.argv
+
+        reply = {"ok": True}
+        output = io.StringIO()
+        self.jobs += 1
+        if self.memory.resettable:
+            self.memory.reset()
+        wall = time.perf_counter()
+        cpu = time.process_time()
+        try:
+            if "file" in request:
+                with open(filename, encoding="utf-8") as f:
+                    source = f.read()
+            else:
+                source = request["script"]
+            sys.argv = [filename]
+            with contextlib.redirect_stdout(output):
+                exec(compile(source, filename, "exec"), namespace)
+        except SystemExit as e:
+            if e.code not in (None, 0):
+                reply = {"ok": False, "error": "Job exited with {}".format(e.code)}
+        except Exception as e:
+            reply = {"ok": False, "error": str(e), "traceback": traceback.format_exc()}
+        finally:
+            sys.argv = argv
+            os.chdir(cwd)
+            for name in set(FreeCAD.listDocuments()) - documents:
+                FreeCAD.closeDocument(name)
+            if active and active.Name in FreeCAD.listDocuments():
+                FreeCAD.setActiveDocument(active.Name)
+            gc.collect()
+
+        reply["time"] = time.perf_counter() - wall
+        reply["cpu_time"] = time.process_time() - cpu
+        reply["peak_memory"] = self.memory.peak()
+        reply["peak_memory_scope"] = "job" if self.memory.resettable else "process"
+        reply["output"] = output.getvalue()
+        if not reply["ok"]:
+            self.failed += 1
+        else:
+            try:
+                json.dumps(namespace["result"])
+                reply["result"] = namespace["result"]
+            except (TypeError, ValueError):
+                reply["result"] = repr(namespace["result"])
+        return reply
+
+    def serve(self, lines, write):
+        """ Handle the requests read from 'lines' until the stream ends or on shutdown """
+        for line in lines:
+            line = line.strip()
+            if not line:
+                continue
+            try:
+                request = json.loads(line)
+            except ValueError as e:
+                reply = {"id": None, "ok": False, "error": "Invalid request: {}".format(e)}
+            else:
+                reply = self.handle(request)
+            write(json.dumps(reply) + "\n")
+            if not self.running:
+                break
+
+
+def _serveStdio(worker):
+    # Keep the protocol stream for the replies and send everything else that is
+    # written to stdout, also by the C++ side, to stderr
+    sys.stdout.flush()
+    protocol = os.fdopen(os.dup(1), "w", encoding="utf-8")
+    os.dup2(2, 1)
+
+    def write(text):
+        protocol.write(text)
+        protocol.flush()
+
+    FreeCAD.Console.PrintLog("Worker: serving on stdin\n")
+    worker.serve(sys.stdin, write)
+
+
+def _loopbackAddress(host, port):
+    # Everybody who can connect can run arbitrary code, so the worker must not be
+    # reachable from other machines
+    infos = socket.getaddrinfo(host.strip("[]"), port, type=socket.SOCK_STREAM)
+    for _, _, _, _, sockaddr in infos:
+        if not ipaddress.ip_address(sockaddr[0].partition("%")[0]).is_loopback:
+            raise ValueError("Worker: '{}' is not a loopback address".format(host))
+    family, _, _, _, sockaddr = infos[0]
+    return family, sockaddr
+
+
+def _removeSocket(address):
+    # Only a stale socket is removed, never another file at that path
+    try:
+        mode = os.lstat(address).st_mode
+    except FileNotFoundError:
+        return
+    if not stat.S_ISSOCK(mode):
+        raise FileExistsError("Worker: '{}' exists and is not a socket".format(address))
+    os.remove(address)
+
+
+def _serveSocket(worker, address):
+    host, _, port = address.rpartition(":")
+    if host and port.isdigit():
+        family, sockaddr = _loopbackAddress(host, int(port))
+        server = socket.create_server(sockaddr, family=family)
+        remove = None
+    else:
+        _removeSocket(address)
+        server = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        umask = os.umask(0o177)
+        try:
+            server.bind(address)
+        finally:
+            os.umask(umask)
+        server.listen()
+        remove = address
+
+    FreeCAD.Console.PrintLog("Worker: serving on {}\n".format(address))
+    try:
+        # The application is not thread-safe, so the clients are served one after the other
+        while worker.running:
+            connection, _ = server.accept()
+            # A text stream for reading and writing drops the read ahead lines on every
+            # write, so separate streams are used for the requests and the replies
+            with connection, connection.makefile("r", encoding="utf-8") as requests,\
+                    connection.makefile("w", encoding="utf-8") as replies:
+                def write(text):
+                    replies.write(text)
+                    replies.flush()
+                try:
+                    worker.serve(requests, write)
+                except OSError as e:
+                    FreeCAD.Console.PrintWarning("Worker: connection lost: {}\n".format(e))
+    finally:
+        server.close()
+        if remove:
+            _removeSocket(remove)
+
+
+def run(address=None):
+    """ Serve jobs on the given address, stdin if '-' """
+    if address is None:
+        address = FreeCAD.ConfigGet("WorkerAddress") or "-"
+    worker = Worker()
+    if address == "-":
+        _serveStdio(worker)
+    else:
+        _serveSocket(worker, address)
+    FreeCAD.Console.PrintLog("Worker: {} jobs done, {} failed\n".format(worker.jobs, worker.failed))
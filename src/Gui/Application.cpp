@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <optional>
 # include <boost/interprocess/sync/file_lock.hpp>
 # include <Inventor/errors/SoDebugError.h>
 # include <Inventor/errors/SoError.h>
@@ -50,6 +51,7 @@
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Base/Parameter.h>
+#include <Base/StartupProfiler.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
 
@@ -2108,7 +2110,11 @@ void Application::runApplication()
     // A new QApplication
     Base::Console().Log("Init: Creating Gui::Application and QApplication\n");
 
+    // each phase ends when the next one is started or the function returns
+    std::optional<Base::StartupProfiler::Phase> phase;
+
     // if application not yet created by the splasher
+    phase.emplace("QApplication");
     int argc = App::Application::GetARGC();
     GUISingleApplication mainApp(argc, App::Application::GetARGV());
     // https://forum.freecad.org/viewtopic.php?f=3&t=15540
@@ -2127,19 +2133,24 @@ void Application::runApplication()
 
     setAppNameAndIcon();
 
+    phase.emplace("StartupProcess");
     StartupProcess process;
     process.execute();
 
+    phase.emplace("MainWindow");
     Application app(true);
     MainWindow mw;
     mw.setProperty("QuitOnClosed", true);
+    phase.reset();
 
 #ifdef FC_DEBUG // redirect Coin messages to FreeCAD
     SoDebugError::setHandlerCallback( messageHandlerCoin, 0 );
 #endif
 
+    phase.emplace("StartupPostProcess");
     StartupPostProcess postProcess(&mw, app, &mainApp);
     postProcess.execute();
+    phase.reset();
 
     Instance->d->startingUp = false;
 
@@ -2157,6 +2168,7 @@ void Application::runApplication()
     Instance->pNavlibInterface->enableNavigation();
 #endif
 
+    Base::StartupProfiler::finish();
     runEventLoop(mainApp);
 
     Base::Console().Log("Finish: Event loop left\n");
@@ -137,6 +137,7 @@ def InitApplications():
     def RunInitGuiPy(Dir) -> bool:
         InstallFile = os.path.join(Dir,"InitGui.py")
         if os.path.exists(InstallFile):
+            FreeCAD.beginStartupPhase(os.path.basename(Dir) + "Gui", "module")
             try:
                 with open(InstallFile, 'rt', encoding='utf-8') as f:
                     exec(compile(f.read(), InstallFile, 'exec'))
@@ -151,6 +152,8 @@ def InitApplications():
             else:
                 Log('Init:      Initializing ' + Dir + '... done\n')
                 return True
+            finally:
+                FreeCAD.endStartupPhase()
         else:
             Log('Init:      Initializing ' + Dir + '(InitGui.py not found)... ignore\n')
         return False
@@ -229,14 +232,17 @@ def InitApplications():
             if freecad_module_ispkg:
                 Log('Init: Initializing ' + freecad_module_name + '\n')
                 try:
-                    freecad_module = importlib.import_module(freecad_module_name)
                     if any (module_name == 'init_gui' for _, module_name,
-                            ispkg in pkgutil.iter_modules(freecad_module.__path__)):
-                        importlib.import_module(freecad_module_name + '.init_gui')
+                            ispkg in pkgutil.iter_modules(FreeCAD._packagePath(freecad_module_name))):
+                        FreeCAD.beginStartupPhase(freecad_module_name + '.init_gui', "module")
+                        try:
+                            importlib.import_module(freecad_module_name + '.init_gui')
+                        finally:
+                            FreeCAD.endStartupPhase()
                         Log('Init: Initializing ' + freecad_module_name + '... done\n')
                     else:
                         Log('Init: No init_gui module found in ' + freecad_module_name\
-                            + ', skipping\n')
+                            + ', it is imported when used\n')
                 except Exception as inst:
                     Err('During initialization the error "' + str(inst) + '" occurred in '\
                         + freecad_module_name + '\n')
@@ -69,6 +69,7 @@
 #include <bitset>
 #include <list>
 #include <map>
+#include <optional>
 #include <queue>
 #include <random>
 #include <set>
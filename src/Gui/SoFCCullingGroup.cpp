@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <unordered_map>
+# include <Inventor/actions/SoGetBoundingBoxAction.h>
+# include <Inventor/actions/SoGLRenderAction.h>
+# include <Inventor/elements/SoCacheElement.h>
+# include <Inventor/elements/SoCullElement.h>
+# include <Inventor/elements/SoViewportRegionElement.h>
+# include <Inventor/misc/SoChildList.h>
+# include <Inventor/misc/SoState.h>
+# include <Inventor/nodes/SoSeparator.h>
+#endif
+
+#include "SoFCCullingGroup.h"
+#include "ViewParams.h"
+
+
+using namespace Gui;
+
+namespace {
+// With fewer children the tests cost more than they save
+constexpr int MinCulledChildren = 8;
+constexpr uint32_t MaxLeafSize = 8;
+}
+
+SO_NODE_SOURCE(SoFCCullingGroup)
+
+SoFCCullingGroup::SoFCCullingGroup()
+{
+    SO_NODE_CONSTRUCTOR(SoFCCullingGroup);
+}
+
+SoFCCullingGroup::~SoFCCullingGroup() = default;
+
+void SoFCCullingGroup::initClass()
+{
+    SO_NODE_INIT_CLASS(SoFCCullingGroup, SoGroup, "Group");
+}
+
+void SoFCCullingGroup::finish()
+{
+    atexit_cleanup();
+}
+
+void SoFCCullingGroup::GLRender(SoGLRenderAction* action)
+{
+    int numIndices = 0;
+    const int* pathIndices = nullptr;
+    SoAction::PathCode pathCode = action->getPathCode(numIndices, pathIndices);
+    SoState* state = action->getState();
+
+    // A render cache that is being built must contain all children, like SoSeparator
+    // doesn't cull while caching either
+    if ((pathCode != SoAction::NO_PATH && pathCode != SoAction::BELOW_PATH)
+        || getNumChildren() < MinCulledChildren || !ViewParams::instance()->getFrustumCulling()
+        || SoCacheElement::anyOpen(state)) {
+        inherited::GLRender(action);
+        return;
+    }
+
+    updateBounds(action);
+
+    std::vector<int> visible = always;
+    if (!nodes.empty()) {
+        collect(state, 0, visible);
+    }
+    std::sort(visible.begin(), visible.end());
+
+    // culled children are separators and don't change the state of the following ones,
+    // so rendering the visible ones in order gives the same result
+    for (int index : visible) {
+        this->children->traverse(action, index);
+        if (action->hasTerminated()) {
+            break;
+        }
+    }
+}
+
+void SoFCCullingGroup::updateBounds(SoGLRenderAction* action)
+{
+    int numChildren = getNumChildren();
+    bool changed = static_cast<int>(boxes.size()) != numChildren;
+    boxes.resize(numChildren);
+
+    // node ids change whenever a node or anything below it is modified, so the boxes of
+    // unmodified children are taken from the cache even if they have moved in the list
+    std::unordered_map<uint32_t, SbBox3f> cache;
+    cache.swap(boxCache);
+    SoGetBoundingBoxAction bboxAction(SoViewportRegionElement::get(action->getState()));
+    for (int i = 0; i < numChildren; i++) {
+        SoNode* child = getChild(i);
+        uint32_t id = child->getNodeId();
+        auto it = cache.find(id);
+        if (it != cache.end()) {
+            changed = changed || !(boxes[i] == it->second);
+            boxes[i] = it->second;
+        }
+        else {
+            changed = true;
+            if (child->isOfType(SoSeparator::getClassTypeId())) {
+                bboxAction.apply(child);
+                boxes[i] = bboxAction.getBoundingBox();
+            }
+            else {
+                boxes[i].makeEmpty();
+            }
+        }
+        boxCache[id] = boxes[i];
+    }
+
+    if (!changed) {
+        return;
+    }
+
+    always.clear();
+    indices.clear();
+    for (int i = 0; i < numChildren; i++) {
+        if (boxes[i].isEmpty()) {
+            always.push_back(i);
+        }
+        else {
+            indices.push_back(i);
+        }
+    }
+
+    nodes.clear();
+    if (!indices.empty()) {
+        nodes.reserve(2 * indices.size() / MaxLeafSize + 1);
+        build(0, static_cast<uint32_t>(indices.size()));
+    }
+}
+
+uint32_t SoFCCullingGroup::build(uint32_t first, uint32_t count)
+{
+    auto index = static_cast<uint32_t>(nodes.size());
+    nodes.emplace_back();
+    SbBox3f box;
+    for (uint32_t i = first; i < first + count; i++) {
+        box.extendBy(boxes[indices[i]]);
+    }
+    nodes[index].box = box;
+
+    if (count <= MaxLeafSize) {
+        nodes[index].first = first;
+        nodes[index].count = count;
+        return index;
+    }
+
+    // split at the median of the box centers along the longest axis
+    float dx {}, dy {}, dz {};
+    box.getSize(dx, dy, dz);
+    int axis = dx >= dy && dx >= dz ? 0 : (dy >= dz ? 1 : 2);
+    auto begin = indices.begin() + first;
+    auto middle = begin + count / 2;
+    std::nth_element(begin, middle, begin + count, [this, axis](int a, int b) {
+        return boxes[a].getCenter()[axis] < boxes[b].getCenter()[axis];
+    });
+
+    build(first, count / 2);
+    nodes[index].first = build(first + count / 2, count - count / 2);
+    return index;
+}
+
+void SoFCCullingGroup::collect(SoState* state, uint32_t node, std::vector<int>& visible) const
+{
+    // the left child of an inner node directly follows it
+    while (true) {
+        const Node& current = nodes[node];
+        if (SoCullElement::cullTest(state, current.box, TRUE)) {
+            return;
+        }
+        if (current.count > 0) {
+            for (uint32_t i = current.first; i < current.first + current.count; i++) {
+                if (current.count == 1 || !SoCullElement::cullTest(state, boxes[indices[i]], TRUE)) {
+                    visible.push_back(indices[i]);
+                }
+            }
+            return;
+        }
+        collect(state, node + 1, visible);
+        node = current.first;
+    }
+}
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef GUI_SOFCCULLINGGROUP_H
+#define GUI_SOFCCULLINGGROUP_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <Inventor/SbBox3f.h>
+#include <Inventor/nodes/SoGroup.h>
+#include <FCGlobal.h>
+
+
+namespace Gui {
+
+/**
+ * A group node that skips children outside of the view volume when rendering.
+ * The bounding boxes of the children are cached by their node id and kept in a bounding
+ * volume hierarchy, so that whole clusters of objects are rejected by a single test.
+ * Only children that are separators are culled, all others are always rendered.
+ */
+class GuiExport SoFCCullingGroup : public SoGroup {
+    using inherited = SoGroup;
+
+    SO_NODE_HEADER(Gui::SoFCCullingGroup);
+
+public:
+    static void initClass();
+    static void finish();
+    SoFCCullingGroup();
+
+    void GLRender(SoGLRenderAction* action) override;
+
+protected:
+    ~SoFCCullingGroup() override;
+
+private:
+    struct Node
+    {
+        SbBox3f box;
+        uint32_t first {0};  // first index into 'indices' or index of the right child
+        uint32_t count {0};  // number of children, 0 for inner nodes
+    };
+
+    void updateBounds(SoGLRenderAction* action);
+    uint32_t build(uint32_t first, uint32_t count);
+    void collect(SoState* state, uint32_t node, std::vector<int>& visible) const;
+
+private:
+    std::unordered_map<uint32_t, SbBox3f> boxCache;
+    std::vector<SbBox3f> boxes;
+    std::vector<Node> nodes;
+    std::vector<int> indices;
+    std::vector<int> always;
+};
+
+} // namespace Gui
+
+#endif // GUI_SOFCCULLINGGROUP_H
@@ -60,8 +60,10 @@
 #include "SoFCColorBar.h"
 #include "SoFCColorGradient.h"
 #include "SoFCColorLegend.h"
+#include "SoFCCullingGroup.h"
 #include "SoFCCSysDragger.h"
 #include "SoFCInteractiveElement.h"
+#include "SoFCLevelOfDetail.h"
 #include "SoFCSelection.h"
 #include "SoFCSelectionAction.h"
 #include "SoFCUnifiedSelection.h"
@@ -141,6 +143,8 @@ void Gui::SoFCDB::init()
     SoFCSeparator                   ::initClass();
     SoFCSelectionRoot               ::initClass();
     SoFCPathAnnotation              ::initClass();
+    SoFCLevelOfDetail               ::initClass();
+    SoFCCullingGroup                ::initClass();
     SoMouseWheelEvent               ::initClass();
     So3DAnnotation                  ::initClass();
 
@@ -233,6 +237,8 @@ void Gui::SoFCDB::finish()
     SoFCSeparator                   ::finish();
     SoFCSelectionRoot               ::finish();
     SoFCPathAnnotation              ::finish();
+    SoFCLevelOfDetail               ::finish();
+    SoFCCullingGroup                ::finish();
 
     storage->unref();
     storage = nullptr;
@@ -0,0 +1,390 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <cmath>
+# include <memory>
+# include <unordered_map>
+# include <QtConcurrentRun>
+# include <Inventor/actions/SoGLRenderAction.h>
+# include <Inventor/elements/SoCacheElement.h>
+# include <Inventor/misc/SoChildList.h>
+# include <Inventor/misc/SoState.h>
+# include <Inventor/nodes/SoCoordinate3.h>
+# include <Inventor/nodes/SoIndexedFaceSet.h>
+# include <Inventor/nodes/SoNormal.h>
+# include <Inventor/nodes/SoNormalBinding.h>
+# include <Inventor/nodes/SoSeparator.h>
+# include <Inventor/nodes/SoShape.h>
+#endif
+
+#include "SoFCLevelOfDetail.h"
+#include "SoFCInteractiveElement.h"
+#include "ViewParams.h"
+
+
+using namespace Gui;
+
+namespace {
+// Number of grid cells along the longest side of a mesh for the coarse version. The coarse
+// version is only shown below LevelOfDetailSize pixels, so a cell covers a few pixels.
+constexpr int DecimationCells = 24;
+}
+
+SO_NODE_SOURCE(SoFCLevelOfDetail)
+
+SoFCLevelOfDetail::SoFCLevelOfDetail()
+{
+    SO_NODE_CONSTRUCTOR(SoFCLevelOfDetail);
+    SO_NODE_ADD_FIELD(boundingBox, (SbBox3f()));
+}
+
+SoFCLevelOfDetail::~SoFCLevelOfDetail() = default;
+
+void SoFCLevelOfDetail::initClass()
+{
+    SO_NODE_INIT_CLASS(SoFCLevelOfDetail, SoGroup, "Group");
+}
+
+void SoFCLevelOfDetail::finish()
+{
+    atexit_cleanup();
+}
+
+void SoFCLevelOfDetail::doAction(SoAction* action)
+{
+    int numIndices = 0;
+    const int* indices = nullptr;
+    SoAction::PathCode pathCode = action->getPathCode(numIndices, indices);
+    if (pathCode == SoAction::IN_PATH || pathCode == SoAction::OFF_PATH) {
+        inherited::doAction(action);
+    }
+    else if (getNumChildren() > 0) {
+        this->children->traverse(action, 0);
+    }
+}
+
+void SoFCLevelOfDetail::callback(SoCallbackAction* action)
+{
+    SoFCLevelOfDetail::doAction(action);
+}
+
+void SoFCLevelOfDetail::GLRender(SoGLRenderAction* action)
+{
+    int numIndices = 0;
+    const int* indices = nullptr;
+    SoAction::PathCode pathCode = action->getPathCode(numIndices, indices);
+    if (pathCode == SoAction::IN_PATH || pathCode == SoAction::OFF_PATH || getNumChildren() < 2) {
+        inherited::GLRender(action);
+        return;
+    }
+
+    int child = 0;
+    SoState* state = action->getState();
+    int limit = ViewParams::instance()->getLevelOfDetailSize();
+    const SbBox3f& box = boundingBox.getValue();
+    if (limit > 0 && !box.isEmpty() && SoFCInteractiveElement::get(state)) {
+        // the choice depends on the camera and must not end up in a render cache
+        SoCacheElement::invalidate(state);
+        SbVec2s size;
+        SoShape::getScreenSize(state, box, size);
+        if (std::max(size[0], size[1]) < limit) {
+            child = 1;
+        }
+    }
+    this->children->traverse(action, child);
+}
+
+void SoFCLevelOfDetail::getBoundingBox(SoGetBoundingBoxAction* action)
+{
+    SoFCLevelOfDetail::doAction(action);
+}
+
+void SoFCLevelOfDetail::getMatrix(SoGetMatrixAction* action)
+{
+    SoFCLevelOfDetail::doAction(action);
+}
+
+void SoFCLevelOfDetail::handleEvent(SoHandleEventAction* action)
+{
+    SoFCLevelOfDetail::doAction(action);
+}
+
+void SoFCLevelOfDetail::pick(SoPickAction* action)
+{
+    SoFCLevelOfDetail::doAction(action);
+}
+
+void SoFCLevelOfDetail::rayPick(SoRayPickAction* action)
+{
+    SoFCLevelOfDetail::doAction(action);
+}
+
+void SoFCLevelOfDetail::getPrimitiveCount(SoGetPrimitiveCountAction* action)
+{
+    SoFCLevelOfDetail::doAction(action);
+}
+
+// ---------------------------------------------------------------------------------
+
+namespace {
+struct ClusterKey
+{
+    int32_t part;
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    bool operator==(const ClusterKey& other) const
+    {
+        return part == other.part && x == other.x && y == other.y && z == other.z;
+    }
+};
+
+struct ClusterKeyHash
+{
+    std::size_t operator()(const ClusterKey& key) const
+    {
+        std::size_t hash = static_cast<uint32_t>(key.part);
+        hash = hash * 73856093U ^ static_cast<uint32_t>(key.x);
+        hash = hash * 19349663U ^ static_cast<uint32_t>(key.y);
+        hash = hash * 83492791U ^ static_cast<uint32_t>(key.z);
+        return hash;
+    }
+};
+}
+
+LevelOfDetailMesh LevelOfDetailMesh::decimate(const std::vector<SbVec3f>& points,
+                                              const std::vector<int32_t>& coordIndex,
+                                              const std::vector<int32_t>& partIndex,
+                                              int cells)
+{
+    LevelOfDetailMesh mesh;
+    auto numPoints = static_cast<int32_t>(points.size());
+    for (int32_t index : coordIndex) {
+        if (index >= 0 && index < numPoints) {
+            mesh.boundingBox.extendBy(points[index]);
+        }
+    }
+    if (mesh.boundingBox.isEmpty()) {
+        return mesh;
+    }
+
+    float dx {}, dy {}, dz {};
+    mesh.boundingBox.getSize(dx, dy, dz);
+    float length = std::max({dx, dy, dz});
+    float cellSize = length > 0.0F ? length / float(std::max(cells, 1)) : 1.0F;
+    const SbVec3f& origin = mesh.boundingBox.getMin();
+
+    std::unordered_map<ClusterKey, int32_t, ClusterKeyHash> clusters;
+    std::vector<int> counts;
+    auto clusterOf = [&](int32_t part, int32_t index) {
+        SbVec3f offset = points[index] - origin;
+        ClusterKey key {part,
+                        static_cast<int32_t>(std::floor(offset[0] / cellSize)),
+                        static_cast<int32_t>(std::floor(offset[1] / cellSize)),
+                        static_cast<int32_t>(std::floor(offset[2] / cellSize))};
+        auto it = clusters.emplace(key, static_cast<int32_t>(mesh.points.size()));
+        if (it.second) {
+            mesh.points.emplace_back(0.0F, 0.0F, 0.0F);
+            counts.push_back(0);
+        }
+        int32_t cluster = it.first->second;
+        mesh.points[cluster] += points[index];
+        counts[cluster]++;
+        return cluster;
+    };
+
+    // first pass: assign the corners of all faces to clusters, a face is kept as a fan of
+    // triangles
+    std::vector<int32_t> triangles;
+    std::vector<int32_t> trianglesPerPart(partIndex.size(), 0);
+    std::vector<int32_t> face;
+    std::size_t part = 0;
+    int32_t facesInPart = 0;
+    auto nextPart = [&]() {
+        while (part < partIndex.size() && facesInPart >= partIndex[part]) {
+            part++;
+            facesInPart = 0;
+        }
+    };
+    nextPart();
+
+    for (std::size_t i = 0; i <= coordIndex.size(); i++) {
+        if (i < coordIndex.size() && coordIndex[i] >= 0) {
+            if (coordIndex[i] < numPoints) {
+                face.push_back(coordIndex[i]);
+            }
+            continue;
+        }
+        if (face.empty()) {
+            continue;
+        }
+        auto key = static_cast<int32_t>(part);
+        for (std::size_t j = 2; j < face.size(); j++) {
+            int32_t c0 = clusterOf(key, face[0]);
+            int32_t c1 = clusterOf(key, face[j - 1]);
+            int32_t c2 = clusterOf(key, face[j]);
+            if (c0 == c1 || c1 == c2 || c2 == c0) {
+                continue;
+            }
+            triangles.push_back(c0);
+            triangles.push_back(c1);
+            triangles.push_back(c2);
+            if (part < partIndex.size()) {
+                trianglesPerPart[part]++;
+            }
+        }
+        face.clear();
+        if (!partIndex.empty()) {
+            facesInPart++;
+            nextPart();
+        }
+    }
+
+    for (std::size_t i = 0; i < mesh.points.size(); i++) {
+        mesh.points[i] /= float(counts[i]);
+    }
+
+    // second pass: area weighted vertex normals of the coarse triangles
+    mesh.normals.resize(mesh.points.size(), SbVec3f(0.0F, 0.0F, 0.0F));
+    mesh.coordIndex.reserve(triangles.size() / 3 * 4);
+    for (std::size_t i = 0; i < triangles.size(); i += 3) {
+        const SbVec3f& p0 = mesh.points[triangles[i]];
+        const SbVec3f& p1 = mesh.points[triangles[i + 1]];
+        const SbVec3f& p2 = mesh.points[triangles[i + 2]];
+        SbVec3f normal = (p1 - p0).cross(p2 - p0);
+        for (std::size_t j = 0; j < 3; j++) {
+            mesh.normals[triangles[i + j]] += normal;
+            mesh.coordIndex.push_back(triangles[i + j]);
+        }
+        mesh.coordIndex.push_back(-1);
+    }
+    for (auto& normal : mesh.normals) {
+        if (normal.normalize() == 0.0F) {
+            normal.setValue(0.0F, 0.0F, 1.0F);
+        }
+    }
+
+    mesh.partIndex = std::move(trianglesPerPart);
+    return mesh;
+}
+
+// ---------------------------------------------------------------------------------
+
+LevelOfDetailBuilder::LevelOfDetailBuilder(SoIndexedFaceSet* faces, SoMFInt32* partIndex)
+    : root(new SoSeparator)
+    , coords(new SoCoordinate3)
+    , normals(new SoNormal)
+    , faces(faces)
+    , partIndex(partIndex)
+    , empty(new SoGroup)
+{
+    root->ref();
+    empty->ref();
+    faces->ref();
+
+    auto binding = new SoNormalBinding;
+    binding->value = SoNormalBinding::PER_VERTEX_INDEXED;
+    root->addChild(coords);
+    root->addChild(normals);
+    root->addChild(binding);
+    root->addChild(faces);
+
+    QObject::connect(&watcher, &QFutureWatcherBase::finished, &watcher, [this]() {
+        QFuture<LevelOfDetailMesh> future = watcher.future();
+        if (future.resultCount() > 0) {
+            apply(future.result());
+        }
+    });
+}
+
+LevelOfDetailBuilder::~LevelOfDetailBuilder()
+{
+    for (auto node : nodes) {
+        node->unref();
+    }
+    root->unref();
+    empty->unref();
+    faces->unref();
+}
+
+SoFCLevelOfDetail* LevelOfDetailBuilder::createNode(SoNode* node, bool coarse)
+{
+    auto lod = new SoFCLevelOfDetail;
+    lod->ref();
+    lod->addChild(node);
+    lod->addChild(coarse ? static_cast<SoNode*>(root) : static_cast<SoNode*>(empty));
+    nodes.push_back(lod);
+    return lod;
+}
+
+void LevelOfDetailBuilder::update(std::vector<SbVec3f> points,
+                                  std::vector<int32_t> coordIndex,
+                                  std::vector<int32_t> partIndex)
+{
+    if (ViewParams::instance()->getLevelOfDetailSize() <= 0) {
+        clear();
+        return;
+    }
+
+    struct Input
+    {
+        std::vector<SbVec3f> points;
+        std::vector<int32_t> coordIndex;
+        std::vector<int32_t> partIndex;
+    };
+    auto input = std::make_shared<Input>();
+    input->points = std::move(points);
+    input->coordIndex = std::move(coordIndex);
+    input->partIndex = std::move(partIndex);
+    watcher.setFuture(QtConcurrent::run([input]() {
+        return LevelOfDetailMesh::decimate(input->points, input->coordIndex, input->partIndex,
+                                           DecimationCells);
+    }));
+}
+
+void LevelOfDetailBuilder::clear()
+{
+    watcher.setFuture(QFuture<LevelOfDetailMesh>());
+    apply(LevelOfDetailMesh());
+}
+
+void LevelOfDetailBuilder::apply(const LevelOfDetailMesh& mesh)
+{
+    coords->point.setNum(static_cast<int>(mesh.points.size()));
+    coords->point.setValues(0, static_cast<int>(mesh.points.size()), mesh.points.data());
+    normals->vector.setNum(static_cast<int>(mesh.normals.size()));
+    normals->vector.setValues(0, static_cast<int>(mesh.normals.size()), mesh.normals.data());
+    faces->coordIndex.setNum(static_cast<int>(mesh.coordIndex.size()));
+    faces->coordIndex.setValues(0, static_cast<int>(mesh.coordIndex.size()), mesh.coordIndex.data());
+    if (partIndex) {
+        partIndex->setNum(static_cast<int>(mesh.partIndex.size()));
+        partIndex->setValues(0, static_cast<int>(mesh.partIndex.size()), mesh.partIndex.data());
+    }
+    for (auto node : nodes) {
+        node->boundingBox.setValue(mesh.boundingBox);
+    }
+}
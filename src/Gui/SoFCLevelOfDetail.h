@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef GUI_SOFCLEVELOFDETAIL_H
+#define GUI_SOFCLEVELOFDETAIL_H
+
+#include <cstdint>
+#include <vector>
+
+#include <QFutureWatcher>
+#include <Inventor/SbBox3f.h>
+#include <Inventor/SbVec3f.h>
+#include <Inventor/fields/SoSFBox3f.h>
+#include <Inventor/nodes/SoGroup.h>
+#include <FCGlobal.h>
+
+class SoCoordinate3;
+class SoIndexedFaceSet;
+class SoMFInt32;
+class SoNormal;
+class SoSeparator;
+
+namespace Gui {
+
+/**
+ * A group node that renders its first child at full detail and, while the user navigates
+ * the 3D view, its second child once the projected size of \a boundingBox is smaller than
+ * the LevelOfDetailSize view parameter in pixels. All other actions only see the first
+ * child, so picking, selection and bounding boxes always work on the full detail.
+ */
+class GuiExport SoFCLevelOfDetail : public SoGroup {
+    using inherited = SoGroup;
+
+    SO_NODE_HEADER(Gui::SoFCLevelOfDetail);
+
+public:
+    static void initClass();
+    static void finish();
+    SoFCLevelOfDetail();
+
+    /// bounding box of the full detail, nothing is switched as long as it is empty
+    SoSFBox3f boundingBox;
+
+    void doAction(SoAction* action) override;
+    void callback(SoCallbackAction* action) override;
+    void GLRender(SoGLRenderAction* action) override;
+    void getBoundingBox(SoGetBoundingBoxAction* action) override;
+    void getMatrix(SoGetMatrixAction* action) override;
+    void handleEvent(SoHandleEventAction* action) override;
+    void pick(SoPickAction* action) override;
+    void rayPick(SoRayPickAction* action) override;
+    void getPrimitiveCount(SoGetPrimitiveCountAction* action) override;
+
+protected:
+    ~SoFCLevelOfDetail() override;
+};
+
+/**
+ * A coarse version of a triangle mesh, made by vertex clustering on a regular grid.
+ * If the mesh is split into parts, e.g. the faces of a shape, vertexes of different parts
+ * are never merged so that the parts and their sharp edges are kept.
+ */
+struct GuiExport LevelOfDetailMesh
+{
+    std::vector<SbVec3f> points;
+    std::vector<SbVec3f> normals;
+    std::vector<int32_t> coordIndex;
+    std::vector<int32_t> partIndex;
+    SbBox3f boundingBox;
+
+    /**
+     * Decimates the faces in \a coordIndex, each terminated by -1. \a partIndex holds the
+     * number of faces per part and may be empty. The longest side of the bounding box is
+     * divided into \a cells grid cells.
+     */
+    static LevelOfDetailMesh decimate(const std::vector<SbVec3f>& points,
+                                      const std::vector<int32_t>& coordIndex,
+                                      const std::vector<int32_t>& partIndex,
+                                      int cells);
+};
+
+/**
+ * Builds the coarse representations of a view provider in the background and keeps
+ * the level of detail nodes that show them up to date.
+ */
+class GuiExport LevelOfDetailBuilder
+{
+public:
+    /**
+     * \a faces is the node the coarse mesh is rendered with, e.g. a SoBrepFaceSet if the
+     * parts must be kept. In this case \a partIndex is the field that gets the faces per part.
+     */
+    explicit LevelOfDetailBuilder(SoIndexedFaceSet* faces, SoMFInt32* partIndex = nullptr);
+    ~LevelOfDetailBuilder();
+
+    LevelOfDetailBuilder(const LevelOfDetailBuilder&) = delete;
+    LevelOfDetailBuilder& operator=(const LevelOfDetailBuilder&) = delete;
+
+    /// the separator with the coarse mesh
+    SoSeparator* getRoot() const
+    {
+        return root;
+    }
+    /**
+     * Creates a level of detail node for \a node. The coarse mesh is its second child
+     * if \a coarse is true, otherwise nothing is rendered at low detail.
+     */
+    SoFCLevelOfDetail* createNode(SoNode* node, bool coarse);
+    /// starts decimating the given mesh in the background, a running update is superseded
+    void update(std::vector<SbVec3f> points,
+                std::vector<int32_t> coordIndex,
+                std::vector<int32_t> partIndex = {});
+    /// removes the coarse mesh
+    void clear();
+
+private:
+    void apply(const LevelOfDetailMesh& mesh);
+
+private:
+    SoSeparator* root;
+    SoCoordinate3* coords;
+    SoNormal* normals;
+    SoIndexedFaceSet* faces;
+    SoMFInt32* partIndex;
+    SoGroup* empty;
+    std::vector<SoFCLevelOfDetail*> nodes;
+    QFutureWatcher<LevelOfDetailMesh> watcher;
+};
+
+} // namespace Gui
+
+#endif // GUI_SOFCLEVELOFDETAIL_H
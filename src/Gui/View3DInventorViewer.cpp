@@ -101,6 +101,7 @@
 #include "SoAxisCrossKit.h"
 #include "SoFCBackgroundGradient.h"
 #include "SoFCBoundingBox.h"
+#include "SoFCCullingGroup.h"
 #include "SoFCDB.h"
 #include "SoFCInteractiveElement.h"
 #include "SoFCOffscreenRenderer.h"
@@ -510,7 +511,7 @@ void View3DInventorViewer::init()
     pcViewProviderRoot->addChild(pcEditingRoot);
 
     // Create group for the physical object
-    objectGroup = new SoGroup();
+    objectGroup = new SoFCCullingGroup();
     objectGroup->ref();
     pcViewProviderRoot->addChild(objectGroup);
 
@@ -66,6 +66,8 @@ public:
     FC_VIEW_PARAM(AxisXColor,unsigned long,Unsigned,0xCC333300) \
     FC_VIEW_PARAM(AxisYColor,unsigned long,Unsigned,0x33CC3300) \
     FC_VIEW_PARAM(AxisZColor,unsigned long,Unsigned,0x3333CC00) \
+    FC_VIEW_PARAM(FrustumCulling,bool,Bool,true) \
+    FC_VIEW_PARAM(LevelOfDetailSize,int,Int,64) \
 
 
 #undef FC_VIEW_PARAM
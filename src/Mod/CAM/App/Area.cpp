@@ -3411,7 +3411,7 @@ static inline void addParameter(bool verbose, Command& cmd, const char* name,
         cmd.Parameters[name] = relative ? d : next;
 }
 
-static inline void addGCode(bool verbose, Toolpath& path, const gp_Pnt& last,
+static inline Command makeGCode(bool verbose, const gp_Pnt& last,
     const gp_Pnt& next, const char* name)
 {
     Command cmd;
@@ -3419,20 +3419,24 @@ static inline void addGCode(bool verbose, Toolpath& path, const gp_Pnt& last,
     addParameter(verbose, cmd, "X", last.X(), next.X());
     addParameter(verbose, cmd, "Y", last.Y(), next.Y());
     addParameter(verbose, cmd, "Z", last.Z(), next.Z());
-    path.addCommand(cmd);
-    return;
+    return cmd;
+}
+
+static inline void addGCode(bool verbose, Toolpath& path, const gp_Pnt& last,
+    const gp_Pnt& next, const char* name)
+{
+    path.addCommand(makeGCode(verbose, last, next, name));
 }
 
 static inline void addG1(bool verbose, Toolpath& path, const gp_Pnt& last,
     const gp_Pnt& next, double f, double& last_f)
 {
-    addGCode(verbose, path, last, next, "G1");
+    Command cmd = makeGCode(verbose, last, next, "G1");
     if (f > Precision::Confusion()) {
-        Command* cmd = path.getCommands().back();
-        addParameter(verbose, *cmd, "F", last_f, f);
+        addParameter(verbose, cmd, "F", last_f, f);
         last_f = f;
     }
-    return;
+    path.addCommand(cmd);
 }
 
 static void addG0(bool verbose, Toolpath& path,
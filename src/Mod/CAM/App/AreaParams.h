@@ -92,7 +92,11 @@
     ((short,max_arc_points,MaxArcPoints,100,"Maximum segments for arc discretization (ignored currently)"))\
     ((double,clipper_scale,ClipperScale,1e7,\
         "ClipperLib operate on integers. This is the scale factor to convert\n"\
-        "floating points.",App::PropertyFloat))
+        "floating points.",App::PropertyFloat))\
+    ((enum,polygon_engine,PolygonEngine,0,\
+        "Polygon engine for the boolean and offset operations. 'Sweep' is a sweep-line\n"\
+        "engine with exact predicates, selectable for comparison with ClipperLib.",\
+        (Clipper)(Sweep)))
 
 /** Pocket parameters
  *
@@ -100,39 +100,47 @@ bool Command::has(const std::string& attr) const
 std::string Command::toGCode (int precision, bool padzero) const
 {
     std::stringstream str;
-    str.fill('0');
     str << Name;
-    if(precision<0)
-        precision = 0;
-    double scale = std::pow(10.0,precision+1);
-    std::int64_t iscale = static_cast<std::int64_t>(scale)/10;
     for(std::map<std::string,double>::const_iterator i = Parameters.begin(); i != Parameters.end(); ++i) {
         if(i->first == "N") continue;
 
         str << " " << i->first;
+        writeGCodeValue(str, i->second, precision, padzero);
+    }
+    return str.str();
+}
 
-        std::int64_t v = static_cast<std::int64_t>(i->second*scale);
-        if(v<0) {
-            v = -v;
-            str << '-'; //shall we allow -0 ?
-        }
-        v+=5;
-        v /= 10;
-        str << (v/iscale);
-        if(!precision) continue;
+void Command::writeGCodeValue(std::ostream &str, double value, int precision, bool padzero)
+{
+    if(precision<0)
+        precision = 0;
+    std::int64_t iscale = 1;
+    for(int i = 0; i < precision; i++)
+        iscale *= 10;
+    double scale = static_cast<double>(iscale)*10;
 
-        int width = precision;
-        std::int64_t digits = v%iscale;
-        if(!padzero) {
-            if(!digits) continue;
-            while(digits%10 == 0) {
-                digits/=10;
-                --width;
-            }
+    std::int64_t v = static_cast<std::int64_t>(value*scale);
+    if(v<0) {
+        v = -v;
+        str << '-'; //shall we allow -0 ?
+    }
+    v+=5;
+    v /= 10;
+    str << (v/iscale);
+    if(!precision) return;
+
+    int width = precision;
+    std::int64_t digits = v%iscale;
+    if(!padzero) {
+        if(!digits) return;
+        while(digits%10 == 0) {
+            digits/=10;
+            --width;
         }
-        str << '.' << std::setw(width) << std::right << digits;
     }
-    return str.str();
+    char fill = str.fill('0');
+    str << '.' << std::setw(width) << std::right << digits;
+    str.fill(fill);
 }
 
 void Command::setFromGCode (const std::string& str)
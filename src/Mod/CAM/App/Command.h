@@ -24,6 +24,7 @@
 #ifndef PATH_COMMAND_H
 #define PATH_COMMAND_H
 
+#include <iosfwd>
 #include <map>
 #include <string>
 #include <Base/Persistence.h>
@@ -61,6 +62,9 @@ namespace Path
         double getValue(const std::string &name) const; // returns the value of a given parameter
         void scaleBy(double factor); // scales the receiver - use for imperial/metric conversions
 
+        // writes a parameter value the way toGCode() does
+        static void writeGCodeValue(std::ostream &str, double value, int precision, bool padzero);
+
         // this assumes the name is upper case
         inline double getParam(const std::string &name, double fallback = 0.0) const {
             auto it = Parameters.find(name);
@@ -0,0 +1,411 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <cctype>
+#include <cstdlib>
+#endif
+
+#include <Base/Exception.h>
+
+#include "CommandTable.h"
+
+
+using namespace Path;
+
+CommandTable::CommandTable()
+    : offsets(1, 0)
+{}
+
+void CommandTable::clear()
+{
+    opcodes.clear();
+    offsets.assign(1, 0);
+    keys.clear();
+    values.clear();
+}
+
+void CommandTable::reserve(std::size_t commands, std::size_t parameters)
+{
+    opcodes.reserve(commands);
+    offsets.reserve(commands + 1);
+    keys.reserve(parameters);
+    values.reserve(parameters);
+}
+
+uint32_t CommandTable::internName(const std::string& name)
+{
+    auto it = nameIndex.find(name);
+    if (it != nameIndex.end()) {
+        return it->second;
+    }
+    auto index = static_cast<uint32_t>(names.size());
+    names.push_back(name);
+    nameIndex.emplace(name, index);
+    return index;
+}
+
+uint16_t CommandTable::internKey(const std::string& key)
+{
+    auto it = keyIndex.find(key);
+    if (it != keyIndex.end()) {
+        return it->second;
+    }
+    if (keyNames.size() > UINT16_MAX) {
+        throw Base::RuntimeError("Too many different command parameters");
+    }
+    auto index = static_cast<uint16_t>(keyNames.size());
+    keyNames.push_back(key);
+    keyIndex.emplace(key, index);
+    return index;
+}
+
+int CommandTable::findKey(const std::string& key) const
+{
+    auto it = keyIndex.find(key);
+    return it == keyIndex.end() ? -1 : it->second;
+}
+
+void CommandTable::append(const Command& cmd)
+{
+    beginCommand(cmd.Name);
+    // the map is already sorted by key
+    for (const auto& it : cmd.Parameters) {
+        keys.push_back(internKey(it.first));
+        values.push_back(it.second);
+    }
+    offsets.back() = static_cast<uint32_t>(keys.size());
+}
+
+void CommandTable::insert(unsigned int pos, const Command& cmd)
+{
+    if (pos >= size()) {
+        append(cmd);
+        return;
+    }
+
+    std::vector<uint16_t> cmdKeys;
+    std::vector<double> cmdValues;
+    for (const auto& it : cmd.Parameters) {
+        cmdKeys.push_back(internKey(it.first));
+        cmdValues.push_back(it.second);
+    }
+
+    uint32_t first = offsets[pos];
+    auto count = static_cast<uint32_t>(cmdKeys.size());
+    opcodes.insert(opcodes.begin() + pos, internName(cmd.Name));
+    keys.insert(keys.begin() + first, cmdKeys.begin(), cmdKeys.end());
+    values.insert(values.begin() + first, cmdValues.begin(), cmdValues.end());
+    offsets.insert(offsets.begin() + pos, first);
+    for (std::size_t i = pos + 1; i < offsets.size(); i++) {
+        offsets[i] += count;
+    }
+}
+
+void CommandTable::erase(unsigned int pos)
+{
+    uint32_t first = offsets[pos];
+    uint32_t count = offsets[pos + 1] - first;
+    opcodes.erase(opcodes.begin() + pos);
+    keys.erase(keys.begin() + first, keys.begin() + first + count);
+    values.erase(values.begin() + first, values.begin() + first + count);
+    offsets.erase(offsets.begin() + pos);
+    for (std::size_t i = pos; i < offsets.size(); i++) {
+        offsets[i] -= count;
+    }
+}
+
+Command CommandTable::get(unsigned int pos) const
+{
+    Command cmd;
+    cmd.Name = names[opcodes[pos]];
+    auto hint = cmd.Parameters.end();
+    for (uint32_t i = offsets[pos]; i < offsets[pos + 1]; i++) {
+        hint = cmd.Parameters.emplace_hint(hint, keyNames[keys[i]], values[i]);
+        ++hint;
+    }
+    return cmd;
+}
+
+void CommandTable::writeGCode(std::ostream& str, unsigned int pos, int precision,
+                              bool padzero) const
+{
+    str << names[opcodes[pos]];
+    for (uint32_t i = offsets[pos]; i < offsets[pos + 1]; i++) {
+        const std::string& key = keyNames[keys[i]];
+        if (key == "N") {
+            continue;
+        }
+        str << " " << key;
+        Command::writeGCodeValue(str, values[i], precision, padzero);
+    }
+}
+
+double CommandTable::getParam(unsigned int pos, int key, double fallback) const
+{
+    for (uint32_t i = offsets[pos]; i < offsets[pos + 1]; i++) {
+        if (keys[i] == key) {
+            return values[i];
+        }
+    }
+    return fallback;
+}
+
+bool CommandTable::has(unsigned int pos, int key) const
+{
+    for (uint32_t i = offsets[pos]; i < offsets[pos + 1]; i++) {
+        if (keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CommandTable::beginCommand(const std::string& name)
+{
+    opcodes.push_back(internName(name));
+    offsets.push_back(static_cast<uint32_t>(keys.size()));
+}
+
+void CommandTable::addParameter(uint16_t key, double value)
+{
+    keys.push_back(key);
+    values.push_back(value);
+}
+
+void CommandTable::endCommand()
+{
+    // insertion sort, commands have only a few parameters
+    uint32_t first = offsets[opcodes.size() - 1];
+    auto last = static_cast<uint32_t>(keys.size());
+    for (uint32_t i = first + 1; i < last; i++) {
+        uint16_t key = keys[i];
+        double value = values[i];
+        uint32_t j = i;
+        while (j > first && keyNames[key] < keyNames[keys[j - 1]]) {
+            keys[j] = keys[j - 1];
+            values[j] = values[j - 1];
+            j--;
+        }
+        keys[j] = key;
+        values[j] = value;
+    }
+
+    // the sort is stable, so keep the last of equal keys
+    uint32_t out = first;
+    for (uint32_t i = first; i < last; i++) {
+        if (i + 1 < last && keys[i + 1] == keys[i]) {
+            continue;
+        }
+        keys[out] = keys[i];
+        values[out] = values[i];
+        out++;
+    }
+    keys.resize(out);
+    values.resize(out);
+    offsets.back() = out;
+}
+
+unsigned int CommandTable::getMemSize() const
+{
+    std::size_t mem = opcodes.capacity() * sizeof(uint32_t) + offsets.capacity() * sizeof(uint32_t)
+        + keys.capacity() * sizeof(uint16_t) + values.capacity() * sizeof(double);
+    for (const auto& it : names) {
+        mem += sizeof(std::string) + it.capacity();
+    }
+    for (const auto& it : keyNames) {
+        mem += sizeof(std::string) + it.capacity();
+    }
+    return static_cast<unsigned int>(mem);
+}
+
+// ----------------------------------------------------------------------------
+
+GCodeParser::GCodeParser(CommandTable& table)
+    : table(table)
+{
+    std::fill(std::begin(keyCache), std::end(keyCache), -1);
+}
+
+void GCodeParser::parse(const char* data, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; i++) {
+        char c = data[i];
+        if (inComment) {
+            segment += c;
+            if (c == ')') {
+                addComment();
+                active = false;
+                inComment = false;
+            }
+        }
+        else if (c == '(' || c == 'g' || c == 'G' || c == 'm' || c == 'M') {
+            if (active) {
+                addCommand();
+            }
+            segment.assign(1, c);
+            active = true;
+            inComment = c == '(';
+        }
+        else if (active) {
+            segment += c;
+        }
+    }
+}
+
+void GCodeParser::parse(std::istream& str)
+{
+    char buffer[65536];
+    while (str.read(buffer, sizeof(buffer)) || str.gcount() > 0) {
+        parse(buffer, static_cast<std::size_t>(str.gcount()));
+    }
+}
+
+void GCodeParser::finish()
+{
+    // an unterminated comment is dropped
+    if (active && !inComment) {
+        addCommand();
+    }
+    active = false;
+    inComment = false;
+}
+
+uint16_t GCodeParser::getKey(char key)
+{
+    auto index = static_cast<unsigned char>(key) & 0x7f;
+    if (keyCache[index] < 0) {
+        keyCache[index] = table.internKey(std::string(1, key));
+    }
+    return static_cast<uint16_t>(keyCache[index]);
+}
+
+// Parses a comment the same way as Command::setFromGCode()
+void GCodeParser::addComment()
+{
+    name.clear();
+    for (char c : segment) {
+        if (c != '(') {
+            name += c;
+        }
+    }
+    name.insert(name.begin(), '(');
+    table.beginCommand(name);
+    table.endCommand();
+}
+
+// Parses a command the same way as Command::setFromGCode()
+void GCodeParser::addCommand()
+{
+    enum
+    {
+        None,
+        Name,
+        Argument
+    } mode = None;
+    char key = 0;
+    name.clear();
+    value.clear();
+    arguments.clear();
+
+    auto setName = [this, &key]() {
+        name = char(std::toupper(static_cast<unsigned char>(key)));
+        name += value;
+    };
+    auto addArgument = [this, &key]() {
+        char upper = char(std::toupper(static_cast<unsigned char>(key)));
+        arguments.emplace_back(upper, std::atof(value.c_str()));
+    };
+
+    for (char c : segment) {
+        auto uc = static_cast<unsigned char>(c);
+        if (std::isdigit(uc) || c == '-' || c == '.') {
+            value += c;
+        }
+        else if (std::isalpha(uc)) {
+            if (mode == Name) {
+                if (key == 0 || value.empty()) {
+                    throw Base::BadFormatError("Badly formatted GCode command");
+                }
+                setName();
+                mode = Argument;
+            }
+            else if (mode == None) {
+                mode = Name;
+            }
+            else {
+                if (key == 0 || value.empty()) {
+                    throw Base::BadFormatError("Badly formatted GCode argument");
+                }
+                addArgument();
+            }
+            key = c;
+            value.clear();
+        }
+        else if (c == ')') {
+            key = '(';
+            value += c;
+        }
+    }
+
+    if (key == 0 || value.empty()) {
+        throw Base::BadFormatError("Badly formatted GCode argument");
+    }
+    if (mode == Name) {
+        setName();
+    }
+    else {
+        addArgument();
+    }
+
+    if (name == "G20") {
+        inches = true;
+        return;
+    }
+    if (name == "G21") {
+        inches = false;
+        return;
+    }
+
+    table.beginCommand(name);
+    for (const auto& it : arguments) {
+        double val = it.second;
+        if (inches) {
+            switch (it.first) {
+                case 'X':
+                case 'Y':
+                case 'Z':
+                case 'I':
+                case 'J':
+                case 'R':
+                case 'Q':
+                case 'F':
+                    val *= 25.4;
+                    break;
+            }
+        }
+        table.addParameter(getKey(it.first), val);
+    }
+    table.endCommand();
+}
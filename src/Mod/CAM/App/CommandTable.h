@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef PATH_COMMANDTABLE_H
+#define PATH_COMMANDTABLE_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Command.h"
+
+
+namespace Path
+{
+
+/** Columnar storage of the commands of a toolpath
+ *
+ * Command names and parameter keys are interned, every command stores the
+ * index of its name and the range of its parameters in dense key and value
+ * arrays. Arcs need no special treatment because their centers are ordinary
+ * I, J, K parameters. The parameters of a command are kept sorted by key, so
+ * get() returns the same Command that was added.
+ */
+class PathExport CommandTable
+{
+public:
+    CommandTable();
+
+    unsigned int size() const
+    {
+        return static_cast<unsigned int>(opcodes.size());
+    }
+    bool empty() const
+    {
+        return opcodes.empty();
+    }
+    void clear();
+    void reserve(std::size_t commands, std::size_t parameters);
+
+    void append(const Command& cmd);
+    void insert(unsigned int pos, const Command& cmd);
+    void erase(unsigned int pos);
+
+    /// Returns a copy of the command at \a pos
+    Command get(unsigned int pos) const;
+    /// Writes the command at \a pos like Command::toGCode() without creating a copy
+    void writeGCode(std::ostream& str, unsigned int pos, int precision = 6,
+                    bool padzero = true) const;
+    const std::string& getName(unsigned int pos) const
+    {
+        return names[opcodes[pos]];
+    }
+    /// Returns the index of the interned parameter key or -1 if no command uses it
+    int findKey(const std::string& key) const;
+    /// Returns the value of the parameter with the interned key index \a key
+    double getParam(unsigned int pos, int key, double fallback = 0.0) const;
+    bool has(unsigned int pos, int key) const;
+
+    /** @name Incremental construction
+     * Used by the G-code parser to add commands without creating a Command.
+     */
+    //@{
+    uint16_t internKey(const std::string& key);
+    void beginCommand(const std::string& name);
+    void addParameter(uint16_t key, double value);
+    /// Sorts the parameters of the last command, later values of a key win
+    void endCommand();
+    //@}
+
+    unsigned int getMemSize() const;
+
+private:
+    uint32_t internName(const std::string& name);
+
+private:
+    std::vector<uint32_t> opcodes;
+    std::vector<uint32_t> offsets;  // first parameter of each command, size() + 1 entries
+    std::vector<uint16_t> keys;
+    std::vector<double> values;
+
+    std::vector<std::string> names;
+    std::unordered_map<std::string, uint32_t> nameIndex;
+    std::vector<std::string> keyNames;
+    std::unordered_map<std::string, uint16_t> keyIndex;
+};
+
+/** Streaming G-code parser
+ *
+ * Splits the input at G, M and comments like Toolpath::setFromGCode() always
+ * did and adds the commands straight to a CommandTable. The input can be fed
+ * in chunks of any size, G20 and G21 switch between inch and metric units.
+ */
+class PathExport GCodeParser
+{
+public:
+    explicit GCodeParser(CommandTable& table);
+
+    void parse(const char* data, std::size_t size);
+    void parse(std::istream& str);
+    /// Adds the pending command, must be called after the last chunk
+    void finish();
+
+private:
+    void addCommand();
+    void addComment();
+    uint16_t getKey(char key);
+
+private:
+    CommandTable& table;
+    std::string segment;
+    std::string name;
+    std::string value;
+    std::vector<std::pair<char, double>> arguments;
+    int keyCache[128];
+    bool active = false;
+    bool inComment = false;
+    bool inches = false;
+};
+
+}  // namespace Path
+
+#endif  // PATH_COMMANDTABLE_H
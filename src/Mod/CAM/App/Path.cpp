@@ -21,6 +21,9 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+# include <sstream>
+#endif
 
 #include <App/Application.h>
 #include <Base/Console.h>
@@ -42,10 +45,9 @@ Toolpath::Toolpath()
 }
 
 Toolpath::Toolpath(const Toolpath& otherPath)
-    : vpcCommands(otherPath.vpcCommands.size())
+    : commands(otherPath.commands)
     , center(otherPath.center)
 {
-    *this = otherPath;
     recalculate();
 }
 
@@ -59,12 +61,7 @@ Toolpath &Toolpath::operator=(const Toolpath& otherPath)
     if (this == &otherPath)
         return *this;
 
-    clear();
-    vpcCommands.resize(otherPath.vpcCommands.size());
-    int i = 0;
-    for (std::vector<Command*>::const_iterator it=otherPath.vpcCommands.begin();it!=otherPath.vpcCommands.end();++it,i++) {
-        vpcCommands[i] = new Command(**it);
-    }
+    commands = otherPath.commands;
     center = otherPath.center;
     recalculate();
     return *this;
@@ -72,16 +69,13 @@ Toolpath &Toolpath::operator=(const Toolpath& otherPath)
 
 void Toolpath::clear()
 {
-    for(std::vector<Command*>::iterator it = vpcCommands.begin();it!=vpcCommands.end();++it)
-        delete ( *it );
-    vpcCommands.clear();
+    commands.clear();
     recalculate();
 }
 
 void Toolpath::addCommand(const Command &Cmd)
 {
-    Command *tmp = new Command(Cmd);
-    vpcCommands.push_back(tmp);
+    commands.append(Cmd);
     recalculate();
 }
 
@@ -89,9 +83,8 @@ void Toolpath::insertCommand(const Command &Cmd, int pos)
 {
     if (pos == -1) {
         addCommand(Cmd);
-    } else if (pos <= static_cast<int>(vpcCommands.size())) {
-        Command *tmp = new Command(Cmd);
-        vpcCommands.insert(vpcCommands.begin()+pos,tmp);
+    } else if (pos <= static_cast<int>(commands.size())) {
+        commands.insert(pos, Cmd);
     } else {
         throw Base::IndexError("Index not in range");
     }
@@ -101,33 +94,58 @@ void Toolpath::insertCommand(const Command &Cmd, int pos)
 void Toolpath::deleteCommand(int pos)
 {
     if (pos == -1) {
-        //delete(*vpcCommands.rbegin()); // causes crash
-        vpcCommands.pop_back();
-    } else if (pos <= static_cast<int>(vpcCommands.size())) {
-        vpcCommands.erase (vpcCommands.begin()+pos);
+        if (!commands.empty())
+            commands.erase(commands.size() - 1);
+    } else if (pos < static_cast<int>(commands.size())) {
+        commands.erase(pos);
     } else {
         throw Base::IndexError("Index not in range");
     }
     recalculate();
 }
 
+// Reads positions and arc centers straight from the command table
+class CommandTableReader
+{
+public:
+    explicit CommandTableReader(const CommandTable &table)
+        : table(table)
+        , x(table.findKey("X")), y(table.findKey("Y")), z(table.findKey("Z"))
+        , i(table.findKey("I")), j(table.findKey("J")), k(table.findKey("K"))
+    {}
+
+    Vector3d getPosition(unsigned int pos, const Vector3d &last) const
+    {
+        return Vector3d(table.getParam(pos, x, last.x), table.getParam(pos, y, last.y), table.getParam(pos, z, last.z));
+    }
+    Vector3d getCenter(unsigned int pos) const
+    {
+        return Vector3d(table.getParam(pos, i), table.getParam(pos, j), table.getParam(pos, k));
+    }
+
+private:
+    const CommandTable &table;
+    int x, y, z, i, j, k;
+};
+
 double Toolpath::getLength()
 {
-    if(vpcCommands.empty())
+    if(commands.empty())
         return 0;
     double l = 0;
     Vector3d last(0,0,0);
     Vector3d next;
-    for(std::vector<Command*>::const_iterator it = vpcCommands.begin();it!=vpcCommands.end();++it) {
-        std::string name = (*it)->Name;
-        next = (*it)->getPlacement(last).getPosition();
+    CommandTableReader reader(commands);
+    for(unsigned int pos = 0; pos < commands.size(); pos++) {
+        const std::string &name = commands.getName(pos);
+        next = reader.getPosition(pos, last);
         if ( (name == "G0") || (name == "G00") || (name == "G1") || (name == "G01") ) {
             // straight line
             l += (next - last).Length();
             last = next;
         } else if ( (name == "G2") || (name == "G02") || (name == "G3") || (name == "G03") ) {
             // arc
-            Vector3d center = (*it)->getCenter();
+            Vector3d center = reader.getCenter(pos);
             double radius = (last - center).Length();
             double angle = (next - center).GetAngle(last - center);
             l += angle * radius;
@@ -156,7 +174,7 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
         vRapid = vFeed;
     }
 
-    if (vpcCommands.empty()) {
+    if (commands.empty()) {
         return 0;
     }
     double l = 0;
@@ -164,14 +182,14 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
     bool verticalMove = false;
     Vector3d last(0,0,0);
     Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin();it!=vpcCommands.end();++it) {
-        std::string name = (*it)->Name;
-        float feedrate = (*it)->getParam("F");
+    CommandTableReader reader(commands);
+    for (unsigned int pos = 0; pos < commands.size(); pos++) {
+        const std::string &name = commands.getName(pos);
+        float feedrate = hFeed;
 
         l = 0;
         verticalMove = false;
-        feedrate = hFeed;
-        next = (*it)->getPlacement(last).getPosition();
+        next = reader.getPosition(pos, last);
 
         if (last.z != next.z){
             verticalMove = true;
@@ -190,7 +208,7 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
             l += (next - last).Length();
         }else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03") ) {
             // Arc Move
-            Vector3d center = (*it)->getCenter();
+            Vector3d center = reader.getCenter(pos);
             double radius = (last - center).Length();
             double angle = (next - center).GetAngle(last - center);
             l += angle * radius;
@@ -274,91 +292,40 @@ Base::BoundBox3d Toolpath::getBoundBox() const
     return visitor.bb;
 }
 
-static void bulkAddCommand(const std::string &gcodestr, std::vector<Command*> &commands, bool &inches)
+void Toolpath::setFromGCode(const std::string instr)
 {
-    Command *cmd = new Command();
-    cmd->setFromGCode(gcodestr);
-    if ("G20" == cmd->Name) {
-        inches = true;
-        delete cmd;
-    } else if ("G21" == cmd->Name) {
-        inches = false;
-        delete cmd;
-    } else {
-        if (inches) {
-            cmd->scaleBy(25.4);
-        }
-        commands.push_back(cmd);
-    }
+    clear();
+
+    GCodeParser parser(commands);
+    parser.parse(instr.data(), instr.size());
+    parser.finish();
+    recalculate();
 }
 
-void Toolpath::setFromGCode(const std::string instr)
+void Toolpath::setFromGCode(std::istream &str)
 {
     clear();
 
-    // remove comments
-    //boost::regex e("\\(.*?\\)");
-    //std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
-
-    // split input string by () or G or M commands
-    std::string mode = "command";
-    std::size_t found = str.find_first_of("(gGmM");
-    int last = -1;
-    bool inches = false;
-    while (found != std::string::npos)
-    {
-        if (str[found] == '(') {
-            // start of comment
-            if ( (last > -1) && (mode == "command") ) {
-                // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found-last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
-            }
-            mode = "comment";
-            last = found;
-            found = str.find_first_of(')', found+1);
-        } else if (str[found] == ')') {
-            // end of comment
-            std::string gcodestr = str.substr(last, found-last+1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-            last = -1;
-            found = str.find_first_of("(gGmM", found+1);
-            mode = "command";
-        } else if (mode == "command") {
-            // command
-            if (last > -1) {
-                std::string gcodestr = str.substr(last, found-last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
-            }
-            last = found;
-            found = str.find_first_of("(gGmM", found+1);
-        }
-    }
-    // add the last command found, if any
-    if (last > -1) {
-        if (mode == "command") {
-            std::string gcodestr = str.substr(last,std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-        }
-    }
+    GCodeParser parser(commands);
+    parser.parse(str);
+    parser.finish();
     recalculate();
 }
 
 std::string Toolpath::toGCode() const
 {
-    std::string result;
-    for (std::vector<Command*>::const_iterator it=vpcCommands.begin();it!=vpcCommands.end();++it) {
-        result += (*it)->toGCode();
-        result += "\n";
+    std::stringstream str;
+    for (unsigned int pos = 0; pos < commands.size(); pos++) {
+        commands.writeGCode(str, pos);
+        str << "\n";
     }
-    return result;
+    return str.str();
 }
 
 void Toolpath::recalculate() // recalculates the path cache
 {
 
-    if(vpcCommands.empty())
+    if(commands.empty())
         return;
 
     // TODO recalculate the KDL stuff. At the moment, this is unused.
@@ -422,7 +389,7 @@ void Toolpath::recalculate() // recalculates the path cache
 
 unsigned int Toolpath::getMemSize () const
 {
-    return toGCode().size();
+    return commands.getMemSize();
 }
 
 void Toolpath::setCenter(const Base::Vector3d &c)
@@ -443,7 +410,7 @@ void Toolpath::Save (Writer &writer) const
         writer.incInd();
         saveCenter(writer, center);
         for(unsigned int i = 0; i < getSize(); i++) {
-            vpcCommands[i]->Save(writer);
+            commands.get(i).Save(writer);
         }
         writer.decInd();
     } else {
@@ -458,9 +425,11 @@ void Toolpath::Save (Writer &writer) const
 
 void Toolpath::SaveDocFile (Base::Writer &writer) const
 {
-    if (toGCode().empty())
-        return;
-    writer.Stream() << toGCode();
+    // write command by command instead of building the whole program in memory
+    for (unsigned int pos = 0; pos < commands.size(); pos++) {
+        commands.writeGCode(writer.Stream(), pos);
+        writer.Stream() << "\n";
+    }
 }
 
 void Toolpath::Restore(XMLReader &reader)
@@ -476,14 +445,7 @@ void Toolpath::Restore(XMLReader &reader)
 
 void Toolpath::RestoreDocFile(Base::Reader &reader)
 {
-    std::string gcode;
-    std::string line;
-    while (reader >> line) {
-        gcode += line;
-        gcode += " ";
-    }
-    setFromGCode(gcode);
-
+    setFromGCode(reader);
 }
 
 
@@ -28,6 +28,7 @@
 #include <Base/Vector3D.h>
 
 #include "Command.h"
+#include "CommandTable.h"
 
 
 namespace Path
@@ -62,13 +63,15 @@ namespace Path
             double getCycleTime(double, double, double, double); // return the Cycle Time (s) of the Path
             void recalculate(); // recalculates the points
             void setFromGCode(const std::string); // sets the path from the contents of the given GCode string
+            void setFromGCode(std::istream&); // sets the path from a GCode stream without loading it at once
             std::string toGCode() const; // gets a gcode string representation from the Path
             Base::BoundBox3d getBoundBox() const;
 
             // shortcut functions
-            unsigned int getSize() const { return vpcCommands.size(); }
-            const std::vector<Command*> &getCommands() const { return vpcCommands; }
-            const Command &getCommand(unsigned int pos)    const { return *vpcCommands[pos]; }
+            unsigned int getSize() const { return commands.size(); }
+            // builds a copy of the command, loops should read getCommandTable() instead
+            Command getCommand(unsigned int pos) const { return commands.get(pos); }
+            const CommandTable &getCommandTable() const { return commands; }
 
             // support for rotation
             const Base::Vector3d& getCenter() const { return center; }
@@ -77,7 +80,7 @@ namespace Path
             static const int SchemaVersion = 2;
 
         protected:
-            std::vector<Command*> vpcCommands;
+            CommandTable commands;
             Base::Vector3d center;
             //KDL::Path_Composite *pcPath;
 
@@ -86,9 +86,10 @@ int PathPy::PyInit(PyObject* args, PyObject* /*kwd*/)
 
 Py::List PathPy::getCommands() const
 {
-    Py::List list;
-    for(unsigned int i = 0; i < getToolpathPtr()->getSize(); i++)
-        list.append(Py::asObject(new Path::CommandPy(new Path::Command(getToolpathPtr()->getCommand(i)))));
+    const CommandTable &table = getToolpathPtr()->getCommandTable();
+    Py::List list(table.size());
+    for(unsigned int i = 0; i < table.size(); i++)
+        list.setItem(i, Py::asObject(new Path::CommandPy(new Path::Command(table.get(i)))));
     return list;
 }
 
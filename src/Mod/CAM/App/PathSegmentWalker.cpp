@@ -136,26 +136,39 @@ void PathSegmentWalker::walk(PathSegmentVisitor &cb, const Base::Vector3d &start
     // for mapping the coordinates to XY plane
     double Base::Vector3d::*pz = &Base::Vector3d::z;
 
+    // read the commands straight from the table instead of copying every command
+    const CommandTable &table = tp.getCommandTable();
+    const int keyX = table.findKey("X");
+    const int keyY = table.findKey("Y");
+    const int keyZ = table.findKey("Z");
+    const int keyA = table.findKey("A");
+    const int keyB = table.findKey("B");
+    const int keyC = table.findKey("C");
+    const int keyI = table.findKey("I");
+    const int keyJ = table.findKey("J");
+    const int keyK = table.findKey("K");
+    const int keyR = table.findKey("R");
+    const int keyQ = table.findKey("Q");
+
     cb.setup(last);
 
     for (unsigned int  i = 0; i < tp.getSize(); i++) {
         std::deque<Base::Vector3d> points;
 
-        const Path::Command &cmd = tp.getCommand(i);
-        const std::string &name = cmd.Name;
-        Base::Vector3d next = cmd.getPlacement().getPosition();
+        const std::string &name = table.getName(i);
+        Base::Vector3d next(table.getParam(i, keyX), table.getParam(i, keyY), table.getParam(i, keyZ));
         double a = A;
         double b = B;
         double c = C;
 
         if (!absolute)
             next = last + next;
-        if (!cmd.has("X")) next.x = last.x;
-        if (!cmd.has("Y")) next.y = last.y;
-        if (!cmd.has("Z")) next.z = last.z;
-        if ( cmd.has("A")) a = cmd.getValue("A");
-        if ( cmd.has("B")) b = cmd.getValue("B");
-        if ( cmd.has("C")) c = cmd.getValue("C");
+        if (!table.has(i, keyX)) next.x = last.x;
+        if (!table.has(i, keyY)) next.y = last.y;
+        if (!table.has(i, keyZ)) next.z = last.z;
+        if ( table.has(i, keyA)) a = table.getParam(i, keyA);
+        if ( table.has(i, keyB)) b = table.getParam(i, keyB);
+        if ( table.has(i, keyC)) c = table.getParam(i, keyC);
 
         Base::Rotation nrot = yawPitchRoll(a, b, c);
 
@@ -206,10 +219,11 @@ void PathSegmentWalker::walk(PathSegmentVisitor &cb, const Base::Vector3d &start
             else
                 norm.*pz = 1.0;
 
+            Base::Vector3d offset(table.getParam(i, keyI), table.getParam(i, keyJ), table.getParam(i, keyK));
             if (absolutecenter)
-                center = cmd.getCenter();
+                center = offset;
             else
-                center = (last + cmd.getCenter());
+                center = (last + offset);
             Base::Vector3d next0(next);
             next0.*pz = 0.0;
             Base::Vector3d last0(last);
@@ -278,8 +292,8 @@ void PathSegmentWalker::walk(PathSegmentVisitor &cb, const Base::Vector3d &start
         } else if ((name=="G73")||(name=="G81")||(name=="G82")||(name=="G83")||(name=="G84")||(name=="G85")||(name=="G86")||(name=="G89")){
             // drill,tap,bore
             double r = 0;
-            if (cmd.has("R"))
-                r = cmd.getValue("R");
+            if (table.has(i, keyR))
+                r = table.getParam(i, keyR);
 
             std::deque<Base::Vector3d> plist;
             std::deque<Base::Vector3d> qlist;
@@ -314,8 +328,8 @@ void PathSegmentWalker::walk(PathSegmentVisitor &cb, const Base::Vector3d &start
             Base::Vector3d p2r = compensateRotation(p2, nrot, rotCenter);
 
             double q;
-            if (cmd.has("Q")) {
-                q = cmd.getValue("Q");
+            if (table.has(i, keyQ)) {
+                q = table.getParam(i, keyQ);
                 if (q>0) {
                     Base::Vector3d temp(next);
                     for(temp.*pz=r;temp.*pz>next.*pz;temp.*pz-=q) {
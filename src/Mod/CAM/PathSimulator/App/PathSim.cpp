@@ -42,11 +42,37 @@ void PathSim::BeginSimulation(Part::TopoShape * stock, float resolution)
 {
 	Base::BoundBox3d bbox = stock->getBoundBox();
 	m_stock = std::make_unique<cStock>(bbox.MinX, bbox.MinY, bbox.MinZ, bbox.LengthX(), bbox.LengthY(), bbox.LengthZ(), resolution);
+	m_dexelStock.reset();
 }
 
 void PathSim::SetToolShape(const TopoDS_Shape& toolShape, float resolution)
 {
 	m_tool = std::make_unique<cSimTool>(toolShape, resolution);
+	if (m_dexelStock)
+		m_dexelStock->SetTool(*m_tool);
+}
+
+void PathSim::BeginDexelSimulation(Part::TopoShape * stock, float resolution)
+{
+	Base::BoundBox3d bbox = stock->getBoundBox();
+	m_dexelStock = std::make_unique<cDexelStock>(bbox.MinX, bbox.MinY, bbox.MinZ, bbox.LengthX(), bbox.LengthY(), bbox.LengthZ(), resolution);
+	if (m_tool)
+		m_dexelStock->SetTool(*m_tool);
+	m_angle = 0;
+	m_feed = 0;
+}
+
+void PathSim::SetHolderShape(float radius, float length)
+{
+	if (m_dexelStock)
+		m_dexelStock->SetHolder(radius, length);
+}
+
+std::vector<cDexelMoveResult> PathSim::ProcessMoves()
+{
+	if (!m_dexelStock)
+		return {};
+	return m_dexelStock->Simulate();
 }
 
 Base::Placement * PathSim::ApplyCommand(Base::Placement * pos, Command * cmd)
@@ -54,7 +80,24 @@ Base::Placement * PathSim::ApplyCommand(Base::Placement * pos, Command * cmd)
 	Point3D fromPos(*pos);
 	Point3D toPos(*pos);
 	toPos.UpdateCmd(*cmd);
-	if (m_tool)
+	if (m_tool && m_dexelStock)
+	{
+		float fromAngle = m_angle;
+		m_angle = (float)cmd->getParam("A", m_angle);
+		m_feed = (float)cmd->getParam("F", m_feed);
+		if (cmd->Name == "G0" || cmd->Name == "G1")
+		{
+			m_dexelStock->AddLinearMove(fromPos, toPos, cmd->Name == "G0", m_feed, fromAngle, m_angle);
+		}
+		else if (cmd->Name == "G2" || cmd->Name == "G3")
+		{
+			// the center is relative to the start point
+			Vector3d vcent = cmd->getCenter();
+			Point3D cent = fromPos + Point3D(vcent);
+			m_dexelStock->AddCircularMove(fromPos, toPos, cent, cmd->Name == "G3", m_feed, fromAngle, m_angle);
+		}
+	}
+	else if (m_tool)
 	{
 		if (cmd->Name == "G0" || cmd->Name == "G1")
 		{
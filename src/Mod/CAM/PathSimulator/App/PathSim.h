@@ -30,6 +30,7 @@
 #include <Mod/Part/App/TopoShape.h>
 #include <Mod/CAM/PathGlobal.h>
 
+#include "TriDexel.h"
 #include "VolSim.h"
 
 
@@ -52,9 +53,18 @@ namespace PathSimulator
 			void SetToolShape(const TopoDS_Shape& toolShape, float resolution);
 			Base::Placement * ApplyCommand(Base::Placement * pos, Command * cmd);
 
+			/** Start a tri-dexel simulation. ApplyCommand() queues the moves
+			 *  which are applied in parallel by ProcessMoves() */
+			void BeginDexelSimulation(Part::TopoShape * stock, float resolution);
+			void SetHolderShape(float radius, float length);
+			std::vector<cDexelMoveResult> ProcessMoves();
+
 		public:
 			std::unique_ptr<cStock> m_stock;
+			std::unique_ptr<cDexelStock> m_dexelStock;
 			std::unique_ptr<cSimTool> m_tool;
+			float m_angle = 0;	// current A axis position
+			float m_feed = 0;	// current feed rate
 	};
 
 } //namespace Path
@@ -63,6 +63,10 @@ PyObject* PathSimPy::BeginSimulation(PyObject * args, PyObject * kwds)
 	float resolution;
 	if (!Base::Wrapped_ParseTupleAndKeywords(args, kwds, "O!f", kwlist, &(Part::TopoShapePy::Type), &pObjStock, &resolution))
 		return nullptr;
+	if (!(resolution > 0)) {
+		PyErr_SetString(PyExc_ValueError, "Resolution must be positive");
+		return nullptr;
+	}
 	PathSim *sim = getPathSimPtr();
 	Part::TopoShape *stock = static_cast<Part::TopoShapePy*>(pObjStock)->getTopoShapePtr();
 	sim->BeginSimulation(stock, resolution);
@@ -125,6 +129,59 @@ PyObject* PathSimPy::ApplyCommand(PyObject * args, PyObject * kwds)
 	return newposPy;
 }
 
+PyObject* PathSimPy::BeginDexelSimulation(PyObject * args, PyObject * kwds)
+{
+	static const std::array<const char *, 3> kwlist { "stock", "resolution", nullptr };
+	PyObject *pObjStock;
+	float resolution;
+	if (!Base::Wrapped_ParseTupleAndKeywords(args, kwds, "O!f", kwlist, &(Part::TopoShapePy::Type), &pObjStock, &resolution))
+		return nullptr;
+	if (!(resolution > 0)) {
+		PyErr_SetString(PyExc_ValueError, "Resolution must be positive");
+		return nullptr;
+	}
+	PathSim *sim = getPathSimPtr();
+	Part::TopoShape *stock = static_cast<Part::TopoShapePy*>(pObjStock)->getTopoShapePtr();
+	sim->BeginDexelSimulation(stock, resolution);
+	Py_IncRef(Py_None);
+	return Py_None;
+}
+
+PyObject* PathSimPy::SetHolderShape(PyObject * args)
+{
+	float radius, length;
+	if (!PyArg_ParseTuple(args, "ff", &radius, &length))
+		return nullptr;
+	getPathSimPtr()->SetHolderShape(radius, length);
+	Py_IncRef(Py_None);
+	return Py_None;
+}
+
+PyObject* PathSimPy::ProcessMoves(PyObject * args)
+{
+	if (!PyArg_ParseTuple(args, ""))
+		return nullptr;
+	PathSim *sim = getPathSimPtr();
+	if (!sim->m_dexelStock)
+	{
+		PyErr_SetString(PyExc_RuntimeError, "No tri-dexel simulation started");
+		return nullptr;
+	}
+
+	Py::List list;
+	for (const auto& result : sim->ProcessMoves())
+	{
+		Py::Tuple tuple(5);
+		tuple.setItem(0, Py::Long(result.index));
+		tuple.setItem(1, Py::Float(result.volume));
+		tuple.setItem(2, Py::Float(result.rate));
+		tuple.setItem(3, Py::Boolean(result.rapidCollision));
+		tuple.setItem(4, Py::Boolean(result.holderCollision));
+		list.append(tuple);
+	}
+	return Py::new_reference_to(list);
+}
+
 Py::Object PathSimPy::getTool() const
 {
     //return Py::Object();
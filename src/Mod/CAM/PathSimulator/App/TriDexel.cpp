@@ -0,0 +1,625 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+#endif
+
+#include <Base/Exception.h>
+#include <Mod/Mesh/App/Core/Functional.h>
+
+#include "TriDexel.h"
+
+
+namespace
+{
+constexpr float DexelInfinity = std::numeric_limits<float>::max();
+
+// Removes the interval [a, b] from the sorted material intervals of a ray and
+// returns the removed length. The scratch vector is swapped with the ray.
+float SubtractInterval(std::vector<float>& ray, float a, float b, std::vector<float>& scratch)
+{
+    if (ray.empty() || b <= ray.front() || a >= ray.back()) {
+        return 0;
+    }
+
+    float removed = 0;
+    scratch.clear();
+    for (std::size_t i = 0; i + 1 < ray.size(); i += 2) {
+        float s = ray[i];
+        float e = ray[i + 1];
+        if (e <= a || s >= b) {
+            scratch.push_back(s);
+            scratch.push_back(e);
+            continue;
+        }
+        removed += std::min(e, b) - std::max(s, a);
+        if (s < a) {
+            scratch.push_back(s);
+            scratch.push_back(a);
+        }
+        if (e > b) {
+            scratch.push_back(b);
+            scratch.push_back(e);
+        }
+    }
+
+    if (removed > 0) {
+        ray.swap(scratch);
+    }
+    return removed;
+}
+
+bool IntersectsInterval(const std::vector<float>& ray, float a, float b)
+{
+    for (std::size_t i = 0; i + 1 < ray.size(); i += 2) {
+        if (ray[i] < b && ray[i + 1] > a) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Intersects the ray o + t * e_axis with the finite cylinder of radius r and
+// height h around the axis base + s * u, 0 <= s <= h.
+bool RayCylinder(const double o[3], int axis, const double base[3], const double u[3],
+                 double r, double h, float& t0, float& t1)
+{
+    double w[3] = {o[0] - base[0], o[1] - base[1], o[2] - base[2]};
+    double wu = w[0] * u[0] + w[1] * u[1] + w[2] * u[2];
+    double eu = u[axis];
+
+    double wp[3] = {w[0] - wu * u[0], w[1] - wu * u[1], w[2] - wu * u[2]};
+    double ep[3] = {-eu * u[0], -eu * u[1], -eu * u[2]};
+    ep[axis] += 1.0;
+
+    double a = ep[0] * ep[0] + ep[1] * ep[1] + ep[2] * ep[2];
+    double b = wp[0] * ep[0] + wp[1] * ep[1] + wp[2] * ep[2];
+    double c = wp[0] * wp[0] + wp[1] * wp[1] + wp[2] * wp[2] - r * r;
+
+    double lo = -DexelInfinity;
+    double hi = DexelInfinity;
+    if (a < 1e-12) {
+        if (c > 0) {
+            return false;
+        }
+    }
+    else {
+        double disc = b * b - a * c;
+        if (disc < 0) {
+            return false;
+        }
+        double sq = std::sqrt(disc);
+        lo = (-b - sq) / a;
+        hi = (-b + sq) / a;
+    }
+
+    if (std::fabs(eu) < 1e-12) {
+        if (wu < 0 || wu > h) {
+            return false;
+        }
+    }
+    else {
+        double s0 = -wu / eu;
+        double s1 = (h - wu) / eu;
+        if (s0 > s1) {
+            std::swap(s0, s1);
+        }
+        lo = std::max(lo, s0);
+        hi = std::min(hi, s1);
+    }
+
+    t0 = float(lo);
+    t1 = float(hi);
+    return t0 < t1;
+}
+}  // namespace
+
+//************************************************************************************************************
+// Tri-dexel tool
+//************************************************************************************************************
+
+cDexelTool::cDexelTool(const std::vector<toolShapePoint>& points, float radius, float length)
+    : profile(points)
+    , radius(radius)
+    , length(length)
+{
+    std::sort(profile.begin(), profile.end(), toolShapePoint::less_than());
+    if (profile.empty() || profile.front().radiusPos > 0) {
+        toolShapePoint tip;
+        tip.radiusPos = 0;
+        tip.heightPos = profile.empty() ? 0 : profile.front().heightPos;
+        profile.insert(profile.begin(), tip);
+    }
+    if (profile.back().radiusPos < radius) {
+        toolShapePoint outer = profile.back();
+        outer.radiusPos = radius;
+        profile.push_back(outer);
+    }
+
+    // material above the cutting surface is always removed, so the
+    // heights must not decrease to the outside
+    for (std::size_t i = 1; i < profile.size(); i++) {
+        profile[i].heightPos = std::max(profile[i].heightPos, profile[i - 1].heightPos);
+    }
+}
+
+cDexelTool::cDexelTool(const cSimTool& tool)
+    : cDexelTool(tool.m_toolShape, tool.radius, tool.length)
+{}
+
+float cDexelTool::HeightAt(float r) const
+{
+    if (r > radius) {
+        return DexelInfinity;
+    }
+
+    toolShapePoint test;
+    test.radiusPos = r;
+    auto it = std::lower_bound(profile.begin(), profile.end(), test, toolShapePoint::less_than());
+    if (it == profile.begin()) {
+        return it->heightPos;
+    }
+    if (it == profile.end()) {
+        return profile.back().heightPos;
+    }
+
+    auto prev = it - 1;
+    float dr = it->radiusPos - prev->radiusPos;
+    if (dr <= 0) {
+        return it->heightPos;
+    }
+    float t = (r - prev->radiusPos) / dr;
+    return prev->heightPos + t * (it->heightPos - prev->heightPos);
+}
+
+float cDexelTool::RadiusAt(float h) const
+{
+    if (h < profile.front().heightPos || h > length) {
+        return -1;
+    }
+
+    auto it = std::upper_bound(profile.begin(), profile.end(), h,
+                               [](float value, const toolShapePoint& pnt) {
+                                   return value < pnt.heightPos;
+                               });
+    if (it == profile.end()) {
+        return radius;
+    }
+
+    auto prev = it - 1;
+    float t = (h - prev->heightPos) / (it->heightPos - prev->heightPos);
+    return prev->radiusPos + t * (it->radiusPos - prev->radiusPos);
+}
+
+//************************************************************************************************************
+// Tri-dexel stock
+//************************************************************************************************************
+
+struct cDexelStock::Move
+{
+    std::shared_ptr<cDexelTool> tool;
+    Point3D p1, p2, cent;
+    float a1 = 0, a2 = 0;  // rotation around the X axis in degrees
+    float feed = 0;
+    float startAngle = 0;
+    float sweep = 0;  // arc angle, zero for linear moves
+    bool rapid = false;
+    int steps = 1;
+    double length = 0;
+    float box[6] = {};  // swept bounding box in stock coordinates
+};
+
+struct cDexelStock::Pose
+{
+    double tip[3];
+    double axis[3];
+    bool vertical;
+};
+
+cDexelStock::cDexelStock(float px, float py, float pz, float lx, float ly, float lz, float res)
+    : m_p {px, py, pz}
+    , m_l {lx, ly, lz}
+    , m_res(res)
+    , m_threads(std::max(1, int(std::thread::hardware_concurrency())))
+{
+    if (!(res > 0)) {
+        throw Base::ValueError("Dexel resolution must be positive");
+    }
+
+    const int axes[3][3] = {{0, 1, 2}, {1, 0, 2}, {2, 0, 1}};
+    for (int g = 0; g < 3; g++) {
+        Grid& grid = m_grid[g];
+        grid.axis = axes[g][0];
+        grid.uaxis = axes[g][1];
+        grid.vaxis = axes[g][2];
+        grid.nu = std::max(1, int(std::ceil(m_l[grid.uaxis] / res - 0.5f)));
+        grid.nv = std::max(1, int(std::ceil(m_l[grid.vaxis] / res - 0.5f)));
+
+        float lo = m_p[grid.axis];
+        float hi = m_p[grid.axis] + m_l[grid.axis];
+        grid.rays.resize(std::size_t(grid.nu) * grid.nv);
+        for (auto& ray : grid.rays) {
+            ray = {lo, hi};
+        }
+    }
+}
+
+cDexelStock::~cDexelStock() = default;
+
+void cDexelStock::SetTool(const cSimTool& tool)
+{
+    m_tool = std::make_shared<cDexelTool>(tool);
+    m_tool->holderRadius = m_holderRadius;
+    m_tool->holderLength = m_holderLength;
+}
+
+void cDexelStock::SetTool(const std::shared_ptr<cDexelTool>& tool)
+{
+    m_tool = tool;
+}
+
+void cDexelStock::SetHolder(float radius, float length)
+{
+    m_holderRadius = radius;
+    m_holderLength = length;
+    if (m_tool) {
+        // queued moves keep the holder they were added with
+        m_tool = std::make_shared<cDexelTool>(*m_tool);
+        m_tool->holderRadius = radius;
+        m_tool->holderLength = length;
+    }
+}
+
+void cDexelStock::AddLinearMove(const Point3D& p1, const Point3D& p2, bool rapid, float feed,
+                                float a1, float a2)
+{
+    if (!m_tool) {
+        return;
+    }
+
+    Move move;
+    move.tool = m_tool;
+    move.p1 = p1;
+    move.p2 = p2;
+    move.a1 = a1;
+    move.a2 = a2;
+    move.feed = feed;
+    move.rapid = rapid;
+    move.length = length(p2 - p1);
+    m_moves.push_back(move);
+}
+
+void cDexelStock::AddCircularMove(const Point3D& p1, const Point3D& p2, const Point3D& cent,
+                                  bool isCCW, float feed, float a1, float a2)
+{
+    if (!m_tool) {
+        return;
+    }
+
+    Move move;
+    move.tool = m_tool;
+    move.p1 = p1;
+    move.p2 = p2;
+    move.cent = cent;
+    move.a1 = a1;
+    move.a2 = a2;
+    move.feed = feed;
+
+    float angle1 = std::atan2(p1.y - cent.y, p1.x - cent.x);
+    float angle2 = std::atan2(p2.y - cent.y, p2.x - cent.x);
+    float sweep = angle2 - angle1;
+    if (isCCW && sweep <= 0) {
+        sweep += float(2 * M_PI);
+    }
+    else if (!isCCW && sweep >= 0) {
+        sweep -= float(2 * M_PI);
+    }
+    move.startAngle = angle1;
+    move.sweep = sweep;
+
+    float radius = std::hypot(p1.x - cent.x, p1.y - cent.y);
+    move.length = std::hypot(std::fabs(sweep) * radius, p2.z - p1.z);
+    m_moves.push_back(move);
+}
+
+cDexelStock::Pose cDexelStock::PoseAt(const Move& move, float s)
+{
+    double x, y, z;
+    if (move.sweep != 0) {
+        double r1 = std::hypot(move.p1.x - move.cent.x, move.p1.y - move.cent.y);
+        double r2 = std::hypot(move.p2.x - move.cent.x, move.p2.y - move.cent.y);
+        double r = r1 + (r2 - r1) * s;
+        double angle = move.startAngle + move.sweep * s;
+        x = move.cent.x + r * std::cos(angle);
+        y = move.cent.y + r * std::sin(angle);
+    }
+    else {
+        x = move.p1.x + (move.p2.x - move.p1.x) * s;
+        y = move.p1.y + (move.p2.y - move.p1.y) * s;
+    }
+    z = move.p1.z + (move.p2.z - move.p1.z) * s;
+
+    Pose pose;
+    if (move.a1 == 0 && move.a2 == 0) {
+        pose.tip[0] = x;
+        pose.tip[1] = y;
+        pose.tip[2] = z;
+        pose.axis[0] = 0;
+        pose.axis[1] = 0;
+        pose.axis[2] = 1;
+        pose.vertical = true;
+    }
+    else {
+        // the stock is rotated by A, so the tool is rotated by -A in stock coordinates
+        double angle = (move.a1 + (move.a2 - move.a1) * s) * M_PI / 180.0;
+        double sina = std::sin(angle);
+        double cosa = std::cos(angle);
+        pose.tip[0] = x;
+        pose.tip[1] = y * cosa + z * sina;
+        pose.tip[2] = -y * sina + z * cosa;
+        pose.axis[0] = 0;
+        pose.axis[1] = sina;
+        pose.axis[2] = cosa;
+        pose.vertical = std::fabs(sina) < 1e-9 && cosa > 0;
+    }
+    return pose;
+}
+
+void cDexelStock::PrepareMove(Move& move) const
+{
+    const cDexelTool& tool = *move.tool;
+    float reach = std::max(tool.radius, tool.holderLength > 0 ? tool.holderRadius : 0.0f);
+    float height = tool.length + tool.holderLength;
+
+    // the rotation moves points far from the X axis further than the tip
+    double travel = move.length;
+    if (move.a1 != move.a2) {
+        double dist = std::max(std::hypot(move.p1.y, move.p1.z), std::hypot(move.p2.y, move.p2.z));
+        travel += std::fabs(move.a2 - move.a1) * M_PI / 180.0 * (dist + height + reach);
+    }
+    move.steps = std::max(1, int(std::ceil(travel / (0.5 * m_res))));
+
+    for (int i = 0; i < 3; i++) {
+        move.box[i] = DexelInfinity;
+        move.box[i + 3] = -DexelInfinity;
+    }
+    for (int i = 0; i <= move.steps; i++) {
+        Pose pose = PoseAt(move, float(i) / float(move.steps));
+        for (int k = 0; k < 3; k++) {
+            double top = pose.tip[k] + pose.axis[k] * height;
+            move.box[k] = std::min(move.box[k], float(std::min(pose.tip[k], top)) - reach);
+            move.box[k + 3] = std::max(move.box[k + 3], float(std::max(pose.tip[k], top)) + reach);
+        }
+    }
+}
+
+void cDexelStock::ApplyPose(Grid& grid, const Tile& tile, const Pose& pose, const cDexelTool& tool,
+                            double& volume, bool& holder, std::vector<float>& scratch)
+{
+    const int a = grid.axis;
+    const int u = grid.uaxis;
+    const int v = grid.vaxis;
+    const bool checkHolder = a == 2 && tool.holderLength > 0;
+    const float reach = std::max(tool.radius, checkHolder ? tool.holderRadius : 0.0f);
+    const float height = tool.length + (checkHolder ? tool.holderLength : 0.0f);
+
+    float lo[3], hi[3];
+    for (int k = 0; k < 3; k++) {
+        double top = pose.tip[k] + pose.axis[k] * height;
+        lo[k] = float(std::min(pose.tip[k], top)) - reach;
+        hi[k] = float(std::max(pose.tip[k], top)) + reach;
+    }
+    if (hi[a] < m_p[a] || lo[a] > m_p[a] + m_l[a]) {
+        return;
+    }
+
+    // rays are in the middle of their cells
+    auto first = [this](float value, int axis) {
+        return int(std::ceil((value - m_p[axis]) / m_res - 0.5f));
+    };
+    auto last = [this](float value, int axis) {
+        return int(std::floor((value - m_p[axis]) / m_res - 0.5f));
+    };
+    int iu0 = std::max(tile.first, first(lo[u], u));
+    int iu1 = std::min(tile.last - 1, last(hi[u], u));
+    int iv0 = std::max(0, first(lo[v], v));
+    int iv1 = std::min(grid.nv - 1, last(hi[v], v));
+
+    for (int iu = iu0; iu <= iu1; iu++) {
+        for (int iv = iv0; iv <= iv1; iv++) {
+            auto& ray = grid.rays[std::size_t(iu) * grid.nv + iv];
+            if (ray.empty()) {
+                continue;
+            }
+
+            double o[3];
+            o[a] = 0;
+            o[u] = m_p[u] + (iu + 0.5) * m_res;
+            o[v] = m_p[v] + (iv + 0.5) * m_res;
+
+            float removed = 0;
+            if (pose.vertical) {
+                if (a == 2) {
+                    float d = float(std::hypot(o[0] - pose.tip[0], o[1] - pose.tip[1]));
+                    if (d <= tool.radius) {
+                        float bottom = float(pose.tip[2]) + tool.HeightAt(d);
+                        float top = float(pose.tip[2]) + tool.length;
+                        removed = SubtractInterval(ray, bottom, top, scratch);
+                    }
+                    if (checkHolder && d <= tool.holderRadius) {
+                        float bottom = float(pose.tip[2]) + tool.length;
+                        holder |= IntersectsInterval(ray, bottom, bottom + tool.holderLength);
+                    }
+                }
+                else {
+                    // the other grid direction is the width of the chord
+                    int w = u == 2 ? v : u;
+                    float r = tool.RadiusAt(float(o[2] - pose.tip[2]));
+                    float d = float(std::fabs(o[w] - pose.tip[w]));
+                    if (d <= r) {
+                        float chord = std::sqrt(r * r - d * d);
+                        float center = float(pose.tip[a]);
+                        removed = SubtractInterval(ray, center - chord, center + chord, scratch);
+                    }
+                }
+            }
+            else {
+                // staircase of cylinders along the tilted axis
+                for (const auto& step : tool.profile) {
+                    if (step.radiusPos <= 0) {
+                        continue;
+                    }
+                    double base[3];
+                    for (int k = 0; k < 3; k++) {
+                        base[k] = pose.tip[k] + pose.axis[k] * step.heightPos;
+                    }
+                    float t0, t1;
+                    if (RayCylinder(o, a, base, pose.axis, step.radiusPos,
+                                    tool.length - step.heightPos, t0, t1)) {
+                        removed += SubtractInterval(ray, t0, t1, scratch);
+                    }
+                }
+                if (checkHolder) {
+                    double base[3];
+                    for (int k = 0; k < 3; k++) {
+                        base[k] = pose.tip[k] + pose.axis[k] * tool.length;
+                    }
+                    float t0, t1;
+                    if (RayCylinder(o, a, base, pose.axis, tool.holderRadius, tool.holderLength,
+                                    t0, t1)) {
+                        holder |= IntersectsInterval(ray, t0, t1);
+                    }
+                }
+            }
+            volume += removed;
+        }
+    }
+}
+
+void cDexelStock::ProcessTile(const Tile& tile, std::vector<double>& volume,
+                              std::vector<char>& holder, std::vector<float>& scratch)
+{
+    Grid& grid = m_grid[tile.grid];
+    const int u = grid.uaxis;
+    const int v = grid.vaxis;
+    float u0 = m_p[u] + tile.first * m_res;
+    float u1 = m_p[u] + tile.last * m_res;
+    float v0 = m_p[v];
+    float v1 = m_p[v] + grid.nv * m_res;
+
+    for (std::size_t k = 0; k < m_moves.size(); k++) {
+        const Move& move = m_moves[k];
+        if (move.box[u + 3] < u0 || move.box[u] > u1 || move.box[v + 3] < v0 || move.box[v] > v1) {
+            continue;
+        }
+
+        double removed = 0;
+        bool collision = false;
+        for (int i = 0; i <= move.steps; i++) {
+            Pose pose = PoseAt(move, float(i) / float(move.steps));
+            ApplyPose(grid, tile, pose, *move.tool, removed, collision, scratch);
+        }
+
+        // the volume is measured with the Z rays only
+        if (grid.axis == 2) {
+            volume[k] += removed * m_res * m_res;
+            holder[k] |= collision;
+        }
+    }
+}
+
+std::vector<cDexelMoveResult> cDexelStock::Simulate()
+{
+    std::vector<cDexelMoveResult> results;
+    if (m_moves.empty()) {
+        return results;
+    }
+
+    MeshCore::parallel_for(
+        m_moves.size(),
+        [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                PrepareMove(m_moves[i]);
+            }
+        },
+        m_threads);
+
+    // several tiles per thread and grid to balance the load
+    std::vector<Tile> tiles;
+    for (int g = 0; g < 3; g++) {
+        int rows = std::max(1, m_grid[g].nu / (4 * m_threads));
+        for (int first = 0; first < m_grid[g].nu; first += rows) {
+            tiles.push_back({g, first, std::min(first + rows, m_grid[g].nu)});
+        }
+    }
+
+    std::size_t threads = std::size_t(m_threads);
+    std::vector<std::vector<double>> volume(threads, std::vector<double>(m_moves.size(), 0.0));
+    std::vector<std::vector<char>> holder(threads, std::vector<char>(m_moves.size(), 0));
+    MeshCore::parallel_for(
+        threads,
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<float> scratch;
+            for (std::size_t t = begin; t < end; t++) {
+                for (std::size_t i = t; i < tiles.size(); i += threads) {
+                    ProcessTile(tiles[i], volume[t], holder[t], scratch);
+                }
+            }
+        },
+        m_threads);
+
+    results.resize(m_moves.size());
+    for (std::size_t k = 0; k < m_moves.size(); k++) {
+        const Move& move = m_moves[k];
+        cDexelMoveResult& result = results[k];
+        result.index = m_moveCount++;
+        for (std::size_t t = 0; t < threads; t++) {
+            result.volume += volume[t][k];
+            result.holderCollision |= holder[t][k] != 0;
+        }
+        result.rapidCollision = move.rapid && result.volume > 0;
+        if (!move.rapid && move.feed > 0 && move.length > 0) {
+            result.rate = result.volume * move.feed / move.length;
+        }
+    }
+
+    m_moves.clear();
+    return results;
+}
+
+double cDexelStock::GetVolume() const
+{
+    double volume = 0;
+    for (const auto& ray : m_grid[2].rays) {
+        for (std::size_t i = 0; i + 1 < ray.size(); i += 2) {
+            volume += ray[i + 1] - ray[i];
+        }
+    }
+    return volume * m_res * m_res;
+}
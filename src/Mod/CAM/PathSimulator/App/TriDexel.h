@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef PATHSIMULATOR_TriDexel_H
+#define PATHSIMULATOR_TriDexel_H
+
+#include <memory>
+#include <vector>
+
+#include <Mod/CAM/PathGlobal.h>
+
+#include "VolSim.h"
+
+
+/**
+ * A tool for the tri-dexel simulation. The profile of a cSimTool is made
+ * monotone and then used as exact height profile for rays along the tool
+ * axis and as a staircase of cylinders for all other rays. The holder is
+ * a cylinder sitting on top of the tool.
+ */
+class PathSimulatorExport cDexelTool
+{
+public:
+    cDexelTool(const std::vector<toolShapePoint>& profile, float radius, float length);
+    explicit cDexelTool(const cSimTool& tool);
+
+    /// Height of the cutting surface above the tip at distance \a r from the axis
+    float HeightAt(float r) const;
+    /// Largest radius of the tool at height \a h above the tip, negative if there is none
+    float RadiusAt(float h) const;
+
+    std::vector<toolShapePoint> profile;
+    float radius;
+    float length;
+    float holderRadius = 0;
+    float holderLength = 0;
+};
+
+/// The simulation result of a single move
+struct cDexelMoveResult
+{
+    int index = 0;          // running index of the move
+    double volume = 0;      // removed material
+    double rate = 0;        // removed material per time unit of the programmed feed
+    bool rapidCollision = false;   // a rapid move touched the stock
+    bool holderCollision = false;  // the holder touched the stock
+};
+
+/**
+ * Tri-dexel stock model. The stock is sampled with three orthogonal grids
+ * of rays along X, Y and Z. Every ray keeps a sorted list of the material
+ * intervals it still passes through, so undercuts and 4-axis moves are
+ * represented correctly.
+ *
+ * Moves are queued with AddLinearMove() and AddCircularMove() and applied
+ * with Simulate(). The rays are split into tiles that are processed in
+ * parallel, every tile applies all moves in order. A move is sampled into
+ * tool positions at most half a ray spacing apart.
+ *
+ * 4-axis moves rotate the stock around the machine X axis by the A angle
+ * in degrees.
+ *
+ * The ray spacing \a res must be positive, otherwise Base::ValueError is thrown.
+ */
+class PathSimulatorExport cDexelStock
+{
+public:
+    cDexelStock(float px, float py, float pz, float lx, float ly, float lz, float res);
+    ~cDexelStock();
+
+    /// Sets the tool for all following moves
+    void SetTool(const cSimTool& tool);
+    void SetTool(const std::shared_ptr<cDexelTool>& tool);
+    /// Sets the holder dimensions for all following moves, a zero length disables the check
+    void SetHolder(float radius, float length);
+    /// Sets the number of threads to use. Default is the number of hardware threads.
+    void SetThreads(int num)
+    {
+        m_threads = num > 0 ? num : 1;
+    }
+
+    void AddLinearMove(const Point3D& p1, const Point3D& p2, bool rapid, float feed = 0,
+                       float a1 = 0, float a2 = 0);
+    void AddCircularMove(const Point3D& p1, const Point3D& p2, const Point3D& cent, bool isCCW,
+                         float feed = 0, float a1 = 0, float a2 = 0);
+    /// Applies all queued moves and returns their results in move order
+    std::vector<cDexelMoveResult> Simulate();
+
+    /// Volume of the remaining stock, measured with the Z rays
+    double GetVolume() const;
+    /// Material intervals of the Z ray at grid position \a i, \a j
+    const std::vector<float>& GetZDexel(int i, int j) const
+    {
+        return m_grid[2].rays[i * m_grid[2].nv + j];
+    }
+
+private:
+    struct Move;
+    struct Pose;
+    struct Grid
+    {
+        int axis = 0;      // ray direction
+        int uaxis = 0;     // first grid direction
+        int vaxis = 0;     // second grid direction
+        int nu = 0, nv = 0;
+        std::vector<std::vector<float>> rays;
+    };
+    struct Tile
+    {
+        int grid;
+        int first, last;   // range of rows in u direction
+    };
+
+    void PrepareMove(Move& move) const;
+    static Pose PoseAt(const Move& move, float s);
+    void ProcessTile(const Tile& tile, std::vector<double>& volume,
+                     std::vector<char>& holder, std::vector<float>& scratch);
+    void ApplyPose(Grid& grid, const Tile& tile, const Pose& pose, const cDexelTool& tool,
+                   double& volume, bool& holder, std::vector<float>& scratch);
+
+private:
+    float m_p[3];      // stock zero position
+    float m_l[3];      // stock dimensions
+    float m_res;       // ray spacing
+    int m_threads;
+    int m_moveCount = 0;
+    float m_holderRadius = 0;
+    float m_holderLength = 0;
+    Grid m_grid[3];
+    std::shared_ptr<cDexelTool> m_tool;
+    std::vector<Move> m_moves;
+};
+
+#endif  // PATHSIMULATOR_TriDexel_H
@@ -24,6 +24,8 @@
 
 import FreeCAD
 import Part
+import area
+import math
 import Path.Op.Adaptive as PathAdaptive
 import Path.Main.Job as PathJob
 from Tests.PathTestUtils import PathTestBase
@@ -414,6 +416,50 @@ class TestPathAdaptive(PathTestBase):
                 break
         self.assertTrue(isInBox, "No paths originating within the inner hole.")
 
+    def test08(self):
+        """test08() Verify that the number of threads does not change the tool paths."""
+
+        def rect(x, y, w, h):
+            return [(x, y), (x + w, y), (x + w, y + h), (x, y + h)]
+
+        def circle(cx, cy, r):
+            return [
+                (cx + r * math.cos(2 * math.pi * i / 64), cy + r * math.sin(2 * math.pi * i / 64))
+                for i in range(64)
+            ]
+
+        # several regions, one of them with a hole
+        paths = [
+            rect(0, 0, 30, 20),
+            rect(40, 0, 20, 30),
+            circle(80, 15, 10),
+            rect(0, 40, 50, 15),
+            circle(25, 47, 4),
+        ]
+        stockPaths = [rect(-5, -5, 110, 70)]
+
+        def execute(threads):
+            a2d = area.Adaptive2d()
+            a2d.stepOverFactor = 0.2
+            a2d.toolDiameter = 3.0
+            a2d.helixRampDiameter = 2.0
+            a2d.tolerance = 0.1
+            a2d.forceInsideOut = False
+            a2d.opType = area.AdaptiveOperationType.ClearingInside
+            a2d.threads = threads
+            results = a2d.Execute(stockPaths, paths, lambda progress: False)
+            return [
+                (r.HelixCenterPoint, r.StartPoint, r.ReturnMotionType, r.AdaptivePaths)
+                for r in results
+            ]
+
+        serial = execute(1)
+        self.assertEqual(len(serial), 4, "Not every region was processed.")
+        for threads in [2, 4, 8]:
+            self.assertEqual(
+                serial, execute(threads), "Tool paths differ with {} threads.".format(threads)
+            )
+
 
 # Eclass
 
@@ -130,6 +130,32 @@ G0 Z0.500000
         p.setFromGCode(lines)
         self.assertEqual(p.toGCode(), output)
 
+    def test20(self):
+        """Test Path gcode parsing and command editing"""
+        gcode = """(header comment)
+G20
+g1 x1 y2 f10 x3
+G21
+G2 I1 J0 X2 Y0
+M30
+"""
+        p = Path.Path(gcode)
+        self.assertEqual(p.Size, 4)
+        self.assertEqual(p.Commands[0].Name, "(header comment)")
+        self.assertEqual(str(p.Commands[1]), "Command G1 [ F:254 X:76.2 Y:50.8 ]")
+        self.assertEqual(str(p.Commands[2]), "Command G2 [ I:1 J:0 X:2 Y:0 ]")
+        self.assertEqual(p.Commands[3].Name, "M30")
+
+        p.insertCommand(Path.Command("G0", {"Z": 5}), 1)
+        p.deleteCommand(0)
+        self.assertEqual(
+            [c.Name for c in p.Commands], ["G0", "G1", "G2", "M30"]
+        )
+        self.assertEqual(str(p.Commands[0]), "Command G0 [ Z:5 ]")
+
+        # a copy keeps all commands
+        self.assertEqual(Path.Path(p.Commands).toGCode(), p.toGCode())
+
     def test50(self):
         """Test Path.Length calculation"""
         commands = []
@@ -26,6 +26,13 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
 
 namespace ClipperLib
 {
@@ -866,6 +873,76 @@ void ConnectPaths(Paths input, Paths &output)
 		output.push_back(joined);
 }
 
+// runs func(block, begin, end) for contiguous blocks of [0,count), one block per thread
+template <typename Func>
+void ParallelBlocks(size_t count, size_t threads, Func func)
+{
+	threads = max<size_t>(1, min(threads, count));
+	size_t blockSize = (count + threads - 1) / threads;
+	vector<future<void>> tasks;
+	for (size_t block = 1; block < threads; block++)
+	{
+		size_t begin = block * blockSize;
+		size_t end = min(count, begin + blockSize);
+		if (begin < end)
+			tasks.push_back(async(launch::async, func, block, begin, end));
+	}
+	func(size_t(0), size_t(0), min(count, blockSize));
+	for (auto &task : tasks)
+		task.get();
+}
+
+// collects the progress of regions processed by worker threads, the callback is called from the thread running Execute
+class ProgressQueue
+{
+  public:
+	ProgressQueue(size_t p_workers)
+	{
+		workers = p_workers;
+	}
+	// returns true if processing should stop
+	bool Post(const TPaths &progressPaths)
+	{
+		lock_guard<mutex> lock(mtx);
+		paths.insert(paths.end(), progressPaths.begin(), progressPaths.end());
+		return stop;
+	}
+	void WorkerFinished()
+	{
+		lock_guard<mutex> lock(mtx);
+		workers--;
+		cond.notify_one();
+	}
+	// reports the posted progress until all workers are finished, returns true if processing was stopped
+	bool Run(std::function<bool(TPaths)> *progressCallback, chrono::milliseconds interval)
+	{
+		unique_lock<mutex> lock(mtx);
+		for (;;)
+		{
+			cond.wait_for(lock, interval, [this]() { return workers == 0; });
+			if (!paths.empty())
+			{
+				TPaths toReport;
+				toReport.swap(paths);
+				lock.unlock();
+				bool stopRequested = progressCallback && (*progressCallback)(toReport);
+				lock.lock();
+				if (stopRequested)
+					stop = true;
+			}
+			else if (workers == 0)
+				return stop;
+		}
+	}
+
+  private:
+	mutex mtx;
+	condition_variable cond;
+	TPaths paths;
+	size_t workers;
+	bool stop = false;
+};
+
 // helper class for measuring performance
 class PerfCounter
 {
@@ -1017,24 +1094,31 @@ class ClearedArea
 	}
 
 	// get cleared area/poly bounded to toolbox
+	// the focus is a cell of a fixed grid, so the result only depends on the tool position and not on
+	// the previous calls - the parallel engage point search then gives the same areas as the sequential one
 	Paths &GetBoundedClearedAreaClipped(const IntPoint &toolPos)
 	{
-		BoundBox toolBB(toolPos, toolRadiusScaled);
-		if (!bboxClippedInvalid && clearedBBClippedInFocus.Contains(toolBB))
+		ClipperLib::cInt cell = focusCellFactor * toolRadiusScaled;
+		auto cellCenter = [cell](ClipperLib::cInt value) {
+			ClipperLib::cInt index = value / cell;
+			if (value % cell < 0)
+				index--;
+			return index * cell + cell / 2;
+		};
+		IntPoint center(cellCenter(toolPos.X), cellCenter(toolPos.Y));
+		if (!bboxClippedInvalid && clearedClippedFocus == center)
 		{
 			return clearedBoundedClipped;
 		}
-		ClipperLib::cInt delta = focusBBFactor1 * toolRadiusScaled;
-		clearedBBClippedInFocus.SetFirstPoint(IntPoint(toolPos.X - delta, toolPos.Y - delta));
-		clearedBBClippedInFocus.AddPoint(IntPoint(toolPos.X + delta, toolPos.Y + delta));
+		clearedClippedFocus = center;
 
-		// a little larger area is bounded than checked
+		// a little larger area is bounded than the cell and the tool
 		ClipperLib::cInt delta2 = focusBBFactor2 * toolRadiusScaled;
 		Path bbPath;
-		bbPath.push_back(IntPoint(toolPos.X - delta2, toolPos.Y - delta2));
-		bbPath.push_back(IntPoint(toolPos.X + delta2, toolPos.Y - delta2));
-		bbPath.push_back(IntPoint(toolPos.X + delta2, toolPos.Y + delta2));
-		bbPath.push_back(IntPoint(toolPos.X - delta2, toolPos.Y + delta2));
+		bbPath.push_back(IntPoint(center.X - delta2, center.Y - delta2));
+		bbPath.push_back(IntPoint(center.X + delta2, center.Y - delta2));
+		bbPath.push_back(IntPoint(center.X + delta2, center.Y + delta2));
+		bbPath.push_back(IntPoint(center.X - delta2, center.Y + delta2));
 		clip.Clear();
 		clip.AddPath(bbPath, PolyType::ptSubject, true);
 		clip.AddPaths(clearedPaths, PolyType::ptClip, true);
@@ -1057,14 +1141,15 @@ class ClearedArea
 	Paths clearedBoundedPaths;
 
 	ClipperLib::cInt toolRadiusScaled;
-	BoundBox clearedBBClippedInFocus;
+	IntPoint clearedClippedFocus;
 	BoundBox clearedBBPathsInFocus;
 
-	bool bboxClippedInvalid = false;
+	bool bboxClippedInvalid = true;
 	bool bboxPathsInvalid = false;
 	// size of the focus BB
 	const ClipperLib::cInt focusBBFactor1 = 8;
 	const ClipperLib::cInt focusBBFactor2 = 9;
+	const ClipperLib::cInt focusCellFactor = 12; // the tool box stays inside of focusBBFactor2
 };
 
 //***************************************
@@ -1135,7 +1220,8 @@ class Interpolation
 
 	double getRandomAngle()
 	{
-		return MIN_ANGLE + (MAX_ANGLE - MIN_ANGLE) * double(rand()) / double(RAND_MAX);
+		// own generator - keeps the result independent of other regions processed in parallel
+		return MIN_ANGLE + (MAX_ANGLE - MIN_ANGLE) * double(generator() - generator.min()) / double(generator.max() - generator.min());
 	}
 	size_t getPointCount()
 	{
@@ -1145,6 +1231,7 @@ class Interpolation
   private:
 	vector<double> angles;
 	vector<double> areas;
+	minstd_rand generator;
 };
 
 //***************************************
@@ -1254,6 +1341,8 @@ class EngagePoint
 	}
 	bool nextEngagePoint(Adaptive2d *parent, ClearedArea &clearedArea, double step, double minCutArea, double maxCutArea, int maxPases = 2)
 	{
+		if (parent->threads > 1)
+			return nextEngagePointBatched(parent, clearedArea, step, minCutArea, maxCutArea, maxPases);
 		Perf_NextEngagePoint.Start();
 		double prevArea = 0; // we want to make sure that we catch the point where the area is on raising slope
 		IntPoint initialPoint(-1000000000, -1000000000);
@@ -1282,6 +1371,84 @@ class EngagePoint
 			prevArea = area;
 		}
 	}
+
+	// same as nextEngagePoint, but the candidate points are stepped ahead in batches
+	// and their cut areas are calculated in parallel
+	bool nextEngagePointBatched(Adaptive2d *parent, ClearedArea &clearedArea, double step, double minCutArea, double maxCutArea, int maxPases)
+	{
+		Perf_NextEngagePoint.Start();
+		size_t threads = size_t(parent->threads);
+		size_t batchSize = threads * parent->ENGAGE_BATCH_PER_THREAD;
+		while (workers.size() < threads)
+			workers.emplace_back(new Worker(parent->toolRadiusScaled));
+		for (size_t i = 0; i < threads; i++)
+			workers[i]->cleared.SetClearedPaths(clearedArea.GetCleared());
+
+		double prevArea = 0; // we want to make sure that we catch the point where the area is on raising slope
+		IntPoint initialPoint(-1000000000, -1000000000);
+		vector<EngageState> states;
+		vector<IntPoint> points;
+		vector<bool> areaResets;
+		vector<double> areas;
+		for (;;)
+		{
+			// step ahead sequentially - the stepping is cheap compared to the area calculation
+			states.clear();
+			points.clear();
+			areaResets.clear();
+			bool finished = false;
+			bool resetArea = false;
+			while (points.size() < batchSize)
+			{
+				if (!moveForward(step))
+				{
+					if (!nextPath())
+					{
+						state.passes++;
+						if (state.passes >= maxPases)
+						{
+							finished = true;
+							break;
+						}
+						resetArea = true;
+					}
+				}
+				states.push_back(state);
+				points.push_back(getCurrentPoint());
+				areaResets.push_back(resetArea);
+				resetArea = false;
+			}
+			EngageState lastState = state;
+
+			areas.resize(points.size());
+			ParallelBlocks(points.size(), threads, [&](size_t block, size_t begin, size_t end) {
+				Worker &worker = *workers[block];
+				for (size_t i = begin; i < end; i++)
+					areas[i] = parent->CalcCutArea(worker.clip, initialPoint, points[i], worker.cleared);
+			});
+
+			// first candidate in order wins - as in the sequential search
+			for (size_t i = 0; i < points.size(); i++)
+			{
+				if (areaResets[i])
+					prevArea = 0;
+				if (areas[i] > minCutArea && areas[i] < maxCutArea && areas[i] > prevArea)
+				{
+					state = states[i];
+					Perf_NextEngagePoint.Stop();
+					return true;
+				}
+				prevArea = areas[i];
+			}
+			if (finished)
+			{
+				state = lastState;
+				Perf_NextEngagePoint.Stop();
+				return false; // nothing more to cut
+			}
+		}
+	}
+
 	IntPoint getCurrentPoint()
 	{
 		const Path *pth = &toolBoundPaths.at(state.currentPathIndex);
@@ -1339,9 +1506,21 @@ class EngagePoint
 	}
 
   private:
+	// per thread data of the batched search
+	struct Worker
+	{
+		Worker(ClipperLib::cInt toolRadiusScaled)
+			: cleared(toolRadiusScaled)
+		{
+		}
+		Clipper clip;
+		ClearedArea cleared;
+	};
+
 	Paths toolBoundPaths;
 	EngageState state;
 	Clipper clip;
+	vector<unique_ptr<Worker>> workers;
 	void calculateCurrentPathLength()
 	{
 		const Path *pth = &toolBoundPaths.at(state.currentPathIndex);
@@ -1370,6 +1549,7 @@ class EngagePoint
 
 Adaptive2d::Adaptive2d()
 {
+	threads = max(1, int(std::thread::hardware_concurrency()));
 }
 
 double Adaptive2d::CalcCutArea(Clipper &clip, const IntPoint &c1, const IntPoint &c2, ClearedArea &clearedArea, bool preventConventional)
@@ -1710,6 +1890,12 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths &stockPaths, const DP
 		scaleFactor = maxScaleFactor;
 	//scaleFactor = round(scaleFactor);
 
+	if (threads < 1)
+		threads = 1;
+#ifdef DEV_MODE
+	threads = 1; // perf counters are not thread safe
+#endif
+
 	current_region=0;
 	cout << "Tool Diameter: " << toolDiameter << endl;
 	cout << "Accuracy: " << round(10000.0/scaleFactor)/10 << " um" << endl;
@@ -1718,7 +1904,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths &stockPaths, const DP
 	toolRadiusScaled = long(toolDiameter * scaleFactor / 2);
 	stepOverScaled = toolRadiusScaled * stepOverFactor;
 	progressCallback = &progressCallbackFn;
-	lastProgressTime = clock();
+	lastProgressTime = chrono::steady_clock::now();
 	stopProcessing = false;
 
 	if(helixRampDiameter<NTOL)
@@ -1801,6 +1987,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths &stockPaths, const DP
 	//	Resolve hierarchy and run processing
 	//***************************************
 	double cornerRoundingOffset = 0.15 * toolRadiusScaled / 2;
+	vector<pair<Paths, Paths>> regions; // bound paths and tool bound paths of independent regions
 	if (opType == OperationType::otClearingInside || opType == OperationType::otClearingOutside)
 	{
 
@@ -1853,7 +2040,7 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths &stockPaths, const DP
 				clipof.Clear();
 				clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
 				clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
-				ProcessPolyNode(boundPaths, toolBoundPaths);
+				regions.emplace_back(boundPaths, toolBoundPaths);
 			}
 		}
 	}
@@ -1912,14 +2099,67 @@ std::list<AdaptiveOutput> Adaptive2d::Execute(const DPaths &stockPaths, const DP
 					clipof.AddPaths(toolBoundPaths, JoinType::jtRound, EndType::etClosedPolygon);
 					clipof.Execute(boundPaths, toolRadiusScaled + finishPassOffsetScaled);
 
-					ProcessPolyNode(boundPaths, toolBoundPaths);
+					regions.emplace_back(boundPaths, toolBoundPaths);
 				}
 			}
 		}
 	}
+	ProcessRegions(regions);
 	return results;
 }
 
+void Adaptive2d::ProcessRegions(vector<pair<Paths, Paths>> &regions)
+{
+	size_t workerCount = min(size_t(threads), regions.size());
+	if (workerCount < 2)
+	{
+		for (auto &region : regions)
+			ProcessPolyNode(region.first, region.second);
+		return;
+	}
+
+	// each worker is a copy of this instance and processes whole regions,
+	// the remaining threads are left to the engage point search inside of the regions
+	ProgressQueue queue(workerCount);
+	vector<Adaptive2d> workers(workerCount, *this);
+	vector<list<AdaptiveOutput>> regionResults(regions.size());
+	atomic<size_t> nextRegion(0);
+	vector<future<void>> tasks;
+	for (auto &worker : workers)
+	{
+		worker.progressQueue = &queue;
+		worker.threads = max(1, threads / int(workerCount));
+		tasks.push_back(async(launch::async, [&worker, &queue, &regions, &regionResults, &nextRegion]() {
+			struct Finished
+			{
+				ProgressQueue &queue;
+				~Finished()
+				{
+					queue.WorkerFinished();
+				}
+			} finished{queue};
+			while (!worker.stopProcessing)
+			{
+				size_t index = nextRegion++;
+				if (index >= regions.size())
+					break;
+				worker.current_region = int(index);
+				worker.results.clear();
+				worker.ProcessPolyNode(regions[index].first, regions[index].second);
+				regionResults[index].swap(worker.results);
+			}
+		}));
+	}
+
+	if (queue.Run(progressCallback, PROGRESS_INTERVAL))
+		stopProcessing = true;
+	for (auto &task : tasks)
+		task.get();
+	// keep the order of the sequential processing
+	for (auto &output : regionResults)
+		results.splice(results.end(), output);
+}
+
 bool Adaptive2d::FindEntryPoint(TPaths &progressPaths, const Paths &toolBoundPaths, const Paths &boundPaths,
 								ClearedArea &clearedArea /*output-initial cleared area by helix*/,
 								IntPoint &entryPoint /*output*/,
@@ -2191,16 +2431,17 @@ bool Adaptive2d::ResolveLinkPath(const IntPoint &startPoint, const IntPoint &end
 	size_t sindex;
 	double par;
 
-	// put a time limit on the resolving the link path
-	clock_t time_limit = (clock_t)(max(keepToolDownDistRatio, 3.0) * CLOCKS_PER_SEC / 6);
+	// put a time limit on the resolving the link path, measured in wall time as
+	// the CPU time of the process grows faster when regions are processed in parallel
+	auto time_limit = chrono::duration<double>(max(keepToolDownDistRatio, 3.0) / 6);
 
-	clock_t time_out = clock() + time_limit;
+	auto time_out = chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(time_limit);
 
 	while (!queue.empty())
 	{
 		if (stopProcessing)
 			return false;
-		if (clock() > time_out)
+		if (chrono::steady_clock::now() > time_out)
 		{
 			cout << "Unable to resolve tool down linking path (limit reached)." << endl;
 			return false;
@@ -2574,12 +2815,18 @@ void Adaptive2d::AppendToolPath(TPaths &progressPaths, AdaptiveOutput &output,
 
 void Adaptive2d::CheckReportProgress(TPaths &progressPaths, bool force)
 {
-	if (!force && (clock() - lastProgressTime < PROGRESS_TICKS))
+	auto now = chrono::steady_clock::now();
+	if (!force && (now - lastProgressTime < PROGRESS_INTERVAL))
 		return; // not yet
-	lastProgressTime = clock();
+	lastProgressTime = now;
 	if (progressPaths.empty())
 		return;
-	if (progressCallback)
+	if (progressQueue)
+	{
+		if (progressQueue->Post(progressPaths))
+			stopProcessing = true; // reported from the thread running Execute
+	}
+	else if (progressCallback)
 		if ((*progressCallback)(progressPaths))
 			stopProcessing = true; // call python function, if returns true signal stop processing
 	// clean the paths - keep the last point
@@ -2626,7 +2873,6 @@ void Adaptive2d::ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths)
 {
 	Perf_ProcessPolyNode.Start();
 	current_region++;
-	cout << "** Processing region: " << current_region << endl;
 
 	// node paths are already constrained to tool boundary path for adaptive path before finishing pass
 	Clipper clip;
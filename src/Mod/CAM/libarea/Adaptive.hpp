@@ -23,6 +23,7 @@
 #include "clipper.hpp"
 #include <vector>
 #include <list>
+#include <chrono>
 #include <time.h>
 
 #ifndef ADAPTIVE_HPP
@@ -81,12 +82,15 @@ struct AdaptiveOutput
 	int ReturnMotionType; // MotionType enum, problem with serialization if enum is used
 };
 
-// used to isolate state -> enable potential adding of multi-threaded processing of separate regions
+class ProgressQueue;
+
+// used to isolate state -> separate regions are processed by copies of this instance in parallel
 
 class Adaptive2d
 {
   public:
 	Adaptive2d();
+	int threads; // number of threads used for processing of regions and engage point search, defaults to hardware concurrency
 	double toolDiameter = 5;
 	double helixRampDiameter = 0;
 	double stepOverFactor = 0.2;
@@ -120,11 +124,13 @@ class Adaptive2d
 	double optimalCutAreaPD = 0;
 	bool stopProcessing = false;
 	int current_region=0;
-	clock_t lastProgressTime = 0;
+	std::chrono::steady_clock::time_point lastProgressTime;
 
 	std::function<bool(TPaths)> *progressCallback = NULL;
+	ProgressQueue *progressQueue = NULL; // set for region workers, progress is then reported through the calling thread
 	Path toolGeometry; // tool geometry at coord 0,0, should not be modified
 
+	void ProcessRegions(std::vector<std::pair<Paths, Paths>> &regions);
 	void ProcessPolyNode(Paths boundPaths, Paths toolBoundPaths);
 	bool FindEntryPoint(TPaths &progressPaths, const Paths &toolBoundPaths, const Paths &bound, ClearedArea &cleared /*output*/,
 						IntPoint &entryPoint /*output*/, IntPoint &toolPos, DoublePoint &toolDir);
@@ -158,13 +164,14 @@ class Adaptive2d
 	const double MIN_CUT_AREA_FACTOR = 0.1;// used for filtering out of insignificant cuts (should be < ENGAGE_AREA_THR_FACTOR)
 	const double ENGAGE_AREA_THR_FACTOR = 0.5;		// influences minimal engage area
 	const double ENGAGE_SCAN_DISTANCE_FACTOR = 0.2; // influences the engage scan/stepping distance
+	const size_t ENGAGE_BATCH_PER_THREAD = 4;		// engage point candidates evaluated per thread at once
 
 	const double CLEAN_PATH_TOLERANCE = 1.41; // should be >1
 	const double FINISHING_CLEAN_PATH_TOLERANCE = 1.41; // should be >1
 
 	const long PASSES_LIMIT = __LONG_MAX__;			   // limit used while debugging
 	const long POINTS_PER_PASS_LIMIT = __LONG_MAX__;   // limit used while debugging
-	const clock_t PROGRESS_TICKS = CLOCKS_PER_SEC / 10; // progress report interval
+	const std::chrono::milliseconds PROGRESS_INTERVAL = std::chrono::milliseconds(100); // progress report interval (wall time)
 };
 } // namespace AdaptivePath
 #endif
\ No newline at end of file
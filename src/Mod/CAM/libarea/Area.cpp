@@ -22,6 +22,7 @@ double CArea::m_MakeOffsets_increment = 0.0;
 double CArea::m_split_processing_length = 0.0;
 bool CArea::m_set_processing_length_in_split = false;
 double CArea::m_after_MakeOffsets_length = 0.0;
+short CArea::m_polygon_engine = ClipperPolygonEngine;
 //static const double PI = 3.1415926535897932;
 
 #define _CAREA_PARAM_DEFINE(_class,_type,_name) \
@@ -41,6 +42,7 @@ CAREA_PARAM_DEFINE(double,units)
 CAREA_PARAM_DEFINE(short,min_arc_points)
 CAREA_PARAM_DEFINE(short,max_arc_points)
 CAREA_PARAM_DEFINE(double,clipper_scale)
+CAREA_PARAM_DEFINE(short,polygon_engine)
 
 void CArea::append(const CCurve& curve)
 {
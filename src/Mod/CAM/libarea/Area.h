@@ -17,6 +17,13 @@ enum PocketMode
 	ZigZagThenSingleOffsetPocketMode,
 };
 
+// engine used for the polygon booleans and offsets
+enum PolygonEngine
+{
+	ClipperPolygonEngine, // ClipperLib
+	SweepPolygonEngine, // PolySweep, for A/B comparison
+};
+
 struct CAreaPocketParams
 {
 	double tool_radius;
@@ -57,6 +64,7 @@ public:
 	static bool m_set_processing_length_in_split;
 	static bool m_please_abort; // the user sets this from another thread, to tell MakeOnePocketCurve to finish with no result.
     static double m_clipper_scale;
+	static short m_polygon_engine; // a PolygonEngine
 
 	void append(const CCurve& curve);
 	void move(CCurve&& curve);
@@ -103,6 +111,7 @@ public:
     CAREA_PARAM_DECLARE(short,min_arc_points)
     CAREA_PARAM_DECLARE(short,max_arc_points)
     CAREA_PARAM_DECLARE(double,clipper_scale)
+    CAREA_PARAM_DECLARE(short,polygon_engine)
 
     // Following functions is add to operate on possible open curves
 	void PopulateClipper(ClipperLib::Clipper &c, ClipperLib::PolyType type) const;
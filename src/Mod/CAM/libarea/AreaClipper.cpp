@@ -4,6 +4,7 @@
 
 #include "Area.h"
 #include "clipper.hpp"
+#include "PolySweep.h"
 using namespace ClipperLib;
 
 #define TPolygon Path
@@ -26,6 +27,22 @@ public:
 
 static std::list<DoubleAreaPoint> pts_for_AddVertex;
 
+// boolean operation of closed polygons with the engine selected by CArea::m_polygon_engine
+static void Execute(ClipType op, const TPolyPolygon &subject, const TPolyPolygon &clip, TPolyPolygon &solution,
+	PolyFillType subjFillType = pftEvenOdd, PolyFillType clipFillType = pftEvenOdd)
+{
+	if(CArea::m_polygon_engine == SweepPolygonEngine)
+	{
+		PolySweep::Execute(op, subject, clip, solution, subjFillType, clipFillType);
+		return;
+	}
+	Clipper c;
+	c.StrictlySimple(CArea::m_clipper_simple);
+	c.AddPaths(subject, ptSubject, true);
+	c.AddPaths(clip, ptClip, true);
+	c.Execute(op, solution, subjFillType, clipFillType);
+}
+
 static void AddPoint(const DoubleAreaPoint& p)
 {
 	pts_for_AddVertex.push_back(p);
@@ -138,8 +155,7 @@ static void MakeLoop(const DoubleAreaPoint &pt0, const DoubleAreaPoint &pt1, con
 
 static void OffsetWithLoops(const TPolyPolygon &pp, TPolyPolygon &pp_new, double inwards_value)
 {
-	Clipper c;
-    c.StrictlySimple(CArea::m_clipper_simple);
+	TPolyPolygon loops;
 
 	bool inwards = (inwards_value > 0);
 	bool reverse = false;
@@ -153,7 +169,7 @@ static void OffsetWithLoops(const TPolyPolygon &pp, TPolyPolygon &pp_new, double
 		p.push_back(DoubleAreaPoint(-10000.0, 10000.0).int_point());
 		p.push_back(DoubleAreaPoint(10000.0, 10000.0).int_point());
 		p.push_back(DoubleAreaPoint(10000.0, -10000.0).int_point());
-		c.AddPath(p, ptSubject, true);
+		loops.push_back(p);
 	}
 	else
 	{
@@ -187,13 +203,13 @@ static void OffsetWithLoops(const TPolyPolygon &pp, TPolyPolygon &pp_new, double
 			{
 				loopy_polygon.push_back(It->int_point());
 			}
-			c.AddPath(loopy_polygon, ptSubject, true);
+			loops.push_back(loopy_polygon);
 			pts_for_AddVertex.clear();
 		}
 	}
 
 	//c.ForceOrientation(false);
-	c.Execute(ctUnion, pp_new, pftNonZero, pftNonZero);
+	Execute(ctUnion, loops, TPolyPolygon(), pp_new, pftNonZero, pftNonZero);
 
 	if(inwards)
 	{
@@ -251,14 +267,12 @@ static void MakeObround(const Point &pt0, const CVertex &vt1, double radius)
 
 static void OffsetSpansWithObrounds(const CArea& area, TPolyPolygon &pp_new, double radius)
 {
-	Clipper c;
-	c.StrictlySimple(CArea::m_clipper_simple);
+	TPolyPolygon loops;
 	pp_new.clear();
 
 	for(std::list<CCurve>::const_iterator It = area.m_curves.begin(); It != area.m_curves.end(); It++)
 	{
-		c.Clear();
-		c.AddPaths(pp_new, ptSubject, true);
+		loops.swap(pp_new);
 		pp_new.clear();
 		pts_for_AddVertex.clear();
 
@@ -277,12 +291,12 @@ static void OffsetSpansWithObrounds(const CArea& area, TPolyPolygon &pp_new, dou
 				{
 					loopy_polygon.push_back(It->int_point());
 				}
-				c.AddPath(loopy_polygon, ptSubject, true);
+				loops.push_back(loopy_polygon);
 				pts_for_AddVertex.clear();
 			}
 			prev_vertex = &vertex;
 		}
-		c.Execute(ctUnion, pp_new, pftNonZero, pftNonZero);
+		Execute(ctUnion, loops, TPolyPolygon(), pp_new, pftNonZero, pftNonZero);
 	}
 
 
@@ -386,52 +400,37 @@ static void SetFromResult( CArea& area, TPolyPolygon& pp, bool reverse=true, boo
 
 void CArea::Subtract(const CArea& a2)
 {
-	Clipper c;
-    c.StrictlySimple(CArea::m_clipper_simple);
 	TPolyPolygon pp1, pp2;
 	MakePolyPoly(*this, pp1);
 	MakePolyPoly(a2, pp2);
-	c.AddPaths(pp1, ptSubject, true);
-	c.AddPaths(pp2, ptClip, true);
 	TPolyPolygon solution;
-	c.Execute(ctDifference, solution);
+	Execute(ctDifference, pp1, pp2, solution);
 	SetFromResult(*this, solution);
 }
 
 void CArea::Intersect(const CArea& a2)
 {
-	Clipper c;
-    c.StrictlySimple(CArea::m_clipper_simple);
 	TPolyPolygon pp1, pp2;
 	MakePolyPoly(*this, pp1);
 	MakePolyPoly(a2, pp2);
-	c.AddPaths(pp1, ptSubject, true);
-	c.AddPaths(pp2, ptClip, true);
 	TPolyPolygon solution;
-	c.Execute(ctIntersection, solution);
+	Execute(ctIntersection, pp1, pp2, solution);
 	SetFromResult(*this, solution);
 }
 
 void CArea::Union(const CArea& a2)
 {
-	Clipper c;
-    c.StrictlySimple(CArea::m_clipper_simple);
 	TPolyPolygon pp1, pp2;
 	MakePolyPoly(*this, pp1);
 	MakePolyPoly(a2, pp2);
-	c.AddPaths(pp1, ptSubject, true);
-	c.AddPaths(pp2, ptClip, true);
 	TPolyPolygon solution;
-	c.Execute(ctUnion, solution);
+	Execute(ctUnion, pp1, pp2, solution);
 	SetFromResult(*this, solution);
 }
 
 // static
 CArea CArea::UniteCurves(std::list<CCurve> &curves)
 {
-	Clipper c;
-    c.StrictlySimple(CArea::m_clipper_simple);
-
 	TPolyPolygon pp;
 
 	for (std::list<CCurve>::iterator It = curves.begin(); It != curves.end(); It++)
@@ -442,9 +441,8 @@ CArea CArea::UniteCurves(std::list<CCurve> &curves)
 		pp.push_back(p);
 	}
 
-	c.AddPaths(pp, ptSubject, true);
 	TPolyPolygon solution;
-	c.Execute(ctUnion, solution, pftNonZero, pftNonZero);
+	Execute(ctUnion, pp, TPolyPolygon(), solution, pftNonZero, pftNonZero);
 	CArea area;
 	SetFromResult(area, solution);
 	return area;
@@ -452,15 +450,11 @@ CArea CArea::UniteCurves(std::list<CCurve> &curves)
 
 void CArea::Xor(const CArea& a2)
 {
-	Clipper c;
-    c.StrictlySimple(CArea::m_clipper_simple);
 	TPolyPolygon pp1, pp2;
 	MakePolyPoly(*this, pp1);
 	MakePolyPoly(a2, pp2);
-	c.AddPaths(pp1, ptSubject, true);
-	c.AddPaths(pp2, ptClip, true);
 	TPolyPolygon solution;
-	c.Execute(ctXor, solution);
+	Execute(ctXor, pp1, pp2, solution);
 	SetFromResult(*this, solution);
 }
 
@@ -498,6 +492,28 @@ void CArea::Clip(ClipType op, const CArea *a,
                  PolyFillType subjFillType,
                  PolyFillType clipFillType)
 {
+	if(m_polygon_engine == SweepPolygonEngine)
+	{
+		// open wires are only supported by Clipper
+		bool closed = true;
+		for(const CCurve &curve : m_curves)
+			closed = closed && curve.IsClosed();
+		if(a)
+		{
+			for(const CCurve &curve : a->m_curves)
+				closed = closed && curve.IsClosed();
+		}
+		if(closed)
+		{
+			TPolyPolygon pp1, pp2, solution;
+			MakePolyPoly(*this, pp1, false);
+			if(a) MakePolyPoly(*a, pp2, false);
+			PolySweep::Execute(op, pp1, pp2, solution, subjFillType, clipFillType);
+			SetFromResult(*this, solution);
+			return;
+		}
+	}
+
 	Clipper c;
     c.StrictlySimple(CArea::m_clipper_simple);
     PopulateClipper(c,ptSubject);
@@ -532,9 +548,19 @@ void CArea::OffsetWithClipper(double offset,
     }else
         roundPrecision *= m_clipper_scale;
 
+    TPolyPolygon pp, pp2;
+    MakePolyPoly(*this, pp, false);
+    if(m_polygon_engine == SweepPolygonEngine) {
+        std::vector<EndType> endTypes;
+        for(const CCurve &c : m_curves)
+            endTypes.push_back(c.IsClosed()?etClosedPolygon:endType);
+        PolySweep::Offset(pp,joinType,endTypes,(double)(long64)(offset),pp2,miterLimit,roundPrecision);
+        SetFromResult(*this, pp2, false);
+        this->Reorder();
+        return;
+    }
+
     ClipperOffset clipper(miterLimit,roundPrecision);
-	TPolyPolygon pp, pp2;
-	MakePolyPoly(*this, pp, false);
     int i=0;
     for(const CCurve &c : m_curves) 
         clipper.AddPath(pp[i++],joinType,c.IsClosed()?etClosedPolygon:endType);
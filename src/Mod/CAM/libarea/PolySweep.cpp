@@ -0,0 +1,1127 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PolySweep.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <set>
+
+namespace PolySweep
+{
+using namespace ClipperLib;
+
+namespace
+{
+
+const double pi = 3.141592653589793238;
+
+//*****************************************
+// Exact predicates
+//*****************************************
+
+void MultiplyU64(uint64_t a, uint64_t b, uint64_t &hi, uint64_t &lo)
+{
+	uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+	uint64_t bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+	uint64_t p0 = aLo * bLo, p1 = aLo * bHi, p2 = aHi * bLo, p3 = aHi * bHi;
+	uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF);
+	lo = (p0 & 0xFFFFFFFF) | (mid << 32);
+	hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+}
+
+inline int Sign(cInt v)
+{
+	return (v > 0) - (v < 0);
+}
+
+inline uint64_t Abs(cInt v)
+{
+	return v < 0 ? uint64_t(-v) : uint64_t(v);
+}
+
+// sign of a * b - c * d
+int CompareProducts(cInt a, cInt b, cInt c, cInt d)
+{
+	const cInt limit = 0x7FFFFFFF;
+	if (a <= limit && a >= -limit && b <= limit && b >= -limit && c <= limit && c >= -limit && d <= limit && d >= -limit)
+		return Sign(a * b - c * d);
+
+	int s1 = Sign(a) * Sign(b);
+	int s2 = Sign(c) * Sign(d);
+	if (s1 != s2)
+		return s1 > s2 ? 1 : -1;
+	if (s1 == 0)
+		return 0;
+	uint64_t hi1, lo1, hi2, lo2;
+	MultiplyU64(Abs(a), Abs(b), hi1, lo1);
+	MultiplyU64(Abs(c), Abs(d), hi2, lo2);
+	int cmp = 0;
+	if (hi1 != hi2)
+		cmp = hi1 > hi2 ? 1 : -1;
+	else if (lo1 != lo2)
+		cmp = lo1 > lo2 ? 1 : -1;
+	return s1 > 0 ? cmp : -cmp;
+}
+
+// > 0 if pt is left of the line a->b, < 0 if right, 0 if on the line
+inline int Cross(const IntPoint &a, const IntPoint &b, const IntPoint &pt)
+{
+	return CompareProducts(b.X - a.X, pt.Y - a.Y, b.Y - a.Y, pt.X - a.X);
+}
+
+// > 0 if d2 is counter clockwise of d1
+inline int CrossDir(const IntPoint &d1, const IntPoint &d2)
+{
+	return CompareProducts(d1.X, d2.Y, d1.Y, d2.X);
+}
+
+inline int DotDir(const IntPoint &d1, const IntPoint &d2)
+{
+	return CompareProducts(d1.X, d2.X, -d1.Y, d2.Y);
+}
+
+inline bool PointLess(const IntPoint &a, const IntPoint &b)
+{
+	return a.X < b.X || (a.X == b.X && a.Y < b.Y);
+}
+
+inline IntPoint Direction(const IntPoint &from, const IntPoint &to)
+{
+	return IntPoint(to.X - from.X, to.Y - from.Y);
+}
+
+//*****************************************
+// Edges
+//*****************************************
+
+struct Edge
+{
+	IntPoint lo; // lo is before hi in (X,Y) order
+	IntPoint hi;
+	int windSubj; // change of the subject winding number from below to above the edge
+	int windClip; // same for the clip polygons
+	bool dirty;   // may cross other edges
+};
+
+struct SplitPoint
+{
+	size_t edge;
+	IntPoint pt;
+	bool exact; // lies exactly on the edges it was found on
+	double position;
+};
+
+inline bool IsInside(const Edge &e, const IntPoint &pt)
+{
+	return PointLess(e.lo, pt) && PointLess(pt, e.hi);
+}
+
+void AddEdge(std::vector<Edge> &edges, const IntPoint &a, const IntPoint &b, int windSubj, int windClip, bool dirty)
+{
+	if (a == b)
+		return;
+	Edge e;
+	if (PointLess(a, b))
+	{
+		e.lo = a;
+		e.hi = b;
+		e.windSubj = windSubj;
+		e.windClip = windClip;
+	}
+	else
+	{
+		e.lo = b;
+		e.hi = a;
+		e.windSubj = -windSubj;
+		e.windClip = -windClip;
+	}
+	e.dirty = dirty;
+	edges.push_back(e);
+}
+
+struct InputPath
+{
+	const Path *path;
+	bool isClip;
+	IntPoint min; // bounding box
+	IntPoint max;
+	size_t cluster;
+};
+
+void AddPath(std::vector<Edge> &edges, const InputPath &input)
+{
+	const Path &path = *input.path;
+	size_t size = path.size();
+	for (size_t i = 0; i < size; i++)
+	{
+		const IntPoint &a = path[i];
+		const IntPoint &b = path[i + 1 < size ? i + 1 : 0];
+		AddEdge(edges, a, b, input.isClip ? 0 : 1, input.isClip ? 1 : 0, true);
+	}
+}
+
+void AddInputs(std::vector<InputPath> &inputs, const Paths &paths, bool isClip)
+{
+	for (const Path &path : paths)
+	{
+		if (path.size() < 3)
+			continue;
+		InputPath input;
+		input.path = &path;
+		input.isClip = isClip;
+		input.min = input.max = path[0];
+		for (const IntPoint &pt : path)
+		{
+			input.min.X = std::min(input.min.X, pt.X);
+			input.min.Y = std::min(input.min.Y, pt.Y);
+			input.max.X = std::max(input.max.X, pt.X);
+			input.max.Y = std::max(input.max.Y, pt.Y);
+		}
+		inputs.push_back(input);
+	}
+}
+
+size_t FindCluster(std::vector<size_t> &parent, size_t i)
+{
+	while (parent[i] != i)
+	{
+		parent[i] = parent[parent[i]];
+		i = parent[i];
+	}
+	return i;
+}
+
+// groups the paths with overlapping bounding boxes. The winding numbers of a group
+// are zero outside of its boxes, so the groups can be processed independently, which
+// keeps the sweeps small for the many separate contours of pockets.
+void FindClusters(std::vector<InputPath> &inputs, std::vector<size_t> &parent, std::vector<size_t> &order,
+				  std::vector<size_t> &active)
+{
+	size_t count = inputs.size();
+	parent.resize(count);
+	order.resize(count);
+	for (size_t i = 0; i < count; i++)
+		parent[i] = order[i] = i;
+	std::sort(order.begin(), order.end(), [&inputs](size_t a, size_t b) { return inputs[a].min.X < inputs[b].min.X; });
+
+	active.clear();
+	for (size_t i : order)
+	{
+		const InputPath &s = inputs[i];
+		for (size_t a = 0; a < active.size();)
+		{
+			const InputPath &t = inputs[active[a]];
+			if (t.max.X < s.min.X)
+			{
+				active[a] = active.back();
+				active.pop_back();
+				continue;
+			}
+			if (t.max.Y >= s.min.Y && t.min.Y <= s.max.Y)
+				parent[FindCluster(parent, active[a])] = FindCluster(parent, i);
+			a++;
+		}
+		active.push_back(i);
+	}
+	for (size_t i = 0; i < count; i++)
+		inputs[i].cluster = FindCluster(parent, i);
+	std::sort(inputs.begin(), inputs.end(), [](const InputPath &a, const InputPath &b) { return a.cluster < b.cluster; });
+}
+
+// sweep order - edges starting in the same point are sorted from bottom to top
+bool EdgeLess(const Edge &a, const Edge &b)
+{
+	if (a.lo != b.lo)
+		return PointLess(a.lo, b.lo);
+	int c = CrossDir(Direction(a.lo, a.hi), Direction(b.lo, b.hi));
+	if (c != 0)
+		return c > 0;
+	return PointLess(a.hi, b.hi);
+}
+
+// sorts the edges, merges identical edges and removes edges without effect on the winding numbers
+void MergeEdges(std::vector<Edge> &edges)
+{
+	std::sort(edges.begin(), edges.end(), EdgeLess);
+	size_t count = 0;
+	for (size_t i = 0; i < edges.size();)
+	{
+		Edge e = edges[i];
+		size_t j = i + 1;
+		for (; j < edges.size() && edges[j].lo == e.lo && edges[j].hi == e.hi; j++)
+		{
+			e.windSubj += edges[j].windSubj;
+			e.windClip += edges[j].windClip;
+			e.dirty = e.dirty || edges[j].dirty;
+		}
+		if (e.windSubj != 0 || e.windClip != 0)
+			edges[count++] = e;
+		i = j;
+	}
+	edges.resize(count);
+}
+
+//*****************************************
+// Intersections
+//*****************************************
+
+class EdgeIntersector
+{
+  public:
+	EdgeIntersector(std::vector<Edge> &p_edges)
+		: edges(p_edges)
+	{
+	}
+
+	// splits the edges at all intersections, returns false if some crossings are left
+	bool Run()
+	{
+		for (int pass = 0; pass < maxPasses; pass++)
+		{
+			MergeEdges(edges);
+			splits.clear();
+			FindSplits();
+			if (splits.empty())
+				return true;
+			SplitEdges();
+		}
+		MergeEdges(edges);
+		return false;
+	}
+
+  private:
+	void Add(size_t edge, const IntPoint &pt, bool exact)
+	{
+		SplitPoint sp;
+		sp.edge = edge;
+		sp.pt = pt;
+		sp.exact = exact;
+		sp.position = 0;
+		splits.push_back(sp);
+	}
+
+	void Intersect(size_t i, size_t j)
+	{
+		const Edge &s = edges[i];
+		const Edge &t = edges[j];
+		int o1 = Cross(s.lo, s.hi, t.lo);
+		int o2 = Cross(s.lo, s.hi, t.hi);
+		if (o1 == 0 && o2 == 0)
+		{
+			// collinear - split both at the end points of the overlap
+			if (IsInside(s, t.lo))
+				Add(i, t.lo, true);
+			if (IsInside(s, t.hi))
+				Add(i, t.hi, true);
+			if (IsInside(t, s.lo))
+				Add(j, s.lo, true);
+			if (IsInside(t, s.hi))
+				Add(j, s.hi, true);
+			return;
+		}
+		if (o1 * o2 > 0)
+			return;
+		int o3 = Cross(t.lo, t.hi, s.lo);
+		int o4 = Cross(t.lo, t.hi, s.hi);
+		if (o3 * o4 > 0)
+			return;
+		if (o1 == 0 || o2 == 0 || o3 == 0 || o4 == 0)
+		{
+			// an end point touches the other edge
+			if (o1 == 0 && IsInside(s, t.lo))
+				Add(i, t.lo, true);
+			if (o2 == 0 && IsInside(s, t.hi))
+				Add(i, t.hi, true);
+			if (o3 == 0 && IsInside(t, s.lo))
+				Add(j, s.lo, true);
+			if (o4 == 0 && IsInside(t, s.hi))
+				Add(j, s.hi, true);
+			return;
+		}
+
+		// proper crossing, the intersection is rounded to the grid
+		long double sx = (long double)(s.hi.X - s.lo.X);
+		long double sy = (long double)(s.hi.Y - s.lo.Y);
+		long double tx = (long double)(t.hi.X - t.lo.X);
+		long double ty = (long double)(t.hi.Y - t.lo.Y);
+		long double denom = sx * ty - sy * tx;
+		long double u = ((long double)(t.lo.X - s.lo.X) * ty - (long double)(t.lo.Y - s.lo.Y) * tx) / denom;
+		IntPoint pt((cInt)std::llround(s.lo.X + u * sx), (cInt)std::llround(s.lo.Y + u * sy));
+		// keep it within the common bounding box
+		pt.X = std::max(pt.X, std::max(s.lo.X, t.lo.X));
+		pt.X = std::min(pt.X, std::min(s.hi.X, t.hi.X));
+		pt.Y = std::max(pt.Y, std::max(std::min(s.lo.Y, s.hi.Y), std::min(t.lo.Y, t.hi.Y)));
+		pt.Y = std::min(pt.Y, std::min(std::max(s.lo.Y, s.hi.Y), std::max(t.lo.Y, t.hi.Y)));
+		bool exact = Cross(s.lo, s.hi, pt) == 0 && Cross(t.lo, t.hi, pt) == 0;
+		Add(i, pt, exact);
+		Add(j, pt, exact);
+	}
+
+	// sweeps along X, the active edges are kept in horizontal strips, a pair of
+	// edges is tested in the first strip both of them are in
+	void FindSplits()
+	{
+		size_t count = edges.size();
+		if (count < 2)
+			return;
+		// the edges are sorted by MergeEdges
+		cInt minY = edges[0].lo.Y;
+		cInt maxY = minY;
+		for (size_t i = 0; i < count; i++)
+		{
+			minY = std::min(minY, std::min(edges[i].lo.Y, edges[i].hi.Y));
+			maxY = std::max(maxY, std::max(edges[i].lo.Y, edges[i].hi.Y));
+		}
+
+		size_t stripCount = std::max<size_t>(1, size_t(std::sqrt(double(count))));
+		double stripHeight = (double(maxY) - double(minY)) / double(stripCount) + 1.0;
+		double origin = double(minY);
+		auto stripOf = [&](cInt y) { return std::min(stripCount - 1, size_t((double(y) - origin) / stripHeight)); };
+		// keep the allocated strips for the next cluster
+		if (strips.size() < stripCount)
+			strips.resize(stripCount);
+		for (size_t k = 0; k < stripCount; k++)
+			strips[k].clear();
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const Edge &s = edges[i];
+			cInt sMinY = std::min(s.lo.Y, s.hi.Y);
+			cInt sMaxY = std::max(s.lo.Y, s.hi.Y);
+			size_t first = stripOf(sMinY);
+			size_t last = stripOf(sMaxY);
+			for (size_t k = first; k <= last; k++)
+			{
+				std::vector<size_t> &active = strips[k];
+				for (size_t a = 0; a < active.size();)
+				{
+					size_t j = active[a];
+					const Edge &t = edges[j];
+					if (t.hi.X < s.lo.X)
+					{
+						// passed by the sweep
+						active[a] = active.back();
+						active.pop_back();
+						continue;
+					}
+					a++;
+					if (!s.dirty && !t.dirty)
+						continue;
+					cInt tMinY = std::min(t.lo.Y, t.hi.Y);
+					cInt tMaxY = std::max(t.lo.Y, t.hi.Y);
+					if (tMaxY < sMinY || tMinY > sMaxY)
+						continue;
+					if (stripOf(std::max(sMinY, tMinY)) != k)
+						continue; // tested in another strip
+					Intersect(i, j);
+				}
+				active.push_back(i);
+			}
+		}
+	}
+
+	void SplitEdges()
+	{
+		for (SplitPoint &sp : splits)
+		{
+			const Edge &e = edges[sp.edge];
+			sp.position = double((long double)(sp.pt.X - e.lo.X) * (long double)(e.hi.X - e.lo.X) + (long double)(sp.pt.Y - e.lo.Y) * (long double)(e.hi.Y - e.lo.Y));
+		}
+		std::sort(splits.begin(), splits.end(), [](const SplitPoint &a, const SplitPoint &b) {
+			if (a.edge != b.edge)
+				return a.edge < b.edge;
+			return a.position < b.position;
+		});
+
+		// edges tested in this pass can only cross the parts of edges split at rounded points
+		for (Edge &e : edges)
+			e.dirty = false;
+
+		for (size_t i = 0; i < splits.size();)
+		{
+			size_t index = splits[i].edge;
+			Edge e = edges[index];
+			edges[index].windSubj = 0; // replaced by its parts, removed by the next merge
+			edges[index].windClip = 0;
+			IntPoint prev = e.lo;
+			bool prevExact = true;
+			for (; i < splits.size() && splits[i].edge == index; i++)
+			{
+				const SplitPoint &sp = splits[i];
+				if (sp.pt == prev || sp.pt == e.hi)
+				{
+					if (sp.pt == prev)
+						prevExact = prevExact && sp.exact;
+					continue;
+				}
+				AddEdge(edges, prev, sp.pt, e.windSubj, e.windClip, !prevExact || !sp.exact);
+				prev = sp.pt;
+				prevExact = sp.exact;
+			}
+			AddEdge(edges, prev, e.hi, e.windSubj, e.windClip, !prevExact);
+		}
+	}
+
+	static const int maxPasses = 16;
+	std::vector<Edge> &edges;
+	std::vector<SplitPoint> splits;
+	std::vector<std::vector<size_t>> strips;
+};
+
+//*****************************************
+// Winding numbers
+//*****************************************
+
+// true if the edge starting at its lower point is below the other active edge
+bool IsBelow(const Edge &s, const Edge &t)
+{
+	int o = Cross(t.lo, t.hi, s.lo);
+	if (o != 0)
+		return o < 0;
+	// both start in the same point
+	return CrossDir(Direction(s.lo, s.hi), Direction(t.lo, t.hi)) > 0;
+}
+
+// bottom to top order of the active edges. The edges do not cross, so the order only
+// has to be decided at the start point of the edge inserted later, which is the one
+// with the larger index as the edges are sorted by MergeEdges.
+struct StatusLess
+{
+	const std::vector<Edge> *edges;
+	bool operator()(size_t a, size_t b) const
+	{
+		if (a == b)
+			return false;
+		if (a > b)
+			return IsBelow((*edges)[a], (*edges)[b]);
+		return !IsBelow((*edges)[b], (*edges)[a]);
+	}
+};
+
+typedef std::set<size_t, StatusLess> Status;
+
+// computes the winding numbers below each edge, the edges have to be sorted by MergeEdges.
+// The active edges are kept in a balanced tree, every edge remembers its position in it
+// for the removal.
+void ComputeWindings(const std::vector<Edge> &edges, std::vector<int> &belowSubj, std::vector<int> &belowClip,
+					 std::vector<size_t> &ends, std::vector<Status::iterator> &handles)
+{
+	size_t count = edges.size();
+	ends.resize(count);
+	for (size_t i = 0; i < count; i++)
+		ends[i] = i;
+	std::sort(ends.begin(), ends.end(), [&edges](size_t a, size_t b) { return PointLess(edges[a].hi, edges[b].hi); });
+
+	Status status(StatusLess {&edges});
+	handles.resize(count);
+	belowSubj.assign(count, 0);
+	belowClip.assign(count, 0);
+	size_t next = 0;
+	for (size_t e = 0; e < count;)
+	{
+		// edges ending in a point are removed before edges starting there are inserted,
+		// an edge always starts before it ends
+		if (next == count || !PointLess(edges[next].lo, edges[ends[e]].hi))
+		{
+			status.erase(handles[ends[e]]);
+			e++;
+			continue;
+		}
+		size_t inserted = next++;
+		auto it = status.insert(inserted).first;
+		handles[inserted] = it;
+		if (it != status.begin())
+		{
+			size_t below = *std::prev(it);
+			belowSubj[inserted] = belowSubj[below] + edges[below].windSubj;
+			belowClip[inserted] = belowClip[below] + edges[below].windClip;
+		}
+	}
+}
+
+bool IsFilled(int wind, PolyFillType fillType)
+{
+	switch (fillType)
+	{
+	case pftEvenOdd:
+		return (wind & 1) != 0;
+	case pftNonZero:
+		return wind != 0;
+	case pftPositive:
+		return wind > 0;
+	default:
+		return wind < 0;
+	}
+}
+
+bool IsInResult(ClipType clipType, bool subj, bool clip)
+{
+	switch (clipType)
+	{
+	case ctIntersection:
+		return subj && clip;
+	case ctUnion:
+		return subj || clip;
+	case ctDifference:
+		return subj && !clip;
+	default:
+		return subj != clip;
+	}
+}
+
+//*****************************************
+// Result polygons
+//*****************************************
+
+struct OutEdge
+{
+	IntPoint from;
+	IntPoint to;
+	bool used;
+};
+
+// order of the directions clockwise from ref, the direction of ref itself is last
+int ClockwiseGroup(const IntPoint &ref, const IntPoint &d)
+{
+	int c = CrossDir(ref, d);
+	if (c < 0)
+		return 0;
+	if (c > 0)
+		return 2;
+	return DotDir(ref, d) < 0 ? 1 : 3;
+}
+
+bool ClockwiseBefore(const IntPoint &ref, const IntPoint &d1, const IntPoint &d2)
+{
+	int g1 = ClockwiseGroup(ref, d1);
+	int g2 = ClockwiseGroup(ref, d2);
+	if (g1 != g2)
+		return g1 < g2;
+	return CrossDir(d1, d2) < 0;
+}
+
+// removes repeated and collinear points
+void RemoveCollinear(Path &path)
+{
+	Path out;
+	out.reserve(path.size());
+	for (const IntPoint &pt : path)
+	{
+		if (!out.empty() && out.back() == pt)
+			continue;
+		while (out.size() >= 2 && Cross(out[out.size() - 2], out.back(), pt) == 0)
+			out.pop_back();
+		out.push_back(pt);
+	}
+	size_t first = 0;
+	while (out.size() - first >= 3)
+	{
+		if (out.back() == out[first] || Cross(out[out.size() - 2], out.back(), out[first]) == 0)
+			out.pop_back();
+		else if (Cross(out.back(), out[first], out[first + 1]) == 0)
+			first++;
+		else
+			break;
+	}
+	if (out.size() - first < 3)
+		path.clear();
+	else
+		path.assign(out.begin() + first, out.end());
+}
+
+// traces the result edges into polygons with the filled area on the left side,
+// at a vertex the next edge clockwise is taken - this separates touching polygons
+void BuildPolygons(std::vector<OutEdge> &out, Paths &solution)
+{
+	std::sort(out.begin(), out.end(), [](const OutEdge &a, const OutEdge &b) { return PointLess(a.from, b.from); });
+	for (size_t start = 0; start < out.size(); start++)
+	{
+		if (out[start].used)
+			continue;
+		Path path;
+		size_t current = start;
+		for (;;)
+		{
+			OutEdge &e = out[current];
+			e.used = true;
+			path.push_back(e.from);
+			// find the edges leaving the end point
+			size_t lo = std::lower_bound(out.begin(), out.end(), e.to, [](const OutEdge &a, const IntPoint &pt) {
+							return PointLess(a.from, pt);
+						}) - out.begin();
+			IntPoint ref = Direction(e.to, e.from);
+			size_t next = out.size();
+			for (size_t k = lo; k < out.size() && out[k].from == e.to; k++)
+			{
+				if (out[k].used && k != start)
+					continue;
+				if (next == out.size() || ClockwiseBefore(ref, Direction(out[k].from, out[k].to), Direction(out[next].from, out[next].to)))
+					next = k;
+			}
+			if (next == out.size() || next == start)
+				break;
+			current = next;
+		}
+		RemoveCollinear(path);
+		if (!path.empty())
+			solution.push_back(path);
+	}
+}
+
+//*****************************************
+// Offset
+//*****************************************
+
+inline cInt Round(double val)
+{
+	return (val < 0) ? static_cast<cInt>(val - 0.5) : static_cast<cInt>(val + 0.5);
+}
+
+double SignedArea(const Path &path)
+{
+	long double area = 0;
+	size_t size = path.size();
+	for (size_t i = 0, j = size - 1; i < size; j = i++)
+		area += ((long double)path[j].X + path[i].X) * ((long double)path[j].Y - path[i].Y);
+	return double(-area * 0.5);
+}
+
+// builds the raw offset outlines the same way as ClipperLib::ClipperOffset
+class PathOffsetter
+{
+  public:
+	PathOffsetter(JoinType p_joinType, double p_delta, double miterLimit, double arcTolerance)
+	{
+		joinType = p_joinType;
+		delta = p_delta;
+		miterLim = miterLimit > 2 ? 2 / (miterLimit * miterLimit) : 0.5;
+		double y;
+		const double defaultArcTolerance = 0.25;
+		if (arcTolerance <= 0.0)
+			y = defaultArcTolerance;
+		else if (arcTolerance > std::fabs(delta) * defaultArcTolerance)
+			y = std::fabs(delta) * defaultArcTolerance;
+		else
+			y = arcTolerance;
+		steps = pi / std::acos(1 - y / std::fabs(delta));
+		if (steps > std::fabs(delta) * pi)
+			steps = std::fabs(delta) * pi;
+		sinStep = std::sin(2 * pi / steps);
+		cosStep = std::cos(2 * pi / steps);
+		stepsPerRad = steps / (2 * pi);
+		if (delta < 0.0)
+			sinStep = -sinStep;
+	}
+
+	void AddPath(const Path &path, EndType endType, Paths &output)
+	{
+		src = &path;
+		size_t len = path.size();
+		if (len == 0 || (delta <= 0 && (len < 3 || endType != etClosedPolygon)))
+			return;
+		output.emplace_back();
+		dest = &output.back();
+		if (len == 1)
+		{
+			AddPoint(path);
+			return;
+		}
+
+		normals.clear();
+		normals.reserve(len);
+		for (size_t j = 0; j + 1 < len; j++)
+			normals.push_back(UnitNormal(path[j], path[j + 1]));
+		if (endType == etClosedLine || endType == etClosedPolygon)
+			normals.push_back(UnitNormal(path[len - 1], path[0]));
+		else
+			normals.push_back(normals[len - 2]);
+
+		if (endType == etClosedPolygon)
+		{
+			size_t k = len - 1;
+			for (size_t j = 0; j < len; j++)
+				OffsetPoint(j, k);
+		}
+		else if (endType == etClosedLine)
+		{
+			size_t k = len - 1;
+			for (size_t j = 0; j < len; j++)
+				OffsetPoint(j, k);
+			output.emplace_back();
+			dest = &output.back();
+			DoublePoint n = normals[len - 1];
+			for (size_t j = len - 1; j > 0; j--)
+				normals[j] = DoublePoint(-normals[j - 1].X, -normals[j - 1].Y);
+			normals[0] = DoublePoint(-n.X, -n.Y);
+			k = 0;
+			for (size_t j = len; j-- > 0;)
+				OffsetPoint(j, k);
+		}
+		else
+		{
+			size_t k = 0;
+			for (size_t j = 1; j + 1 < len; j++)
+				OffsetPoint(j, k);
+			if (endType == etOpenButt)
+			{
+				size_t j = len - 1;
+				dest->push_back(IntPoint(Round(path[j].X + normals[j].X * delta), Round(path[j].Y + normals[j].Y * delta)));
+				dest->push_back(IntPoint(Round(path[j].X - normals[j].X * delta), Round(path[j].Y - normals[j].Y * delta)));
+			}
+			else
+			{
+				size_t j = len - 1;
+				sinA = 0;
+				normals[j] = DoublePoint(-normals[j].X, -normals[j].Y);
+				if (endType == etOpenSquare)
+					DoSquare(j, len - 2);
+				else
+					DoRound(j, len - 2);
+			}
+
+			for (size_t j = len - 1; j > 0; j--)
+				normals[j] = DoublePoint(-normals[j - 1].X, -normals[j - 1].Y);
+			normals[0] = DoublePoint(-normals[1].X, -normals[1].Y);
+
+			k = len - 1;
+			for (size_t j = k - 1; j > 0; j--)
+				OffsetPoint(j, k);
+
+			if (endType == etOpenButt)
+			{
+				dest->push_back(IntPoint(Round(path[0].X - normals[0].X * delta), Round(path[0].Y - normals[0].Y * delta)));
+				dest->push_back(IntPoint(Round(path[0].X + normals[0].X * delta), Round(path[0].Y + normals[0].Y * delta)));
+			}
+			else
+			{
+				sinA = 0;
+				if (endType == etOpenSquare)
+					DoSquare(0, 1);
+				else
+					DoRound(0, 1);
+			}
+		}
+	}
+
+  private:
+	static DoublePoint UnitNormal(const IntPoint &pt1, const IntPoint &pt2)
+	{
+		double dx = double(pt2.X - pt1.X);
+		double dy = double(pt2.Y - pt1.Y);
+		if (dx == 0 && dy == 0)
+			return DoublePoint(0, 0);
+		double f = 1.0 / std::sqrt(dx * dx + dy * dy);
+		return DoublePoint(dy * f, -dx * f);
+	}
+
+	// offset of a single point - a circle or a square
+	void AddPoint(const Path &path)
+	{
+		if (joinType == jtRound)
+		{
+			double x = 1.0, y = 0.0;
+			for (cInt j = 1; j <= steps; j++)
+			{
+				dest->push_back(IntPoint(Round(path[0].X + x * delta), Round(path[0].Y + y * delta)));
+				double x2 = x;
+				x = x * cosStep - sinStep * y;
+				y = x2 * sinStep + y * cosStep;
+			}
+		}
+		else
+		{
+			double x = -1.0, y = -1.0;
+			for (int j = 0; j < 4; j++)
+			{
+				dest->push_back(IntPoint(Round(path[0].X + x * delta), Round(path[0].Y + y * delta)));
+				if (x < 0)
+					x = 1;
+				else if (y < 0)
+					y = 1;
+				else
+					x = -1;
+			}
+		}
+	}
+
+	void OffsetPoint(size_t j, size_t &k)
+	{
+		const Path &path = *src;
+		sinA = normals[k].X * normals[j].Y - normals[j].X * normals[k].Y;
+		if (std::fabs(sinA * delta) < 1.0)
+		{
+			double cosA = normals[k].X * normals[j].X + normals[j].Y * normals[k].Y;
+			if (cosA > 0)
+			{
+				// nearly collinear
+				dest->push_back(IntPoint(Round(path[j].X + normals[k].X * delta), Round(path[j].Y + normals[k].Y * delta)));
+				return;
+			}
+		}
+		else if (sinA > 1.0)
+			sinA = 1.0;
+		else if (sinA < -1.0)
+			sinA = -1.0;
+
+		if (sinA * delta < 0)
+		{
+			// concave corner - go through the vertex itself
+			dest->push_back(IntPoint(Round(path[j].X + normals[k].X * delta), Round(path[j].Y + normals[k].Y * delta)));
+			dest->push_back(path[j]);
+			dest->push_back(IntPoint(Round(path[j].X + normals[j].X * delta), Round(path[j].Y + normals[j].Y * delta)));
+		}
+		else
+		{
+			switch (joinType)
+			{
+			case jtMiter:
+			{
+				double r = 1 + (normals[j].X * normals[k].X + normals[j].Y * normals[k].Y);
+				if (r >= miterLim)
+					DoMiter(j, k, r);
+				else
+					DoSquare(j, k);
+				break;
+			}
+			case jtSquare:
+				DoSquare(j, k);
+				break;
+			case jtRound:
+				DoRound(j, k);
+				break;
+			}
+		}
+		k = j;
+	}
+
+	void DoSquare(size_t j, size_t k)
+	{
+		const Path &path = *src;
+		double dx = std::tan(std::atan2(sinA, normals[k].X * normals[j].X + normals[k].Y * normals[j].Y) / 4);
+		dest->push_back(IntPoint(Round(path[j].X + delta * (normals[k].X - normals[k].Y * dx)),
+								 Round(path[j].Y + delta * (normals[k].Y + normals[k].X * dx))));
+		dest->push_back(IntPoint(Round(path[j].X + delta * (normals[j].X + normals[j].Y * dx)),
+								 Round(path[j].Y + delta * (normals[j].Y - normals[j].X * dx))));
+	}
+
+	void DoMiter(size_t j, size_t k, double r)
+	{
+		const Path &path = *src;
+		double q = delta / r;
+		dest->push_back(IntPoint(Round(path[j].X + (normals[k].X + normals[j].X) * q),
+								 Round(path[j].Y + (normals[k].Y + normals[j].Y) * q)));
+	}
+
+	void DoRound(size_t j, size_t k)
+	{
+		const Path &path = *src;
+		double a = std::atan2(sinA, normals[k].X * normals[j].X + normals[k].Y * normals[j].Y);
+		int count = (int)Round(stepsPerRad * std::fabs(a));
+		double x = normals[k].X, y = normals[k].Y;
+		for (int i = 0; i < count; i++)
+		{
+			dest->push_back(IntPoint(Round(path[j].X + x * delta), Round(path[j].Y + y * delta)));
+			double x2 = x;
+			x = x * cosStep - sinStep * y;
+			y = x2 * sinStep + y * cosStep;
+		}
+		dest->push_back(IntPoint(Round(path[j].X + normals[j].X * delta), Round(path[j].Y + normals[j].Y * delta)));
+	}
+
+	JoinType joinType;
+	double delta;
+	double miterLim;
+	double steps;
+	double sinStep;
+	double cosStep;
+	double stepsPerRad;
+	double sinA = 0;
+	const Path *src = nullptr;
+	Path *dest = nullptr;
+	std::vector<DoublePoint> normals;
+};
+
+struct Workspace
+{
+	Workspace()
+		: intersector(edges)
+	{
+	}
+
+	std::vector<InputPath> inputs;
+	std::vector<size_t> parent;
+	std::vector<size_t> order;
+	std::vector<size_t> active;
+	std::vector<Edge> edges;
+	EdgeIntersector intersector;
+	std::vector<int> belowSubj;
+	std::vector<int> belowClip;
+	std::vector<size_t> ends;
+	std::vector<Status::iterator> handles;
+	std::vector<OutEdge> out;
+};
+
+// used for a cluster whose edges still cross after the last pass of the intersector,
+// the output has the same orientation and strictly simple polygons
+void ExecuteClipper(ClipType clipType, const std::vector<InputPath> &inputs, size_t first, size_t last,
+					PolyFillType subjFillType, PolyFillType clipFillType, Paths &solution)
+{
+	Clipper clipper;
+	clipper.StrictlySimple(true);
+	for (size_t i = first; i < last; i++)
+		clipper.AddPath(*inputs[i].path, inputs[i].isClip ? ptClip : ptSubject, true);
+	Paths result;
+	clipper.Execute(clipType, result, subjFillType, clipFillType);
+	solution.insert(solution.end(), result.begin(), result.end());
+}
+
+} // namespace
+
+void Execute(ClipType clipType, const Paths &subject, const Paths &clip, Paths &solution,
+			 PolyFillType subjFillType, PolyFillType clipFillType)
+{
+	// the buffers are kept, pocketing calls this for many small areas
+	static thread_local Workspace workspace;
+	std::vector<InputPath> &inputs = workspace.inputs;
+	std::vector<Edge> &edges = workspace.edges;
+	std::vector<int> &belowSubj = workspace.belowSubj;
+	std::vector<int> &belowClip = workspace.belowClip;
+	std::vector<OutEdge> &out = workspace.out;
+
+	solution.clear();
+	inputs.clear();
+	AddInputs(inputs, subject, false);
+	AddInputs(inputs, clip, true);
+	FindClusters(inputs, workspace.parent, workspace.order, workspace.active);
+
+	for (size_t first = 0; first < inputs.size();)
+	{
+		edges.clear();
+		size_t last = first;
+		for (; last < inputs.size() && inputs[last].cluster == inputs[first].cluster; last++)
+			AddPath(edges, inputs[last]);
+
+		if (!workspace.intersector.Run())
+		{
+			// rounding the intersections keeps creating new crossings
+			ExecuteClipper(clipType, inputs, first, last, subjFillType, clipFillType, solution);
+			first = last;
+			continue;
+		}
+		first = last;
+		ComputeWindings(edges, belowSubj, belowClip, workspace.ends, workspace.handles);
+
+		// result edges have the filled area on their left side
+		out.clear();
+		for (size_t i = 0; i < edges.size(); i++)
+		{
+			const Edge &e = edges[i];
+			bool below = IsInResult(clipType, IsFilled(belowSubj[i], subjFillType), IsFilled(belowClip[i], clipFillType));
+			bool above = IsInResult(clipType, IsFilled(belowSubj[i] + e.windSubj, subjFillType),
+									IsFilled(belowClip[i] + e.windClip, clipFillType));
+			if (below == above)
+				continue;
+			if (above)
+				out.push_back(OutEdge {e.lo, e.hi, false});
+			else
+				out.push_back(OutEdge {e.hi, e.lo, false});
+		}
+		BuildPolygons(out, solution);
+	}
+}
+
+void Offset(const Paths &paths, JoinType joinType, const std::vector<EndType> &endTypes, double delta,
+			Paths &solution, double miterLimit, double arcTolerance)
+{
+	solution.clear();
+
+	// strip duplicate points and find the closed polygon with the lowest point
+	Paths cleaned(paths.size());
+	size_t lowestPath = paths.size();
+	IntPoint lowest;
+	for (size_t i = 0; i < paths.size(); i++)
+	{
+		const Path &path = paths[i];
+		EndType endType = i < endTypes.size() ? endTypes[i] : etClosedPolygon;
+		if (path.empty())
+			continue;
+		size_t highI = path.size() - 1;
+		if (endType == etClosedLine || endType == etClosedPolygon)
+			while (highI > 0 && path[0] == path[highI])
+				highI--;
+		Path &c = cleaned[i];
+		c.reserve(highI + 1);
+		c.push_back(path[0]);
+		size_t k = 0;
+		for (size_t j = 1; j <= highI; j++)
+		{
+			if (c.back() == path[j])
+				continue;
+			c.push_back(path[j]);
+			if (path[j].Y > c[k].Y || (path[j].Y == c[k].Y && path[j].X < c[k].X))
+				k = c.size() - 1;
+		}
+		if (endType == etClosedPolygon && c.size() < 3)
+		{
+			c.clear();
+			continue;
+		}
+		if (endType == etClosedPolygon &&
+			(lowestPath == paths.size() || c[k].Y > lowest.Y || (c[k].Y == lowest.Y && c[k].X < lowest.X)))
+		{
+			lowestPath = i;
+			lowest = c[k];
+		}
+	}
+
+	// orientation of the closed paths
+	bool reverseClosed = lowestPath < paths.size() && SignedArea(cleaned[lowestPath]) < 0;
+	for (size_t i = 0; i < cleaned.size(); i++)
+	{
+		EndType endType = i < endTypes.size() ? endTypes[i] : etClosedPolygon;
+		bool positive = SignedArea(cleaned[i]) >= 0;
+		if ((endType == etClosedPolygon && reverseClosed) || (endType == etClosedLine && positive == reverseClosed))
+			std::reverse(cleaned[i].begin(), cleaned[i].end());
+	}
+
+	Paths raw;
+	if (std::fabs(delta) < 1.0E-20)
+	{
+		for (size_t i = 0; i < cleaned.size(); i++)
+			if ((i < endTypes.size() ? endTypes[i] : etClosedPolygon) == etClosedPolygon && !cleaned[i].empty())
+				raw.push_back(cleaned[i]);
+	}
+	else
+	{
+		PathOffsetter offsetter(joinType, delta, miterLimit, arcTolerance);
+		for (size_t i = 0; i < cleaned.size(); i++)
+			offsetter.AddPath(cleaned[i], i < endTypes.size() ? endTypes[i] : etClosedPolygon, raw);
+	}
+	// the outlines overlap themselves at concave corners, the offset is their positive area
+	Execute(ctUnion, raw, Paths(), solution, pftPositive, pftPositive);
+}
+
+} // namespace PolySweep
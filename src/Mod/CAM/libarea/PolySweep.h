@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POLYSWEEP_HEADER
+#define POLYSWEEP_HEADER
+
+#include <vector>
+#include "clipper.hpp"
+
+// Sweep-line polygon engine for closed polygon booleans and offsets.
+//
+// It works on the ClipperLib types, so CArea can switch between both engines at
+// runtime (see CArea::m_polygon_engine). All edges are first split at their mutual
+// intersections, rounded to the integer grid and repeated until no crossing is left,
+// and overlapping edges are merged. Groups of paths that still cross after a fixed
+// number of passes are handed to ClipperLib::Clipper. A second sweep assigns the subject and clip
+// winding numbers to both sides of every edge, so the result boundary is selected
+// edge by edge and traced into polygons without any intermediate output polygons.
+// All predicates are exact, coordinates have to stay within +-2^62.
+
+namespace PolySweep
+{
+
+// Boolean operation of closed polygons. Outer polygons of the solution are counter
+// clockwise (ClipperLib::Orientation() is true), holes are clockwise, and polygons
+// touching in a vertex are separated, like with Clipper::StrictlySimple(true).
+void Execute(ClipperLib::ClipType clipType,
+			 const ClipperLib::Paths &subject,
+			 const ClipperLib::Paths &clip,
+			 ClipperLib::Paths &solution,
+			 ClipperLib::PolyFillType subjFillType = ClipperLib::pftEvenOdd,
+			 ClipperLib::PolyFillType clipFillType = ClipperLib::pftEvenOdd);
+
+// Offsets the paths with the semantics of ClipperLib::ClipperOffset, endTypes holds
+// the end type of each path.
+void Offset(const ClipperLib::Paths &paths,
+			ClipperLib::JoinType joinType,
+			const std::vector<ClipperLib::EndType> &endTypes,
+			double delta,
+			ClipperLib::Paths &solution,
+			double miterLimit = 2.0,
+			double arcTolerance = 0.25);
+
+} // namespace PolySweep
+
+#endif // POLYSWEEP_HEADER
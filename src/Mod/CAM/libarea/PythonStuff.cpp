@@ -538,6 +538,7 @@ BOOST_PYTHON_MODULE(area) {
 		//.def_readwrite("polyTreeNestingLimit", &Adaptive2d::polyTreeNestingLimit)
 		.def_readwrite("tolerance", &Adaptive2d::tolerance)
 		.def_readwrite("keepToolDownDistRatio", &Adaptive2d::keepToolDownDistRatio)
+		.def_readwrite("threads", &Adaptive2d::threads)
 		.def_readwrite("opType", &Adaptive2d::opType);
 
 
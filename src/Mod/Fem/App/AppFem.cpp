@@ -53,6 +53,7 @@
 #include "FemMeshShapeNetgenObject.h"
 #include "FemMeshShapeObject.h"
 #include "FemResultObject.h"
+#include "FemResultStoreProperty.h"
 #include "FemSetElementNodesObject.h"
 #include "FemSetElementsObject.h"
 #include "FemSetFacesObject.h"
@@ -164,6 +165,7 @@ PyMOD_INIT_FUNC(Fem)
     Fem::FemMeshShapeObject                   ::init();
     Fem::FemMeshShapeNetgenObject             ::init();
     Fem::PropertyFemMesh                      ::init();
+    Fem::PropertyFemResultStore               ::init();
 
     Fem::FemResultObject                      ::init();
     Fem::FemResultObjectPython                ::init();
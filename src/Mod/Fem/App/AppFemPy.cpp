@@ -37,6 +37,8 @@
 #include "FemMesh.h"
 #include "FemMeshObject.h"
 #include "FemMeshPy.h"
+#include "FemResultObject.h"
+#include "FemResultStore.h"
 #ifdef FC_USE_VTK
 #include "FemPostPipeline.h"
 #include "FemVTKTools.h"
@@ -74,7 +76,17 @@ public:
                            &Module::writeResult,
                            "write a CFD or FEM result (auto detect) to a file (file format "
                            "detected from file suffix)");
+        add_varargs_method("readResultSteps",
+                           &Module::readResultSteps,
+                           "readResultSteps(list of strings,[list of floats],[result]) -- Read a "
+                           "transient result with one file per time step into the result store of "
+                           "a result object.");
 #endif
+        add_varargs_method("readResultField",
+                           &Module::readResultField,
+                           "readResultField(result,string,[int]) -- Read a field of a time step "
+                           "from the result store of a result object. Node fields are ordered by "
+                           "node id.");
         add_varargs_method("show",
                            &Module::show,
                            "show(shape,[string]) -- Add the mesh to the active document or create "
@@ -285,8 +297,95 @@ private:
 
         return Py::None();
     }
+
+    Py::Object readResultSteps(const Py::Tuple& args)
+    {
+        PyObject* pcFiles = nullptr;
+        PyObject* pcTimes = nullptr;
+        PyObject* pcObj = nullptr;
+        if (!PyArg_ParseTuple(args.ptr(),
+                              "O|OO!",
+                              &pcFiles,
+                              &pcTimes,
+                              &(App::DocumentObjectPy::Type),
+                              &pcObj)) {
+            throw Py::Exception();
+        }
+
+        std::vector<std::string> files;
+        Py::Sequence fileList(pcFiles);
+        for (const auto& it : fileList) {
+            files.push_back(Py::String(it).as_std_string("utf-8"));
+        }
+        std::vector<double> times;
+        if (pcTimes && pcTimes != Py_None) {
+            Py::Sequence timeList(pcTimes);
+            for (const auto& it : timeList) {
+                times.push_back(static_cast<double>(Py::Float(it)));
+            }
+        }
+
+        App::DocumentObject* obj = nullptr;
+        if (pcObj) {
+            obj = static_cast<App::DocumentObjectPy*>(pcObj)->getDocumentObjectPtr();
+        }
+        App::DocumentObject* res = FemVTKTools::readResultSteps(files, times, obj);
+        if (res) {
+            return Py::asObject(res->getPyObject());
+        }
+        return Py::None();
+    }
 #endif
 
+    Py::Object readResultField(const Py::Tuple& args)
+    {
+        PyObject* pcObj = nullptr;
+        char* name = nullptr;
+        int step = -1;
+        if (!PyArg_ParseTuple(args.ptr(),
+                              "O!s|i",
+                              &(App::DocumentObjectPy::Type),
+                              &pcObj,
+                              &name,
+                              &step)) {
+            throw Py::Exception();
+        }
+
+        auto result = dynamic_cast<FemResultObject*>(
+            static_cast<App::DocumentObjectPy*>(pcObj)->getDocumentObjectPtr());
+        if (!result) {
+            throw Py::TypeError("Object is not a FEM result");
+        }
+        const auto& store = result->ResultStore.getValue();
+        if (!store) {
+            throw Py::ValueError("Result has no result store");
+        }
+        if (step < 0) {
+            step = static_cast<int>(result->TimeStep.getValue());
+        }
+
+        FemResultStore::Field field = store->getField(static_cast<std::size_t>(step), name);
+        if (!field.isValid()) {
+            throw Py::ValueError("No such field in this time step");
+        }
+
+        // only this field is paged in from the mapped file
+        Py::List list(static_cast<Py::List::size_type>(field.tuples));
+        for (uint64_t i = 0; i < field.tuples; i++) {
+            if (field.components == 1) {
+                list.setItem(i, Py::Float(field.value(i)));
+            }
+            else {
+                Py::Tuple tuple(field.components);
+                for (uint32_t j = 0; j < field.components; j++) {
+                    tuple.setItem(j, Py::Float(field.value(i, j)));
+                }
+                list.setItem(i, tuple);
+            }
+        }
+        return list;
+    }
+
     Py::Object show(const Py::Tuple& args)
     {
         PyObject* pcObj;
@@ -25,7 +25,10 @@
 #ifndef _PreComp_
 #include <Python.h>
 #include <cstdlib>
+#include <array>
+#include <limits>
 #include <memory>
+#include <tuple>
 
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -141,132 +144,13 @@ FemMesh& FemMesh::operator=(const FemMesh& mesh)
 
 void FemMesh::copyMeshData(const FemMesh& mesh)
 {
+    boundaryFaces.reset();
     _Mtrx = mesh._Mtrx;
 
     // See file SMESH_I/SMESH_Gen_i.cxx in the git repo of smesh at
     // https://git.salome-platform.org
 #if 1
-    // 1. Get source mesh
-    SMESHDS_Mesh* srcMeshDS = mesh.myMesh->GetMeshDS();
-
-    // 2. Get target mesh
-    SMESHDS_Mesh* newMeshDS = this->myMesh->GetMeshDS();
-    SMESH_MeshEditor editor(this->myMesh);
-
-    // 3. Get elements to copy
-    SMDS_ElemIteratorPtr srcElemIt;
-    SMDS_NodeIteratorPtr srcNodeIt;
-    srcElemIt = srcMeshDS->elementsIterator();
-    srcNodeIt = srcMeshDS->nodesIterator();
-
-    // 4. Copy elements
-    int iN;
-    const SMDS_MeshNode *nSrc, *nTgt;
-    std::vector<const SMDS_MeshNode*> nodes;
-    while (srcElemIt->more()) {
-        const SMDS_MeshElement* elem = srcElemIt->next();
-        // find / add nodes
-        nodes.resize(elem->NbNodes());
-        SMDS_ElemIteratorPtr nIt = elem->nodesIterator();
-        for (iN = 0; nIt->more(); ++iN) {
-            nSrc = static_cast<const SMDS_MeshNode*>(nIt->next());
-            nTgt = newMeshDS->FindNode(nSrc->GetID());
-            if (!nTgt) {
-                nTgt = newMeshDS->AddNodeWithID(nSrc->X(), nSrc->Y(), nSrc->Z(), nSrc->GetID());
-            }
-            nodes[iN] = nTgt;
-        }
-
-        // add elements
-        if (elem->GetType() != SMDSAbs_Node) {
-            int ID = elem->GetID();
-            switch (elem->GetEntityType()) {
-                case SMDSEntity_Polyhedra:
-#if SMESH_VERSION_MAJOR >= 9
-                    editor.GetMeshDS()->AddPolyhedralVolumeWithID(
-                        nodes,
-                        static_cast<const SMDS_MeshVolume*>(elem)->GetQuantities(),
-                        ID);
-#else
-                    editor.GetMeshDS()->AddPolyhedralVolumeWithID(
-                        nodes,
-                        static_cast<const SMDS_VtkVolume*>(elem)->GetQuantities(),
-                        ID);
-#endif
-                    break;
-                case SMDSEntity_Ball: {
-                    SMESH_MeshEditor::ElemFeatures elemFeat;
-                    elemFeat.Init(static_cast<const SMDS_BallElement*>(elem)->GetDiameter());
-                    elemFeat.SetID(ID);
-                    editor.AddElement(nodes, elemFeat);
-                    break;
-                }
-                default: {
-                    SMESH_MeshEditor::ElemFeatures elemFeat(elem->GetType(), elem->IsPoly());
-                    elemFeat.SetID(ID);
-                    editor.AddElement(nodes, elemFeat);
-                    break;
-                }
-            }
-        }
-    }
-
-    // 4(b). Copy free nodes
-    if (srcNodeIt && srcMeshDS->NbNodes() != newMeshDS->NbNodes()) {
-        while (srcNodeIt->more()) {
-            nSrc = srcNodeIt->next();
-            if (nSrc->NbInverseElements() == 0) {
-                nTgt = newMeshDS->AddNodeWithID(nSrc->X(), nSrc->Y(), nSrc->Z(), nSrc->GetID());
-            }
-        }
-    }
-
-    // 5. Copy groups
-    SMESH_Mesh::GroupIteratorPtr gIt = mesh.myMesh->GetGroups();
-    while (gIt->more()) {
-        SMESH_Group* group = gIt->next();
-        const SMESHDS_GroupBase* groupDS = group->GetGroupDS();
-
-        // Check group type. We copy nodal groups containing nodes of copied element
-        SMDSAbs_ElementType groupType = groupDS->GetType();
-        if (groupType != SMDSAbs_Node && newMeshDS->GetMeshInfo().NbElements(groupType) == 0) {
-            continue;  // group type differs from types of meshPart
-        }
-
-        // Find copied elements in the group
-        std::vector<const SMDS_MeshElement*> groupElems;
-        SMDS_ElemIteratorPtr eIt = groupDS->GetElements();
-        const SMDS_MeshElement* foundElem;
-        if (groupType == SMDSAbs_Node) {
-            while (eIt->more()) {
-                if ((foundElem = newMeshDS->FindNode(eIt->next()->GetID()))) {
-                    groupElems.push_back(foundElem);
-                }
-            }
-        }
-        else {
-            while (eIt->more()) {
-                if ((foundElem = newMeshDS->FindElement(eIt->next()->GetID()))) {
-                    groupElems.push_back(foundElem);
-                }
-            }
-        }
-
-        // Make a new group
-        if (!groupElems.empty()) {
-            int aId = -1;
-            SMESH_Group* newGroupObj = this->myMesh->AddGroup(groupType, group->GetName(), aId);
-            SMESHDS_Group* newGroupDS = dynamic_cast<SMESHDS_Group*>(newGroupObj->GetGroupDS());
-            if (newGroupDS) {
-                SMDS_MeshGroup& smdsGroup = ((SMESHDS_Group*)newGroupDS)->SMDSGroup();
-                for (auto it : groupElems) {
-                    smdsGroup.Add(it);
-                }
-            }
-        }
-    }
-
-    newMeshDS->Modified();
+    addMeshData(mesh, 0, 0, false);
 
 #else
     SMESHDS_Mesh* meshds = this->myMesh->GetMeshDS();
@@ -510,6 +394,163 @@ void FemMesh::copyMeshData(const FemMesh& mesh)
 #endif
 }
 
+void FemMesh::addMeshData(const FemMesh& mesh,
+                          int nodeOffset,
+                          int elementOffset,
+                          bool joinGroups)
+{
+    // 1. Get source mesh
+    SMESHDS_Mesh* srcMeshDS = mesh.myMesh->GetMeshDS();
+
+    // 2. Get target mesh
+    SMESHDS_Mesh* newMeshDS = this->myMesh->GetMeshDS();
+    int numNodes = 0;
+    SMESH_MeshEditor editor(this->myMesh);
+
+    // 3. Get elements to copy
+    SMDS_ElemIteratorPtr srcElemIt;
+    SMDS_NodeIteratorPtr srcNodeIt;
+    srcElemIt = srcMeshDS->elementsIterator();
+    srcNodeIt = srcMeshDS->nodesIterator();
+
+    // 4. Copy elements
+    int iN;
+    const SMDS_MeshNode *nSrc, *nTgt;
+    std::vector<const SMDS_MeshNode*> nodes;
+    while (srcElemIt->more()) {
+        const SMDS_MeshElement* elem = srcElemIt->next();
+        // find / add nodes
+        nodes.resize(elem->NbNodes());
+        SMDS_ElemIteratorPtr nIt = elem->nodesIterator();
+        for (iN = 0; nIt->more(); ++iN) {
+            nSrc = static_cast<const SMDS_MeshNode*>(nIt->next());
+            nTgt = newMeshDS->FindNode(nSrc->GetID() + nodeOffset);
+            if (!nTgt) {
+                nTgt = newMeshDS->AddNodeWithID(nSrc->X(),
+                                                nSrc->Y(),
+                                                nSrc->Z(),
+                                                nSrc->GetID() + nodeOffset);
+                numNodes++;
+            }
+            nodes[iN] = nTgt;
+        }
+
+        // add elements
+        if (elem->GetType() != SMDSAbs_Node) {
+            int ID = elem->GetID() + elementOffset;
+            switch (elem->GetEntityType()) {
+                case SMDSEntity_Polyhedra:
+#if SMESH_VERSION_MAJOR >= 9
+                    editor.GetMeshDS()->AddPolyhedralVolumeWithID(
+                        nodes,
+                        static_cast<const SMDS_MeshVolume*>(elem)->GetQuantities(),
+                        ID);
+#else
+                    editor.GetMeshDS()->AddPolyhedralVolumeWithID(
+                        nodes,
+                        static_cast<const SMDS_VtkVolume*>(elem)->GetQuantities(),
+                        ID);
+#endif
+                    break;
+                case SMDSEntity_Ball: {
+                    SMESH_MeshEditor::ElemFeatures elemFeat;
+                    elemFeat.Init(static_cast<const SMDS_BallElement*>(elem)->GetDiameter());
+                    elemFeat.SetID(ID);
+                    editor.AddElement(nodes, elemFeat);
+                    break;
+                }
+                default: {
+                    SMESH_MeshEditor::ElemFeatures elemFeat(elem->GetType(), elem->IsPoly());
+                    elemFeat.SetID(ID);
+                    editor.AddElement(nodes, elemFeat);
+                    break;
+                }
+            }
+        }
+    }
+
+    // 4(b). Copy free nodes
+    if (srcNodeIt && srcMeshDS->NbNodes() != numNodes) {
+        while (srcNodeIt->more()) {
+            nSrc = srcNodeIt->next();
+            if (nSrc->NbInverseElements() == 0) {
+                nTgt = newMeshDS->AddNodeWithID(nSrc->X(),
+                                                nSrc->Y(),
+                                                nSrc->Z(),
+                                                nSrc->GetID() + nodeOffset);
+            }
+        }
+    }
+
+    // 5. Copy groups
+    SMESH_Mesh::GroupIteratorPtr gIt = mesh.myMesh->GetGroups();
+    while (gIt->more()) {
+        SMESH_Group* group = gIt->next();
+        const SMESHDS_GroupBase* groupDS = group->GetGroupDS();
+
+        // Check group type. We copy nodal groups containing nodes of copied element
+        SMDSAbs_ElementType groupType = groupDS->GetType();
+        if (groupType != SMDSAbs_Node && newMeshDS->GetMeshInfo().NbElements(groupType) == 0) {
+            continue;  // group type differs from types of meshPart
+        }
+
+        // Find copied elements in the group
+        std::vector<const SMDS_MeshElement*> groupElems;
+        SMDS_ElemIteratorPtr eIt = groupDS->GetElements();
+        const SMDS_MeshElement* foundElem;
+        if (groupType == SMDSAbs_Node) {
+            while (eIt->more()) {
+                if ((foundElem = newMeshDS->FindNode(eIt->next()->GetID() + nodeOffset))) {
+                    groupElems.push_back(foundElem);
+                }
+            }
+        }
+        else {
+            while (eIt->more()) {
+                if ((foundElem = newMeshDS->FindElement(eIt->next()->GetID() + elementOffset))) {
+                    groupElems.push_back(foundElem);
+                }
+            }
+        }
+
+        // Make a new group or, when joining, extend the group of the same name and type
+        if (!groupElems.empty()) {
+            SMESH_Group* newGroupObj = nullptr;
+            SMESH_Mesh::GroupIteratorPtr tIt = this->myMesh->GetGroups();
+            while (joinGroups && tIt->more() && !newGroupObj) {
+                SMESH_Group* target = tIt->next();
+                if (target->GetGroupDS()->GetType() == groupType
+                    && std::string(target->GetName()) == group->GetName()) {
+                    newGroupObj = target;
+                }
+            }
+            if (!newGroupObj) {
+                int aId = -1;
+                newGroupObj = this->myMesh->AddGroup(groupType, group->GetName(), aId);
+            }
+            SMESHDS_Group* newGroupDS = dynamic_cast<SMESHDS_Group*>(newGroupObj->GetGroupDS());
+            if (newGroupDS) {
+                SMDS_MeshGroup& smdsGroup = ((SMESHDS_Group*)newGroupDS)->SMDSGroup();
+                for (auto it : groupElems) {
+                    smdsGroup.Add(it);
+                }
+            }
+        }
+    }
+
+    newMeshDS->Modified();
+}
+
+void FemMesh::append(const FemMesh& mesh)
+{
+    boundaryFaces.reset();
+
+    SMESHDS_Mesh* meshDS = this->myMesh->GetMeshDS();
+    int nodeOffset = meshDS->NbNodes() > 0 ? meshDS->MaxNodeID() : 0;
+    int elementOffset = meshDS->NbElements() > 0 ? meshDS->MaxElementID() : 0;
+    addMeshData(mesh, nodeOffset, elementOffset, true);
+}
+
 const SMESH_Mesh* FemMesh::getSMesh() const
 {
     return myMesh;
@@ -517,6 +558,8 @@ const SMESH_Mesh* FemMesh::getSMesh() const
 
 SMESH_Mesh* FemMesh::getSMesh()
 {
+    // the caller may modify the mesh
+    boundaryFaces.reset();
     return myMesh;
 }
 
@@ -610,6 +653,7 @@ void FemMesh::setStandardHypotheses()
 
 void FemMesh::compute()
 {
+    boundaryFaces.reset();
     getGenerator()->Compute(*myMesh, myMesh->GetShapeToMesh());
 }
 
@@ -1170,6 +1214,276 @@ std::set<int> FemMesh::getFacesOnly() const
     return resultIDs;
 }
 
+namespace
+{
+// The faces of the supported elements by their number of nodes. Each face lists the local
+// node indexes in the order used for display, the mid-side nodes between the corner nodes.
+using FaceTable = std::vector<std::vector<int>>;
+
+const FaceTable* getFaceTable(int numNodes, bool volume)
+{
+    static const std::map<int, FaceTable> faceTables = {
+        {3, {{0, 1, 2}}},
+        {4, {{0, 1, 2, 3}}},
+        {6, {{0, 3, 1, 4, 2, 5}}},
+        {8, {{0, 4, 1, 5, 2, 6, 3, 7}}},
+    };
+    static const std::map<int, FaceTable> volumeTables = {
+        // tetra4
+        {4, {{0, 1, 2}, {0, 3, 1}, {1, 3, 2}, {2, 3, 0}}},
+        // pyra5
+        {5, {{0, 1, 2, 3}, {0, 4, 1}, {1, 4, 2}, {2, 4, 3}, {3, 4, 0}}},
+        // penta6
+        {6, {{0, 1, 2}, {3, 5, 4}, {0, 3, 4, 1}, {1, 4, 5, 2}, {2, 5, 3, 0}}},
+        // hexa8
+        {8,
+         {{0, 1, 2, 3},
+          {4, 7, 6, 5},
+          {0, 4, 5, 1},
+          {1, 5, 6, 2},
+          {2, 6, 7, 3},
+          {3, 7, 4, 0}}},
+        // tetra10
+        {10,
+         {{0, 4, 1, 5, 2, 6},
+          {0, 7, 3, 8, 1, 4},
+          {1, 8, 3, 9, 2, 5},
+          {2, 9, 3, 7, 0, 6}}},
+        // pyra13
+        {13,
+         {{0, 5, 1, 6, 2, 7, 3, 8},
+          {0, 9, 4, 10, 1, 5},
+          {1, 10, 4, 11, 2, 6},
+          {2, 11, 4, 12, 3, 7},
+          {3, 12, 4, 9, 0, 8}}},
+        // penta15
+        {15,
+         {{0, 6, 1, 7, 2, 8},
+          {3, 11, 5, 10, 4, 9},
+          {0, 12, 3, 9, 4, 13, 1, 6},
+          {1, 13, 4, 10, 5, 14, 2, 7},
+          {2, 14, 5, 11, 3, 12, 0, 8}}},
+        // hexa20
+        {20,
+         {{0, 8, 1, 9, 2, 10, 3, 11},
+          {4, 15, 7, 14, 6, 13, 5, 12},
+          {0, 16, 4, 12, 5, 17, 1, 8},
+          {1, 17, 5, 13, 6, 18, 2, 9},
+          {2, 18, 6, 14, 7, 19, 3, 10},
+          {3, 19, 7, 15, 4, 16, 0, 11}}},
+    };
+
+    const auto& tables = volume ? volumeTables : faceTables;
+    auto it = tables.find(numNodes);
+    return it != tables.end() ? &it->second : nullptr;
+}
+
+const FaceTable& getCheckedFaceTable(int numNodes, bool volume)
+{
+    const FaceTable* table = getFaceTable(numNodes, volume);
+    if (!table) {
+        throw std::runtime_error(volume ? "Node count not supported for volumes, "
+                                          "[4|5|6|8|10|13|15|20] are allowed"
+                                        : "Node count not supported for faces, "
+                                          "[3|4|6|8] are allowed");
+    }
+    return *table;
+}
+
+bool hasVolumes(const SMESH_Mesh* mesh)
+{
+    return mesh->GetMeshDS()->GetMeshInfo().NbVolumes() > 0;
+}
+
+// A face of an element in the list of all element faces. The key holds the sorted IDs of
+// the corner nodes, faces of linear and quadratic elements are told apart by their size.
+struct FaceRecord
+{
+    std::array<uint32_t, 4> key;
+    uint32_t element;
+    uint16_t face;
+    uint16_t size;
+
+    bool isSameFace(const FaceRecord& other) const
+    {
+        return key == other.key && size == other.size;
+    }
+    bool operator<(const FaceRecord& other) const
+    {
+        return std::tie(key, size, element, face)
+            < std::tie(other.key, other.size, other.element, other.face);
+    }
+};
+
+FaceRecord makeFaceRecord(const uint32_t* nodes, const std::vector<int>& face)
+{
+    FaceRecord record {};
+    record.size = static_cast<uint16_t>(face.size());
+    record.key.fill(std::numeric_limits<uint32_t>::max());
+    // the mid-side nodes of quadratic faces are between the corner nodes
+    int step = face.size() > 4 ? 2 : 1;
+    int corners = static_cast<int>(face.size()) / step;
+    for (int i = 0; i < corners; i++) {
+        uint32_t node = nodes[face[i * step]];
+        int j = i;
+        for (; j > 0 && record.key[j - 1] > node; j--) {
+            record.key[j] = record.key[j - 1];
+        }
+        record.key[j] = node;
+    }
+    return record;
+}
+
+int getBucket(const FaceRecord& record, int bits)
+{
+    uint64_t value = (uint64_t(record.key[0]) << 32 | record.key[1]) ^ record.key[2];
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<int>((value ^ (value >> 31)) >> (64 - bits));
+}
+}  // namespace
+
+int FemMesh::getFaceNodes(const ElementFace& face, const SMDS_MeshNode* nodes[8])
+{
+    bool volume = face.faceNo > 0;
+    const FaceTable& table = getCheckedFaceTable(face.element->NbNodes(), volume);
+    const std::vector<int>& indexes = table.at(volume ? face.faceNo - 1 : 0);
+    for (std::size_t i = 0; i < indexes.size(); i++) {
+        nodes[i] = face.element->GetNode(indexes[i]);
+    }
+    return static_cast<int>(indexes.size());
+}
+
+std::vector<FemMesh::ElementFace> FemMesh::getElementFaces() const
+{
+    std::vector<ElementFace> faces;
+    bool volume = hasVolumes(myMesh);
+    SMDS_ElemIteratorPtr aElemIter =
+        myMesh->GetMeshDS()->elementsIterator(volume ? SMDSAbs_Volume : SMDSAbs_Face);
+    while (aElemIter->more()) {
+        const SMDS_MeshElement* aElem = aElemIter->next();
+        const FaceTable& table = getCheckedFaceTable(aElem->NbNodes(), volume);
+        for (std::size_t i = 0; i < table.size(); i++) {
+            faces.push_back({aElem, volume ? static_cast<short>(i + 1) : short(0)});
+        }
+    }
+    return faces;
+}
+
+const std::vector<FemMesh::ElementFace>& FemMesh::getBoundaryFaces() const
+{
+    if (!boundaryFaces) {
+        boundaryFaces = std::make_unique<std::vector<ElementFace>>(findBoundaryFaces());
+    }
+    return *boundaryFaces;
+}
+
+std::vector<FemMesh::ElementFace> FemMesh::findBoundaryFaces() const
+{
+    // How it works:
+    // The node IDs of all elements are gathered first because the element access of SMDS
+    // isn't thread-safe. Then, in parallel over blocks of elements, every element face gets a
+    // key of its sorted corner node IDs. The keys are distributed into buckets and each bucket
+    // is sorted on its own, so that equal faces become neighbours. A face that occurs once
+    // belongs to the skin. Faces that occur several times cancel each other out in pairs.
+    bool volume = hasVolumes(myMesh);
+    std::vector<const SMDS_MeshElement*> elements;
+    std::vector<const FaceTable*> tables;
+    std::vector<std::size_t> nodeOffsets {0};
+    std::vector<std::size_t> faceOffsets {0};
+    std::vector<uint32_t> nodes;
+
+    SMDS_ElemIteratorPtr aElemIter =
+        myMesh->GetMeshDS()->elementsIterator(volume ? SMDSAbs_Volume : SMDSAbs_Face);
+    while (aElemIter->more()) {
+        const SMDS_MeshElement* aElem = aElemIter->next();
+        int numNodes = aElem->NbNodes();
+        const FaceTable& table = getCheckedFaceTable(numNodes, volume);
+        elements.push_back(aElem);
+        tables.push_back(&table);
+        for (int i = 0; i < numNodes; i++) {
+            nodes.push_back(static_cast<uint32_t>(aElem->GetNode(i)->GetID()));
+        }
+        nodeOffsets.push_back(nodes.size());
+        faceOffsets.push_back(faceOffsets.back() + table.size());
+    }
+
+    std::size_t numFaces = faceOffsets.back();
+    if (elements.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("Too many elements");
+    }
+
+    auto numElements = static_cast<long>(elements.size());
+    std::vector<FaceRecord> records(numFaces);
+#pragma omp parallel for schedule(static)
+    for (long i = 0; i < numElements; i++) {
+        const FaceTable& table = *tables[i];
+        for (std::size_t j = 0; j < table.size(); j++) {
+            FaceRecord& record = records[faceOffsets[i] + j];
+            record = makeFaceRecord(&nodes[nodeOffsets[i]], table[j]);
+            record.element = static_cast<uint32_t>(i);
+            record.face = static_cast<uint16_t>(j);
+        }
+    }
+
+    constexpr int bucketBits = 10;
+    constexpr int numBuckets = 1 << bucketBits;
+    std::vector<int> bucketOf(numFaces);
+    std::vector<std::size_t> bucketOffsets(numBuckets + 1, 0);
+#pragma omp parallel for schedule(static)
+    for (long i = 0; i < static_cast<long>(numFaces); i++) {
+        bucketOf[i] = getBucket(records[i], bucketBits);
+    }
+    for (int bucket : bucketOf) {
+        bucketOffsets[bucket + 1]++;
+    }
+    for (int i = 0; i < numBuckets; i++) {
+        bucketOffsets[i + 1] += bucketOffsets[i];
+    }
+    std::vector<FaceRecord> buckets(numFaces);
+    {
+        std::vector<std::size_t> next(bucketOffsets.begin(), bucketOffsets.end() - 1);
+        for (std::size_t i = 0; i < numFaces; i++) {
+            buckets[next[bucketOf[i]]++] = records[i];
+        }
+    }
+    records.clear();
+    records.shrink_to_fit();
+    bucketOf.clear();
+    bucketOf.shrink_to_fit();
+
+    std::vector<char> boundary(numFaces, 0);
+#pragma omp parallel for schedule(dynamic)
+    for (int b = 0; b < numBuckets; b++) {
+        auto begin = buckets.begin() + static_cast<long>(bucketOffsets[b]);
+        auto end = buckets.begin() + static_cast<long>(bucketOffsets[b + 1]);
+        std::sort(begin, end);
+        // equal faces are sorted by their element, so the last one of an odd run is kept
+        for (auto run = begin; run != end;) {
+            auto runEnd = run + 1;
+            while (runEnd != end && runEnd->isSameFace(*run)) {
+                ++runEnd;
+            }
+            if ((runEnd - run) % 2 == 1) {
+                const FaceRecord& last = *(runEnd - 1);
+                boundary[faceOffsets[last.element] + last.face] = 1;
+            }
+            run = runEnd;
+        }
+    }
+
+    std::vector<ElementFace> faces;
+    for (std::size_t i = 0; i < elements.size(); i++) {
+        for (std::size_t j = faceOffsets[i]; j < faceOffsets[i + 1]; j++) {
+            if (boundary[j]) {
+                auto faceNo = static_cast<short>(volume ? j - faceOffsets[i] + 1 : 0);
+                faces.push_back({elements[i], faceNo});
+            }
+        }
+    }
+    return faces;
+}
+
 namespace
 {
 class NastranElement
@@ -1883,6 +2197,7 @@ void FemMesh::read(const char* FileName)
 {
     Base::FileInfo File(FileName);
     _Mtrx = Base::Matrix4D();
+    boundaryFaces.reset();
 
     // checking on the file
     if (!File.isReadable()) {
@@ -2679,6 +2994,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
     file.close();
 
     // read the shape from the temp file
+    boundaryFaces.reset();
     myMesh->UNVToMesh(fi.filePath().c_str());
 
     // delete the temp file
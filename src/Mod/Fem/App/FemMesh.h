@@ -38,6 +38,8 @@
 class SMESH_Gen;
 class SMESH_Mesh;
 class SMESH_Hypothesis;
+class SMDS_MeshElement;
+class SMDS_MeshNode;
 class TopoDS_Shape;
 class TopoDS_Face;
 class TopoDS_Edge;
@@ -151,6 +153,27 @@ public:
     std::set<int> getFacesOnly() const;
     //@}
 
+    /** @name Boundary */
+    //@{
+    /// A face of an element, \a faceNo is 0 for face elements and counts from 1 for volumes
+    struct ElementFace
+    {
+        const SMDS_MeshElement* element;
+        short faceNo;
+    };
+    /** The outer skin of the mesh. These are the faces of volumes that aren't shared with
+     *  another volume or, if there are no volumes, the face elements that don't occur twice.
+     *  The faces are cached until the mesh is modified through the non-const methods.
+     */
+    const std::vector<ElementFace>& getBoundaryFaces() const;
+    /// All faces of the volumes or, if there are no volumes, all face elements
+    std::vector<ElementFace> getElementFaces() const;
+    /** Gets the nodes of a face in the order used for display, i.e. the corner nodes
+     *  with the mid-side nodes in between. Returns the number of nodes, at most 8.
+     */
+    static int getFaceNodes(const ElementFace& face, const SMDS_MeshNode* nodes[8]);
+    //@}
+
     /** @name Placement control */
     //@{
     /// set the transformation
@@ -179,6 +202,12 @@ public:
     bool removeGroup(int);
     //@}
 
+    /** Adds the nodes, elements and groups of another mesh. Their IDs are shifted
+     *  behind the existing ones and groups of the same name and type are joined.
+     *  The nodes aren't merged with the existing nodes.
+     */
+    void append(const FemMesh&);
+
 
     struct FemMeshInfo
     {
@@ -211,10 +240,12 @@ public:
 
 private:
     void copyMeshData(const FemMesh&);
+    void addMeshData(const FemMesh&, int nodeOffset, int elementOffset, bool joinGroups);
     void readNastran(const std::string& Filename);
     void readNastran95(const std::string& Filename);
     void readZ88(const std::string& Filename);
     void readAbaqus(const std::string& Filename);
+    std::vector<ElementFace> findBoundaryFaces() const;
 
 private:
     /// positioning matrix
@@ -222,6 +253,7 @@ private:
     SMESH_Mesh* myMesh;
 
     std::list<SMESH_HypothesisPtr> hypoth;
+    mutable std::unique_ptr<std::vector<ElementFace>> boundaryFaces;
     static SMESH_Gen* _mesh_gen;
 };
 
@@ -25,8 +25,28 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QProcess>
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Builder.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ListIteratorOfListOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
 
 #ifdef FCWithNetgen
 #include <NETGENPlugin_Hypothesis.hxx>
@@ -34,8 +54,14 @@
 #endif
 #endif
 
+#include <App/Application.h>
 #include <App/DocumentObjectPy.h>
 #include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Sequencer.h>
+#include <Base/Stream.h>
+#include <Base/Tools.h>
 #include <Mod/Part/App/PartFeature.h>
 
 #include "FemMesh.h"
@@ -76,42 +102,297 @@ FemMeshShapeNetgenObject::FemMeshShapeNetgenObject()
         Prop_None,
         "allows to define the minimum number of mesh segments in which radiuses will be split");
     ADD_PROPERTY_TYPE(Optimize, (true), "MeshParams", Prop_None, "Optimize the resulting mesh");
+    ADD_PROPERTY_TYPE(ParallelSolids,
+                      (false),
+                      "MeshParams",
+                      Prop_None,
+                      "Mesh solids that don't share any faces, edges or vertices\n"
+                      "in parallel FreeCADCmd processes and merge the meshes");
 }
 
 FemMeshShapeNetgenObject::~FemMeshShapeNetgenObject() = default;
 
-App::DocumentObjectExecReturn* FemMeshShapeNetgenObject::execute()
-{
 #ifdef FCWithNetgen
+namespace
+{
 
-    Fem::FemMesh newMesh;
-
-    Part::Feature* feat = Shape.getValue<Part::Feature*>();
-    TopoDS_Shape shape = feat->Shape.getValue();
-
-    NETGENPlugin_Mesher myNetGenMesher(newMesh.getSMesh(), shape, true);
+void meshShape(const FemMeshShapeNetgenObject* obj, Fem::FemMesh& mesh, const TopoDS_Shape& shape)
+{
+    NETGENPlugin_Mesher myNetGenMesher(mesh.getSMesh(), shape, true);
 #if SMESH_VERSION_MAJOR >= 9
-    NETGENPlugin_Hypothesis* tet = new NETGENPlugin_Hypothesis(0, newMesh.getGenerator());
+    NETGENPlugin_Hypothesis* tet = new NETGENPlugin_Hypothesis(0, mesh.getGenerator());
 #else
-    NETGENPlugin_Hypothesis* tet = new NETGENPlugin_Hypothesis(0, 1, newMesh.getGenerator());
+    NETGENPlugin_Hypothesis* tet = new NETGENPlugin_Hypothesis(0, 1, mesh.getGenerator());
 #endif
-    tet->SetMaxSize(MaxSize.getValue());
-    tet->SetMinSize(MinSize.getValue());
-    tet->SetSecondOrder(SecondOrder.getValue());
-    tet->SetOptimize(Optimize.getValue());
-    int iFineness = Fineness.getValue();
+    tet->SetMaxSize(obj->MaxSize.getValue());
+    tet->SetMinSize(obj->MinSize.getValue());
+    tet->SetSecondOrder(obj->SecondOrder.getValue());
+    tet->SetOptimize(obj->Optimize.getValue());
+    int iFineness = obj->Fineness.getValue();
     tet->SetFineness((NETGENPlugin_Hypothesis::Fineness)iFineness);
     if (iFineness == 5) {
-        tet->SetGrowthRate(GrowthRate.getValue());
-        tet->SetNbSegPerEdge(NbSegsPerEdge.getValue());
-        tet->SetNbSegPerRadius(NbSegsPerRadius.getValue());
+        tet->SetGrowthRate(obj->GrowthRate.getValue());
+        tet->SetNbSegPerEdge(obj->NbSegsPerEdge.getValue());
+        tet->SetNbSegPerRadius(obj->NbSegsPerRadius.getValue());
     }
     myNetGenMesher.SetParameters(tet);
-    newMesh.getSMesh()->ShapeToMesh(shape);
+    mesh.getSMesh()->ShapeToMesh(shape);
 
     myNetGenMesher.Compute();
+}
+
+// Groups the solids of the shape into compounds of solids that are connected through a
+// shared vertex, edge or face. Returns an empty list if the shape has faces outside of solids.
+std::vector<TopoDS_Shape> getIndependentSolids(const TopoDS_Shape& shape)
+{
+    std::vector<TopoDS_Shape> compounds;
+    TopTools_IndexedMapOfShape solids;
+    TopExp::MapShapes(shape, TopAbs_SOLID, solids);
+    if (TopExp_Explorer(shape, TopAbs_FACE, TopAbs_SOLID).More()) {
+        return compounds;
+    }
+
+    std::vector<int> parent(solids.Extent());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](int index) {
+        while (parent[index] != index) {
+            index = parent[index] = parent[parent[index]];
+        }
+        return index;
+    };
+
+    // a shared face or edge also means a shared vertex
+    TopTools_IndexedDataMapOfShapeListOfShape ancestors;
+    TopExp::MapShapesAndAncestors(shape, TopAbs_VERTEX, TopAbs_SOLID, ancestors);
+    for (int i = 1; i <= ancestors.Extent(); i++) {
+        int first = -1;
+        for (TopTools_ListIteratorOfListOfShape it(ancestors(i)); it.More(); it.Next()) {
+            int index = find(solids.FindIndex(it.Value()) - 1);
+            if (first < 0) {
+                first = index;
+            }
+            else if (index != first) {
+                parent[index] = first;
+            }
+        }
+    }
+
+    std::map<int, std::size_t> groups;
+    BRep_Builder builder;
+    for (int i = 0; i < solids.Extent(); i++) {
+        auto it = groups.emplace(find(i), compounds.size());
+        if (it.second) {
+            TopoDS_Compound comp;
+            builder.MakeCompound(comp);
+            compounds.push_back(comp);
+        }
+        builder.Add(compounds[it.first->second], solids(i + 1));
+    }
+
+    return compounds;
+}
+
+// Netgen keeps its meshing parameters in global variables, so that it cannot run in several
+// threads, and forking this multithreaded process isn't safe either. Every group of solids is
+// meshed by a FreeCADCmd process instead that reads the group from a BREP file and writes
+// the mesh to a UNV file (the format of the FemMesh in the project file). Each process has its
+// own user configuration so that they don't overwrite each other's settings on exit.
+// The meshes are joined in the order of the groups, a group whose process failed is meshed
+// here. A process that exceeds the timeout or a cancel of the user aborts the recompute.
+class MeshProcess
+{
+public:
+    MeshProcess(const FemMeshShapeNetgenObject* obj,
+                const TopoDS_Shape& shape,
+                const QString& exe,
+                const QStringList& options)
+        : base(App::Application::getTempFileName())
+    {
+        BRepTools::Write(shape, (base + ".brep").c_str());
+
+        Base::ofstream str(Base::FileInfo(base + ".py"));
+        str.precision(std::numeric_limits<double>::max_digits10);
+        str << "import FreeCAD, Part, Fem\n"
+            << "doc = FreeCAD.newDocument()\n"
+            << "shape = doc.addObject('Part::Feature', 'Shape')\n"
+            << "shape.Shape = Part.read(\"" << file("brep") << "\")\n"
+            << "mesh = doc.addObject('Fem::FemMeshShapeNetgenObject', 'Mesh')\n"
+            << "mesh.Shape = shape\n"
+            << "mesh.MaxSize = " << obj->MaxSize.getValue() << "\n"
+            << "mesh.MinSize = " << obj->MinSize.getValue() << "\n"
+            << "mesh.SecondOrder = " << (obj->SecondOrder.getValue() ? "True" : "False") << "\n"
+            << "mesh.Fineness = '" << obj->Fineness.getValueAsString() << "'\n"
+            << "mesh.GrowthRate = " << obj->GrowthRate.getValue() << "\n"
+            << "mesh.NbSegsPerEdge = " << obj->NbSegsPerEdge.getValue() << "\n"
+            << "mesh.NbSegsPerRadius = " << obj->NbSegsPerRadius.getValue() << "\n"
+            << "mesh.Optimize = " << (obj->Optimize.getValue() ? "True" : "False") << "\n"
+            << "doc.recompute()\n"
+            << "if not mesh.isValid():\n"
+            << "    raise SystemExit(1)\n"
+            << "mesh.FemMesh.write(\"" << file("unv") << "\")\n";
+        str.close();
+
+        QStringList args(options);
+        args << QString::fromLatin1("-u") << QString::fromUtf8((base + ".cfg").c_str())
+             << QString::fromUtf8((base + ".py").c_str());
+        process.start(exe, args);
+    }
+    ~MeshProcess()
+    {
+        if (process.state() != QProcess::NotRunning) {
+            process.kill();
+            process.waitForFinished();
+        }
+        for (const char* ext : {".brep", ".py", ".cfg", ".unv"}) {
+            Base::FileInfo(base + ext).deleteFile();
+        }
+    }
+    MeshProcess(const MeshProcess&) = delete;
+    MeshProcess& operator=(const MeshProcess&) = delete;
+
+    // Waits at most \a msecs for the process, returns true if it has finished
+    bool wait(int msecs)
+    {
+        return process.state() == QProcess::NotRunning || process.waitForFinished(msecs);
+    }
+    // Reads the mesh of the process into \a mesh, returns false if it failed
+    bool read(Fem::FemMesh& mesh) const
+    {
+        Base::FileInfo fi(base + ".unv");
+        if (process.error() != QProcess::UnknownError
+            || process.exitStatus() != QProcess::NormalExit || process.exitCode() != 0
+            || !fi.exists() || fi.size() == 0) {
+            return false;
+        }
+        mesh.getSMesh()->UNVToMesh(fi.filePath().c_str());
+        return true;
+    }
+
+private:
+    std::string file(const char* ext) const
+    {
+        return Base::Tools::escapeEncodeFilename(base + "." + ext);
+    }
+
+    std::string base;
+    QProcess process;
+};
+
+// FreeCADCmd is installed next to the running executable, which on macOS is inside the
+// application bundle. Without an application instance the bin directory of the home path
+// is taken.
+QString commandLineExecutable()
+{
+#ifdef FC_OS_WIN32
+    QString name = QString::fromLatin1("FreeCADCmd.exe");
+#else
+    QString name = QString::fromLatin1("FreeCADCmd");
+#endif
+    if (QCoreApplication::instance()) {
+        QFileInfo fi(QDir(QCoreApplication::applicationDirPath()), name);
+        if (fi.isExecutable()) {
+            return fi.absoluteFilePath();
+        }
+    }
+
+    QString exe = QString::fromUtf8((App::Application::getHomePath() + "bin/").c_str()) + name;
+    Base::Console().Log("NetgenMesh: %s not found next to the executable, using %s\n",
+                        name.toUtf8().constData(),
+                        exe.toUtf8().constData());
+    return exe;
+}
+
+// The processes load the modules from the same additional paths as this one
+QStringList commandLineOptions()
+{
+    QStringList options;
+    const std::map<std::string, std::string>& config = App::Application::Config();
+    auto it = config.find("AdditionalModulePaths");
+    if (it != config.end()) {
+        for (const QString& path : QString::fromUtf8(it->second.c_str()).split(QLatin1Char(';'))) {
+            if (!path.isEmpty()) {
+                options << QString::fromLatin1("-M") << path;
+            }
+        }
+    }
+    return options;
+}
+
+void meshInProcesses(const FemMeshShapeNetgenObject* obj,
+                     Fem::FemMesh& mesh,
+                     const std::vector<TopoDS_Shape>& shapes)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Fem/Netgen");
+    long timeout = hGrp->GetInt("SolidGroupTimeout", 3600);
+    std::size_t maxProcesses = std::max(1U, std::thread::hardware_concurrency());
+    QString exe = commandLineExecutable();
+    QStringList options = commandLineOptions();
+
+    std::vector<std::unique_ptr<MeshProcess>> processes(shapes.size());
+    std::vector<QElapsedTimer> timers(shapes.size());
+    std::size_t next = 0;
+    std::size_t running = 0;
+
+    Base::SequencerLauncher seq("Meshing solids...", 0);
+    while (next < shapes.size() || running > 0) {
+        while (next < shapes.size() && running < maxProcesses) {
+            processes[next] = std::make_unique<MeshProcess>(obj, shapes[next], exe, options);
+            timers[next].start();
+            next++;
+            running++;
+        }
+
+        // throws if the user has canceled, the processes are killed on destruction
+        seq.next(true);
+
+        running = 0;
+        for (std::size_t i = 0; i < next; i++) {
+            if (processes[i]->wait(20)) {
+                continue;
+            }
+            if (timeout > 0 && timers[i].hasExpired(timeout * 1000)) {
+                throw Base::RuntimeError("NetgenMesh: meshing a group of solids timed out");
+            }
+            running++;
+        }
+    }
+
+    for (std::size_t i = 0; i < shapes.size(); i++) {
+        Fem::FemMesh part;
+        if (!processes[i]->read(part)) {
+            Base::Console().Log("NetgenMesh: meshing solid group %i in the main process\n",
+                                int(i));
+            meshShape(obj, part, shapes[i]);
+        }
+        processes[i].reset();
+        mesh.append(part);
+    }
+}
 
-    // throw Base::RuntimeError("Compute Done\n");
+}  // namespace
+#endif
+
+App::DocumentObjectExecReturn* FemMeshShapeNetgenObject::execute()
+{
+#ifdef FCWithNetgen
+
+    Fem::FemMesh newMesh;
+
+    Part::Feature* feat = Shape.getValue<Part::Feature*>();
+    TopoDS_Shape shape = feat->Shape.getValue();
+
+    std::vector<TopoDS_Shape> solids;
+    if (ParallelSolids.getValue()) {
+        solids = getIndependentSolids(shape);
+    }
+
+    if (solids.size() > 1) {
+        meshInProcesses(this, newMesh, solids);
+    }
+    else {
+        meshShape(this, newMesh, shape);
+    }
 
     SMESHDS_Mesh* data = const_cast<SMESH_Mesh*>(newMesh.getSMesh())->GetMeshDS();
     const SMDS_MeshInfo& info = data->GetMeshInfo();
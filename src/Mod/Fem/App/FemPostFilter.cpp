@@ -23,12 +23,21 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <set>
 #include <Python.h>
+#include <vtkCallbackCommand.h>
 #include <vtkDoubleArray.h>
 #include <vtkPointData.h>
+#include <vtkSMPTools.h>
 #endif
 
 #include <App/Document.h>
+#include <Base/Exception.h>
+#include <Base/Sequencer.h>
 
 #include "FemPostFilter.h"
 #include "FemPostPipeline.h"
@@ -39,10 +48,51 @@ using namespace App;
 
 PROPERTY_SOURCE(Fem::FemPostFilter, Fem::FemPostObject)
 
+namespace
+{
+// Clip, cut, contour, warp and probe filters of VTK run in parallel with the SMP tools
+// if the backend is a threaded one
+void initSMPTools()
+{
+    static std::once_flag flag;
+    std::call_once(flag, []() {
+#if (VTK_MAJOR_VERSION > 9) || (VTK_MAJOR_VERSION == 9 && VTK_MINOR_VERSION >= 1)
+        if (std::string(vtkSMPTools::GetBackend()) == "Sequential") {
+            vtkSMPTools::SetBackend("STDThread");
+        }
+#endif
+        vtkSMPTools::Initialize();
+    });
+}
+
+// shared between the worker thread running the filters and the thread waiting for it
+struct ProgressData
+{
+    std::atomic<double> progress {0.0};
+    std::atomic<bool> canceled {false};
+};
+
+// called by vtk on the worker thread
+void onProgress(vtkObject* caller, unsigned long /*eventId*/, void* clientData, void* callData)
+{
+    auto data = static_cast<ProgressData*>(clientData);
+    auto algorithm = vtkAlgorithm::SafeDownCast(caller);
+    if (!algorithm) {
+        return;
+    }
+
+    data->progress = *static_cast<double*>(callData);
+    if (data->canceled) {
+        algorithm->SetAbortExecute(1);
+    }
+}
+}  // namespace
+
 
 FemPostFilter::FemPostFilter()
 {
     ADD_PROPERTY(Input, (nullptr));
+    initSMPTools();
 }
 
 FemPostFilter::~FemPostFilter() = default;
@@ -73,21 +123,98 @@ DocumentObjectExecReturn* FemPostFilter::execute()
             return StdReturn;
         }
 
+        // an unchanged input keeps its pointer and modification time, so vtk only
+        // re-executes the algorithms whose parameters were modified
+        vtkAlgorithm* target = nullptr;
         if ((m_activePipeline == "DataAlongLine") || (m_activePipeline == "DataAtPoint")) {
-            pipe.filterSource->SetSourceData(getInputData());
-            pipe.filterTarget->Update();
-            Data.setValue(pipe.filterTarget->GetOutputDataObject(0));
+            pipe.filterSource->SetSourceData(data);
+            target = pipe.filterTarget;
         }
         else {
             pipe.source->SetInputDataObject(data);
-            pipe.target->Update();
-            Data.setValue(pipe.target->GetOutputDataObject(0));
+            target = pipe.target;
+        }
+
+        if (!updateAlgorithm(target, pipe)) {
+            return new App::DocumentObjectExecReturn("Filter execution canceled");
         }
+        setOutputData(target->GetOutputDataObject(0));
     }
 
     return StdReturn;
 }
 
+bool FemPostFilter::updateAlgorithm(vtkAlgorithm* algorithm, const FilterPipeline& pipe)
+{
+    Base::SequencerLauncher seq("Applying filter...", 100);
+    ProgressData data;
+
+    vtkSmartPointer<vtkCallbackCommand> callback = vtkSmartPointer<vtkCallbackCommand>::New();
+    callback->SetCallback(onProgress);
+    callback->SetClientData(&data);
+
+    std::set<vtkAlgorithm*> algorithms {pipe.source,
+                                        pipe.target,
+                                        pipe.filterSource,
+                                        pipe.filterTarget,
+                                        algorithm};
+    for (const auto& it : pipe.algorithmStorage) {
+        algorithms.insert(it);
+    }
+    algorithms.erase(nullptr);
+
+    std::vector<unsigned long> tags;
+    for (auto it : algorithms) {
+        tags.push_back(it->AddObserver(vtkCommand::ProgressEvent, callback));
+    }
+
+    // the filters run on a worker thread while this thread keeps the progress bar and the
+    // user interface responsive and passes a cancel request on to the filters
+    std::future<void> update = std::async(std::launch::async, [algorithm]() {
+        algorithm->Update();
+    });
+    while (update.wait_for(std::chrono::milliseconds(50)) != std::future_status::ready) {
+        if (data.canceled) {
+            continue;
+        }
+        try {
+            seq.setProgress(static_cast<std::size_t>(data.progress * 100.0));
+            Base::Sequencer().checkAbort();
+        }
+        catch (const Base::AbortException&) {
+            data.canceled = true;
+        }
+    }
+    update.get();
+
+    auto tag = tags.begin();
+    for (auto it : algorithms) {
+        it->RemoveObserver(*tag++);
+        if (data.canceled) {
+            // make sure the next update executes again
+            it->SetAbortExecute(0);
+            it->Modified();
+        }
+    }
+
+    return !data.canceled;
+}
+
+void FemPostFilter::setOutputData(vtkDataObject* output)
+{
+    vtkDataObject* current = Data.getValue();
+    if (output && output == m_lastOutput && output->GetMTime() == m_lastOutputTime
+        && current && current == m_lastData && current->GetMTime() == m_lastDataTime) {
+        return;
+    }
+
+    Data.setValue(output);
+    m_lastOutput = output;
+    m_lastOutputTime = output ? output->GetMTime() : 0;
+    m_lastData = Data.getValue();
+    m_lastDataTime = m_lastData ? m_lastData->GetMTime() : 0;
+}
+
 vtkDataObject* FemPostFilter::getInputData()
 {
     if (Input.getValue()) {
@@ -34,6 +34,7 @@
 #include <vtkTableBasedClipDataSet.h>
 #include <vtkVectorNorm.h>
 #include <vtkWarpVector.h>
+#include <vtkWeakPointer.h>
 
 #include <App/PropertyUnits.h>
 
@@ -71,10 +72,25 @@ protected:
     void setActiveFilterPipeline(std::string name);
     FilterPipeline& getFilterPipeline(std::string name);
 
+    /// Updates the algorithm on a worker thread with a progress indicator, returns false if
+    /// the user canceled
+    static bool updateAlgorithm(vtkAlgorithm* algorithm, const FilterPipeline& pipe);
+    /** Copies the output of a filter to Data. If neither the output nor Data were modified
+     * since the last call nothing is copied, so that downstream filters whose input is
+     * unchanged are not executed again.
+     */
+    void setOutputData(vtkDataObject* output);
+
 private:
     // handling of multiple pipelines which can be the filter
     std::map<std::string, FilterPipeline> m_pipelines;
     std::string m_activePipeline;
+
+    // the output copied to Data by the last execution
+    vtkWeakPointer<vtkDataObject> m_lastOutput;
+    vtkMTimeType m_lastOutputTime = 0;
+    vtkWeakPointer<vtkDataObject> m_lastData;
+    vtkMTimeType m_lastDataTime = 0;
 };
 
 // ***************************************************************************
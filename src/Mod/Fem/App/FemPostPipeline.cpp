@@ -24,6 +24,7 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
 #include <vtkAppendFilter.h>
 #include <vtkDataSetReader.h>
 #include <vtkImageData.h>
@@ -44,6 +45,7 @@
 #include "FemMeshObject.h"
 #include "FemPostPipeline.h"
 #include "FemPostPipelinePy.h"
+#include "FemResultStore.h"
 #include "FemVTKTools.h"
 
 
@@ -102,7 +104,7 @@ DocumentObjectExecReturn* FemPostPipeline::execute()
     // but if we are in parallel we need to combine all filter results
     if (Mode.getValue() == 0) {
         // serial
-        Data.setValue(getLastPostObject()->Data.getValue());
+        setOutputData(getLastPostObject()->Data.getValue());
     }
     else if (Mode.getValue() == 1) {
         // parallel, go through all filters and append the result
@@ -116,7 +118,7 @@ DocumentObjectExecReturn* FemPostPipeline::execute()
         }
 
         append->Update();
-        Data.setValue(append->GetOutputDataObject(0));
+        setOutputData(append->GetOutputDataObject(0));
     }
 
     return Fem::FemPostObject::execute();
@@ -298,7 +300,17 @@ void FemPostPipeline::load(FemResultObject* res)
 
     // Now copy the point data over
     // ***************************
-    FemVTKTools::exportFreeCADResult(res, grid);
+    const auto& store = res->ResultStore.getValue();
+    if (store && store->countTimeSteps() > 0) {
+        // only the fields of the shown time step are read from the mapped file
+        long step = std::clamp<long>(res->TimeStep.getValue(),
+                                     0,
+                                     static_cast<long>(store->countTimeSteps()) - 1);
+        FemVTKTools::exportResultStep(*store, static_cast<std::size_t>(step), grid);
+    }
+    else {
+        FemVTKTools::exportFreeCADResult(res, grid);
+    }
 
     Data.setValue(grid);
 }
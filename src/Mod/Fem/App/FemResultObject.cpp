@@ -40,11 +40,18 @@ FemResultObject::FemResultObject()
     ADD_PROPERTY_TYPE(NodeNumbers, (0), "NodeData", Prop_None, "Numbers of the result nodes");
     ADD_PROPERTY_TYPE(Stats, (0), "Data", Prop_None, "Statistics of the results");
     ADD_PROPERTY_TYPE(Time, (0), "Data", Prop_None, "Time of analysis increment");
+    ADD_PROPERTY_TYPE(ResultStore,
+                      (),
+                      "Data",
+                      Prop_None,
+                      "Result fields of all time steps, kept in a memory-mapped file");
+    ADD_PROPERTY_TYPE(TimeStep, (0), "Data", Prop_None, "Index of the time step that is shown");
 
     // make read-only for property editor
     NodeNumbers.setStatus(App::Property::ReadOnly, true);
     Stats.setStatus(App::Property::ReadOnly, true);
     Time.setStatus(App::Property::ReadOnly, true);
+    ResultStore.setStatus(App::Property::ReadOnly, true);
 }
 
 FemResultObject::~FemResultObject() = default;
@@ -54,6 +61,19 @@ short FemResultObject::mustExecute() const
     return 0;
 }
 
+void FemResultObject::onChanged(const App::Property* prop)
+{
+    if (prop == &TimeStep || prop == &ResultStore) {
+        // keep the time in sync with the shown step of the store
+        const auto& store = ResultStore.getValue();
+        long step = TimeStep.getValue();
+        if (store && step >= 0 && step < static_cast<long>(store->countTimeSteps())) {
+            Time.setValue(store->getTime(step));
+        }
+    }
+    App::DocumentObject::onChanged(prop);
+}
+
 PyObject* FemResultObject::getPyObject()
 {
     if (PythonObject.is(Py::_None())) {
@@ -27,6 +27,8 @@
 #include <App/FeaturePython.h>
 #include <Mod/Fem/FemGlobal.h>
 
+#include "FemResultStoreProperty.h"
+
 
 namespace Fem
 {
@@ -47,6 +49,10 @@ public:
     App::PropertyFloat Time;
     /// User defined results
     App::PropertyFloatList Stats;
+    /// Memory-mapped fields of large or transient results
+    PropertyFemResultStore ResultStore;
+    /// Index of the time step of ResultStore that is shown
+    App::PropertyInteger TimeStep;
     /// Displacement vectors of analysis
 
     /// returns the type name of the ViewProvider
@@ -60,6 +66,9 @@ public:
     }
     short mustExecute() const override;
     PyObject* getPyObject() override;
+
+protected:
+    void onChanged(const App::Property* prop) override;
 };
 
 using FemResultObjectPython = App::FeaturePythonT<FemResultObject>;
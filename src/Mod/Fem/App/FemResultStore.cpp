@@ -0,0 +1,376 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cstring>
+#include <QFile>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+
+#include "FemResultStore.h"
+
+
+using namespace Fem;
+
+namespace
+{
+// File layout:
+//   header:  magic, version, byte order mark
+//   data:    one array of doubles per field and time step, aligned to 8 bytes
+//   index:   number of time steps, then per step its time and the descriptions of its fields
+//   trailer: offset of the index, magic
+const char Magic[8] = {'F', 'C', 'R', 'S', 'T', 'O', 'R', 'E'};
+const uint32_t Version = 1;
+const uint32_t ByteOrderMark = 0x01020304;
+const uint64_t HeaderSize = 16;
+const uint64_t TrailerSize = 16;
+
+template<typename T>
+void writeValue(std::ostream& str, T value)
+{
+    str.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+class IndexReader
+{
+public:
+    IndexReader(const unsigned char* data, uint64_t pos, uint64_t end)
+        : data(data)
+        , pos(pos)
+        , end(end)
+    {}
+
+    template<typename T>
+    T read()
+    {
+        T value;
+        check(sizeof(T));
+        std::memcpy(&value, data + pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    std::string readString(uint32_t length)
+    {
+        check(length);
+        std::string str(reinterpret_cast<const char*>(data + pos), length);
+        pos += length;
+        return str;
+    }
+
+private:
+    void check(uint64_t size) const
+    {
+        if (size > end - pos) {
+            throw Base::FileException("Truncated index in result store");
+        }
+    }
+
+private:
+    const unsigned char* data;
+    uint64_t pos;
+    uint64_t end;
+};
+}  // namespace
+
+FemResultStore::FemResultStore() = default;
+
+FemResultStore::~FemResultStore()
+{
+    close();
+}
+
+void FemResultStore::create(const std::string& name, bool temp)
+{
+    close();
+    fileName = name;
+    temporary = temp;
+
+    output.open(Base::FileInfo(fileName), std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!output) {
+        throw Base::FileException("Cannot create result store", fileName.c_str());
+    }
+    output.write(Magic, sizeof(Magic));
+    writeValue(output, Version);
+    writeValue(output, ByteOrderMark);
+}
+
+std::size_t FemResultStore::addTimeStep(double time)
+{
+    if (!output.is_open()) {
+        throw Base::RuntimeError("Result store is not open for writing");
+    }
+    TimeStep step;
+    step.time = time;
+    steps.push_back(step);
+    return steps.size() - 1;
+}
+
+void FemResultStore::addField(const std::string& name,
+                              Location location,
+                              uint32_t components,
+                              const double* values,
+                              uint64_t tuples)
+{
+    if (!output.is_open()) {
+        throw Base::RuntimeError("Result store is not open for writing");
+    }
+    if (steps.empty()) {
+        throw Base::RuntimeError("No time step added to result store");
+    }
+    if (components == 0) {
+        throw Base::ValueError("Field must have at least one component");
+    }
+
+    align();
+    FieldInfo info;
+    info.name = name;
+    info.location = location;
+    info.components = components;
+    info.tuples = tuples;
+    info.offset = static_cast<uint64_t>(output.tellp());
+    output.write(reinterpret_cast<const char*>(values),
+                 static_cast<std::streamsize>(tuples * components * sizeof(double)));
+    if (!output) {
+        throw Base::FileException("Cannot write to result store", fileName.c_str());
+    }
+
+    // a field added twice to the same step replaces the previous one
+    auto& fields = steps.back().fields;
+    auto it = std::find_if(fields.begin(), fields.end(), [&name](const FieldInfo& field) {
+        return field.name == name;
+    });
+    if (it != fields.end()) {
+        *it = info;
+    }
+    else {
+        fields.push_back(info);
+    }
+}
+
+void FemResultStore::finish()
+{
+    if (!output.is_open()) {
+        throw Base::RuntimeError("Result store is not open for writing");
+    }
+    try {
+        writeIndex();
+        output.close();
+        if (output.fail()) {
+            throw Base::FileException("Cannot write to result store", fileName.c_str());
+        }
+        map();
+    }
+    catch (...) {
+        // removes a temporary file
+        close();
+        throw;
+    }
+}
+
+void FemResultStore::align()
+{
+    auto pos = static_cast<uint64_t>(output.tellp());
+    while (pos % sizeof(double) != 0) {
+        output.put('\0');
+        ++pos;
+    }
+}
+
+void FemResultStore::writeIndex()
+{
+    align();
+    auto indexOffset = static_cast<uint64_t>(output.tellp());
+    writeValue(output, static_cast<uint64_t>(steps.size()));
+    for (const auto& step : steps) {
+        writeValue(output, step.time);
+        writeValue(output, static_cast<uint64_t>(step.fields.size()));
+        for (const auto& field : step.fields) {
+            writeValue(output, static_cast<uint32_t>(field.name.size()));
+            output.write(field.name.c_str(), static_cast<std::streamsize>(field.name.size()));
+            writeValue(output, static_cast<uint32_t>(field.location));
+            writeValue(output, field.components);
+            writeValue(output, field.tuples);
+            writeValue(output, field.offset);
+        }
+    }
+    writeValue(output, indexOffset);
+    output.write(Magic, sizeof(Magic));
+}
+
+void FemResultStore::open(const std::string& name, bool temp)
+{
+    close();
+    fileName = name;
+    temporary = temp;
+    try {
+        map();
+        readIndex();
+    }
+    catch (...) {
+        close();
+        throw;
+    }
+}
+
+void FemResultStore::map()
+{
+    file = std::make_unique<QFile>(QString::fromStdString(fileName));
+    if (!file->open(QIODevice::ReadOnly)) {
+        file.reset();
+        throw Base::FileException("Cannot open result store", fileName.c_str());
+    }
+    mappedSize = static_cast<uint64_t>(file->size());
+    if (mappedSize < HeaderSize + TrailerSize) {
+        file.reset();
+        throw Base::FileException("Invalid result store", fileName.c_str());
+    }
+    // the OS loads the pages of a field only when it is accessed
+    mapped = file->map(0, file->size());
+    if (!mapped) {
+        file.reset();
+        throw Base::FileException("Cannot map result store", fileName.c_str());
+    }
+}
+
+void FemResultStore::readIndex()
+{
+    uint32_t version {};
+    uint32_t byteOrder {};
+    std::memcpy(&version, mapped + sizeof(Magic), sizeof(version));
+    std::memcpy(&byteOrder, mapped + sizeof(Magic) + sizeof(version), sizeof(byteOrder));
+    if (std::memcmp(mapped, Magic, sizeof(Magic)) != 0
+        || std::memcmp(mapped + mappedSize - sizeof(Magic), Magic, sizeof(Magic)) != 0) {
+        throw Base::FileException("Not a result store", fileName.c_str());
+    }
+    if (version != Version || byteOrder != ByteOrderMark) {
+        throw Base::FileException("Unsupported result store version or byte order",
+                                  fileName.c_str());
+    }
+
+    uint64_t indexEnd = mappedSize - TrailerSize;
+    uint64_t indexOffset {};
+    std::memcpy(&indexOffset, mapped + indexEnd, sizeof(indexOffset));
+    if (indexOffset < HeaderSize || indexOffset > indexEnd) {
+        throw Base::FileException("Invalid index in result store", fileName.c_str());
+    }
+
+    IndexReader reader(mapped, indexOffset, indexEnd);
+    auto numSteps = reader.read<uint64_t>();
+    steps.clear();
+    for (uint64_t i = 0; i < numSteps; i++) {
+        TimeStep step;
+        step.time = reader.read<double>();
+        auto numFields = reader.read<uint64_t>();
+        for (uint64_t j = 0; j < numFields; j++) {
+            FieldInfo field;
+            field.name = reader.readString(reader.read<uint32_t>());
+            field.location = static_cast<Location>(reader.read<uint32_t>());
+            field.components = reader.read<uint32_t>();
+            field.tuples = reader.read<uint64_t>();
+            field.offset = reader.read<uint64_t>();
+            // the size of the field is not computed as it may overflow
+            if (field.components == 0 || field.offset % sizeof(double) != 0
+                || field.offset < HeaderSize || field.offset > indexOffset
+                || field.tuples > (indexOffset - field.offset) / sizeof(double) / field.components) {
+                throw Base::FileException("Invalid field in result store", fileName.c_str());
+            }
+            step.fields.push_back(field);
+        }
+        steps.push_back(step);
+    }
+}
+
+void FemResultStore::close()
+{
+    if (output.is_open()) {
+        output.close();
+    }
+    if (file) {
+        if (mapped) {
+            file->unmap(const_cast<unsigned char*>(mapped));  // NOLINT
+        }
+        file->close();
+        file.reset();
+    }
+    mapped = nullptr;
+    mappedSize = 0;
+    steps.clear();
+    if (temporary && !fileName.empty()) {
+        Base::FileInfo(fileName).deleteFile();
+    }
+    temporary = false;
+    fileName.clear();
+}
+
+bool FemResultStore::isOpen() const
+{
+    return mapped != nullptr;
+}
+
+uint64_t FemResultStore::getFileSize() const
+{
+    return mappedSize;
+}
+
+double FemResultStore::getTime(std::size_t step) const
+{
+    return steps.at(step).time;
+}
+
+std::vector<std::string> FemResultStore::getFieldNames(std::size_t step) const
+{
+    std::vector<std::string> names;
+    for (const auto& field : steps.at(step).fields) {
+        names.push_back(field.name);
+    }
+    return names;
+}
+
+bool FemResultStore::hasField(std::size_t step, const std::string& name) const
+{
+    return getField(step, name).isValid();
+}
+
+FemResultStore::Field FemResultStore::getField(std::size_t step, const std::string& name) const
+{
+    Field result;
+    if (!mapped || step >= steps.size()) {
+        return result;
+    }
+    for (const auto& field : steps[step].fields) {
+        if (field.name == name) {
+            result.data = reinterpret_cast<const double*>(mapped + field.offset);  // NOLINT
+            result.tuples = field.tuples;
+            result.components = field.components;
+            result.location = field.location;
+            break;
+        }
+    }
+    return result;
+}
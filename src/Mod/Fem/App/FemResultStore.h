@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef FEM_FEMRESULTSTORE_H
+#define FEM_FEMRESULTSTORE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Base/Stream.h>
+#include <Mod/Fem/FemGlobal.h>
+
+class QFile;
+
+namespace Fem
+{
+
+/*!
+ * \brief The FemResultStore class
+ * Keeps the fields of a (transient) result in a binary file instead of document properties.
+ * Every field of every time step is stored as one contiguous array of doubles. The file is
+ * memory-mapped for reading so that only the pages of the fields that are actually accessed
+ * get loaded.
+ *
+ * The file is written once: create() it, then add the fields of each time step with
+ * addTimeStep() and addField() and call finish(). Only the field that is currently written
+ * is held in memory, so solver output can be streamed step by step.
+ */
+class FemExport FemResultStore
+{
+public:
+    enum Location
+    {
+        Node = 0,
+        Element = 1
+    };
+
+    struct FieldInfo
+    {
+        std::string name;
+        Location location {Node};
+        uint32_t components {1};
+        uint64_t tuples {0};
+        uint64_t offset {0};
+    };
+
+    struct TimeStep
+    {
+        double time {0.0};
+        std::vector<FieldInfo> fields;
+    };
+
+    /// A read-only view of a field that points into the mapped file
+    struct Field
+    {
+        const double* data {nullptr};
+        uint64_t tuples {0};
+        uint32_t components {0};
+        Location location {Node};
+
+        bool isValid() const
+        {
+            return data != nullptr;
+        }
+        double value(uint64_t tuple, uint32_t component = 0) const
+        {
+            return data[tuple * components + component];
+        }
+    };
+
+    FemResultStore();
+    ~FemResultStore();
+
+    FemResultStore(const FemResultStore&) = delete;
+    FemResultStore& operator=(const FemResultStore&) = delete;
+
+    /** @name Writing */
+    //@{
+    /// Creates a new store file. If \a temporary is true the file is removed on close().
+    void create(const std::string& fileName, bool temporary = false);
+    /// Starts a new time step, returns its index
+    std::size_t addTimeStep(double time);
+    /// Appends a field with \a tuples tuples of \a components values to the last time step
+    void addField(const std::string& name,
+                  Location location,
+                  uint32_t components,
+                  const double* values,
+                  uint64_t tuples);
+    /// Writes the index and opens the file for reading
+    void finish();
+    //@}
+
+    /** @name Reading */
+    //@{
+    /// Opens an existing store file. If \a temporary is true the file is removed on close().
+    void open(const std::string& fileName, bool temporary = false);
+    void close();
+    bool isOpen() const;
+    const std::string& getFileName() const
+    {
+        return fileName;
+    }
+    uint64_t getFileSize() const;
+    std::size_t countTimeSteps() const
+    {
+        return steps.size();
+    }
+    const std::vector<TimeStep>& getTimeSteps() const
+    {
+        return steps;
+    }
+    double getTime(std::size_t step) const;
+    std::vector<std::string> getFieldNames(std::size_t step) const;
+    bool hasField(std::size_t step, const std::string& name) const;
+    /// Returns the field \a name of time step \a step, or an invalid field if there is none
+    Field getField(std::size_t step, const std::string& name) const;
+    //@}
+
+private:
+    void writeIndex();
+    void readIndex();
+    void map();
+    void align();
+
+private:
+    std::string fileName;
+    bool temporary {false};
+    std::vector<TimeStep> steps;
+    Base::ofstream output;
+    std::unique_ptr<QFile> file;
+    const unsigned char* mapped {nullptr};
+    uint64_t mappedSize {0};
+};
+
+}  // namespace Fem
+
+
+#endif  // FEM_FEMRESULTSTORE_H
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <Python.h>
+#endif
+
+#include <App/Application.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Reader.h>
+#include <Base/Stream.h>
+#include <Base/Writer.h>
+#include <CXX/Objects.hxx>
+
+#include "FemResultStoreProperty.h"
+
+
+using namespace Fem;
+
+TYPESYSTEM_SOURCE(Fem::PropertyFemResultStore, App::Property)
+
+PropertyFemResultStore::PropertyFemResultStore() = default;
+
+PropertyFemResultStore::~PropertyFemResultStore() = default;
+
+void PropertyFemResultStore::setValue(const std::shared_ptr<FemResultStore>& store)
+{
+    aboutToSetValue();
+    _Store = store;
+    hasSetValue();
+}
+
+PyObject* PropertyFemResultStore::getPyObject()
+{
+    // the times of the stored steps, the fields are accessed with Fem.readResultField()
+    std::size_t count = _Store ? _Store->countTimeSteps() : 0;
+    Py::Tuple tuple(count);
+    for (std::size_t i = 0; i < count; i++) {
+        tuple.setItem(i, Py::Float(_Store->getTime(i)));
+    }
+    return Py::new_reference_to(tuple);
+}
+
+void PropertyFemResultStore::setPyObject(PyObject* value)
+{
+    if (value == Py_None) {
+        setValue(nullptr);
+    }
+    else if (PyUnicode_Check(value)) {
+        auto store = std::make_shared<FemResultStore>();
+        store->open(PyUnicode_AsUTF8(value));
+        setValue(store);
+    }
+    else {
+        std::string error = std::string("type must be 'str' or 'None', not ");
+        error += value->ob_type->tp_name;
+        throw Base::TypeError(error);
+    }
+}
+
+void PropertyFemResultStore::Save(Base::Writer& writer) const
+{
+    writer.Stream() << writer.ind() << "<ResultStore file=\"";
+    if (!writer.isForceXML() && _Store && _Store->isOpen()) {
+        writer.Stream() << writer.addFile("ResultStore.bin", this);
+    }
+    writer.Stream() << "\"/>" << std::endl;
+}
+
+void PropertyFemResultStore::Restore(Base::XMLReader& reader)
+{
+    reader.readElement("ResultStore");
+    std::string file(reader.getAttribute("file"));
+    if (!file.empty()) {
+        // initiate a file read
+        reader.addFile(file.c_str(), this);
+    }
+    else {
+        setValue(nullptr);
+    }
+}
+
+void PropertyFemResultStore::SaveDocFile(Base::Writer& writer) const
+{
+    Base::ifstream file(Base::FileInfo(_Store->getFileName()), std::ios::in | std::ios::binary);
+    if (file) {
+        writer.Stream() << file.rdbuf();
+    }
+}
+
+void PropertyFemResultStore::RestoreDocFile(Base::Reader& reader)
+{
+    // the store is memory-mapped so it must live in a file of its own
+    Base::FileInfo fi(App::Application::getTempFileName().c_str());
+    Base::ofstream file(fi, std::ios::out | std::ios::binary);
+    if (reader) {
+        reader >> file.rdbuf();
+    }
+    file.close();
+
+    // the temporary file is removed if it cannot be opened
+    auto store = std::make_shared<FemResultStore>();
+    store->open(fi.filePath(), true);
+    setValue(store);
+}
+
+App::Property* PropertyFemResultStore::Copy() const
+{
+    auto prop = new PropertyFemResultStore();
+    prop->_Store = _Store;
+    return prop;
+}
+
+void PropertyFemResultStore::Paste(const App::Property& from)
+{
+    setValue(dynamic_cast<const PropertyFemResultStore&>(from)._Store);
+}
+
+unsigned int PropertyFemResultStore::getMemSize() const
+{
+    // the field data is not held in memory
+    std::size_t size = sizeof(FemResultStore);
+    if (_Store) {
+        for (const auto& step : _Store->getTimeSteps()) {
+            size += sizeof(step) + step.fields.size() * sizeof(FemResultStore::FieldInfo);
+        }
+    }
+    return static_cast<unsigned int>(size);
+}
+
+bool PropertyFemResultStore::isSame(const App::Property& other) const
+{
+    if (&other == this) {
+        return true;
+    }
+    return other.isDerivedFrom<PropertyFemResultStore>()
+        && static_cast<const PropertyFemResultStore&>(other)._Store == _Store;
+}
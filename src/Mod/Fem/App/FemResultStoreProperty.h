@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef FEM_PROPERTYFEMRESULTSTORE_H
+#define FEM_PROPERTYFEMRESULTSTORE_H
+
+#include <memory>
+
+#include <App/Property.h>
+
+#include "FemResultStore.h"
+
+
+namespace Fem
+{
+
+/** The result store property class.
+ * The store is shared between copies of the property as it is never modified once written.
+ * On save the store file is copied into the document, on restore it is extracted to a
+ * temporary file which is memory-mapped again.
+ */
+class FemExport PropertyFemResultStore: public App::Property
+{
+    TYPESYSTEM_HEADER_WITH_OVERRIDE();
+
+public:
+    PropertyFemResultStore();
+    ~PropertyFemResultStore() override;
+
+    /** @name Getter/setter */
+    //@{
+    void setValue(const std::shared_ptr<FemResultStore>& store);
+    /// does nothing, for add property macro
+    void setValue()
+    {}
+    const std::shared_ptr<FemResultStore>& getValue() const
+    {
+        return _Store;
+    }
+    //@}
+
+    /** @name Python interface */
+    //@{
+    PyObject* getPyObject() override;
+    void setPyObject(PyObject* value) override;
+    //@}
+
+    /** @name Save/restore */
+    //@{
+    void Save(Base::Writer& writer) const override;
+    void Restore(Base::XMLReader& reader) override;
+    void SaveDocFile(Base::Writer& writer) const override;
+    void RestoreDocFile(Base::Reader& reader) override;
+
+    App::Property* Copy() const override;
+    void Paste(const App::Property& from) override;
+    unsigned int getMemSize() const override;
+    bool isSame(const App::Property& other) const override;
+    //@}
+
+private:
+    std::shared_ptr<FemResultStore> _Store;
+};
+
+}  // namespace Fem
+
+
+#endif  // FEM_PROPERTYFEMRESULTSTORE_H
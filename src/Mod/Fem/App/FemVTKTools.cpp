@@ -34,6 +34,7 @@
 #include <SMESH_Mesh.hxx>
 
 #include <vtkCellArray.h>
+#include <vtkCellData.h>
 #include <vtkDataArray.h>
 #include <vtkDataSetReader.h>
 #include <vtkDataSetWriter.h>
@@ -69,6 +70,7 @@
 
 #include "FemAnalysis.h"
 #include "FemResultObject.h"
+#include "FemResultStore.h"
 #include "FemVTKTools.h"
 
 
@@ -530,6 +532,183 @@ App::DocumentObject* createObjectByType(const Base::Type type)
 }
 
 
+namespace
+{
+void importResultArrays(vtkFieldData* data,
+                        FemResultStore::Location location,
+                        FemResultStore& store)
+{
+    std::vector<double> values;
+    for (int i = 0; i < data->GetNumberOfArrays(); i++) {
+        vtkDataArray* array = vtkDataArray::SafeDownCast(data->GetAbstractArray(i));
+        if (!array || !array->GetName()) {
+            continue;
+        }
+
+        // only the array that is currently written is held in memory
+        vtkIdType tuples = array->GetNumberOfTuples();
+        int components = array->GetNumberOfComponents();
+        values.resize(static_cast<std::size_t>(tuples) * components);
+        for (vtkIdType j = 0; j < tuples; j++) {
+            array->GetTuple(j, &values[static_cast<std::size_t>(j) * components]);
+        }
+        store.addField(array->GetName(),
+                       location,
+                       static_cast<uint32_t>(components),
+                       values.data(),
+                       static_cast<uint64_t>(tuples));
+    }
+}
+
+void exportResultArrays(const FemResultStore& store,
+                        std::size_t step,
+                        FemResultStore::Location location,
+                        vtkIdType size,
+                        vtkFieldData* data)
+{
+    for (const auto& name : store.getFieldNames(step)) {
+        FemResultStore::Field field = store.getField(step, name);
+        if (field.location != location) {
+            continue;
+        }
+        if (static_cast<vtkIdType>(field.tuples) != size) {
+            Base::Console().Warning("Result field '%s' does not match the mesh, skipped\n",
+                                    name.c_str());
+            continue;
+        }
+
+        vtkSmartPointer<vtkDoubleArray> array = vtkSmartPointer<vtkDoubleArray>::New();
+        array->SetName(name.c_str());
+        array->SetNumberOfComponents(static_cast<int>(field.components));
+        array->SetNumberOfTuples(size);
+        std::copy(field.data,
+                  field.data + field.tuples * field.components,
+                  array->GetPointer(0));
+        data->AddArray(array);
+    }
+}
+}  // namespace
+
+void FemVTKTools::importResultStep(vtkSmartPointer<vtkDataSet> dataset,
+                                   FemResultStore& store,
+                                   double time)
+{
+    store.addTimeStep(time);
+    importResultArrays(dataset->GetPointData(), FemResultStore::Node, store);
+    importResultArrays(dataset->GetCellData(), FemResultStore::Element, store);
+}
+
+
+void FemVTKTools::exportResultStep(const FemResultStore& store,
+                                   std::size_t step,
+                                   vtkSmartPointer<vtkDataSet> grid)
+{
+    if (step >= store.countTimeSteps()) {
+        Base::Console().Error("Time step %d is not in the result store\n", int(step));
+        return;
+    }
+
+    // the node fields are stored in the order of the vtk points, i.e. by node id
+    exportResultArrays(store,
+                       step,
+                       FemResultStore::Node,
+                       grid->GetNumberOfPoints(),
+                       grid->GetPointData());
+    exportResultArrays(store,
+                       step,
+                       FemResultStore::Element,
+                       grid->GetNumberOfCells(),
+                       grid->GetCellData());
+}
+
+
+App::DocumentObject* FemVTKTools::readResultSteps(const std::vector<std::string>& filenames,
+                                                  const std::vector<double>& times,
+                                                  App::DocumentObject* res)
+{
+    if (filenames.empty()) {
+        return nullptr;
+    }
+
+    Base::TimeElapsed Start;
+    Base::Console().Log("Start: read transient FemResult from VTK files ======================\n");
+
+    auto readDataSet = [](const std::string& filename) {
+        Base::FileInfo f(filename);
+        vtkSmartPointer<vtkDataSet> ds;
+        if (!f.isReadable()) {
+            Base::Console().Error("Failed to read file %s\n", filename.c_str());
+        }
+        else if (f.hasExtension("vtu")) {
+            ds.TakeReference(readVTKFile<vtkXMLUnstructuredGridReader>(filename.c_str()));
+        }
+        else if (f.hasExtension("vtk")) {
+            ds.TakeReference(readVTKFile<vtkDataSetReader>(filename.c_str()));
+        }
+        else {
+            Base::Console().Error("file name extension is not supported\n");
+        }
+        return ds;
+    };
+
+    if (res && !res->isDerivedFrom<FemResultObject>()) {
+        Base::Console().Message("the result object is not the correct type, do nothing\n");
+        return nullptr;
+    }
+
+    // the mesh is taken from the first step
+    vtkSmartPointer<vtkDataSet> dataset = readDataSet(filenames.front());
+    if (!dataset) {
+        return nullptr;
+    }
+    std::unique_ptr<FemMesh> fmesh(new FemMesh());
+    importVTKMesh(dataset, fmesh.get());
+
+    // stream one step after the other into the store so that only a single step is in memory.
+    // The temporary file is removed by the store if this fails.
+    auto store = std::make_shared<FemResultStore>();
+    store->create(App::Application::getTempFileName(), true);
+    for (std::size_t i = 0; i < filenames.size(); i++) {
+        if (i > 0) {
+            dataset = readDataSet(filenames[i]);
+        }
+        if (!dataset) {
+            continue;
+        }
+        double time = i < times.size() ? times[i] : static_cast<double>(i);
+        importResultStep(dataset, *store, time);
+        dataset = nullptr;
+    }
+    store->finish();
+
+    // the document objects are only created once everything has been read
+    FemResultObject* result = nullptr;
+    if (res) {
+        result = static_cast<FemResultObject*>(res);
+    }
+    else {
+        result = static_cast<FemResultObject*>(
+            createObjectByType(FemResultObject::getClassTypeId()));
+    }
+    App::Document* pcDoc = result->getDocument();
+    App::DocumentObject* mesh = pcDoc->addObject("Fem::FemMeshObject", "ResultMesh");
+    static_cast<PropertyFemMesh*>(mesh->getPropertyByName("FemMesh"))->setValuePtr(fmesh.release());
+    result->Mesh.setValue(mesh);
+
+    result->ResultStore.setValue(store);
+    result->TimeStep.setValue(static_cast<long>(store->countTimeSteps()) - 1);
+
+    pcDoc->recompute();
+    Base::Console().Log("    %f: %d steps stored in %s\n",
+                        Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()),
+                        int(store->countTimeSteps()),
+                        store->getFileName().c_str());
+    Base::Console().Log("End: read transient FemResult from VTK files ======================\n");
+
+    return result;
+}
+
+
 App::DocumentObject* FemVTKTools::readResult(const char* filename, App::DocumentObject* res)
 {
     Base::TimeElapsed Start;
@@ -23,6 +23,9 @@
 #ifndef FEM_VTK_TOOLS_H
 #define FEM_VTK_TOOLS_H
 
+#include <string>
+#include <vector>
+
 #include <vtkDataSet.h>
 #include <vtkSmartPointer.h>
 #include <vtkUnstructuredGrid.h>
@@ -34,6 +37,8 @@
 
 namespace Fem
 {
+class FemResultStore;
+
 // utility class to import/export read/write vtk mesh and result
 class FemExport FemVTKTools
 {
@@ -69,6 +74,21 @@ public:
 
     // write FemResult (activeObject if res= NULL) to vtkUnstructuredGrid dataset file
     static void writeResult(const char* filename, const App::DocumentObject* res = nullptr);
+
+    // add the point and cell data arrays of a dataset as a new time step to a result store
+    static void
+    importResultStep(vtkSmartPointer<vtkDataSet> dataset, FemResultStore& store, double time);
+
+    // fill the point and cell data of a grid with the fields of one time step of a result store
+    static void exportResultStep(const FemResultStore& store,
+                                 std::size_t step,
+                                 vtkSmartPointer<vtkDataSet> grid);
+
+    // FemResult (created if res= NULL) of a transient analysis read from one vtkUnstructuredGrid
+    // dataset file per time step, the steps are streamed into the result store of the object
+    static App::DocumentObject* readResultSteps(const std::vector<std::string>& filenames,
+                                                const std::vector<double>& times,
+                                                App::DocumentObject* res = nullptr);
 };
 }  // namespace Fem
 
@@ -47,7 +47,6 @@
 #endif
 
 #include <App/DocumentObject.h>
-#include <Base/BoundBox.h>
 #include <Base/Console.h>
 #include <Base/TimeInfo.h>
 #include <Mod/Fem/App/FemMeshObject.h>
@@ -65,101 +64,17 @@ struct FemFace
     const SMDS_MeshElement* Element;
     unsigned short Size;
     unsigned short FaceNo;
-    bool hide;
-    Base::Vector3d getFirstNodePoint()
-    {
-        return Base::Vector3d(Nodes[0]->X(), Nodes[0]->Y(), Nodes[0]->Z());
-    }
-
-    Base::Vector3d set(short size,
-                       const SMDS_MeshElement* element,
-                       unsigned short id,
-                       short faceNo,
-                       const SMDS_MeshNode* n1,
-                       const SMDS_MeshNode* n2,
-                       const SMDS_MeshNode* n3,
-                       const SMDS_MeshNode* n4 = nullptr,
-                       const SMDS_MeshNode* n5 = nullptr,
-                       const SMDS_MeshNode* n6 = nullptr,
-                       const SMDS_MeshNode* n7 = nullptr,
-                       const SMDS_MeshNode* n8 = nullptr);
-
-    bool isSameFace(FemFace& face);
-};
-
-Base::Vector3d FemFace::set(short size,
-                            const SMDS_MeshElement* element,
-                            unsigned short id,
-                            short faceNo,
-                            const SMDS_MeshNode* n1,
-                            const SMDS_MeshNode* n2,
-                            const SMDS_MeshNode* n3,
-                            const SMDS_MeshNode* n4,
-                            const SMDS_MeshNode* n5,
-                            const SMDS_MeshNode* n6,
-                            const SMDS_MeshNode* n7,
-                            const SMDS_MeshNode* n8)
-{
-    Nodes[0] = n1;
-    Nodes[1] = n2;
-    Nodes[2] = n3;
-    Nodes[3] = n4;
-    Nodes[4] = n5;
-    Nodes[5] = n6;
-    Nodes[6] = n7;
-    Nodes[7] = n8;
-
-    Element = element;
-    ElementNumber = id;
-    Size = size;
-    FaceNo = faceNo;
-    hide = false;
-
-    // sorting the nodes for later easier comparison (bubble sort)
-    int i, j, flag = 1;         // set flag to 1 to start first pass
-    const SMDS_MeshNode* temp;  // holding variable
-
-    for (i = 1; (i <= size) && flag; i++) {
-        flag = 0;
-        for (j = 0; j < (size - 1); j++) {
-            if (Nodes[j + 1] > Nodes[j])  // ascending order simply changes to <
-            {
-                temp = Nodes[j];  // swap elements
-                Nodes[j] = Nodes[j + 1];
-                Nodes[j + 1] = temp;
-                flag = 1;  // indicates that a swap occurred.
-            }
-        }
-    }
-
-    return Base::Vector3d(Nodes[0]->X(), Nodes[0]->Y(), Nodes[0]->Z());
-}
 
-class FemFaceGridItem: public std::vector<FemFace*>
-{
-public:
-    // FemFaceGridItem(void){reserve(200);}
+    void set(const Fem::FemMesh::ElementFace& face);
 };
 
-bool FemFace::isSameFace(FemFace& face)
+void FemFace::set(const Fem::FemMesh::ElementFace& face)
 {
-    // the same element can not have the same face
-    if (face.ElementNumber == ElementNumber) {
-        return false;
-    }
-    if (face.Size != Size) {
-        return false;
-    }
-    // if the same face size just compare if the sorted nodes are the same
-    if (Nodes[0] == face.Nodes[0] && Nodes[1] == face.Nodes[1] && Nodes[2] == face.Nodes[2]
-        && Nodes[3] == face.Nodes[3] && Nodes[4] == face.Nodes[4] && Nodes[5] == face.Nodes[5]
-        && Nodes[6] == face.Nodes[6] && Nodes[7] == face.Nodes[7]) {
-        hide = true;
-        face.hide = true;
-        return true;
-    }
-
-    return false;
+    std::fill(std::begin(Nodes), std::end(Nodes), nullptr);
+    Size = Fem::FemMesh::getFaceNodes(face, Nodes);
+    Element = face.element;
+    ElementNumber = face.element->GetID();
+    FaceNo = face.faceNo;
 }
 
 // ----------------------------------------------------------------------------
@@ -988,618 +903,29 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
         onlyEdges = true;
     }
 
-    std::vector<FemFace> facesHelper(numTries);
+    // The outer skin is cached on the mesh. The inner faces are only shown for small meshes.
+    const Fem::FemMesh& femMesh = mesh->getValue();
+    std::vector<Fem::FemMesh::ElementFace> innerFaces;
+    const std::vector<Fem::FemMesh::ElementFace>* elementFaces = &innerFaces;
+    if (ShowInner && numTries < MaxFacesShowInner) {
+        innerFaces = femMesh.getElementFaces();
+    }
+    else {
+        Base::Console().Log("    %f: Start get boundary faces\n",
+                            Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
+        elementFaces = &femMesh.getBoundaryFaces();
+    }
 
+    std::vector<FemFace> facesHelper(elementFaces->size());
     Base::Console().Log("    %f: Start build up %i face helper\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()),
                         facesHelper.size());
-    Base::BoundBox3d BndBox;
-
-    int i = 0;
-
-    if (ShowFaces) {
-        SMDS_FaceIteratorPtr aFaceIter = data->facesIterator();
-        for (; aFaceIter->more();) {
-            const SMDS_MeshFace* aFace = aFaceIter->next();
-
-            int num = aFace->NbNodes();
-            switch (num) {
-                case 3:
-                    // tria3 face = N1, N2, N3
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(2)));
-                    break;
-                case 4:
-                    // quad4 face = N1, N2, N3, N4
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(3)));
-                    break;
-                case 6:
-                    // tria6 face = N1, N4, N2, N5, N3, N6
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(3),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(4),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(5)));
-                    break;
-                case 8:
-                    // quad8 face = N1, N5, N2, N6, N3, N7, N4, N8
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aFace,
-                                                    aFace->GetID(),
-                                                    0,
-                                                    aFace->GetNode(0),
-                                                    aFace->GetNode(4),
-                                                    aFace->GetNode(1),
-                                                    aFace->GetNode(5),
-                                                    aFace->GetNode(2),
-                                                    aFace->GetNode(6),
-                                                    aFace->GetNode(3),
-                                                    aFace->GetNode(7)));
-                    break;
-                default:
-                    // unknown face type
-                    throw std::runtime_error(
-                        "Node count not supported by ViewProviderFemMesh, [3|4|6|8] are allowed");
-            }
-        }
-    }
-    else {
-
-        // iterate all volumes
-        SMDS_VolumeIteratorPtr aVolIter = data->volumesIterator();
-        for (; aVolIter->more();) {
-            const SMDS_MeshVolume* aVol = aVolIter->next();
-
-            int num = aVol->NbNodes();
-
-            switch (num) {
-                // tetra4 volume
-                case 4:
-                    // face 1 = N1, N2, N3
-                    // face 2 = N1, N4, N2
-                    // face 3 = N2, N4, N3
-                    // face 4 = N3, N4, N1
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(0)));
-                    break;
-                // pyra5 volume
-                case 5:
-                    // face 1 = N1, N2, N3, N4
-                    // face 2 = N1, N5, N2
-                    // face 3 = N2, N5, N3
-                    // face 4 = N3, N5, N4
-                    // face 5 = N4, N5, N1
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(0)));
-                    break;
-                // penta6 volume
-                case 6:
-                    // face 1 = N1, N2, N3
-                    // face 2 = N4, N6, N5
-                    // face 3 = N1, N4, N5, N2
-                    // face 4 = N2, N5, N6, N3
-                    // face 5 = N3, N6, N4, N1
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(3,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(4)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(0)));
-                    break;
-                // hexa8 volume
-                case 8:
-                    // face 1 = N1, N2, N3, N4
-                    // face 2 = N5, N8, N7, N6
-                    // face 3 = N1, N5, N6, N2
-                    // face 4 = N2, N6, N7, N3
-                    // face 5 = N3, N7, N8, N4
-                    // face 6 = N4, N8, N5, N1
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(1)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(2)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3)));
-                    BndBox.Add(facesHelper[i++].set(4,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    6,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(0)));
-                    break;
-                // tetra10 volume
-                case 10:
-                    // face 1 = N1, N5,  N2, N6,  N3, N7
-                    // face 2 = N1, N8,  N4, N9,  N2, N5
-                    // face 3 = N2, N9,  N4, N10, N3, N6
-                    // face 4 = N3, N10, N4, N8,  N1, N7
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(4)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(6)));
-                    break;
-                // pyra13 volume
-                case 13:
-                    // face 1 = N1, N6, N2, N7,  N3,  N8, N4, N9
-                    // face 2 = N1, N10, N5, N11, N2, N6
-                    // face 3 = N2, N11, N5, N12, N3, N7
-                    // face 4 = N3, N12, N5, N13, N4, N8
-                    // face 5 = N4, N13, N5, N10, N1, N9
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(5)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(7)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8)));
-                    break;
-                // penta15 volume
-                case 15:
-                    // face 1 = N1, N7,  N2, N8,  N3, N9
-                    // face 2 = N4, N12, N6, N11, N5, N10
-                    // face 3 = N1, N13, N4, N10, N5, N14, N2, N7
-                    // face 4 = N2, N14, N5, N11, N6, N15, N3, N8
-                    // face 5 = N3, N15, N6, N12, N4, N13, N1, N9
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(6,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(9)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(6)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(7)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(11),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8)));
-                    break;
-                // hexa20 volume
-                case 20:
-                    // face 1 = N1, N9,  N2, N10, N3, N11, N4, N12
-                    // face 2 = N5, N16, N8, N15, N7, N14, N6, N13
-                    // face 3 = N1, N17, N5, N13, N6, N18, N2, N9
-                    // face 4 = N2, N18, N6, N14, N7, N19, N3, N10
-                    // face 5 = N3, N19, N7, N15, N8, N20, N4, N11
-                    // face 6 = N4, N20, N8, N16, N5, N17, N1, N12
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    1,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(8),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(9),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(10),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(11)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    2,
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(15),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(12)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    3,
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(16),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(12),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(17),
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(8)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    4,
-                                                    aVol->GetNode(1),
-                                                    aVol->GetNode(17),
-                                                    aVol->GetNode(5),
-                                                    aVol->GetNode(13),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(18),
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(9)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    5,
-                                                    aVol->GetNode(2),
-                                                    aVol->GetNode(18),
-                                                    aVol->GetNode(6),
-                                                    aVol->GetNode(14),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(19),
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(10)));
-                    BndBox.Add(facesHelper[i++].set(8,
-                                                    aVol,
-                                                    aVol->GetID(),
-                                                    6,
-                                                    aVol->GetNode(3),
-                                                    aVol->GetNode(19),
-                                                    aVol->GetNode(7),
-                                                    aVol->GetNode(15),
-                                                    aVol->GetNode(4),
-                                                    aVol->GetNode(16),
-                                                    aVol->GetNode(0),
-                                                    aVol->GetNode(11)));
-                    break;
-                // unknown volume type
-                default:
-                    throw std::runtime_error("Node count not supported by ViewProviderFemMesh, "
-                                             "[4|5|6|8|10|13|15|20] are allowed");
-            }
-        }
+    for (std::size_t i = 0; i < elementFaces->size(); i++) {
+        facesHelper[i].set((*elementFaces)[i]);
     }
     int FaceSize = facesHelper.size();
 
 
-    if (FaceSize < MaxFacesShowInner) {
-        Base::Console().Log("    %f: Start eliminate internal faces SIMPLE\n",
-                            Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
-
-        // search for double (inside) faces and hide them
-        if (!ShowInner) {
-            for (int l = 0; l < FaceSize; l++) {
-                if (!facesHelper[l].hide) {
-                    for (int i = l + 1; i < FaceSize; i++) {
-                        if (facesHelper[l].isSameFace(facesHelper[i])) {
-                            break;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    else {
-        Base::Console().Log("    %f: Start eliminate internal faces GRID\n",
-                            Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
-        BndBox.Enlarge(BndBox.CalcDiagonalLength() / 10000.0);
-        // calculate grid properties
-        double edge = pow(FaceSize, 1.0 / 3.0);
-        double edgeL = BndBox.LengthX() + BndBox.LengthY() + BndBox.LengthZ();
-        double gridFactor = 5.0;
-        double size = (edgeL / (3 * edge)) * gridFactor;
-
-        unsigned int NbrX = (unsigned int)(BndBox.LengthX() / size) + 1;
-        unsigned int NbrY = (unsigned int)(BndBox.LengthY() / size) + 1;
-        unsigned int NbrZ = (unsigned int)(BndBox.LengthZ() / size) + 1;
-        Base::Console().Log("      Size:F:%f,  X:%i  ,Y:%i  ,Z:%i\n", gridFactor, NbrX, NbrY, NbrZ);
-
-        double Xmin = BndBox.MinX;
-        double Ymin = BndBox.MinY;
-        double Zmin = BndBox.MinZ;
-        double Xln = BndBox.LengthX() / NbrX;
-        double Yln = BndBox.LengthY() / NbrY;
-        double Zln = BndBox.LengthZ() / NbrZ;
-
-        std::vector<FemFaceGridItem> Grid(NbrX * NbrY * NbrZ);
-
-
-        unsigned int iX = 0;
-        unsigned int iY = 0;
-        unsigned int iZ = 0;
-
-        for (int l = 0; l < FaceSize; l++) {
-            Base::Vector3d point(facesHelper[l].getFirstNodePoint());
-            double x = (point.x - Xmin) / Xln;
-            double y = (point.y - Ymin) / Yln;
-            double z = (point.z - Zmin) / Zln;
-
-            iX = x;
-            iY = y;
-            iZ = z;
-
-            if (iX >= NbrX || iY >= NbrY || iZ >= NbrZ) {
-                Base::Console().Log("      Outof range!\n");
-            }
-
-            Grid[iX + iY * NbrX + iZ * NbrX * NbrY].push_back(&facesHelper[l]);
-        }
-
-        unsigned int max = 0, avg = 0;
-        for (const auto& it : Grid) {
-            for (size_t l = 0; l < it.size(); l++) {
-                if (!it[l]->hide) {
-                    for (size_t i = l + 1; i < it.size(); i++) {
-                        if (it[l]->isSameFace(*(it[i]))) {
-                            break;
-                        }
-                    }
-                }
-            }
-            if (it.size() > max) {
-                max = it.size();
-            }
-            avg += it.size();
-        }
-        avg = avg / Grid.size();
-
-        Base::Console().Log("      VoxelSize: Max:%i ,Average:%i\n", max, avg);
-
-    }  // if( FaceSize < 1000)
-
-
     Base::Console().Log("    %f: Start build up node map\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 
@@ -1621,14 +947,12 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
     else {
 
         for (int l = 0; l < FaceSize; l++) {
-            if (!facesHelper[l].hide) {
-                for (auto Node : facesHelper[l].Nodes) {
-                    if (Node) {
-                        mapNodeIndex[Node] = 0;
-                    }
-                    else {
-                        break;
-                    }
+            for (auto Node : facesHelper[l].Nodes) {
+                if (Node) {
+                    mapNodeIndex[Node] = 0;
+                }
+                else {
+                    break;
                 }
             }
         }
@@ -1655,25 +979,23 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
     int triangleCount = 0;
     for (int l = 0; l < FaceSize; l++) {
-        if (!facesHelper[l].hide) {
-            switch (facesHelper[l].Size) {
-                case 3:
-                    triangleCount++;
-                    break;  // 3-node triangle face   --> 1 triangle
-                case 4:
-                    triangleCount += 2;
-                    break;  // 4-node quadrangle face --> 2 triangles
-                case 6:
-                    triangleCount += 4;
-                    break;  // 6-node triangle face   --> 4 triangles
-                case 8:
-                    triangleCount += 6;
-                    break;  // 8-node quadrangle face --> 6 triangles
-                default:
-                    throw std::runtime_error(
-                        "Face with unknown node count found, only display mode nodes is supported "
-                        "for this element (tiangleCount)");
-            }
+        switch (facesHelper[l].Size) {
+            case 3:
+                triangleCount++;
+                break;  // 3-node triangle face   --> 1 triangle
+            case 4:
+                triangleCount += 2;
+                break;  // 4-node quadrangle face --> 2 triangles
+            case 6:
+                triangleCount += 4;
+                break;  // 6-node triangle face   --> 4 triangles
+            case 8:
+                triangleCount += 6;
+                break;  // 8-node quadrangle face --> 6 triangles
+            default:
+                throw std::runtime_error(
+                    "Face with unknown node count found, only display mode nodes is supported "
+                    "for this element (tiangleCount)");
         }
     }
     Base::Console().Log("    NumTriangles:%i\n", triangleCount);
@@ -1717,1411 +1039,1409 @@ void ViewProviderFEMMeshBuilder::createMesh(const App::Property* prop,
     // iterate all non-hidden element faces, always assure CLOCKWISE triangle ordering to allow
     // backface culling
     for (int l = 0; l < FaceSize; l++) {
-        if (!facesHelper[l].hide) {
-            switch (facesHelper[l].Element->NbNodes()) {
-                // 3 nodes
-                case 3:
-                    // tria3 face
-                    switch (facesHelper[l].FaceNo) {
-                        case 0: {  // tria3 face, 3-node triangle
-                            // prefeche all node indexes of this face
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            // create triangle number 1
-                            // ---------------------------------------------- fill in the node
-                            // indexes in CLOCKWISE order
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            // add the three edge segments for that triangle
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx0);
-                            // remember the element and face number for that triangle
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            break;
-                        }
-                        default:
-                            assert(0);
+        switch (facesHelper[l].Element->NbNodes()) {
+            // 3 nodes
+            case 3:
+                // tria3 face
+                switch (facesHelper[l].FaceNo) {
+                    case 0: {  // tria3 face, 3-node triangle
+                        // prefeche all node indexes of this face
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        // create triangle number 1
+                        // ---------------------------------------------- fill in the node
+                        // indexes in CLOCKWISE order
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        // add the three edge segments for that triangle
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx0);
+                        // remember the element and face number for that triangle
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        break;
                     }
-                    break;
-                // 4 nodes
-                case 4:
-                    // quad4 face
-                    // tetra4 volume, four 3-node triangles
-                    switch (facesHelper[l].FaceNo) {
-                        case 0: {  // quad4 face, 4-node quadrangle
-                            // prefeche all node indexes of this face
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            // create triangle number 1
-                            // ---------------------------------------------- fill in the node
-                            // indexes in CLOCKWISE order
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            // add the two edge segments for that triangle
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            // remember the element and face number for that triangle
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            // create triangle number 2
-                            // ----------------------------------------------
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            break;
-                        }
-                        case 1: {  // tetra4 volume: face 1, 3-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            break;
-                        }
-                        case 2: {  // tetra4 volume: face 2, 3-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            break;
-                        }
-                        case 3: {  // tetra4 volume: face 3, 3-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            break;
-                        }
-                        case 4: {  // tetra4 volume: face 4, 3-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            break;
-                        }
-                        default:
-                            assert(0);
+                    default:
+                        assert(0);
+                }
+                break;
+            // 4 nodes
+            case 4:
+                // quad4 face
+                // tetra4 volume, four 3-node triangles
+                switch (facesHelper[l].FaceNo) {
+                    case 0: {  // quad4 face, 4-node quadrangle
+                        // prefeche all node indexes of this face
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        // create triangle number 1
+                        // ---------------------------------------------- fill in the node
+                        // indexes in CLOCKWISE order
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        // add the two edge segments for that triangle
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        // remember the element and face number for that triangle
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        // create triangle number 2
+                        // ----------------------------------------------
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        break;
                     }
-                    break;
-                // 5 nodes
-                case 5:
-                    // pyra5 volume, one 4-node quadrangle and four 3-node triangles
-                    switch (facesHelper[l].FaceNo) {
-                        case 1: {  // pyra5 volume: face 1, 4-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            break;
-                        }
-                        case 2: {  // pyra5 volume: face 2, 3-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            break;
-                        }
-                        case 3: {  // pyra5 volume: face 3, 3-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            break;
-                        }
-                        case 4: {  // pyra5 volume: face 4, 3-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            break;
-                        }
-                        case 5: {  // pyra5 volume: face 5, 3-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            break;
-                        }
-                        default:
-                            assert(0);
+                    case 1: {  // tetra4 volume: face 1, 3-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        break;
                     }
-                    break;
-                // 6 nodes
-                case 6:
-                    // tria6 face
-                    // penta6 volume, two 3-node triangle and three 4-node quadrangles
-                    switch (facesHelper[l].FaceNo) {
-                        case 0: {  // tria6 face, 6-node triangle
-                            // prefeche all node indexes of this face
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            // create triangle number 1
-                            // ---------------------------------------------- fill in the node
-                            // indexes in CLOCKWISE order
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            // add the two edge segments for that triangle
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            // remember the element and face number for that triangle
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            // create triangle number 2
-                            // ----------------------------------------------
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            // create triangle number 3
-                            // ----------------------------------------------
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            // create triangle number 4
-                            // ----------------------------------------------
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            // this triangle has no edge (inner triangle).
-                            break;
-                        }
-                        case 1: {  // penta6 volume: face 1, 3-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            break;
-                        }
-                        case 2: {  // penta6 volume: face 2, 3-node triangle
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx4;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx5);
-                            insEdgeVec(EdgeMap, nIdx5, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            break;
-                        }
-                        case 3: {  // penta6 volume: face 3, 4-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            break;
-                        }
-                        case 4: {  // penta6 volume: face 4, 4-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            break;
-                        }
-                        case 5: {  // penta6 volume: face 5, 4-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            break;
-                        }
-                        default:
-                            assert(0);
+                    case 2: {  // tetra4 volume: face 2, 3-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        break;
                     }
-                    break;
-                // 8 nodes
-                case 8:
-                    // quad8 face
-                    // hexa8 volume, six 4-node quadrangles
-                    switch (facesHelper[l].FaceNo) {
-                        case 0: {  // quad8 face, 8-node quadrangle
-                            // prefeche all node indexes of this face
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            // create triangle number 1
-                            // ---------------------------------------------- fill in the node
-                            // indexes in CLOCKWISE order
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            // add the two edge segments for that triangle
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            // remember the element and face number for that triangle
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            // create triangle number 2
-                            // ----------------------------------------------
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            // create triangle number 3
-                            // ----------------------------------------------
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            // create triangle number 4
-                            // ----------------------------------------------
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            // create triangle number 5
-                            // ----------------------------------------------
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            // this triangle has no edge (inner triangle)
-                            // create triangle number 6
-                            // ----------------------------------------------
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            // this triangle has no edge (inner triangle)
-                            break;
-                        }
-                        case 1: {  // hexa8 volume: face 1, 4-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            break;
-                        }
-                        case 2: {  // hexa8 volume: face 2, 4-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            break;
-                        }
-                        case 3: {  // hexa8 volume: face 3, 4-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            break;
-                        }
-                        case 4: {  // hexa8 volume: face 4, 4-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            break;
-                        }
-                        case 5: {  // hexa8 volume: face 5, 4-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            break;
-                        }
-                        case 6: {  // hexa8 volume: face 6, 4-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx0;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            insEdgeVec(EdgeMap, nIdx3, nIdx0);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
-                            break;
-                        }
-                        default:
-                            assert(0);
+                    case 3: {  // tetra4 volume: face 3, 3-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        break;
                     }
-                    break;
-                // 10 nodes
-                case 10:
-                    // tetra10 volume, four 6-node triangles
-                    switch (facesHelper[l].FaceNo) {
-                        case 1: {  // tetra10 volume: face 1, 6-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 2: {  // tetra10 volume: face 2, 6-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 3: {  // tetra10 volume: face 3, 6-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 4: {  // tetra10 volume: face 4, 6-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        default:
-                            assert(0);
+                    case 4: {  // tetra4 volume: face 4, 3-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        break;
                     }
-                    break;
-                // 13 nodes
-                case 13:
-                    // pyra13 volume, four 6-node triangle and one 8-node quadrangles
-                    switch (facesHelper[l].FaceNo) {
-                        case 1: {  // pyra13 volume: face 1, 8-node quadrangles
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 2: {  // pyra13 volume: face 2, 6-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 3: {  // pyra13 volume: face 3, 6-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 4: {  // pyra13 volume: face 4, 6-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 5: {  // pyra13 volume: face 5, 6-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        default:
-                            assert(0);
+                    default:
+                        assert(0);
+                }
+                break;
+            // 5 nodes
+            case 5:
+                // pyra5 volume, one 4-node quadrangle and four 3-node triangles
+                switch (facesHelper[l].FaceNo) {
+                    case 1: {  // pyra5 volume: face 1, 4-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        break;
                     }
-                    break;
-                // 15 nodes
-                case 15:
-                    // penta15 volume, two 6-node triangles and three 8-node quadrangles
-                    switch (facesHelper[l].FaceNo) {
-                        case 1: {  // penta15 volume: face 1, 6-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 2: {  // penta15 volume: face 2, 6-node triangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 3: {  // penta15 volume: face 3, 8-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(13)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 4: {  // penta15 volume: face 4, 8-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(13)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(14)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 5: {  // penta15 volume: face 5, 8-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(14)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        default:
-                            assert(0);
+                    case 2: {  // pyra5 volume: face 2, 3-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        break;
                     }
-                    break;
-                // 20 nodes
-                case 20:
-                    // hexa20 volume, six 8-node quadrangles
-                    switch (facesHelper[l].FaceNo) {
-                        case 1: {  // hexa20 volume: face 1
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 2: {  // hexa20 volume: face 2, 8-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(15)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(14)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(13)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 3: {  // hexa20 volume: face 3, 8-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(16)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(17)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 4: {  // hexa20 volume: face 4, 8-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(17)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(13)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(18)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 5: {  // hexa20 volume: face 5, 8-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(18)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(14)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(19)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        case 6: {  // hexa20 volume: face 6, 8-node quadrangle
-                            int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
-                            int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(19)];
-                            int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
-                            int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(15)];
-                            int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
-                            int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(16)];
-                            int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
-                            int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx0;
-                            indices[index++] = nIdx1;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx7, nIdx0);
-                            insEdgeVec(EdgeMap, nIdx0, nIdx1);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx2;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx1, nIdx2);
-                            insEdgeVec(EdgeMap, nIdx2, nIdx3);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx4;
-                            indices[index++] = nIdx5;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx3, nIdx4);
-                            insEdgeVec(EdgeMap, nIdx4, nIdx5);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx6;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            insEdgeVec(EdgeMap, nIdx5, nIdx6);
-                            insEdgeVec(EdgeMap, nIdx6, nIdx7);
-                            vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
-                            indices[index++] = nIdx7;
-                            indices[index++] = nIdx1;
-                            indices[index++] = nIdx3;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            indices[index++] = nIdx3;
-                            indices[index++] = nIdx5;
-                            indices[index++] = nIdx7;
-                            indices[index++] = SO_END_FACE_INDEX;
-                            break;
-                        }
-                        default:
-                            assert(0);
+                    case 3: {  // pyra5 volume: face 3, 3-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        break;
                     }
-                    break;
+                    case 4: {  // pyra5 volume: face 4, 3-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        break;
+                    }
+                    case 5: {  // pyra5 volume: face 5, 3-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        break;
+                    }
+                    default:
+                        assert(0);
+                }
+                break;
+            // 6 nodes
+            case 6:
+                // tria6 face
+                // penta6 volume, two 3-node triangle and three 4-node quadrangles
+                switch (facesHelper[l].FaceNo) {
+                    case 0: {  // tria6 face, 6-node triangle
+                        // prefeche all node indexes of this face
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        // create triangle number 1
+                        // ---------------------------------------------- fill in the node
+                        // indexes in CLOCKWISE order
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        // add the two edge segments for that triangle
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        // remember the element and face number for that triangle
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        // create triangle number 2
+                        // ----------------------------------------------
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        // create triangle number 3
+                        // ----------------------------------------------
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        // create triangle number 4
+                        // ----------------------------------------------
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        // this triangle has no edge (inner triangle).
+                        break;
+                    }
+                    case 1: {  // penta6 volume: face 1, 3-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        break;
+                    }
+                    case 2: {  // penta6 volume: face 2, 3-node triangle
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx4;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx5);
+                        insEdgeVec(EdgeMap, nIdx5, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        break;
+                    }
+                    case 3: {  // penta6 volume: face 3, 4-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        break;
+                    }
+                    case 4: {  // penta6 volume: face 4, 4-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        break;
+                    }
+                    case 5: {  // penta6 volume: face 5, 4-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        break;
+                    }
+                    default:
+                        assert(0);
+                }
+                break;
+            // 8 nodes
+            case 8:
+                // quad8 face
+                // hexa8 volume, six 4-node quadrangles
+                switch (facesHelper[l].FaceNo) {
+                    case 0: {  // quad8 face, 8-node quadrangle
+                        // prefeche all node indexes of this face
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        // create triangle number 1
+                        // ---------------------------------------------- fill in the node
+                        // indexes in CLOCKWISE order
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        // add the two edge segments for that triangle
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        // remember the element and face number for that triangle
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        // create triangle number 2
+                        // ----------------------------------------------
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        // create triangle number 3
+                        // ----------------------------------------------
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        // create triangle number 4
+                        // ----------------------------------------------
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        // create triangle number 5
+                        // ----------------------------------------------
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        // this triangle has no edge (inner triangle)
+                        // create triangle number 6
+                        // ----------------------------------------------
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        // this triangle has no edge (inner triangle)
+                        break;
+                    }
+                    case 1: {  // hexa8 volume: face 1, 4-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        break;
+                    }
+                    case 2: {  // hexa8 volume: face 2, 4-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        break;
+                    }
+                    case 3: {  // hexa8 volume: face 3, 4-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        break;
+                    }
+                    case 4: {  // hexa8 volume: face 4, 4-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        break;
+                    }
+                    case 5: {  // hexa8 volume: face 5, 4-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        break;
+                    }
+                    case 6: {  // hexa8 volume: face 6, 4-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx0;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        insEdgeVec(EdgeMap, nIdx3, nIdx0);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
+                        break;
+                    }
+                    default:
+                        assert(0);
+                }
+                break;
+            // 10 nodes
+            case 10:
+                // tetra10 volume, four 6-node triangles
+                switch (facesHelper[l].FaceNo) {
+                    case 1: {  // tetra10 volume: face 1, 6-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 2: {  // tetra10 volume: face 2, 6-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 3: {  // tetra10 volume: face 3, 6-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 4: {  // tetra10 volume: face 4, 6-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    default:
+                        assert(0);
+                }
+                break;
+            // 13 nodes
+            case 13:
+                // pyra13 volume, four 6-node triangle and one 8-node quadrangles
+                switch (facesHelper[l].FaceNo) {
+                    case 1: {  // pyra13 volume: face 1, 8-node quadrangles
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 2: {  // pyra13 volume: face 2, 6-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 3: {  // pyra13 volume: face 3, 6-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 4: {  // pyra13 volume: face 4, 6-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 5: {  // pyra13 volume: face 5, 6-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    default:
+                        assert(0);
+                }
+                break;
+            // 15 nodes
+            case 15:
+                // penta15 volume, two 6-node triangles and three 8-node quadrangles
+                switch (facesHelper[l].FaceNo) {
+                    case 1: {  // penta15 volume: face 1, 6-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 2: {  // penta15 volume: face 2, 6-node triangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 3: {  // penta15 volume: face 3, 8-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(13)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 4: {  // penta15 volume: face 4, 8-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(13)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(14)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 5: {  // penta15 volume: face 5, 8-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(14)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    default:
+                        assert(0);
+                }
+                break;
+            // 20 nodes
+            case 20:
+                // hexa20 volume, six 8-node quadrangles
+                switch (facesHelper[l].FaceNo) {
+                    case 1: {  // hexa20 volume: face 1
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 0);
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 2: {  // hexa20 volume: face 2, 8-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(15)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(14)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(13)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 1);
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 3: {  // hexa20 volume: face 3, 8-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(16)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(12)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(17)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(8)];
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 2);
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 4: {  // hexa20 volume: face 4, 8-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(1)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(17)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(5)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(13)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(18)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(9)];
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 3);
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 5: {  // hexa20 volume: face 5, 8-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(2)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(18)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(6)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(14)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(19)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(10)];
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 4);
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    case 6: {  // hexa20 volume: face 6, 8-node quadrangle
+                        int nIdx0 = mapNodeIndex[facesHelper[l].Element->GetNode(3)];
+                        int nIdx1 = mapNodeIndex[facesHelper[l].Element->GetNode(19)];
+                        int nIdx2 = mapNodeIndex[facesHelper[l].Element->GetNode(7)];
+                        int nIdx3 = mapNodeIndex[facesHelper[l].Element->GetNode(15)];
+                        int nIdx4 = mapNodeIndex[facesHelper[l].Element->GetNode(4)];
+                        int nIdx5 = mapNodeIndex[facesHelper[l].Element->GetNode(16)];
+                        int nIdx6 = mapNodeIndex[facesHelper[l].Element->GetNode(0)];
+                        int nIdx7 = mapNodeIndex[facesHelper[l].Element->GetNode(11)];
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx0;
+                        indices[index++] = nIdx1;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx7, nIdx0);
+                        insEdgeVec(EdgeMap, nIdx0, nIdx1);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx2;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx1, nIdx2);
+                        insEdgeVec(EdgeMap, nIdx2, nIdx3);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx4;
+                        indices[index++] = nIdx5;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx3, nIdx4);
+                        insEdgeVec(EdgeMap, nIdx4, nIdx5);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx6;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        insEdgeVec(EdgeMap, nIdx5, nIdx6);
+                        insEdgeVec(EdgeMap, nIdx6, nIdx7);
+                        vFaceElementIdx[indexIdx++] = ElemFold(facesHelper[l].ElementNumber, 5);
+                        indices[index++] = nIdx7;
+                        indices[index++] = nIdx1;
+                        indices[index++] = nIdx3;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        indices[index++] = nIdx3;
+                        indices[index++] = nIdx5;
+                        indices[index++] = nIdx7;
+                        indices[index++] = SO_END_FACE_INDEX;
+                        break;
+                    }
+                    default:
+                        assert(0);
+                }
+                break;
 
-                // not implemented elements
-                default:
-                    throw std::runtime_error(
-                        "Element with unknown node count found (may be not implemented), only "
-                        "display mode nodes is supported for this element (NodeCount)");
-            }
+            // not implemented elements
+            default:
+                throw std::runtime_error(
+                    "Element with unknown node count found (may be not implemented), only "
+                    "display mode nodes is supported for this element (NodeCount)");
         }
     }
 
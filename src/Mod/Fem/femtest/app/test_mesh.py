@@ -156,6 +156,40 @@ class TestMeshCommon(unittest.TestCase):
             "Nodes order of quadratic volume element is unexpected",
         )
 
+    # ********************************************************************************************
+    @unittest.skipUnless("BUILD_FEM_NETGEN" in FreeCAD.__cmake__, "FEM Netgen is not enabled")
+    def test_netgen_parallel_solids(self):
+        import Part
+        import ObjectsFem
+
+        # two separate boxes, they are meshed in two processes and the meshes are appended
+        shape = self.document.addObject("Part::Feature", "Boxes")
+        shape.Shape = Part.makeCompound(
+            [
+                Part.makeBox(10, 10, 10),
+                Part.makeBox(10, 10, 10, FreeCAD.Vector(20, 0, 0)),
+            ]
+        )
+        meshes = []
+        for parallel in (False, True):
+            mesh = ObjectsFem.makeMeshNetgen(self.document)
+            mesh.Shape = shape
+            mesh.MaxSize = 4.0
+            mesh.Fineness = "Moderate"
+            mesh.SecondOrder = True
+            mesh.ParallelSolids = parallel
+            meshes.append(mesh)
+        self.document.recompute()
+
+        serial = meshes[0].FemMesh
+        parallel = meshes[1].FemMesh
+        self.assertGreater(serial.VolumeCount, 0)
+        self.assertEqual(parallel.NodeCount, serial.NodeCount)
+        self.assertEqual(parallel.VolumeCount, serial.VolumeCount)
+        self.assertEqual(parallel.FaceCount, serial.FaceCount)
+        self.assertEqual(parallel.EdgeCount, serial.EdgeCount)
+        self.assertAlmostEqual(parallel.Volume.Value, serial.Volume.Value, places=6)
+
     # ********************************************************************************************
     def test_writeAbaqus_precision(self):
         # https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
@@ -25,6 +25,7 @@ __title__ = "Results FEM unit tests"
 __author__ = "Bernd Hahnebach"
 __url__ = "https://www.freecad.org"
 
+import os
 import unittest
 from os.path import join
 
@@ -205,3 +206,85 @@ class TestResult(unittest.TestCase):
         self.assertEqual(
             disp_abs, expected_dispabs, "Calculated displacement abs are not the expected values."
         )
+
+    # ********************************************************************************************
+    @unittest.skipUnless("BUILD_FEM_VTK" in FreeCAD.__cmake__, "FEM VTK is not enabled")
+    def test_result_store(self):
+        import Fem
+
+        vtk_file = join(testtools.get_fem_test_home_dir(), "mesh", "tetra10_mesh.vtk")
+        temp_dir = testtools.get_fem_test_tmp_dir("result_store")
+
+        # a step which cannot be read leaves nothing behind in the document
+        missing_file = join(temp_dir, "missing.vtk")
+        self.assertIsNone(Fem.readResultSteps([missing_file]))
+        self.assertEqual(len(self.document.Objects), 0)
+
+        res = Fem.readResultSteps([vtk_file, vtk_file], [0.5, 1.5])
+        self.assertIsNotNone(res)
+        self.assertEqual(res.ResultStore, (0.5, 1.5))
+        self.assertEqual(res.TimeStep, 1)
+        with self.assertRaises(ValueError):
+            Fem.readResultField(res, "NoSuchField")
+
+        # the steps are kept when the document is saved and restored
+        doc_file = join(temp_dir, "result_store.FCStd")
+        self.document.saveAs(doc_file)
+        FreeCAD.closeDocument(self.document.Name)
+        self.document = FreeCAD.openDocument(doc_file)
+        res = self.document.getObject(res.Name)
+        self.assertEqual(res.ResultStore, (0.5, 1.5))
+
+        # a store whose field size overflows is rejected and the file of the user is not removed
+        import struct
+
+        magic = b"FCRSTORE"
+        header = magic + struct.pack("=II", 1, 0x01020304)
+        index = struct.pack("=QdQI", 1, 0.0, 1, 1) + b"a"
+        index += struct.pack("=IIQQ", 0, 2**31, 2**62, len(header))
+        corrupt_file = join(temp_dir, "corrupt.bin")
+        with open(corrupt_file, "wb") as f:
+            f.write(header + index + struct.pack("=Q", len(header)) + magic)
+        with self.assertRaises(Exception):
+            res.ResultStore = corrupt_file
+        self.assertTrue(os.path.exists(corrupt_file))
+        self.assertEqual(res.ResultStore, (0.5, 1.5))
+
+    # ********************************************************************************************
+    @unittest.skipUnless("BUILD_FEM_VTK" in FreeCAD.__cmake__, "FEM VTK is not enabled")
+    def test_post_filter_cache(self):
+        import ObjectsFem
+        from feminout.importCcxFrdResults import importFrd
+
+        frd_file = join(testtools.get_fem_test_home_dir(), "calculix", "box_static.frd")
+        importFrd(frd_file)
+        pipeline = self.document.getObject("Pipeline_Results")
+        self.assertIsNotNone(pipeline)
+        warp = ObjectsFem.makePostVtkFilterWarp(self.document, pipeline)
+        clip = ObjectsFem.makePostVtkFilterClipScalar(self.document, pipeline)
+        self.document.recompute()
+
+        # records the filters whose output was copied to Data again
+        class DataObserver:
+            def __init__(self):
+                self.changed = set()
+
+            def slotChangedObject(self, obj, prop):
+                if prop == "Data":
+                    self.changed.add(obj.Name)
+
+        observer = DataObserver()
+        FreeCAD.addDocumentObserver(observer)
+        try:
+            # the filters execute again with unchanged inputs and keep their output
+            pipeline.recomputeChildren()
+            self.assertGreater(self.document.recompute(), 0)
+            self.assertFalse(observer.changed)
+
+            # only the filter with a modified parameter changes its output
+            clip.InsideOut = not clip.InsideOut
+            self.document.recompute()
+            self.assertIn(clip.Name, observer.changed)
+            self.assertNotIn(warp.Name, observer.changed)
+        finally:
+            FreeCAD.removeDocumentObserver(observer)
@@ -67,6 +67,11 @@ MaterialFilter::MaterialFilter()
 bool MaterialFilter::modelIncluded(const std::shared_ptr<Material>& material) const
 {
     for (const auto& complete : _requiredComplete) {
+        if (material->hasModel(complete)) {
+            // Completeness depends on the property values, which may not have been read yet
+            MaterialManager manager;
+            manager.dereference(material);
+        }
         if (!material->isModelComplete(complete)) {
             return false;
         }
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#endif
+
+#include <App/Application.h>
+
+#include "MaterialIndex.h"
+
+
+using namespace Materials;
+
+namespace
+{
+// "FCMI"
+constexpr quint32 IndexMagic = 0x46434D49;
+// Increment when the layout of the entries changes
+constexpr quint32 IndexVersion = 1;
+
+QDataStream& operator<<(QDataStream& stream, const MaterialIndexEntry& entry)
+{
+    stream << entry.path << entry.modified << entry.size << entry.uuid << entry.name
+           << entry.parentUuid << entry.author << entry.license << entry.description
+           << entry.physicalModels << entry.appearanceModels;
+    return stream;
+}
+
+QDataStream& operator>>(QDataStream& stream, MaterialIndexEntry& entry)
+{
+    stream >> entry.path >> entry.modified >> entry.size >> entry.uuid >> entry.name
+        >> entry.parentUuid >> entry.author >> entry.license >> entry.description
+        >> entry.physicalModels >> entry.appearanceModels;
+    return stream;
+}
+}  // namespace
+
+MaterialIndex::MaterialIndex(const QString& directory)
+    : MaterialIndex(directory, defaultIndexFile(directory))
+{}
+
+MaterialIndex::MaterialIndex(const QString& directory, const QString& indexFile)
+    : _directory(QDir(directory).absolutePath())
+    , _indexFile(indexFile)
+{}
+
+QString MaterialIndex::defaultIndexFile(const QString& directory)
+{
+    // One index per library directory
+    QByteArray hash = QCryptographicHash::hash(QDir(directory).absolutePath().toUtf8(),
+                                               QCryptographicHash::Md5);
+    QDir cache(QString::fromStdString(App::Application::getUserCachePath()));
+    return cache.filePath(QString::fromStdString("Material/")
+                          + QString::fromLatin1(hash.toHex())
+                          + QString::fromStdString(".index"));
+}
+
+QString MaterialIndex::relativePath(const QFileInfo& file) const
+{
+    return QDir(_directory).relativeFilePath(file.absoluteFilePath());
+}
+
+bool MaterialIndex::read()
+{
+    _entries.clear();
+
+    QFile file(_indexFile);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_6);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QString directory;
+    stream >> magic >> version >> directory;
+    if (magic != IndexMagic || version != IndexVersion || directory != _directory) {
+        return false;
+    }
+
+    quint32 count = 0;
+    stream >> count;
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; i++) {
+        MaterialIndexEntry entry;
+        stream >> entry;
+        _entries[entry.path] = entry;
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        // A truncated index is rebuilt
+        _entries.clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool MaterialIndex::write() const
+{
+    QFileInfo info(_indexFile);
+    if (!info.dir().exists() && !QDir().mkpath(info.absolutePath())) {
+        return false;
+    }
+
+    // Write to a temporary file first so that concurrent instances never read a partial index
+    QSaveFile file(_indexFile);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream << IndexMagic << IndexVersion << _directory;
+    stream << static_cast<quint32>(_entries.size());
+    for (const auto& it : _entries) {
+        stream << it.second;
+    }
+
+    return file.commit();
+}
+
+const MaterialIndexEntry* MaterialIndex::find(const QFileInfo& file) const
+{
+    auto it = _entries.find(relativePath(file));
+    if (it == _entries.end()) {
+        return nullptr;
+    }
+
+    const MaterialIndexEntry& entry = it->second;
+    if (entry.size != file.size()
+        || entry.modified != file.lastModified().toMSecsSinceEpoch()) {
+        return nullptr;
+    }
+
+    return &entry;
+}
+
+void MaterialIndex::insert(const QFileInfo& file, const MaterialIndexEntry& entry)
+{
+    MaterialIndexEntry& newEntry = _entries[relativePath(file)];
+    newEntry = entry;
+    newEntry.path = relativePath(file);
+    newEntry.modified = file.lastModified().toMSecsSinceEpoch();
+    newEntry.size = file.size();
+}
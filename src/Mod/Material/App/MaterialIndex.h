@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MATERIAL_MATERIALINDEX_H
+#define MATERIAL_MATERIALINDEX_H
+
+#include <map>
+
+#include <QString>
+#include <QStringList>
+
+#include <Mod/Material/MaterialGlobal.h>
+
+class QFileInfo;
+
+namespace Materials
+{
+
+/// The data of a material card that is needed before the card is fully read
+class MaterialsExport MaterialIndexEntry
+{
+public:
+    QString path;  // relative to the library directory
+    qint64 modified {0};
+    qint64 size {0};
+
+    QString uuid;
+    QString name;
+    QString parentUuid;
+    QString author;
+    QString license;
+    QString description;
+    QStringList physicalModels;
+    QStringList appearanceModels;
+};
+
+/*!
+ * \brief The MaterialIndex class
+ * A binary cache of the material cards of a library. An entry is valid as long as
+ * modification time and size of its card are unchanged, so that unchanged cards
+ * don't need to be parsed when the libraries are loaded.
+ */
+class MaterialsExport MaterialIndex
+{
+public:
+    /// Uses an index file in the user cache directory
+    explicit MaterialIndex(const QString& directory);
+    MaterialIndex(const QString& directory, const QString& indexFile);
+    ~MaterialIndex() = default;
+
+    QString getDirectory() const
+    {
+        return _directory;
+    }
+    QString getIndexFile() const
+    {
+        return _indexFile;
+    }
+    std::size_t size() const
+    {
+        return _entries.size();
+    }
+
+    /// Reads the index file. Returns false if it doesn't exist or is outdated.
+    bool read();
+    /// Writes the index file
+    bool write() const;
+
+    /// Returns the entry of the card if the card hasn't changed since it was indexed
+    const MaterialIndexEntry* find(const QFileInfo& file) const;
+    /// Adds the entry for the card, taking its time stamp and size from \a file
+    void insert(const QFileInfo& file, const MaterialIndexEntry& entry);
+    void clear()
+    {
+        _entries.clear();
+    }
+
+    static QString defaultIndexFile(const QString& directory);
+
+private:
+    QString relativePath(const QFileInfo& file) const;
+
+    QString _directory;
+    QString _indexFile;
+    std::map<QString, MaterialIndexEntry> _entries;
+};
+
+}  // namespace Materials
+
+#endif  // MATERIAL_MATERIALINDEX_H
@@ -27,6 +27,7 @@
 #include <QMetaType>
 #include <QRegularExpression>
 #include <QString>
+#include <QtConcurrentMap>
 #endif
 
 #include <App/Application.h>
@@ -45,6 +46,43 @@
 
 using namespace Materials;
 
+namespace
+{
+// A card that isn't in the library index
+struct MaterialCard
+{
+    QFileInfo file;
+    bool legacy {false};
+    bool readable {true};
+    YAML::Node yamlroot;
+    std::string error;
+};
+
+// Runs on a worker thread, so messages are reported by the caller
+void readCard(MaterialCard& card)
+{
+    QString path = card.file.canonicalFilePath();
+    if (MaterialConfigLoader::isConfigStyle(path)) {
+        card.legacy = true;
+        return;
+    }
+
+    Base::FileInfo info(path.toStdString());
+    Base::ifstream fin(info);
+    if (!fin) {
+        card.readable = false;
+        return;
+    }
+
+    try {
+        card.yamlroot = YAML::Load(fin);
+    }
+    catch (YAML::Exception const& e) {
+        card.error = e.what();
+    }
+}
+}  // namespace
+
 MaterialEntry::MaterialEntry(const std::shared_ptr<MaterialLibrary>& library,
                              const QString& modelName,
                              const QString& dir,
@@ -198,6 +236,15 @@ void MaterialYamlEntry::addToTree(
         }
     }
 
+    readModels(finalModel, yamlModel);
+
+    QString path = QDir(directory).absolutePath();
+    (*materialMap)[uuid] = library->addMaterial(finalModel, path);
+}
+
+void MaterialYamlEntry::readModels(const std::shared_ptr<Material>& material,
+                                   const YAML::Node& yamlModel)
+{
     // Add material models
     if (yamlModel["Models"]) {
         auto models = yamlModel["Models"];
@@ -207,36 +254,36 @@ void MaterialYamlEntry::addToTree(
             // Add the model uuid
             auto modelNode = models[modelName];
             auto modelUUID = modelNode["UUID"].as<std::string>();
-            finalModel->addPhysical(QString::fromStdString(modelUUID));
+            material->addPhysical(QString::fromStdString(modelUUID));
 
             // Add the property values
             auto properties = yamlModel["Models"][modelName];
             for (auto itp = properties.begin(); itp != properties.end(); itp++) {
                 auto propertyName = (itp->first).as<std::string>();
-                if (finalModel->hasPhysicalProperty(QString::fromStdString(propertyName))) {
+                if (material->hasPhysicalProperty(QString::fromStdString(propertyName))) {
                     auto prop =
-                        finalModel->getPhysicalProperty(QString::fromStdString(propertyName));
+                        material->getPhysicalProperty(QString::fromStdString(propertyName));
                     auto type = prop->getType();
 
                     try {
                         if (type == MaterialValue::List || type == MaterialValue::FileList) {
                             auto list = readList(itp->second);
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
+                            material->setPhysicalValue(QString::fromStdString(propertyName),
                                                          list);
                         }
                         else if (type == MaterialValue::ImageList) {
                             auto list = readImageList(itp->second);
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
+                            material->setPhysicalValue(QString::fromStdString(propertyName),
                                                          list);
                         }
                         else if (type == MaterialValue::Array2D) {
                             auto array2d = read2DArray(itp->second, prop->columns());
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
+                            material->setPhysicalValue(QString::fromStdString(propertyName),
                                                          array2d);
                         }
                         else if (type == MaterialValue::Array3D) {
                             auto array3d = read3DArray(itp->second, prop->columns());
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
+                            material->setPhysicalValue(QString::fromStdString(propertyName),
                                                          array3d);
                         }
                         else {
@@ -246,14 +293,14 @@ void MaterialYamlEntry::addToTree(
                                 propertyValue = propertyValue.remove(
                                     QRegularExpression(QString::fromStdString("[\r\n]")));
                             }
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
+                            material->setPhysicalValue(QString::fromStdString(propertyName),
                                                          propertyValue);
                         }
                     }
                     catch (const YAML::BadConversion& e) {
                         Base::Console().Log("Exception %s <%s:%s> - ignored\n",
                                             e.what(),
-                                            name.toStdString().c_str(),
+                                            material->getName().toStdString().c_str(),
                                             propertyName.c_str());
                     }
                 }
@@ -274,36 +321,36 @@ void MaterialYamlEntry::addToTree(
             // Add the model uuid
             auto modelNode = models[modelName];
             auto modelUUID = modelNode["UUID"].as<std::string>();
-            finalModel->addAppearance(QString::fromStdString(modelUUID));
+            material->addAppearance(QString::fromStdString(modelUUID));
 
             // Add the property values
             auto properties = yamlModel["AppearanceModels"][modelName];
             for (auto itp = properties.begin(); itp != properties.end(); itp++) {
                 auto propertyName = (itp->first).as<std::string>();
-                if (finalModel->hasAppearanceProperty(QString::fromStdString(propertyName))) {
+                if (material->hasAppearanceProperty(QString::fromStdString(propertyName))) {
                     auto prop =
-                        finalModel->getAppearanceProperty(QString::fromStdString(propertyName));
+                        material->getAppearanceProperty(QString::fromStdString(propertyName));
                     auto type = prop->getType();
 
                     try {
                         if (type == MaterialValue::List || type == MaterialValue::FileList) {
                             auto list = readList(itp->second);
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
+                            material->setAppearanceValue(QString::fromStdString(propertyName),
                                                            list);
                         }
                         else if (type == MaterialValue::ImageList) {
                             auto list = readImageList(itp->second);
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
+                            material->setAppearanceValue(QString::fromStdString(propertyName),
                                                            list);
                         }
                         else if (type == MaterialValue::Array2D) {
                             auto array2d = read2DArray(itp->second, prop->columns());
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
+                            material->setAppearanceValue(QString::fromStdString(propertyName),
                                                            array2d);
                         }
                         else if (type == MaterialValue::Array3D) {
                             auto array3d = read3DArray(itp->second, prop->columns());
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
+                            material->setAppearanceValue(QString::fromStdString(propertyName),
                                                            array3d);
                         }
                         else {
@@ -313,14 +360,14 @@ void MaterialYamlEntry::addToTree(
                                 propertyValue = propertyValue.remove(
                                     QRegularExpression(QString::fromStdString("[\r\n]")));
                             }
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
+                            material->setAppearanceValue(QString::fromStdString(propertyName),
                                                            propertyValue);
                         }
                     }
                     catch (const YAML::BadConversion& e) {
                         Base::Console().Log("Exception %s <%s:%s> - ignored\n",
                                             e.what(),
-                                            name.toStdString().c_str(),
+                                            material->getName().toStdString().c_str(),
                                             propertyName.c_str());
                     }
                 }
@@ -331,6 +378,71 @@ void MaterialYamlEntry::addToTree(
             }
         }
     }
+}
+
+MaterialIndexEntry MaterialYamlEntry::getIndexEntry() const
+{
+    const YAML::Node& yamlModel = getModel();
+
+    MaterialIndexEntry entry;
+    entry.uuid = getUUID();
+    entry.name = getName();
+    entry.author = yamlValue(yamlModel["General"], "Author", "");
+    entry.license = yamlValue(yamlModel["General"], "License", "");
+    entry.description = yamlValue(yamlModel["General"], "Description", "");
+
+    if (yamlModel["Inherits"]) {
+        auto inherits = yamlModel["Inherits"];
+        for (auto it = inherits.begin(); it != inherits.end(); it++) {
+            entry.parentUuid = QString::fromStdString(it->second["UUID"].as<std::string>());
+        }
+    }
+
+    if (yamlModel["Models"]) {
+        auto models = yamlModel["Models"];
+        for (auto it = models.begin(); it != models.end(); it++) {
+            entry.physicalModels << QString::fromStdString(it->second["UUID"].as<std::string>());
+        }
+    }
+
+    if (yamlModel["AppearanceModels"]) {
+        auto models = yamlModel["AppearanceModels"];
+        for (auto it = models.begin(); it != models.end(); it++) {
+            entry.appearanceModels << QString::fromStdString(it->second["UUID"].as<std::string>());
+        }
+    }
+
+    return entry;
+}
+
+//===
+
+MaterialIndexedEntry::MaterialIndexedEntry(const std::shared_ptr<MaterialLibrary>& library,
+                                           const QString& path,
+                                           const MaterialIndexEntry& entry)
+    : MaterialEntry(library, entry.name, path, entry.uuid)
+    , _entry(entry)
+{}
+
+void MaterialIndexedEntry::addToTree(
+    std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap)
+{
+    auto library = getLibrary();
+    auto directory = getDirectory();
+    QString uuid = getUUID();
+
+    std::shared_ptr<Material> finalModel =
+        std::make_shared<Material>(library, directory, uuid, getName());
+    finalModel->setAuthor(_entry.author);
+    finalModel->setLicense(_entry.license);
+    finalModel->setDescription(_entry.description);
+    finalModel->setParentUUID(_entry.parentUuid);
+    for (const auto& model : std::as_const(_entry.physicalModels)) {
+        finalModel->addPhysical(model);
+    }
+    for (const auto& model : std::as_const(_entry.appearanceModels)) {
+        finalModel->addAppearance(model);
+    }
 
     QString path = QDir(directory).absolutePath();
     (*materialMap)[uuid] = library->addMaterial(finalModel, path);
@@ -338,8 +450,8 @@ void MaterialYamlEntry::addToTree(
 
 //===
 
-std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>>
-    MaterialLoader::_materialEntryMap = nullptr;
+std::map<QString, MaterialLoader::DeferredMaterial> MaterialLoader::_deferredMap;
+std::recursive_mutex MaterialLoader::_deferredMutex;
 
 MaterialLoader::MaterialLoader(
     const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
@@ -386,49 +498,6 @@ MaterialLoader::getMaterialFromYAML(const std::shared_ptr<MaterialLibrary>& libr
     return model;
 }
 
-std::shared_ptr<MaterialEntry>
-MaterialLoader::getMaterialFromPath(const std::shared_ptr<MaterialLibrary>& library,
-                                    const QString& path) const
-{
-    std::shared_ptr<MaterialEntry> model = nullptr;
-
-    // Used for debugging
-    std::string pathName = path.toStdString();
-
-    if (MaterialConfigLoader::isConfigStyle(path)) {
-        auto material = MaterialConfigLoader::getMaterialFromPath(library, path);
-        if (material) {
-            (*_materialMap)[material->getUUID()] = library->addMaterial(material, path);
-        }
-
-        // Return the nullptr as there are no intermediate steps to take, such
-        // as checking inheritance
-        return model;
-    }
-
-    Base::FileInfo info(pathName);
-    Base::ifstream fin(info);
-    if (!fin) {
-        Base::Console().Error("YAML file open error: '%s'\n", pathName.c_str());
-        return model;
-    }
-
-    YAML::Node yamlroot;
-    try {
-        yamlroot = YAML::Load(fin);
-
-        model = getMaterialFromYAML(library, yamlroot, path);
-    }
-    catch (YAML::Exception const& e) {
-        Base::Console().Error("YAML parsing error: '%s'\n", pathName.c_str());
-        Base::Console().Error("\t'%s'\n", e.what());
-        showYaml(yamlroot);
-    }
-
-
-    return model;
-}
-
 void MaterialLoader::showYaml(const YAML::Node& yaml)
 {
     std::stringstream out;
@@ -443,6 +512,9 @@ void MaterialLoader::dereference(
     const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
     const std::shared_ptr<Material>& material)
 {
+    // Materials from the library index are read on first use
+    loadDeferred(material);
+
     // Avoid recursion
     if (material->getDereferenced()) {
         return;
@@ -511,33 +583,194 @@ void MaterialLoader::dereference(const std::shared_ptr<Material>& material)
     dereference(_materialMap, material);
 }
 
-void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibrary>& library)
+void MaterialLoader::inheritModels(
+    const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
+    const std::shared_ptr<Material>& material)
 {
-    if (_materialEntryMap == nullptr) {
-        _materialEntryMap = std::make_unique<std::map<QString, std::shared_ptr<MaterialEntry>>>();
+    // Limit the depth in case of an inheritance cycle
+    auto parentUUID = material->getParentUUID();
+    for (int depth = 0; !parentUUID.isEmpty() && depth < 100; depth++) {
+        auto it = materialMap->find(parentUUID);
+        if (it == materialMap->end()) {
+            return;
+        }
+        auto parent = it->second;
+
+        auto modelVector = parent->getPhysicalModels();
+        for (auto& model : *modelVector) {
+            if (!material->hasPhysicalModel(model)) {
+                material->addPhysical(model);
+            }
+        }
+
+        modelVector = parent->getAppearanceModels();
+        for (auto& model : *modelVector) {
+            if (!material->hasAppearanceModel(model)) {
+                material->addAppearance(model);
+            }
+        }
+
+        parentUUID = parent->getParentUUID();
+    }
+}
+
+void MaterialLoader::loadDeferred(const std::shared_ptr<Material>& material)
+{
+    std::lock_guard<std::recursive_mutex> lock(_deferredMutex);
+
+    auto it = _deferredMap.find(material->getUUID());
+    if (it == _deferredMap.end() || it->second.material.lock() != material) {
+        return;
+    }
+
+    QString path = it->second.path;
+    _deferredMap.erase(it);
+
+    // The card may have been moved by renaming its folder
+    auto library = material->getLibrary();
+    if (library) {
+        QString localPath = library->getLocalPath(material->getDirectory());
+        if (QFileInfo::exists(localPath)) {
+            path = localPath;
+        }
     }
 
+    std::string pathName = path.toStdString();
+
+    Base::FileInfo info(pathName);
+    Base::ifstream fin(info);
+    if (!fin) {
+        Base::Console().Error("YAML file open error: '%s'\n", pathName.c_str());
+        return;
+    }
+
+    YAML::Node yamlroot;
+    try {
+        yamlroot = YAML::Load(fin);
+        MaterialYamlEntry::readModels(material, yamlroot);
+    }
+    catch (YAML::Exception const& e) {
+        Base::Console().Error("YAML parsing error: '%s'\n", pathName.c_str());
+        Base::Console().Error("\t'%s'\n", e.what());
+        showYaml(yamlroot);
+    }
+}
+
+void MaterialLoader::loadDeferred(
+    const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap)
+{
+    std::lock_guard<std::recursive_mutex> lock(_deferredMutex);
+    if (_deferredMap.empty()) {
+        return;
+    }
+
+    for (auto& it : *materialMap) {
+        dereference(materialMap, it.second);
+    }
+}
+
+bool MaterialLoader::isDeferred(const std::shared_ptr<Material>& material)
+{
+    std::lock_guard<std::recursive_mutex> lock(_deferredMutex);
+
+    auto it = _deferredMap.find(material->getUUID());
+    return it != _deferredMap.end() && it->second.material.lock() == material;
+}
+
+void MaterialLoader::clearDeferred()
+{
+    std::lock_guard<std::recursive_mutex> lock(_deferredMutex);
+    _deferredMap.clear();
+}
+
+void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibrary>& library)
+{
+    MaterialIndex index(library->getDirectory());
+    bool modified = !index.read();
+    MaterialIndex newIndex(library->getDirectory(), index.getIndexFile());
+
+    std::map<QString, std::shared_ptr<MaterialEntry>> entryMap;
+    std::vector<MaterialCard> cards;
+
     QDirIterator it(library->getDirectory(), QDirIterator::Subdirectories);
     while (it.hasNext()) {
         auto pathname = it.next();
         QFileInfo file(pathname);
         if (file.isFile()) {
             if (file.suffix().toStdString() == "FCMat") {
-                try {
-                    auto model = getMaterialFromPath(library, file.canonicalFilePath());
-                    if (model) {
-                        (*_materialEntryMap)[model->getUUID()] = model;
-                    }
+                // Unchanged cards are taken from the index without being parsed
+                auto entry = index.find(file);
+                if (entry) {
+                    newIndex.insert(file, *entry);
+                    entryMap[entry->uuid] =
+                        std::make_shared<MaterialIndexedEntry>(library,
+                                                               file.canonicalFilePath(),
+                                                               *entry);
                 }
-                catch (const MaterialReadError&) {
-                    // Ignore the file. Error messages should have already been logged
+                else {
+                    MaterialCard card;
+                    card.file = file;
+                    cards.push_back(card);
                 }
             }
         }
     }
 
-    for (auto& it : *_materialEntryMap) {
+    // New and modified cards are parsed in parallel
+    QtConcurrent::blockingMap(cards, readCard);
+
+    for (auto& card : cards) {
+        QString path = card.file.canonicalFilePath();
+        if (card.legacy) {
+            try {
+                auto material = MaterialConfigLoader::getMaterialFromPath(library, path);
+                if (material) {
+                    (*_materialMap)[material->getUUID()] = library->addMaterial(material, path);
+                }
+            }
+            catch (const MaterialReadError&) {
+                // Ignore the file. Error messages should have already been logged
+            }
+            continue;
+        }
+
+        if (!card.readable) {
+            Base::Console().Error("YAML file open error: '%s'\n", path.toStdString().c_str());
+            continue;
+        }
+        if (!card.error.empty()) {
+            Base::Console().Error("YAML parsing error: '%s'\n", path.toStdString().c_str());
+            Base::Console().Error("\t'%s'\n", card.error.c_str());
+            showYaml(card.yamlroot);
+            continue;
+        }
+
+        auto model = getMaterialFromYAML(library, card.yamlroot, path);
+        if (model) {
+            auto yamlEntry = std::static_pointer_cast<MaterialYamlEntry>(model);
+            newIndex.insert(card.file, yamlEntry->getIndexEntry());
+            entryMap[model->getUUID()] = model;
+            modified = true;
+        }
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(_deferredMutex);
+    for (auto& it : entryMap) {
         it.second->addToTree(_materialMap);
+        if (std::dynamic_pointer_cast<MaterialIndexedEntry>(it.second)) {
+            DeferredMaterial deferred;
+            deferred.material = (*_materialMap)[it.first];
+            deferred.path = it.second->getDirectory();
+            _deferredMap[it.first] = deferred;
+        }
+    }
+
+    // Rewrite the index if cards were added, changed or removed
+    if (modified || newIndex.size() != index.size()) {
+        if (!newIndex.write()) {
+            Base::Console().Log("Unable to write material index '%s'\n",
+                                newIndex.getIndexFile().toStdString().c_str());
+        }
     }
 }
 
@@ -550,8 +783,15 @@ void MaterialLoader::loadLibraries()
         }
     }
 
+    // Deferred materials only get the models of their parents until they are loaded.
+    // Dereferencing any other material loads its parents.
     for (auto& it : *_materialMap) {
-        dereference(it.second);
+        if (isDeferred(it.second)) {
+            inheritModels(_materialMap, it.second);
+        }
+        else {
+            dereference(it.second);
+        }
     }
 }
 
@@ -22,12 +22,15 @@
 #ifndef MATERIAL_MATERIALLOADER_H
 #define MATERIAL_MATERIALLOADER_H
 
+#include <map>
 #include <memory>
+#include <mutex>
 
 #include <QDir>
 #include <QString>
 #include <yaml-cpp/yaml.h>
 
+#include "MaterialIndex.h"
 #include "Materials.h"
 #include "trim.h"
 
@@ -92,6 +95,10 @@ public:
     {
         return &_model;
     }
+    MaterialIndexEntry getIndexEntry() const;
+
+    /// Adds the models and property values of the card to the material
+    static void readModels(const std::shared_ptr<Material>& material, const YAML::Node& yamlModel);
 
 private:
     MaterialYamlEntry();
@@ -107,6 +114,25 @@ private:
     YAML::Node _model;
 };
 
+/*!
+ * A card taken from the library index. The material is created with its models only,
+ * the property values are read when the material is requested.
+ */
+class MaterialIndexedEntry: public MaterialEntry
+{
+public:
+    MaterialIndexedEntry(const std::shared_ptr<MaterialLibrary>& library,
+                         const QString& path,
+                         const MaterialIndexEntry& entry);
+    ~MaterialIndexedEntry() override = default;
+
+    void
+    addToTree(std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap) override;
+
+private:
+    MaterialIndexEntry _entry;
+};
+
 class MaterialLoader
 {
 public:
@@ -125,18 +151,33 @@ public:
                         YAML::Node& yamlroot,
                         const QString& path);
 
+    /// Reads the property values of a material created from the library index
+    static void loadDeferred(const std::shared_ptr<Material>& material);
+    static void
+    loadDeferred(const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap);
+    static bool isDeferred(const std::shared_ptr<Material>& material);
+    static void clearDeferred();
+
 private:
     MaterialLoader();
 
+    struct DeferredMaterial
+    {
+        std::weak_ptr<Material> material;
+        QString path;
+    };
+
     void addToTree(std::shared_ptr<MaterialEntry> model);
     void dereference(const std::shared_ptr<Material>& material);
-    std::shared_ptr<MaterialEntry>
-    getMaterialFromPath(const std::shared_ptr<MaterialLibrary>& library, const QString& path) const;
     void addLibrary(const std::shared_ptr<MaterialLibrary>& model);
     void loadLibrary(const std::shared_ptr<MaterialLibrary>& library);
     void loadLibraries();
+    static void
+    inheritModels(const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
+                  const std::shared_ptr<Material>& material);
 
-    static std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>> _materialEntryMap;
+    static std::map<QString, DeferredMaterial> _deferredMap;
+    static std::recursive_mutex _deferredMutex;
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> _materialMap;
     std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>> _libraryList;
 };
@@ -81,6 +81,8 @@ void MaterialManager::cleanup()
 {
     QMutexLocker locker(&_mutex);
 
+    MaterialLoader::clearDeferred();
+
     if (_libraryList) {
         _libraryList->clear();
         _libraryList = nullptr;
@@ -216,14 +218,25 @@ QString MaterialManager::defaultMaterialUUID()
     return QString::fromStdString(uuid);
 }
 
+std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> MaterialManager::getMaterials() const
+{
+    // All materials are handed out, so the deferred ones have to be read now
+    MaterialLoader::loadDeferred(_materialMap);
+    return _materialMap;
+}
+
 std::shared_ptr<Material> MaterialManager::getMaterial(const QString& uuid) const
 {
+    std::shared_ptr<Material> material;
     try {
-        return _materialMap->at(uuid);
+        material = _materialMap->at(uuid);
     }
     catch (std::out_of_range&) {
         throw MaterialNotFound();
     }
+
+    dereference(material);
+    return material;
 }
 
 std::shared_ptr<Material> MaterialManager::getMaterial(const App::Material& material)
@@ -240,7 +253,9 @@ std::shared_ptr<Material> MaterialManager::getMaterialByPath(const QString& path
     for (auto& library : *_libraryList) {
         if (cleanPath.startsWith(library->getDirectory())) {
             try {
-                return library->getMaterialByPath(cleanPath);
+                auto material = library->getMaterialByPath(cleanPath);
+                dereference(material);
+                return material;
             }
             catch (const MaterialNotFound&) {
             }
@@ -278,8 +293,10 @@ std::shared_ptr<Material> MaterialManager::getMaterialByPath(const QString& path
 std::shared_ptr<Material> MaterialManager::getMaterialByPath(const QString& path,
                                                              const QString& lib) const
 {
-    auto library = getLibrary(lib);           // May throw LibraryNotFound
-    return library->getMaterialByPath(path);  // May throw MaterialNotFound
+    auto library = getLibrary(lib);                   // May throw LibraryNotFound
+    auto material = library->getMaterialByPath(path);  // May throw MaterialNotFound
+    dereference(material);
+    return material;
 }
 
 bool MaterialManager::exists(const QString& uuid) const
@@ -381,6 +398,9 @@ MaterialManager::materialsWithModelComplete(const QString& uuid) const
         QString key = it.first;
         auto material = it.second;
 
+        if (material->hasModel(uuid)) {
+            dereference(material);
+        }
         if (material->isModelComplete(uuid)) {
             (*dict)[key] = material;
         }
@@ -60,10 +60,7 @@ public:
     static std::shared_ptr<Material> defaultMaterial();
     static QString defaultMaterialUUID();
 
-    std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> getMaterials() const
-    {
-        return _materialMap;
-    }
+    std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> getMaterials() const;
     std::shared_ptr<Material> getMaterial(const QString& uuid) const;
     static std::shared_ptr<Material> getMaterial(const App::Material& material);
     std::shared_ptr<Material> getMaterialByPath(const QString& path) const;
@@ -50,6 +50,7 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <random>
 #include <sstream>
 #include <string>
@@ -57,17 +58,23 @@
 
 // Qt
 #include <QtGlobal>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
 #include <QDirIterator>
+#include <QFile>
 #include <QFileInfo>
 #include <QIODevice>
 #include <QList>
 #include <QMetaType>
 #include <QMetaType>
 #include <QRegularExpression>
+#include <QSaveFile>
 #include <QString>
 #include <QTextStream>
 #include <QUuid>
 #include <QVector>
+#include <QtConcurrentMap>
 
 #endif  //_PreComp_
 
@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <future>
+#include <vector>
 
 
 namespace MeshCore
@@ -62,6 +63,33 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/*!
+ * \brief parallel_for
+ * Splits the index range [0, count) into at most \a threads contiguous blocks
+ * and calls \a func(begin, end) for each block. The calling thread processes
+ * the first block itself. Exceptions thrown by \a func are re-thrown.
+ */
+template<class Func>
+static void parallel_for(std::size_t count, Func func, int threads)
+{
+    if (threads < 2 || count < 2) {
+        func(std::size_t(0), count);
+    }
+    else {
+        std::size_t blocks = std::min(static_cast<std::size_t>(threads), count);
+        std::size_t step = (count + blocks - 1) / blocks;
+        std::vector<std::future<void>> tasks;
+        for (std::size_t begin = step; begin < count; begin += step) {
+            tasks.push_back(
+                std::async(std::launch::async, func, begin, std::min(begin + step, count)));
+        }
+        func(std::size_t(0), step);
+        for (auto& it : tasks) {
+            it.get();
+        }
+    }
+}
+
 }  // namespace MeshCore
 
 
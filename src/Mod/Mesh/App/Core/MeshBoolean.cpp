@@ -0,0 +1,1480 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <deque>
+#include <numeric>
+#include <thread>
+#endif
+
+#include <Base/Converter.h>
+#include <Base/Tools2D.h>
+
+#include "Functional.h"
+#include "MeshBoolean.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+
+// ----------------------------------------------------------------------------
+// Adaptive orientation predicates. A floating-point filter decides the sign in
+// the common case, otherwise the determinant is evaluated exactly as a sum of
+// non-overlapping expansions (see J. R. Shewchuk, Adaptive Precision Floating-Point
+// Arithmetic and Fast Robust Geometric Predicates).
+
+inline void TwoSum(double a, double b, double& x, double& y)
+{
+    x = a + b;
+    double bv = x - a;
+    double av = x - bv;
+    y = (a - av) + (b - bv);
+}
+
+inline void TwoProduct(double a, double b, double& x, double& y)
+{
+    x = a * b;
+    y = std::fma(a, b, -x);
+}
+
+// Adds b to the expansion e in place and returns the new length
+int GrowExpansion(int elen, double* e, double b)
+{
+    double q = b;
+    int hindex = 0;
+    for (int i = 0; i < elen; i++) {
+        double sum {};
+        double err {};
+        TwoSum(q, e[i], sum, err);
+        q = sum;
+        if (err != 0.0) {
+            e[hindex++] = err;
+        }
+    }
+    if (q != 0.0 || hindex == 0) {
+        e[hindex++] = q;
+    }
+    return hindex;
+}
+
+// Adds the exact product a*b*c to the expansion e
+int AddProduct(int elen, double* e, double a, double b, double c)
+{
+    double p1 {}, p0 {};
+    TwoProduct(a, b, p1, p0);
+    double s1 {}, s0 {}, t1 {}, t0 {};
+    TwoProduct(p1, c, s1, s0);
+    TwoProduct(p0, c, t1, t0);
+    elen = GrowExpansion(elen, e, t0);
+    elen = GrowExpansion(elen, e, t1);
+    elen = GrowExpansion(elen, e, s0);
+    elen = GrowExpansion(elen, e, s1);
+    return elen;
+}
+
+// Adds sign * det(p, q, r) to the expansion e
+int AddDeterminant(int elen,
+                   double* e,
+                   const Base::Vector3d& p,
+                   const Base::Vector3d& q,
+                   const Base::Vector3d& r,
+                   double sign)
+{
+    elen = AddProduct(elen, e, sign * p.x, q.y, r.z);
+    elen = AddProduct(elen, e, -sign * p.x, q.z, r.y);
+    elen = AddProduct(elen, e, sign * p.y, q.z, r.x);
+    elen = AddProduct(elen, e, -sign * p.y, q.x, r.z);
+    elen = AddProduct(elen, e, sign * p.z, q.x, r.y);
+    elen = AddProduct(elen, e, -sign * p.z, q.y, r.x);
+    return elen;
+}
+
+inline int ExpansionSign(int elen, const double* e)
+{
+    double top = e[elen - 1];
+    return top > 0.0 ? 1 : (top < 0.0 ? -1 : 0);
+}
+
+int Orient3dExact(const Base::Vector3d& a,
+                  const Base::Vector3d& b,
+                  const Base::Vector3d& c,
+                  const Base::Vector3d& d)
+{
+    // det(a-d, b-d, c-d) = det(a,b,c) - det(d,b,c) - det(a,d,c) - det(a,b,d)
+    std::array<double, 100> e {};
+    int elen = 1;
+    elen = AddDeterminant(elen, e.data(), a, b, c, 1.0);
+    elen = AddDeterminant(elen, e.data(), d, b, c, -1.0);
+    elen = AddDeterminant(elen, e.data(), a, d, c, -1.0);
+    elen = AddDeterminant(elen, e.data(), a, b, d, -1.0);
+    return ExpansionSign(elen, e.data());
+}
+
+/*!
+ * Returns the sign of det(a-d, b-d, c-d) which is positive if d lies below the
+ * plane through a, b and c, i.e. a, b and c appear counterclockwise when seen
+ * from d.
+ */
+int Orient3d(const Base::Vector3d& a,
+             const Base::Vector3d& b,
+             const Base::Vector3d& c,
+             const Base::Vector3d& d)
+{
+    double adx = a.x - d.x;
+    double bdx = b.x - d.x;
+    double cdx = c.x - d.x;
+    double ady = a.y - d.y;
+    double bdy = b.y - d.y;
+    double cdy = c.y - d.y;
+    double adz = a.z - d.z;
+    double bdz = b.z - d.z;
+    double cdz = c.z - d.z;
+
+    double bdxcdy = bdx * cdy;
+    double cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady;
+    double adxcdy = adx * cdy;
+    double adxbdy = adx * bdy;
+    double bdxady = bdx * ady;
+
+    double det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) + cdz * (adxbdy - bdxady);
+    double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * std::fabs(adz)
+        + (std::fabs(cdxady) + std::fabs(adxcdy)) * std::fabs(bdz)
+        + (std::fabs(adxbdy) + std::fabs(bdxady)) * std::fabs(cdz);
+    double errbound = 7.7715611723761027e-16 * permanent;
+    if (det > errbound) {
+        return 1;
+    }
+    if (-det > errbound) {
+        return -1;
+    }
+    return Orient3dExact(a, b, c, d);
+}
+
+/*!
+ * Returns the sign of the signed area of the triangle a, b, c which is positive
+ * if the points are in counterclockwise order.
+ */
+int Orient2d(const Base::Vector2d& a, const Base::Vector2d& b, const Base::Vector2d& c)
+{
+    double detleft = (a.x - c.x) * (b.y - c.y);
+    double detright = (a.y - c.y) * (b.x - c.x);
+    double det = detleft - detright;
+    double errbound = 3.3306690738754716e-16 * (std::fabs(detleft) + std::fabs(detright));
+    if (det > errbound) {
+        return 1;
+    }
+    if (-det > errbound) {
+        return -1;
+    }
+
+    std::array<double, 30> e {};
+    int elen = 1;
+    auto add = [&e, &elen](double u, double v) {
+        double p1 {}, p0 {};
+        TwoProduct(u, v, p1, p0);
+        elen = GrowExpansion(elen, e.data(), p0);
+        elen = GrowExpansion(elen, e.data(), p1);
+    };
+    add(a.x, b.y);
+    add(-a.y, b.x);
+    add(b.x, c.y);
+    add(-b.y, c.x);
+    add(c.x, a.y);
+    add(-c.y, a.x);
+    return ExpansionSign(elen, e.data());
+}
+
+// ----------------------------------------------------------------------------
+
+using Triangle = std::array<PointIndex, 3>;
+
+/*!
+ * Projection onto the coordinate plane where a triangle with the given normal has
+ * its largest extent. The orientation of the triangle is kept.
+ */
+class Projection
+{
+public:
+    explicit Projection(const Base::Vector3d& normal)
+    {
+        Base::Vector3d n(std::fabs(normal.x), std::fabs(normal.y), std::fabs(normal.z));
+        unsigned short axis = n.x >= n.y ? (n.x >= n.z ? 0 : 2) : (n.y >= n.z ? 1 : 2);
+        u = (axis + 1) % 3;
+        v = (axis + 2) % 3;
+        if (normal[axis] < 0.0) {
+            std::swap(u, v);
+        }
+    }
+    Base::Vector2d operator()(const Base::Vector3d& p) const
+    {
+        return {p[u], p[v]};
+    }
+
+private:
+    unsigned short u, v;
+};
+
+/*!
+ * An intersection point of an edge of one mesh with a facet of the other mesh.
+ * The point indices refer to the combined point list of both meshes and are
+ * stored in ascending order so that each edge has exactly one representation.
+ */
+struct Hit
+{
+    PointIndex p0, p1;
+    FacetIndex facet;
+
+    bool operator<(const Hit& h) const
+    {
+        if (p0 != h.p0) {
+            return p0 < h.p0;
+        }
+        if (p1 != h.p1) {
+            return p1 < h.p1;
+        }
+        return facet < h.facet;
+    }
+    bool operator==(const Hit& h) const
+    {
+        return p0 == h.p0 && p1 == h.p1 && facet == h.facet;
+    }
+};
+
+struct Segment
+{
+    Hit h0, h1;
+    FacetIndex f0, f1;
+};
+
+enum class Location
+{
+    Outside,
+    Inside,
+    OnSurface
+};
+
+/*!
+ * Retriangulates a single facet with a set of points on its boundary and interior
+ * and constraint segments between them. The facet is projected onto the coordinate
+ * plane where it has the largest extent and orientation is preserved.
+ */
+class FacetTriangulator
+{
+public:
+    std::vector<Base::Vector2d> points;
+    std::vector<std::pair<int, int>> boundary;
+    std::vector<std::array<int, 3>> triangles;
+    std::vector<std::pair<int, int>> constraints;
+
+    int AddPoint(const Base::Vector2d& p)
+    {
+        points.push_back(p);
+        return static_cast<int>(points.size()) - 1;
+    }
+
+    int Orient(int a, int b, int c) const
+    {
+        return Orient2d(points[a], points[b], points[c]);
+    }
+
+    void TriangulatePolygon(std::vector<int> poly)
+    {
+        for (std::size_t i = 0; i < poly.size(); i++) {
+            int u = poly[i];
+            int v = poly[(i + 1) % poly.size()];
+            boundary.emplace_back(std::min(u, v), std::max(u, v));
+        }
+        while (poly.size() > 3) {
+            bool clipped = false;
+            std::size_t num = poly.size();
+            for (std::size_t i = 0; i < num; i++) {
+                int prev = poly[(i + num - 1) % num];
+                int curr = poly[i];
+                int next = poly[(i + 1) % num];
+                if (Orient(prev, curr, next) <= 0) {
+                    continue;
+                }
+                bool ear = true;
+                for (int v : poly) {
+                    if (v == prev || v == curr || v == next) {
+                        continue;
+                    }
+                    if (Orient(prev, curr, v) >= 0 && Orient(curr, next, v) >= 0
+                        && Orient(next, prev, v) >= 0) {
+                        ear = false;
+                        break;
+                    }
+                }
+                if (ear) {
+                    triangles.push_back({prev, curr, next});
+                    poly.erase(poly.begin() + static_cast<std::ptrdiff_t>(i));
+                    clipped = true;
+                    break;
+                }
+            }
+            if (!clipped) {
+                // only (nearly) collinear points are left, keep the topology
+                for (std::size_t i = 1; i + 1 < poly.size(); i++) {
+                    triangles.push_back({poly[0], poly[i], poly[i + 1]});
+                }
+                return;
+            }
+        }
+        triangles.push_back({poly[0], poly[1], poly[2]});
+    }
+
+    void SplitEdge(int u, int v, int p)
+    {
+        std::size_t num = triangles.size();
+        for (std::size_t i = 0; i < num; i++) {
+            auto& tria = triangles[i];
+            for (int j = 0; j < 3; j++) {
+                int a = tria[j];
+                int b = tria[(j + 1) % 3];
+                int c = tria[(j + 2) % 3];
+                if ((a == u && b == v) || (a == v && b == u)) {
+                    tria = {a, p, c};
+                    triangles.push_back({p, b, c});
+                    break;
+                }
+            }
+        }
+    }
+
+    bool IsBoundary(int u, int v) const
+    {
+        return std::find(boundary.begin(), boundary.end(), std::make_pair(std::min(u, v), std::max(u, v)))
+            != boundary.end();
+    }
+
+    void SplitTriangle(std::size_t index, int p)
+    {
+        auto tria = triangles[index];
+        triangles[index] = {tria[0], tria[1], p};
+        triangles.push_back({tria[1], tria[2], p});
+        triangles.push_back({tria[2], tria[0], p});
+    }
+
+    /*!
+     * Inserts a point in the interior of the facet. If due to its coordinates the point
+     * lies on the facet boundary or on an existing vertex the containing triangle is
+     * split anyway. This gives degenerated triangles but keeps the facet boundary
+     * identical to the neighbour facets.
+     */
+    void InsertPoint(int p)
+    {
+        std::size_t best = 0;
+        double bestArea = -DBL_MAX;
+        for (std::size_t i = 0; i < triangles.size(); i++) {
+            auto tria = triangles[i];
+            int s0 = Orient(tria[0], tria[1], p);
+            int s1 = Orient(tria[1], tria[2], p);
+            int s2 = Orient(tria[2], tria[0], p);
+            if (s0 < 0 || s1 < 0 || s2 < 0) {
+                // keep the least violating triangle in case rounding moved the point outside
+                double area = DBL_MAX;
+                for (int j = 0; j < 3; j++) {
+                    const Base::Vector2d& a = points[tria[j]];
+                    const Base::Vector2d& b = points[tria[(j + 1) % 3]];
+                    const Base::Vector2d& c = points[p];
+                    area = std::min(area, (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x));
+                }
+                if (area > bestArea) {
+                    bestArea = area;
+                    best = i;
+                }
+                continue;
+            }
+
+            int zeros = int(s0 == 0) + int(s1 == 0) + int(s2 == 0);
+            if (zeros == 1) {
+                int j = s0 == 0 ? 0 : (s1 == 0 ? 1 : 2);
+                int u = tria[j];
+                int v = tria[(j + 1) % 3];
+                if (!IsBoundary(u, v)) {
+                    SplitEdge(u, v, p);
+                    return;
+                }
+            }
+            SplitTriangle(i, p);
+            return;
+        }
+
+        if (!triangles.empty()) {
+            SplitTriangle(best, p);
+        }
+    }
+
+    bool HasEdge(int a, int b) const
+    {
+        return std::any_of(triangles.begin(), triangles.end(), [a, b](const auto& tria) {
+            for (int j = 0; j < 3; j++) {
+                if (tria[j] == a && tria[(j + 1) % 3] == b) {
+                    return true;
+                }
+                if (tria[j] == b && tria[(j + 1) % 3] == a) {
+                    return true;
+                }
+            }
+            return false;
+        });
+    }
+
+    bool Crosses(int a, int b, int u, int v) const
+    {
+        if (u == a || u == b || v == a || v == b) {
+            return false;
+        }
+        return Orient(a, b, u) * Orient(a, b, v) < 0 && Orient(u, v, a) * Orient(u, v, b) < 0;
+    }
+
+    bool InsertConstraint(int a, int b)
+    {
+        if (a == b) {
+            return true;
+        }
+
+        // split the constraint at vertices lying on it
+        for (std::size_t v = 0; v < points.size(); v++) {
+            int vi = static_cast<int>(v);
+            if (vi == a || vi == b || Orient(a, b, vi) != 0) {
+                continue;
+            }
+            Base::Vector2d ab = points[b] - points[a];
+            double t = ab * (points[vi] - points[a]);
+            if (t > 0.0 && t < ab * ab) {
+                return InsertConstraint(a, vi) && InsertConstraint(vi, b);
+            }
+        }
+
+        if (!HasEdge(a, b)) {
+            // Sloan's edge flipping to recover the constraint
+            std::deque<std::pair<int, int>> crossing;
+            for (const auto& tria : triangles) {
+                for (int j = 0; j < 3; j++) {
+                    int u = tria[j];
+                    int v = tria[(j + 1) % 3];
+                    if (u < v && Crosses(a, b, u, v)) {
+                        crossing.emplace_back(u, v);
+                    }
+                }
+            }
+
+            std::size_t limit = 10 * (crossing.size() + 1) * (crossing.size() + 1);
+            std::size_t iter = 0;
+            while (!crossing.empty()) {
+                if (++iter > limit) {
+                    return false;
+                }
+                auto [u, v] = crossing.front();
+                crossing.pop_front();
+
+                std::array<int, 3>* t1 = nullptr;
+                std::array<int, 3>* t2 = nullptr;
+                int w1 = -1;
+                int w2 = -1;
+                for (auto& tria : triangles) {
+                    for (int j = 0; j < 3; j++) {
+                        if (tria[j] == u && tria[(j + 1) % 3] == v) {
+                            t1 = &tria;
+                            w1 = tria[(j + 2) % 3];
+                        }
+                        else if (tria[j] == v && tria[(j + 1) % 3] == u) {
+                            t2 = &tria;
+                            w2 = tria[(j + 2) % 3];
+                        }
+                    }
+                }
+                if (!t1 || !t2) {
+                    return false;
+                }
+
+                if (Orient(w1, w2, u) * Orient(w1, w2, v) < 0) {
+                    *t1 = {u, w2, w1};
+                    *t2 = {w2, v, w1};
+                    if (Crosses(a, b, w1, w2)) {
+                        crossing.emplace_back(std::min(w1, w2), std::max(w1, w2));
+                    }
+                }
+                else {
+                    crossing.emplace_back(u, v);
+                }
+            }
+        }
+
+        constraints.emplace_back(a, b);
+        return true;
+    }
+};
+
+/*!
+ * Holds the combined data of both meshes. Points and facets of the second mesh
+ * follow the ones of the first mesh.
+ */
+class BooleanData
+{
+public:
+    BooleanData(const MeshKernel& mesh1, const MeshKernel& mesh2)
+        : bvh {MeshFacetBVH(mesh1), MeshFacetBVH(mesh2)}
+    {
+        const MeshPointArray& pts1 = mesh1.GetPoints();
+        const MeshPointArray& pts2 = mesh2.GetPoints();
+        numPoints[0] = pts1.size();
+        numPoints[1] = pts2.size();
+        points.reserve(pts1.size() + pts2.size());
+        for (const auto& it : pts1) {
+            points.emplace_back(it.x, it.y, it.z);
+        }
+        for (const auto& it : pts2) {
+            points.emplace_back(it.x, it.y, it.z);
+        }
+
+        const MeshFacetArray& fac1 = mesh1.GetFacets();
+        const MeshFacetArray& fac2 = mesh2.GetFacets();
+        numFacets[0] = fac1.size();
+        numFacets[1] = fac2.size();
+        facets.reserve(fac1.size() + fac2.size());
+        for (const auto& it : fac1) {
+            facets.push_back({it._aulPoints[0], it._aulPoints[1], it._aulPoints[2]});
+        }
+        PointIndex offset = numPoints[0];
+        for (const auto& it : fac2) {
+            facets.push_back(
+                {it._aulPoints[0] + offset, it._aulPoints[1] + offset, it._aulPoints[2] + offset});
+        }
+
+        const Base::BoundBox3f& bbox1 = mesh1.GetBoundBox();
+        const Base::BoundBox3f& bbox2 = mesh2.GetBoundBox();
+        center[0] = Base::convertTo<Base::Vector3d>(bbox1.GetCenter());
+        center[1] = Base::convertTo<Base::Vector3d>(bbox2.GetCenter());
+        radius[0] = bbox1.CalcDiagonalLength();
+        radius[1] = bbox2.CalcDiagonalLength();
+    }
+
+    int Side(FacetIndex facet) const
+    {
+        return facet < numFacets[0] ? 0 : 1;
+    }
+
+    // Orientation of the point p relative to the plane of the facet where points in
+    // the plane are treated as lying above it
+    int Orient(const Triangle& tria, PointIndex p) const
+    {
+        int sign = Orient3d(points[tria[0]], points[tria[1]], points[tria[2]], points[p]);
+        return sign == 0 ? 1 : sign;
+    }
+
+    // Orientation of the edge (p0, p1) against the edge (u, v) with a symbolic
+    // perturbation depending on the point indices for degenerate configurations
+    int Orient(PointIndex p0, PointIndex p1, PointIndex u, PointIndex v) const
+    {
+        int sign = Orient3d(points[p0], points[p1], points[u], points[v]);
+        if (sign == 0) {
+            sign = u < v ? 1 : -1;
+        }
+        return sign;
+    }
+
+    bool EdgeCrossesFacet(PointIndex p0, PointIndex p1, const Triangle& tria) const
+    {
+        int s0 = Orient(p0, p1, tria[0], tria[1]);
+        int s1 = Orient(p0, p1, tria[1], tria[2]);
+        if (s0 != s1) {
+            return false;
+        }
+        int s2 = Orient(p0, p1, tria[2], tria[0]);
+        return s1 == s2;
+    }
+
+    void IntersectFacets(FacetIndex f0, FacetIndex f1, std::vector<Segment>& segments) const
+    {
+        const Triangle& t0 = facets[f0];
+        const Triangle& t1 = facets[f1];
+
+        std::array<int, 3> side0 {};
+        for (int i = 0; i < 3; i++) {
+            side0[i] = Orient(t1, t0[i]);
+        }
+        if (side0[0] == side0[1] && side0[1] == side0[2]) {
+            return;
+        }
+
+        std::array<int, 3> side1 {};
+        for (int i = 0; i < 3; i++) {
+            side1[i] = Orient(t0, t1[i]);
+        }
+        if (side1[0] == side1[1] && side1[1] == side1[2]) {
+            return;
+        }
+
+        std::array<Hit, 6> hits {};
+        int count = 0;
+        auto checkEdges = [&](const Triangle& edges,
+                              const std::array<int, 3>& sides,
+                              const Triangle& other,
+                              FacetIndex facet) {
+            for (int i = 0; i < 3; i++) {
+                int j = (i + 1) % 3;
+                if (sides[i] == sides[j]) {
+                    continue;
+                }
+                PointIndex p0 = std::min(edges[i], edges[j]);
+                PointIndex p1 = std::max(edges[i], edges[j]);
+                if (EdgeCrossesFacet(p0, p1, other)) {
+                    hits[count++] = Hit {p0, p1, facet};
+                }
+            }
+        };
+
+        checkEdges(t0, side0, t1, f1);
+        checkEdges(t1, side1, t0, f0);
+        if (count == 2) {
+            segments.push_back(Segment {hits[0], hits[1], f0, f1});
+        }
+        else if (count != 0) {
+            degenerate = true;
+        }
+    }
+
+    // Computes the intersection point of the hit and its parameter along the edge
+    Base::Vector3d HitPoint(const Hit& hit, double& param) const
+    {
+        const Triangle& tria = facets[hit.facet];
+        const Base::Vector3d& a = points[tria[0]];
+        Base::Vector3d normal = (points[tria[1]] - a) % (points[tria[2]] - a);
+        const Base::Vector3d& p0 = points[hit.p0];
+        const Base::Vector3d& p1 = points[hit.p1];
+        double d0 = normal * (p0 - a);
+        double d1 = normal * (p1 - a);
+        double den = d0 - d1;
+        param = den != 0.0 ? std::clamp(d0 / den, 0.0, 1.0) : 0.5;
+        return p0 + (p1 - p0) * param;
+    }
+
+    /*!
+     * Checks whether the point \a p is inside the mesh \a side by counting the
+     * crossings of a ray with its facets.
+     */
+    Location Locate(const Base::Vector3d& p, int side) const
+    {
+        static const std::array<Base::Vector3d, 4> directions {
+            Base::Vector3d(0.5377, 0.6199, 0.5714),
+            Base::Vector3d(-0.7071, 0.3827, 0.5946),
+            Base::Vector3d(0.2312, -0.8913, 0.3901),
+            Base::Vector3d(-0.4451, -0.5234, -0.7265)};
+
+        double length = 2.0 * radius[side] + Base::Distance(p, center[side]);
+        std::vector<FacetIndex> candidates;
+        FacetIndex offset = side == 0 ? 0 : numFacets[0];
+        for (const auto& dir : directions) {
+            Base::Vector3d q = p + dir * length;
+            candidates.clear();
+            bvh[side].GetFacets(p, q, candidates);
+
+            int crossings = 0;
+            bool degenerated = false;
+            for (FacetIndex index : candidates) {
+                const Triangle& tria = facets[index + offset];
+                const Base::Vector3d& a = points[tria[0]];
+                const Base::Vector3d& b = points[tria[1]];
+                const Base::Vector3d& c = points[tria[2]];
+                int sp = Orient3d(a, b, c, p);
+                int sq = Orient3d(a, b, c, q);
+                if (sp == sq && sp != 0) {
+                    continue;
+                }
+                if (sp == 0) {
+                    if (IsInsideTriangle(a, b, c, p)) {
+                        return Location::OnSurface;
+                    }
+                    continue;
+                }
+                if (sq == 0) {
+                    degenerated = true;
+                    break;
+                }
+
+                int u = Orient3d(p, q, a, b);
+                int v = Orient3d(p, q, b, c);
+                int w = Orient3d(p, q, c, a);
+                if ((u > 0 || v > 0 || w > 0) && (u < 0 || v < 0 || w < 0)) {
+                    continue;
+                }
+                if (u == 0 || v == 0 || w == 0) {
+                    degenerated = true;
+                    break;
+                }
+                crossings++;
+            }
+
+            if (!degenerated) {
+                return (crossings % 2) == 1 ? Location::Inside : Location::Outside;
+            }
+        }
+
+        return Location::OnSurface;
+    }
+
+    static bool IsInsideTriangle(const Base::Vector3d& a,
+                                 const Base::Vector3d& b,
+                                 const Base::Vector3d& c,
+                                 const Base::Vector3d& p)
+    {
+        Base::Vector3d normal = (b - a) % (c - a);
+        Projection project(normal);
+        Base::Vector2d pa = project(a);
+        Base::Vector2d pb = project(b);
+        Base::Vector2d pc = project(c);
+        Base::Vector2d pp = project(p);
+        int s0 = Orient2d(pa, pb, pp);
+        int s1 = Orient2d(pb, pc, pp);
+        int s2 = Orient2d(pc, pa, pp);
+        return (s0 >= 0 && s1 >= 0 && s2 >= 0) || (s0 <= 0 && s1 <= 0 && s2 <= 0);
+    }
+
+    /*!
+     * Retriangulates the facet with the given intersection segments. Returns false
+     * if not all segments could be inserted.
+     */
+    bool Retriangulate(FacetIndex facet,
+                       const std::vector<const Segment*>& segs,
+                       std::vector<Triangle>& triangles,
+                       std::vector<std::pair<PointIndex, PointIndex>>& edges) const
+    {
+        const Triangle& tria = facets[facet];
+        Base::Vector3d normal =
+            (points[tria[1]] - points[tria[0]]) % (points[tria[2]] - points[tria[0]]);
+        if (normal.Sqr() == 0.0) {
+            triangles.push_back(tria);
+            return true;
+        }
+
+        Projection project(normal);
+        FacetTriangulator mesher;
+        std::vector<PointIndex> ids;
+        auto localIndex = [&ids](PointIndex index) {
+            return static_cast<int>(std::find(ids.begin(), ids.end(), index) - ids.begin());
+        };
+        auto addPoint = [&](PointIndex index) {
+            int local = localIndex(index);
+            if (local == static_cast<int>(ids.size())) {
+                ids.push_back(index);
+                mesher.AddPoint(project(points[index]));
+            }
+            return local;
+        };
+
+        // collect all intersection points of this facet
+        std::vector<std::size_t> hitIndices;
+        hitIndices.reserve(2 * segs.size());
+        for (const Segment* seg : segs) {
+            hitIndices.push_back(HitIndex(seg->h0));
+            hitIndices.push_back(HitIndex(seg->h1));
+        }
+        std::sort(hitIndices.begin(), hitIndices.end());
+        hitIndices.erase(std::unique(hitIndices.begin(), hitIndices.end()), hitIndices.end());
+
+        std::array<int, 3> corner {};
+        for (int i = 0; i < 3; i++) {
+            corner[i] = addPoint(tria[i]);
+        }
+
+        // the boundary polygon with the intersection points on the facet edges
+        std::vector<int> polygon;
+        std::vector<std::pair<double, std::size_t>> onEdge;
+        for (int i = 0; i < 3; i++) {
+            PointIndex p0 = tria[i];
+            PointIndex p1 = tria[(i + 1) % 3];
+            bool reverse = p0 > p1;
+            if (reverse) {
+                std::swap(p0, p1);
+            }
+
+            onEdge.clear();
+            for (std::size_t index : hitIndices) {
+                const Hit& hit = hits[index];
+                if (hit.facet != facet && hit.p0 == p0 && hit.p1 == p1) {
+                    double param = reverse ? 1.0 - hitParams[index] : hitParams[index];
+                    onEdge.emplace_back(param, index);
+                }
+            }
+            std::sort(onEdge.begin(), onEdge.end());
+
+            polygon.push_back(corner[i]);
+            for (const auto& it : onEdge) {
+                int local = addPoint(hitVertex[it.second]);
+                if (std::find(polygon.begin(), polygon.end(), local) == polygon.end()) {
+                    polygon.push_back(local);
+                }
+            }
+        }
+        mesher.TriangulatePolygon(polygon);
+
+        // the intersection points in the interior
+        for (std::size_t index : hitIndices) {
+            if (hits[index].facet == facet) {
+                int num = static_cast<int>(ids.size());
+                int local = addPoint(hitVertex[index]);
+                if (local == num) {
+                    mesher.InsertPoint(local);
+                }
+            }
+        }
+
+        bool ok = true;
+        for (const Segment* seg : segs) {
+            int a = localIndex(hitVertex[HitIndex(seg->h0)]);
+            int b = localIndex(hitVertex[HitIndex(seg->h1)]);
+            if (!mesher.InsertConstraint(a, b)) {
+                ok = false;
+            }
+        }
+
+        for (const auto& it : mesher.triangles) {
+            if (it[0] != it[1] && it[1] != it[2] && it[2] != it[0]) {
+                triangles.push_back({ids[it[0]], ids[it[1]], ids[it[2]]});
+            }
+        }
+        for (const auto& it : mesher.constraints) {
+            PointIndex a = ids[it.first];
+            PointIndex b = ids[it.second];
+            edges.emplace_back(std::min(a, b), std::max(a, b));
+        }
+
+        return ok;
+    }
+
+    /*!
+     * Intersection points with identical coordinates are merged into a single vertex.
+     * This happens when an edge passes exactly through an edge or vertex of the other
+     * mesh. Points coinciding with a vertex of the edge or facet are replaced by it.
+     */
+    void MergeHitPoints(int threads)
+    {
+        hitVertex.resize(hits.size());
+        for (std::size_t i = 0; i < hits.size(); i++) {
+            const Hit& hit = hits[i];
+            PointIndex index = firstHitPoint + i;
+            const Base::Vector3d& p = points[index];
+            const Triangle& tria = facets[hit.facet];
+            for (PointIndex corner : {hit.p0, hit.p1, tria[0], tria[1], tria[2]}) {
+                if (points[corner] == p) {
+                    index = std::min(index, corner);
+                }
+            }
+            hitVertex[i] = index;
+        }
+
+        auto lessPoint = [this](std::size_t a, std::size_t b) {
+            const Base::Vector3d& p = points[firstHitPoint + a];
+            const Base::Vector3d& q = points[firstHitPoint + b];
+            if (p.x != q.x) {
+                return p.x < q.x;
+            }
+            if (p.y != q.y) {
+                return p.y < q.y;
+            }
+            return p.z < q.z;
+        };
+        std::vector<std::size_t> order(hits.size());
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        MeshCore::parallel_sort(order.begin(), order.end(), lessPoint, threads);
+
+        for (std::size_t i = 0; i < order.size();) {
+            std::size_t j = i;
+            PointIndex index = hitVertex[order[i]];
+            while (j < order.size() && !lessPoint(order[i], order[j])) {
+                index = std::min(index, hitVertex[order[j]]);
+                j++;
+            }
+            for (std::size_t k = i; k < j; k++) {
+                hitVertex[order[k]] = index;
+            }
+            i = j;
+        }
+    }
+
+    std::size_t HitIndex(const Hit& hit) const
+    {
+        return static_cast<std::size_t>(std::lower_bound(hits.begin(), hits.end(), hit)
+                                        - hits.begin());
+    }
+
+public:
+    MeshFacetBVH bvh[2];
+    std::vector<Base::Vector3d> points;
+    std::vector<Triangle> facets;
+    std::size_t numPoints[2];
+    std::size_t numFacets[2];
+    Base::Vector3d center[2];
+    double radius[2];
+
+    std::vector<Hit> hits;
+    std::vector<double> hitParams;
+    std::vector<PointIndex> hitVertex;
+    PointIndex firstHitPoint {0};
+    mutable std::atomic<bool> degenerate {false};
+};
+
+class UnionFind
+{
+public:
+    explicit UnionFind(std::size_t num)
+        : parent(num)
+    {
+        std::iota(parent.begin(), parent.end(), std::size_t(0));
+    }
+    std::size_t Find(std::size_t index)
+    {
+        while (parent[index] != index) {
+            parent[index] = parent[parent[index]];
+            index = parent[index];
+        }
+        return index;
+    }
+    void Unite(std::size_t a, std::size_t b)
+    {
+        a = Find(a);
+        b = Find(b);
+        if (a != b) {
+            parent[std::max(a, b)] = std::min(a, b);
+        }
+    }
+
+private:
+    std::vector<std::size_t> parent;
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+namespace
+{
+constexpr uint32_t LeafSize = 4;
+
+bool SegmentIntersectsBox(const Base::Vector3d& p,
+                          const Base::Vector3d& dir,
+                          const Base::BoundBox3f& box)
+{
+    double tmin = 0.0;
+    double tmax = 1.0;
+    const double lo[3] = {box.MinX, box.MinY, box.MinZ};
+    const double hi[3] = {box.MaxX, box.MaxY, box.MaxZ};
+    const double org[3] = {p.x, p.y, p.z};
+    const double vec[3] = {dir.x, dir.y, dir.z};
+    for (int i = 0; i < 3; i++) {
+        if (vec[i] == 0.0) {
+            if (org[i] < lo[i] || org[i] > hi[i]) {
+                return false;
+            }
+            continue;
+        }
+        double t0 = (lo[i] - org[i]) / vec[i];
+        double t1 = (hi[i] - org[i]) / vec[i];
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        tmin = std::max(tmin, t0);
+        tmax = std::min(tmax, t1);
+        if (tmin > tmax) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& kernel)
+{
+    const MeshPointArray& points = kernel.GetPoints();
+    const MeshFacetArray& facets = kernel.GetFacets();
+    boxes.reserve(facets.size());
+    centers.reserve(facets.size());
+    for (const auto& it : facets) {
+        Base::BoundBox3f box;
+        box.Add(points[it._aulPoints[0]]);
+        box.Add(points[it._aulPoints[1]]);
+        box.Add(points[it._aulPoints[2]]);
+        boxes.push_back(box);
+        centers.push_back(box.GetCenter());
+    }
+
+    indices.resize(facets.size());
+    std::iota(indices.begin(), indices.end(), FacetIndex(0));
+    if (!indices.empty()) {
+        nodes.reserve(2 * indices.size() / LeafSize + 1);
+        Build(0, static_cast<uint32_t>(indices.size()));
+    }
+}
+
+uint32_t MeshFacetBVH::Build(uint32_t first, uint32_t count)
+{
+    auto index = static_cast<uint32_t>(nodes.size());
+    nodes.emplace_back();
+
+    Base::BoundBox3f box;
+    Base::BoundBox3f centerBox;
+    for (uint32_t i = first; i < first + count; i++) {
+        box.Add(boxes[indices[i]]);
+        centerBox.Add(centers[indices[i]]);
+    }
+    nodes[index].box = box;
+
+    if (count <= LeafSize) {
+        nodes[index].first = first;
+        nodes[index].count = count;
+        return index;
+    }
+
+    unsigned short axis = 0;
+    if (centerBox.LengthY() > centerBox.LengthX()) {
+        axis = 1;
+    }
+    if (centerBox.LengthZ() > std::max(centerBox.LengthX(), centerBox.LengthY())) {
+        axis = 2;
+    }
+
+    uint32_t half = count / 2;
+    auto begin = indices.begin() + first;
+    std::nth_element(begin, begin + half, begin + count, [this, axis](FacetIndex a, FacetIndex b) {
+        return centers[a][axis] < centers[b][axis];
+    });
+
+    Build(first, half);  // the left child directly follows its parent
+    uint32_t right = Build(first + half, count - half);
+    nodes[index].first = right;
+    return index;
+}
+
+void MeshFacetBVH::GetOverlaps(uint32_t node,
+                               const MeshFacetBVH& other,
+                               uint32_t otherNode,
+                               std::vector<std::pair<FacetIndex, FacetIndex>>& pairs) const
+{
+    const Node& n1 = nodes[node];
+    const Node& n2 = other.nodes[otherNode];
+    if (!n1.box.Intersect(n2.box)) {
+        return;
+    }
+
+    if (n1.count > 0 && n2.count > 0) {
+        for (uint32_t i = n1.first; i < n1.first + n1.count; i++) {
+            FacetIndex f1 = indices[i];
+            for (uint32_t j = n2.first; j < n2.first + n2.count; j++) {
+                FacetIndex f2 = other.indices[j];
+                if (boxes[f1].Intersect(other.boxes[f2])) {
+                    pairs.emplace_back(f1, f2);
+                }
+            }
+        }
+    }
+    else if (n2.count > 0
+             || (n1.count == 0 && n1.box.CalcDiagonalLength() >= n2.box.CalcDiagonalLength())) {
+        GetOverlaps(node + 1, other, otherNode, pairs);
+        GetOverlaps(n1.first, other, otherNode, pairs);
+    }
+    else {
+        GetOverlaps(node, other, otherNode + 1, pairs);
+        GetOverlaps(node, other, n2.first, pairs);
+    }
+}
+
+void MeshFacetBVH::GetOverlaps(const MeshFacetBVH& other,
+                               std::vector<std::pair<FacetIndex, FacetIndex>>& pairs,
+                               int threads) const
+{
+    if (nodes.empty() || other.nodes.empty()) {
+        return;
+    }
+
+    // split the traversal into independent sub-tasks
+    std::vector<std::pair<uint32_t, uint32_t>> tasks {{0, 0}};
+    std::size_t wanted = 16 * static_cast<std::size_t>(std::max(threads, 1));
+    while (tasks.size() < wanted) {
+        std::vector<std::pair<uint32_t, uint32_t>> next;
+        bool split = false;
+        for (const auto& it : tasks) {
+            const Node& n1 = nodes[it.first];
+            const Node& n2 = other.nodes[it.second];
+            if (!n1.box.Intersect(n2.box)) {
+                continue;
+            }
+            if (n1.count == 0) {
+                next.emplace_back(it.first + 1, it.second);
+                next.emplace_back(n1.first, it.second);
+                split = true;
+            }
+            else if (n2.count == 0) {
+                next.emplace_back(it.first, it.second + 1);
+                next.emplace_back(it.first, n2.first);
+                split = true;
+            }
+            else {
+                next.push_back(it);
+            }
+        }
+        tasks.swap(next);
+        if (!split) {
+            break;
+        }
+    }
+
+    std::vector<std::vector<std::pair<FacetIndex, FacetIndex>>> results(tasks.size());
+    MeshCore::parallel_for(
+        tasks.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                GetOverlaps(tasks[i].first, other, tasks[i].second, results[i]);
+            }
+        },
+        threads);
+
+    std::size_t total = pairs.size();
+    for (const auto& it : results) {
+        total += it.size();
+    }
+    pairs.reserve(total);
+    for (const auto& it : results) {
+        pairs.insert(pairs.end(), it.begin(), it.end());
+    }
+}
+
+void MeshFacetBVH::GetFacets(const Base::Vector3d& p,
+                             const Base::Vector3d& q,
+                             std::vector<FacetIndex>& facets) const
+{
+    if (nodes.empty()) {
+        return;
+    }
+
+    Base::Vector3d dir = q - p;
+    std::vector<uint32_t> stack {0};
+    while (!stack.empty()) {
+        uint32_t index = stack.back();
+        stack.pop_back();
+        const Node& node = nodes[index];
+        if (!SegmentIntersectsBox(p, dir, node.box)) {
+            continue;
+        }
+        if (node.count > 0) {
+            for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                if (SegmentIntersectsBox(p, dir, boxes[indices[i]])) {
+                    facets.push_back(indices[i]);
+                }
+            }
+        }
+        else {
+            stack.push_back(index + 1);
+            stack.push_back(node.first);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+MeshBoolean::MeshBoolean(const MeshKernel& mesh1,
+                         const MeshKernel& mesh2,
+                         MeshKernel& result,
+                         OperationType type)
+    : mesh1(mesh1)
+    , mesh2(mesh2)
+    , result(result)
+    , type(type)
+    , threads(std::max(1, int(std::thread::hardware_concurrency())))
+{}
+
+bool MeshBoolean::Do()
+{
+    BooleanData data(mesh1, mesh2);
+    bool ok = true;
+
+    // broad phase
+    std::vector<std::pair<FacetIndex, FacetIndex>> pairs;
+    data.bvh[0].GetOverlaps(data.bvh[1], pairs, threads);
+
+    // narrow phase
+    FacetIndex offset = data.numFacets[0];
+    std::vector<std::vector<Segment>> blocks(static_cast<std::size_t>(threads));
+    std::size_t blockSize = (pairs.size() + blocks.size() - 1) / blocks.size();
+    MeshCore::parallel_for(
+        blocks.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                std::size_t first = i * blockSize;
+                std::size_t last = std::min(first + blockSize, pairs.size());
+                for (std::size_t j = first; j < last; j++) {
+                    data.IntersectFacets(pairs[j].first, pairs[j].second + offset, blocks[i]);
+                }
+            }
+        },
+        threads);
+    pairs.clear();
+    pairs.shrink_to_fit();
+
+    std::vector<Segment> segments;
+    for (auto& it : blocks) {
+        segments.insert(segments.end(), it.begin(), it.end());
+        it.clear();
+    }
+    if (data.degenerate) {
+        ok = false;
+    }
+
+    // unique intersection points
+    data.hits.reserve(2 * segments.size());
+    for (const auto& it : segments) {
+        data.hits.push_back(it.h0);
+        data.hits.push_back(it.h1);
+    }
+    MeshCore::parallel_sort(data.hits.begin(), data.hits.end(), std::less<>(), threads);
+    data.hits.erase(std::unique(data.hits.begin(), data.hits.end()), data.hits.end());
+
+    data.firstHitPoint = data.points.size();
+    data.points.resize(data.points.size() + data.hits.size());
+    data.hitParams.resize(data.hits.size());
+    MeshCore::parallel_for(
+        data.hits.size(),
+        [&data](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                data.points[data.firstHitPoint + i] =
+                    data.HitPoint(data.hits[i], data.hitParams[i]);
+            }
+        },
+        threads);
+    data.MergeHitPoints(threads);
+
+    // group the segments by facet and retriangulate the cut facets
+    std::vector<std::pair<FacetIndex, std::size_t>> facetSegments;
+    facetSegments.reserve(2 * segments.size());
+    for (std::size_t i = 0; i < segments.size(); i++) {
+        facetSegments.emplace_back(segments[i].f0, i);
+        facetSegments.emplace_back(segments[i].f1, i);
+    }
+    MeshCore::parallel_sort(facetSegments.begin(),
+                            facetSegments.end(),
+                            std::less<>(),
+                            threads);
+
+    std::vector<std::pair<std::size_t, std::size_t>> groups;
+    for (std::size_t i = 0; i < facetSegments.size();) {
+        std::size_t j = i;
+        while (j < facetSegments.size() && facetSegments[j].first == facetSegments[i].first) {
+            j++;
+        }
+        groups.emplace_back(i, j);
+        i = j;
+    }
+
+    std::vector<std::vector<Triangle>> cutTriangles(groups.size());
+    std::vector<std::vector<std::pair<PointIndex, PointIndex>>> cutEdges(groups.size());
+    std::atomic<bool> retriangulated {true};
+    MeshCore::parallel_for(
+        groups.size(),
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<const Segment*> segs;
+            for (std::size_t i = begin; i < end; i++) {
+                segs.clear();
+                for (std::size_t j = groups[i].first; j < groups[i].second; j++) {
+                    segs.push_back(&segments[facetSegments[j].second]);
+                }
+                FacetIndex facet = facetSegments[groups[i].first].first;
+                if (!data.Retriangulate(facet, segs, cutTriangles[i], cutEdges[i])) {
+                    retriangulated = false;
+                }
+            }
+        },
+        threads);
+    if (!retriangulated) {
+        ok = false;
+    }
+
+    // collect all triangles of both meshes
+    std::vector<Triangle> triangles;
+    std::vector<int> sides;
+    std::vector<bool> isCut(data.facets.size(), false);
+    for (const auto& it : groups) {
+        isCut[facetSegments[it.first].first] = true;
+    }
+    for (FacetIndex i = 0; i < data.facets.size(); i++) {
+        if (!isCut[i]) {
+            triangles.push_back(data.facets[i]);
+            sides.push_back(data.Side(i));
+        }
+    }
+    for (std::size_t i = 0; i < groups.size(); i++) {
+        int side = data.Side(facetSegments[groups[i].first].first);
+        for (const auto& it : cutTriangles[i]) {
+            triangles.push_back(it);
+            sides.push_back(side);
+        }
+    }
+
+    std::vector<std::pair<PointIndex, PointIndex>> constraints;
+    for (const auto& it : cutEdges) {
+        constraints.insert(constraints.end(), it.begin(), it.end());
+    }
+    std::sort(constraints.begin(), constraints.end());
+    constraints.erase(std::unique(constraints.begin(), constraints.end()), constraints.end());
+
+    // connected patches of each mesh that are bounded by the intersection curves
+    struct EdgeEntry
+    {
+        PointIndex p0, p1;
+        std::size_t tria;
+        int side;
+        bool operator<(const EdgeEntry& e) const
+        {
+            if (side != e.side) {
+                return side < e.side;
+            }
+            if (p0 != e.p0) {
+                return p0 < e.p0;
+            }
+            return p1 < e.p1;
+        }
+    };
+    std::vector<EdgeEntry> edges;
+    edges.reserve(3 * triangles.size());
+    for (std::size_t i = 0; i < triangles.size(); i++) {
+        const Triangle& tria = triangles[i];
+        for (int j = 0; j < 3; j++) {
+            PointIndex p0 = tria[j];
+            PointIndex p1 = tria[(j + 1) % 3];
+            edges.push_back(EdgeEntry {std::min(p0, p1), std::max(p0, p1), i, sides[i]});
+        }
+    }
+    MeshCore::parallel_sort(edges.begin(), edges.end(), std::less<>(), threads);
+
+    UnionFind patches(triangles.size());
+    for (std::size_t i = 1; i < edges.size(); i++) {
+        const EdgeEntry& e0 = edges[i - 1];
+        const EdgeEntry& e1 = edges[i];
+        if (e0.side == e1.side && e0.p0 == e1.p0 && e0.p1 == e1.p1) {
+            if (!std::binary_search(constraints.begin(),
+                                    constraints.end(),
+                                    std::make_pair(e0.p0, e0.p1))) {
+                patches.Unite(e0.tria, e1.tria);
+            }
+        }
+    }
+
+    // classify each patch by its largest triangle
+    std::vector<std::size_t> roots;
+    std::vector<std::size_t> patchOf(triangles.size());
+    std::vector<std::size_t> representative;
+    std::vector<double> largest;
+    {
+        std::vector<std::size_t> rootIndex(triangles.size(), std::size_t(-1));
+        for (std::size_t i = 0; i < triangles.size(); i++) {
+            std::size_t root = patches.Find(i);
+            if (rootIndex[root] == std::size_t(-1)) {
+                rootIndex[root] = representative.size();
+                representative.push_back(i);
+                largest.push_back(-1.0);
+            }
+            std::size_t patch = rootIndex[root];
+            patchOf[i] = patch;
+
+            const Triangle& tria = triangles[i];
+            const Base::Vector3d& a = data.points[tria[0]];
+            double area = ((data.points[tria[1]] - a) % (data.points[tria[2]] - a)).Sqr();
+            if (area > largest[patch]) {
+                largest[patch] = area;
+                representative[patch] = i;
+            }
+        }
+    }
+
+    std::vector<Location> location(representative.size());
+    MeshCore::parallel_for(
+        representative.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                std::size_t index = representative[i];
+                const Triangle& tria = triangles[index];
+                Base::Vector3d center =
+                    (data.points[tria[0]] + data.points[tria[1]] + data.points[tria[2]]) / 3.0;
+                location[i] = data.Locate(center, 1 - sides[index]);
+            }
+        },
+        threads);
+
+    auto keep = [this](int side, Location loc) {
+        switch (type) {
+            case Union:
+                return side == 0 ? loc != Location::Inside : loc == Location::Outside;
+            case Intersect:
+                return side == 0 ? loc == Location::Inside : loc != Location::Outside;
+            case Difference:
+                return side == 0 ? loc != Location::Inside : loc == Location::Inside;
+            case Inner:
+                return side == 0 && loc == Location::Inside;
+            case Outer:
+                return side == 0 && loc != Location::Inside;
+        }
+        return false;
+    };
+
+    // build the result mesh
+    std::vector<PointIndex> pointMap(data.points.size(), POINT_INDEX_MAX);
+    MeshPointArray resultPoints;
+    MeshFacetArray resultFacets;
+    for (std::size_t i = 0; i < triangles.size(); i++) {
+        int side = sides[i];
+        if (!keep(side, location[patchOf[i]])) {
+            continue;
+        }
+
+        Triangle tria = triangles[i];
+        if (type == Difference && side == 1) {
+            std::swap(tria[1], tria[2]);
+        }
+
+        MeshFacet facet;
+        for (int j = 0; j < 3; j++) {
+            PointIndex& index = pointMap[tria[j]];
+            if (index == POINT_INDEX_MAX) {
+                index = static_cast<PointIndex>(resultPoints.size());
+                const Base::Vector3d& p = data.points[tria[j]];
+                resultPoints.push_back(MeshPoint(Base::convertTo<Base::Vector3f>(p)));
+            }
+            facet._aulPoints[j] = index;
+        }
+        resultFacets.push_back(facet);
+    }
+
+    result.Adopt(resultPoints, resultFacets, true);
+    return ok;
+}
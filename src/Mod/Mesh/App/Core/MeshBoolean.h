@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_MESHBOOLEAN_H
+#define MESH_MESHBOOLEAN_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <Base/BoundBox.h>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+class MeshKernel;
+
+/*!
+ * \brief The MeshFacetBVH class
+ * A bounding volume hierarchy of axis-aligned boxes over the facets of a mesh.
+ * The tree is built once by splitting the facet centroids at the median of the
+ * longest box axis and is used as broad phase for the mesh booleans.
+ */
+class MeshExport MeshFacetBVH
+{
+public:
+    explicit MeshFacetBVH(const MeshKernel&);
+
+    /// Returns the bounding box of the facet with index \a facet
+    const Base::BoundBox3f& GetFacetBoundBox(FacetIndex facet) const
+    {
+        return boxes[facet];
+    }
+    /*!
+     * Collects all facet pairs (this, other) whose bounding boxes overlap.
+     * The traversal is distributed over \a threads threads.
+     */
+    void GetOverlaps(const MeshFacetBVH& other,
+                     std::vector<std::pair<FacetIndex, FacetIndex>>& pairs,
+                     int threads) const;
+    /*!
+     * Collects all facets whose bounding boxes are hit by the segment
+     * from \a p to \a q.
+     */
+    void GetFacets(const Base::Vector3d& p,
+                   const Base::Vector3d& q,
+                   std::vector<FacetIndex>& facets) const;
+
+private:
+    struct Node
+    {
+        Base::BoundBox3f box;
+        uint32_t first {0};  // first index into 'indices' or index of the right child
+        uint32_t count {0};  // number of facets, 0 for inner nodes
+    };
+
+    uint32_t Build(uint32_t first, uint32_t count);
+    void GetOverlaps(uint32_t node,
+                     const MeshFacetBVH& other,
+                     uint32_t otherNode,
+                     std::vector<std::pair<FacetIndex, FacetIndex>>& pairs) const;
+
+private:
+    std::vector<Node> nodes;
+    std::vector<FacetIndex> indices;
+    std::vector<Base::BoundBox3f> boxes;
+    std::vector<Base::Vector3f> centers;
+};
+
+/*!
+ * \brief The MeshBoolean class
+ * Computes union, intersection and difference of two closed meshes.
+ *
+ * Candidate facet pairs are found with a MeshFacetBVH per mesh. All decisions whether
+ * two facets intersect are taken with exact orientation predicates (a floating-point
+ * filter with an exact expansion fallback) so that nearly coplanar facets are handled
+ * consistently. The intersection segments are inserted into every cut facet as
+ * constraints of a 2D triangulation and the resulting patches are classified as inside
+ * or outside of the other mesh. Intersection tests, retriangulation and classification
+ * run in parallel.
+ *
+ * \note Exactly coplanar overlapping facets are not split against each other. Patches
+ * lying on the surface of the other mesh are kept from the first mesh for the union and
+ * from the second mesh for the intersection.
+ */
+class MeshExport MeshBoolean
+{
+public:
+    enum OperationType
+    {
+        Union,
+        Intersect,
+        Difference,
+        Inner,
+        Outer
+    };
+
+    MeshBoolean(const MeshKernel& mesh1,
+                const MeshKernel& mesh2,
+                MeshKernel& result,
+                OperationType type);
+
+    /// Sets the number of threads to use. Default is the number of hardware threads.
+    void SetThreads(int num)
+    {
+        threads = num > 0 ? num : 1;
+    }
+    /*!
+     * Computes the boolean operation. Returns false if some facets couldn't be
+     * retriangulated because the input meshes intersect themselves.
+     */
+    bool Do();
+
+private:
+    const MeshKernel& mesh1;
+    const MeshKernel& mesh2;
+    MeshKernel& result;
+    OperationType type;
+    int threads;
+};
+
+}  // namespace MeshCore
+
+#endif  // MESH_MESHBOOLEAN_H
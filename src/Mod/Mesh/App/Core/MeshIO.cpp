@@ -1736,6 +1736,11 @@ void MeshOutput::SetSTLHeaderData(const std::string& header)
     }
 }
 
+const std::string& MeshOutput::GetSTLHeaderData()
+{
+    return stl_header;
+}
+
 std::string MeshOutput::asyWidth = "500";
 std::string MeshOutput::asyHeight = "500";
 
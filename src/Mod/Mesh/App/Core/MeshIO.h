@@ -196,6 +196,8 @@ public:
      * automatically filled up with spaces.
      */
     static void SetSTLHeaderData(const std::string&);
+    /** Returns the 80 characters written to the header of a binary STL. */
+    static const std::string& GetSTLHeaderData();
     /**
      * Change the image size of the asymptote output.
      */
@@ -23,14 +23,100 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <thread>
 #endif
 
+#include <Eigen/Eigenvalues>
+#include <Base/Converter.h>
+
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "Functional.h"
 #include "Segmentation.h"
 
 using namespace MeshCore;
 
+void IncrementalPlaneFit::Clear()
+{
+    std::fill(std::begin(sum), std::end(sum), 0.0);
+    std::fill(std::begin(sum2), std::end(sum2), 0.0);
+    count = 0;
+    fitted = false;
+    valid = false;
+    base.Set(0.0F, 0.0F, 0.0F);
+    normal.Set(0.0F, 0.0F, 0.0F);
+}
+
+void IncrementalPlaneFit::AddPoint(const Base::Vector3f& pnt)
+{
+    // the moments are taken relative to the first point to reduce cancellation errors
+    Base::Vector3d p(pnt.x, pnt.y, pnt.z);
+    if (count == 0) {
+        origin = p;
+    }
+    p -= origin;
+    sum[0] += p.x;
+    sum[1] += p.y;
+    sum[2] += p.z;
+    sum2[0] += p.x * p.x;
+    sum2[1] += p.x * p.y;
+    sum2[2] += p.x * p.z;
+    sum2[3] += p.y * p.y;
+    sum2[4] += p.y * p.z;
+    sum2[5] += p.z * p.z;
+    count++;
+    fitted = false;
+}
+
+float IncrementalPlaneFit::Fit()
+{
+    fitted = true;
+    valid = false;
+    if (count < 3) {
+        return FLOAT_MAX;
+    }
+
+    double n = double(count);
+    double mx = sum[0] / n;
+    double my = sum[1] / n;
+    double mz = sum[2] / n;
+
+    Eigen::Matrix3d covMat;
+    covMat(0, 0) = sum2[0] - mx * sum[0];
+    covMat(0, 1) = sum2[1] - mx * sum[1];
+    covMat(0, 2) = sum2[2] - mx * sum[2];
+    covMat(1, 1) = sum2[3] - my * sum[1];
+    covMat(1, 2) = sum2[4] - my * sum[2];
+    covMat(2, 2) = sum2[5] - mz * sum[2];
+    covMat(1, 0) = covMat(0, 1);
+    covMat(2, 0) = covMat(0, 2);
+    covMat(2, 1) = covMat(1, 2);
+
+    // the eigenvalues are sorted in increasing order
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> eig(covMat);
+    if (eig.info() != Eigen::Success || eig.eigenvalues()(1) <= 0.0) {
+        return FLOAT_MAX;
+    }
+
+    Eigen::Vector3d w = eig.eigenvectors().col(0);
+    normal.Set(float(w.x()), float(w.y()), float(w.z()));
+    base.Set(float(origin.x + mx), float(origin.y + my), float(origin.z + mz));
+    valid = true;
+
+    double sigma = std::max(0.0, eig.eigenvalues()(0));
+    return count > 3 ? float(std::sqrt(sigma / (n - 3.0))) : 0.0F;
+}
+
+float IncrementalPlaneFit::GetDistanceToPlane(const Base::Vector3f& pnt) const
+{
+    return (pnt - base) * normal;
+}
+
 void MeshSurfaceSegment::Initialize(FacetIndex)
 {}
 
@@ -66,7 +152,7 @@ MeshDistancePlanarSegment::MeshDistancePlanarSegment(const MeshKernel& mesh,
                                                      unsigned long minFacets,
                                                      float tol)
     : MeshDistanceSurfaceSegment(mesh, minFacets, tol)
-    , fitter(new PlaneFit)
+    , fitter(new IncrementalPlaneFit)
 {}
 
 MeshDistancePlanarSegment::~MeshDistancePlanarSegment()
@@ -91,9 +177,18 @@ bool MeshDistancePlanarSegment::TestFacet(const MeshFacet& face) const
     if (!fitter->Done()) {
         fitter->Fit();
     }
+
+    // if the points don't define a plane, e.g. for a degenerated initial facet,
+    // the plane of the initial facet is used
+    bool useFit = fitter->IsValid();
+    if (!useFit && normal.IsNull()) {
+        return false;
+    }
+
     MeshGeomFacet triangle = kernel.GetFacet(face);
     for (auto pnt : triangle._aclPoints) {
-        if (fabs(fitter->GetDistanceToPlane(pnt)) > tolerance) {
+        float dist = useFit ? fitter->GetDistanceToPlane(pnt) : pnt.DistanceToPlane(basepoint, normal);
+        if (fabs(dist) > tolerance) {
             return false;
         }
     }
@@ -110,7 +205,7 @@ void MeshDistancePlanarSegment::AddFacet(const MeshFacet& face)
 // --------------------------------------------------------
 
 PlaneSurfaceFit::PlaneSurfaceFit()
-    : fitter(new PlaneFit)
+    : fitter(new IncrementalPlaneFit)
 {}
 
 PlaneSurfaceFit::PlaneSurfaceFit(const Base::Vector3f& b, const Base::Vector3f& n)
@@ -173,19 +268,21 @@ float PlaneSurfaceFit::Fit()
 
 float PlaneSurfaceFit::GetDistanceToSurface(const Base::Vector3f& pnt) const
 {
-    if (!fitter) {
-        return pnt.DistanceToPlane(basepoint, normal);
-    }
-    else {
+    if (fitter && fitter->IsValid()) {
         return fitter->GetDistanceToPlane(pnt);
     }
+    // no plane could be fitted, use the plane of the initial triangle if it has one
+    if (normal.IsNull()) {
+        return FLOAT_MAX;
+    }
+    return pnt.DistanceToPlane(basepoint, normal);
 }
 
 std::vector<float> PlaneSurfaceFit::Parameters() const
 {
     Base::Vector3f base = basepoint;
     Base::Vector3f norm = normal;
-    if (fitter) {
+    if (fitter && fitter->IsValid()) {
         base = fitter->GetBase();
         norm = fitter->GetNormal();
     }
@@ -616,3 +713,607 @@ void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm
         }
     }
 }
+
+// --------------------------------------------------------
+
+namespace
+{
+constexpr std::size_t NoRegion = std::numeric_limits<std::size_t>::max();
+
+struct Region
+{
+    std::unique_ptr<AbstractSurfaceFit> fitter;
+    std::vector<FacetIndex> facets;
+    std::vector<FacetIndex> front;
+    std::vector<FacetIndex> candidates;
+};
+
+void ClaimFacet(std::atomic<std::size_t>& claim, std::size_t region)
+{
+    std::size_t current = claim.load();
+    while (region < current && !claim.compare_exchange_weak(current, region)) {}
+}
+}  // namespace
+
+MeshParallelSegmentAlgorithm::MeshParallelSegmentAlgorithm(const MeshKernel& kernel,
+                                                           SurfaceFitFactory factory,
+                                                           unsigned long minFacets,
+                                                           float tol)
+    : myKernel(kernel)
+    , factory(std::move(factory))
+    , minFacets(minFacets)
+    , tolerance(tol)
+    , threads(std::max(1, int(std::thread::hardware_concurrency())))
+{}
+
+bool MeshParallelSegmentAlgorithm::TestTriangle(const AbstractSurfaceFit& fitter,
+                                                const MeshGeomFacet& triangle) const
+{
+    for (const auto& pnt : triangle._aclPoints) {
+        if (fabs(fitter.GetDistanceToSurface(pnt)) > tolerance) {
+            return false;
+        }
+    }
+    return fitter.TestTriangle(triangle);
+}
+
+std::vector<MeshSegment> MeshParallelSegmentAlgorithm::FindSegments()
+{
+    const MeshFacetArray& facets = myKernel.GetFacets();
+    std::size_t numFacets = facets.size();
+    std::size_t numSeeds = seedsPerRound > 0 ? seedsPerRound : 4 * std::size_t(threads);
+
+    std::vector<std::size_t> label(numFacets, NoRegion);
+    std::vector<std::atomic<std::size_t>> claim(numFacets);
+    for (auto& it : claim) {
+        it = NoRegion;
+    }
+    std::vector<bool> tried(numFacets, false);
+    std::vector<std::size_t> blocked(numFacets, NoRegion);
+    std::vector<Region> regions;
+
+    std::size_t next = 0;
+    for (std::size_t round = 0; next < numFacets; round++) {
+        // pick the seeds of this round, direct neighbours of a seed are not used as seed
+        std::size_t first = regions.size();
+        std::size_t picked = 0;
+        for (std::size_t i = next; i < numFacets && picked < numSeeds; i++) {
+            if (tried[i] || label[i] != NoRegion || blocked[i] == round) {
+                continue;
+            }
+            tried[i] = true;
+            picked++;
+
+            Region region;
+            region.fitter = factory();
+            MeshGeomFacet triangle = myKernel.GetFacet(i);
+            region.fitter->Initialize(triangle);
+            if (!TestTriangle(*region.fitter, triangle)) {
+                continue;
+            }
+
+            label[i] = regions.size();
+            claim[i] = regions.size();
+            region.facets.push_back(i);
+            region.front.push_back(i);
+            regions.push_back(std::move(region));
+            for (FacetIndex neighbour : facets[i]._aulNeighbours) {
+                if (neighbour != FACET_INDEX_MAX) {
+                    blocked[neighbour] = round;
+                }
+            }
+        }
+
+        // grow all regions of this round ring by ring
+        std::atomic<bool> growing {regions.size() > first};
+        while (growing) {
+            growing = false;
+            MeshCore::parallel_for(
+                regions.size() - first,
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t r = first + begin; r < first + end; r++) {
+                        Region& region = regions[r];
+                        region.candidates.clear();
+                        if (region.front.empty()) {
+                            continue;
+                        }
+                        if (!region.fitter->Done()) {
+                            region.fitter->Fit();
+                        }
+                        for (FacetIndex index : region.front) {
+                            for (FacetIndex neighbour : facets[index]._aulNeighbours) {
+                                if (neighbour != FACET_INDEX_MAX && label[neighbour] == NoRegion) {
+                                    region.candidates.push_back(neighbour);
+                                }
+                            }
+                        }
+                        std::sort(region.candidates.begin(), region.candidates.end());
+                        region.candidates.erase(
+                            std::unique(region.candidates.begin(), region.candidates.end()),
+                            region.candidates.end());
+                        auto it = std::remove_if(region.candidates.begin(),
+                                                 region.candidates.end(),
+                                                 [&](FacetIndex index) {
+                                                     return !TestTriangle(*region.fitter,
+                                                                          myKernel.GetFacet(index));
+                                                 });
+                        region.candidates.erase(it, region.candidates.end());
+                        for (FacetIndex index : region.candidates) {
+                            ClaimFacet(claim[index], r);
+                        }
+                    }
+                },
+                threads);
+
+            // a facet claimed by several regions goes to the one with the lowest index
+            MeshCore::parallel_for(
+                regions.size() - first,
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t r = first + begin; r < first + end; r++) {
+                        Region& region = regions[r];
+                        region.front.clear();
+                        for (FacetIndex index : region.candidates) {
+                            if (claim[index] == r) {
+                                label[index] = r;
+                                region.facets.push_back(index);
+                                region.front.push_back(index);
+                                region.fitter->AddTriangle(myKernel.GetFacet(index));
+                            }
+                        }
+                        if (!region.front.empty()) {
+                            growing = true;
+                        }
+                    }
+                },
+                threads);
+        }
+
+        // single facets can still become part of another region
+        for (std::size_t r = first; r < regions.size(); r++) {
+            Region& region = regions[r];
+            region.fitter.reset();
+            if (region.facets.size() <= 1) {
+                for (FacetIndex index : region.facets) {
+                    label[index] = NoRegion;
+                    claim[index] = NoRegion;
+                }
+                region.facets.clear();
+            }
+        }
+
+        while (next < numFacets && (tried[next] || label[next] != NoRegion)) {
+            next++;
+        }
+    }
+
+    // merge adjacent regions that fit to the same surface, longest common borders first
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    for (FacetIndex i = 0; i < numFacets; i++) {
+        if (label[i] == NoRegion) {
+            continue;
+        }
+        for (FacetIndex neighbour : facets[i]._aulNeighbours) {
+            if (neighbour != FACET_INDEX_MAX && label[neighbour] != NoRegion
+                && label[i] < label[neighbour]) {
+                pairs.emplace_back(label[i], label[neighbour]);
+            }
+        }
+    }
+    MeshCore::parallel_sort(pairs.begin(), pairs.end(), std::less<>(), threads);
+
+    std::vector<std::pair<std::size_t, std::pair<std::size_t, std::size_t>>> borders;
+    for (std::size_t i = 0; i < pairs.size();) {
+        std::size_t j = i;
+        while (j < pairs.size() && pairs[j] == pairs[i]) {
+            j++;
+        }
+        borders.emplace_back(j - i, pairs[i]);
+        i = j;
+    }
+    std::stable_sort(borders.begin(), borders.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    std::vector<std::size_t> parent(regions.size());
+    std::iota(parent.begin(), parent.end(), std::size_t(0));
+    auto find = [&parent](std::size_t index) {
+        while (parent[index] != index) {
+            parent[index] = parent[parent[index]];
+            index = parent[index];
+        }
+        return index;
+    };
+
+    for (const auto& it : borders) {
+        std::size_t r0 = find(it.second.first);
+        std::size_t r1 = find(it.second.second);
+        if (r0 == r1) {
+            continue;
+        }
+
+        std::vector<FacetIndex>& facets0 = regions[r0].facets;
+        std::vector<FacetIndex>& facets1 = regions[r1].facets;
+        std::unique_ptr<AbstractSurfaceFit> fitter = factory();
+        // the initial facet is already part of the fit
+        fitter->Initialize(myKernel.GetFacet(facets0.front()));
+        for (auto it = std::next(facets0.begin()); it != facets0.end(); ++it) {
+            fitter->AddTriangle(myKernel.GetFacet(*it));
+        }
+        for (FacetIndex index : facets1) {
+            fitter->AddTriangle(myKernel.GetFacet(index));
+        }
+        fitter->Fit();
+
+        auto fits = [&](FacetIndex index) {
+            return TestTriangle(*fitter, myKernel.GetFacet(index));
+        };
+        if (std::all_of(facets0.begin(), facets0.end(), fits)
+            && std::all_of(facets1.begin(), facets1.end(), fits)) {
+            std::size_t root = std::min(r0, r1);
+            std::size_t other = std::max(r0, r1);
+            parent[other] = root;
+            std::vector<FacetIndex>& target = regions[root].facets;
+            std::vector<FacetIndex>& source = regions[other].facets;
+            target.insert(target.end(), source.begin(), source.end());
+            source.clear();
+        }
+    }
+
+    std::vector<MeshSegment> segments;
+    for (auto& it : regions) {
+        if (it.facets.size() > 1 && it.facets.size() >= minFacets) {
+            std::sort(it.facets.begin(), it.facets.end());
+            segments.push_back(std::move(it.facets));
+        }
+    }
+
+    return segments;
+}
+
+// --------------------------------------------------------
+
+namespace
+{
+struct Shape
+{
+    MeshRansacSegmentation::Type type {MeshRansacSegmentation::Plane};
+    Base::Vector3d base;
+    Base::Vector3d axis;
+    double radius {0.0};
+
+    // Returns the unit normal of the shape at the projection of p
+    Base::Vector3d Normal(const Base::Vector3d& p) const
+    {
+        switch (type) {
+            case MeshRansacSegmentation::Plane:
+                return axis;
+            case MeshRansacSegmentation::Cylinder: {
+                Base::Vector3d d = p - base;
+                Base::Vector3d radial = d - axis * (d * axis);
+                return radial.Normalize();
+            }
+            case MeshRansacSegmentation::Sphere: {
+                Base::Vector3d radial = p - base;
+                return radial.Normalize();
+            }
+        }
+        return axis;
+    }
+
+    double Distance(const Base::Vector3d& p) const
+    {
+        switch (type) {
+            case MeshRansacSegmentation::Plane:
+                return std::fabs((p - base) * axis);
+            case MeshRansacSegmentation::Cylinder: {
+                Base::Vector3d d = p - base;
+                Base::Vector3d radial = d - axis * (d * axis);
+                return std::fabs(radial.Length() - radius);
+            }
+            case MeshRansacSegmentation::Sphere:
+                return std::fabs((p - base).Length() - radius);
+        }
+        return DBL_MAX;
+    }
+
+    bool IsInlier(const Base::Vector3d& p,
+                  const Base::Vector3d& n,
+                  double distance,
+                  double cosAngle) const
+    {
+        return Distance(p) <= distance && std::fabs(Normal(p) * n) >= cosAngle;
+    }
+
+    std::vector<float> Parameters() const
+    {
+        std::vector<float> c {float(base.x), float(base.y), float(base.z)};
+        if (type != MeshRansacSegmentation::Sphere) {
+            c.push_back(float(axis.x));
+            c.push_back(float(axis.y));
+            c.push_back(float(axis.z));
+        }
+        if (type != MeshRansacSegmentation::Plane) {
+            c.push_back(float(radius));
+        }
+        return c;
+    }
+};
+
+// Closest points of the lines p0 + t * d0 and p1 + s * d1
+bool ClosestPoints(const Base::Vector3d& p0,
+                   const Base::Vector3d& d0,
+                   const Base::Vector3d& p1,
+                   const Base::Vector3d& d1,
+                   Base::Vector3d& c0,
+                   Base::Vector3d& c1)
+{
+    Base::Vector3d w = p0 - p1;
+    double a = d0 * d0;
+    double b = d0 * d1;
+    double c = d1 * d1;
+    double d = d0 * w;
+    double e = d1 * w;
+    double denom = a * c - b * b;
+    if (denom <= 1e-12 * a * c) {
+        return false;
+    }
+    double t = (b * e - c * d) / denom;
+    double s = (a * e - b * d) / denom;
+    c0 = p0 + d0 * t;
+    c1 = p1 + d1 * s;
+    return true;
+}
+
+bool MakeShape(MeshRansacSegmentation::Type type,
+               const Base::Vector3d* p,
+               const Base::Vector3d* n,
+               Shape& shape)
+{
+    shape.type = type;
+    switch (type) {
+        case MeshRansacSegmentation::Plane: {
+            Base::Vector3d normal = (p[1] - p[0]) % (p[2] - p[0]);
+            if (normal.Length() <= 0.0) {
+                return false;
+            }
+            shape.base = p[0];
+            shape.axis = normal.Normalize();
+            return true;
+        }
+        case MeshRansacSegmentation::Cylinder: {
+            Base::Vector3d axis = n[0] % n[1];
+            if (axis.Length() < 1e-3) {
+                return false;
+            }
+            axis.Normalize();
+            // intersect the normal lines projected onto the plane perpendicular to the axis
+            Base::Vector3d q1 = p[1] - axis * ((p[1] - p[0]) * axis);
+            Base::Vector3d d0 = n[0] - axis * (n[0] * axis);
+            Base::Vector3d d1 = n[1] - axis * (n[1] * axis);
+            Base::Vector3d c0, c1;
+            if (!ClosestPoints(p[0], d0, q1, d1, c0, c1)) {
+                return false;
+            }
+            shape.base = (c0 + c1) / 2.0;
+            shape.axis = axis;
+            shape.radius = (Base::Distance(p[0], c0) + Base::Distance(q1, c1)) / 2.0;
+            return shape.radius > 0.0;
+        }
+        case MeshRansacSegmentation::Sphere: {
+            Base::Vector3d c0, c1;
+            if (!ClosestPoints(p[0], n[0], p[1], n[1], c0, c1)) {
+                return false;
+            }
+            shape.base = (c0 + c1) / 2.0;
+            shape.radius = (Base::Distance(p[0], shape.base) + Base::Distance(p[1], shape.base)) / 2.0;
+            return shape.radius > 0.0;
+        }
+    }
+    return false;
+}
+}  // namespace
+
+MeshRansacSegmentation::MeshRansacSegmentation(const MeshKernel& kernel)
+    : myKernel(kernel)
+    , threads(std::max(1, int(std::thread::hardware_concurrency())))
+{}
+
+std::vector<MeshRansacSegmentation::Primitive> MeshRansacSegmentation::FindPrimitives()
+{
+    std::vector<Primitive> primitives;
+    const MeshFacetArray& facets = myKernel.GetFacets();
+    std::size_t numFacets = facets.size();
+
+    std::vector<Type> types;
+    for (Type type : {Plane, Cylinder, Sphere}) {
+        if (searchTypes & type) {
+            types.push_back(type);
+        }
+    }
+    if (types.empty() || numFacets == 0) {
+        return primitives;
+    }
+
+    // oriented samples
+    std::vector<Base::Vector3d> centers(numFacets);
+    std::vector<Base::Vector3d> normals(numFacets);
+    MeshCore::parallel_for(
+        numFacets,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                MeshGeomFacet triangle = myKernel.GetFacet(i);
+                centers[i] = Base::convertTo<Base::Vector3d>(triangle.GetGravityPoint());
+                normals[i] = Base::convertTo<Base::Vector3d>(triangle.GetNormal());
+                normals[i].Normalize();
+            }
+        },
+        threads);
+
+    const double dist = distance;
+    const double cosAngle = std::cos(double(deviation));
+    const std::size_t numCandidates = std::size_t(std::max(candidates, 1));
+    const std::size_t subsetSize = 4096;
+    const std::size_t neighbourhood = 256;
+    const int maxFailures = 10;
+
+    std::vector<bool> removed(numFacets, false);
+    std::vector<FacetIndex> remaining(numFacets);
+    std::iota(remaining.begin(), remaining.end(), FacetIndex(0));
+
+    int failures = 0;
+    for (std::size_t iteration = 0; remaining.size() >= std::max<std::size_t>(minFacets, 3)
+         && failures < maxFailures;
+         iteration++) {
+        std::vector<FacetIndex> subset;
+        std::size_t stride = std::max<std::size_t>(1, remaining.size() / subsetSize);
+        for (std::size_t i = iteration % stride; i < remaining.size(); i += stride) {
+            subset.push_back(remaining[i]);
+        }
+
+        // build and score the candidates, each with its own random sequence
+        std::vector<Shape> shapes(numCandidates);
+        std::vector<std::size_t> scores(numCandidates, 0);
+        MeshCore::parallel_for(
+            numCandidates,
+            [&](std::size_t begin, std::size_t end) {
+                std::vector<FacetIndex> near;
+                std::vector<FacetIndex> visited;
+                for (std::size_t c = begin; c < end; c++) {
+                    std::mt19937 rng(seed + static_cast<unsigned int>(iteration * numCandidates + c));
+                    FacetIndex start = remaining[rng() % remaining.size()];
+
+                    // the other samples are taken from the surrounding facets
+                    near.clear();
+                    visited.clear();
+                    near.push_back(start);
+                    visited.push_back(start);
+                    for (std::size_t i = 0; i < near.size() && near.size() < neighbourhood; i++) {
+                        for (FacetIndex neighbour : facets[near[i]]._aulNeighbours) {
+                            if (neighbour != FACET_INDEX_MAX && !removed[neighbour]
+                                && std::find(visited.begin(), visited.end(), neighbour)
+                                    == visited.end()) {
+                                visited.push_back(neighbour);
+                                near.push_back(neighbour);
+                            }
+                        }
+                    }
+                    const std::vector<FacetIndex>& pool = near.size() >= 3 ? near : remaining;
+
+                    FacetIndex sample[3] = {start,
+                                            pool[rng() % pool.size()],
+                                            pool[rng() % pool.size()]};
+                    if (sample[0] == sample[1] || sample[0] == sample[2] || sample[1] == sample[2]) {
+                        continue;
+                    }
+
+                    Base::Vector3d p[3];
+                    Base::Vector3d n[3];
+                    for (int i = 0; i < 3; i++) {
+                        p[i] = centers[sample[i]];
+                        n[i] = normals[sample[i]];
+                    }
+
+                    Shape& shape = shapes[c];
+                    if (!MakeShape(types[c % types.size()], p, n, shape)) {
+                        continue;
+                    }
+                    bool valid = true;
+                    for (int i = 0; i < 3; i++) {
+                        if (!shape.IsInlier(p[i], n[i], dist, cosAngle)) {
+                            valid = false;
+                        }
+                    }
+                    if (!valid) {
+                        continue;
+                    }
+
+                    std::size_t score = 0;
+                    for (FacetIndex index : subset) {
+                        if (shape.IsInlier(centers[index], normals[index], dist, cosAngle)) {
+                            score++;
+                        }
+                    }
+                    scores[c] = score;
+                }
+            },
+            threads);
+
+        std::size_t best = std::max_element(scores.begin(), scores.end()) - scores.begin();
+        if (scores[best] < 3) {
+            failures++;
+            continue;
+        }
+
+        // rate the best candidate on all remaining facets
+        const Shape& shape = shapes[best];
+        std::vector<bool> inlier(numFacets, false);
+        std::vector<char> flags(remaining.size(), 0);
+        MeshCore::parallel_for(
+            remaining.size(),
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    FacetIndex index = remaining[i];
+                    flags[i] = shape.IsInlier(centers[index], normals[index], dist, cosAngle);
+                }
+            },
+            threads);
+        for (std::size_t i = 0; i < remaining.size(); i++) {
+            inlier[remaining[i]] = flags[i] != 0;
+        }
+
+        // largest connected component of the inliers
+        MeshSegment component;
+        std::vector<bool> done(numFacets, false);
+        for (FacetIndex index : remaining) {
+            if (!inlier[index] || done[index]) {
+                continue;
+            }
+            MeshSegment current {index};
+            done[index] = true;
+            for (std::size_t i = 0; i < current.size(); i++) {
+                for (FacetIndex neighbour : facets[current[i]]._aulNeighbours) {
+                    if (neighbour != FACET_INDEX_MAX && inlier[neighbour] && !done[neighbour]) {
+                        done[neighbour] = true;
+                        current.push_back(neighbour);
+                    }
+                }
+            }
+            if (current.size() > component.size()) {
+                component.swap(current);
+            }
+        }
+
+        if (component.size() < std::max<unsigned long>(minFacets, 3)) {
+            failures++;
+            continue;
+        }
+
+        failures = 0;
+        Shape result = shape;
+        if (result.type == Plane) {
+            IncrementalPlaneFit fit;
+            for (FacetIndex index : component) {
+                fit.AddPoint(Base::convertTo<Base::Vector3f>(centers[index]));
+            }
+            if (fit.Fit() < FLOAT_MAX) {
+                result.base = Base::convertTo<Base::Vector3d>(fit.GetBase());
+                result.axis = Base::convertTo<Base::Vector3d>(fit.GetNormal());
+            }
+        }
+
+        for (FacetIndex index : component) {
+            removed[index] = true;
+        }
+        remaining.erase(std::remove_if(remaining.begin(),
+                                       remaining.end(),
+                                       [&removed](FacetIndex index) {
+                                           return removed[index];
+                                       }),
+                        remaining.end());
+
+        std::sort(component.begin(), component.end());
+        primitives.push_back({result.type, result.Parameters(), std::move(component)});
+    }
+
+    return primitives;
+}
@@ -23,6 +23,7 @@
 #ifndef MESHCORE_SEGMENTATION_H
 #define MESHCORE_SEGMENTATION_H
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -40,6 +41,59 @@ class SphereFit;
 class MeshFacet;
 using MeshSegment = std::vector<FacetIndex>;
 
+/*!
+ * \brief The IncrementalPlaneFit class
+ * Fits a plane into a point set like PlaneFit but only keeps the sums of the first and
+ * second order moments. Adding a point and re-fitting the plane is therefore independent
+ * of the number of points added so far which is needed when growing large regions.
+ */
+class MeshExport IncrementalPlaneFit
+{
+public:
+    IncrementalPlaneFit() = default;
+
+    void Clear();
+    void AddPoint(const Base::Vector3f&);
+    std::size_t CountPoints() const
+    {
+        return count;
+    }
+    /// Returns true if no point was added since the last fit
+    bool Done() const
+    {
+        return fitted;
+    }
+    /**
+     * Fits the plane into the added points. If there are less than three non-collinear
+     * points FLOAT_MAX is returned, otherwise the standard deviation.
+     */
+    float Fit();
+    /// Returns true if the last fit has found a plane
+    bool IsValid() const
+    {
+        return valid;
+    }
+    Base::Vector3f GetBase() const
+    {
+        return base;
+    }
+    Base::Vector3f GetNormal() const
+    {
+        return normal;
+    }
+    float GetDistanceToPlane(const Base::Vector3f&) const;
+
+private:
+    Base::Vector3d origin;
+    double sum[3] {};
+    double sum2[6] {};  // xx, xy, xz, yy, yz, zz
+    std::size_t count {0};
+    bool fitted {false};
+    bool valid {false};
+    Base::Vector3f base;
+    Base::Vector3f normal;
+};
+
 class MeshExport MeshSurfaceSegment
 {
 public:
@@ -111,7 +165,7 @@ public:
 private:
     Base::Vector3f basepoint;
     Base::Vector3f normal;
-    PlaneFit* fitter;
+    IncrementalPlaneFit* fitter;
 };
 
 class MeshExport AbstractSurfaceFit
@@ -162,7 +216,7 @@ public:
 private:
     Base::Vector3f basepoint;
     Base::Vector3f normal;
-    PlaneFit* fitter;
+    IncrementalPlaneFit* fitter;
 };
 
 class MeshExport CylinderSurfaceFit: public AbstractSurfaceFit
@@ -396,6 +450,120 @@ private:
     const MeshKernel& myKernel;
 };
 
+/*!
+ * \brief The MeshParallelSegmentAlgorithm class
+ * Region growing like MeshSegmentAlgorithm but many regions are seeded and grown at
+ * the same time. The regions grow ring by ring in lockstep: in each step every region
+ * proposes the free neighbour facets that fit its surface and a facet wanted by several
+ * regions goes to the region with the lowest index. This makes the result independent
+ * of the number of threads. Afterwards adjacent regions are merged if one surface fits
+ * both of them so that a surface seeded several times still ends up as one segment.
+ */
+class MeshExport MeshParallelSegmentAlgorithm
+{
+public:
+    using SurfaceFitFactory = std::function<std::unique_ptr<AbstractSurfaceFit>()>;
+
+    MeshParallelSegmentAlgorithm(const MeshKernel& kernel,
+                                 SurfaceFitFactory factory,
+                                 unsigned long minFacets,
+                                 float tol);
+
+    /// Sets the number of threads to use. Default is the number of hardware threads.
+    void SetThreads(int num)
+    {
+        threads = num > 0 ? num : 1;
+    }
+    /// Sets the number of regions grown at the same time. Default is four per thread.
+    void SetSeedsPerRound(std::size_t num)
+    {
+        seedsPerRound = num;
+    }
+    std::vector<MeshSegment> FindSegments();
+
+private:
+    bool TestTriangle(const AbstractSurfaceFit&, const MeshGeomFacet&) const;
+
+private:
+    const MeshKernel& myKernel;
+    SurfaceFitFactory factory;
+    unsigned long minFacets;
+    float tolerance;
+    int threads;
+    std::size_t seedsPerRound {0};
+};
+
+/*!
+ * \brief The MeshRansacSegmentation class
+ * Detects planes, cylinders and spheres with RANSAC in the spirit of Schnabel et al.,
+ * Efficient RANSAC for Point-Cloud Shape Detection. The facet centers and normals are
+ * used as oriented samples. Candidate shapes are built from minimal samples of nearby
+ * facets and scored in parallel on a subset of the remaining facets. The best candidate
+ * is rated on all remaining facets and its largest connected component of inliers is
+ * extracted as segment.
+ */
+class MeshExport MeshRansacSegmentation
+{
+public:
+    enum Type
+    {
+        Plane = 1,
+        Cylinder = 2,
+        Sphere = 4
+    };
+
+    struct Primitive
+    {
+        Type type;
+        /// Same layout as AbstractSurfaceFit::Parameters() of the according fit
+        std::vector<float> parameters;
+        MeshSegment segment;
+    };
+
+    explicit MeshRansacSegmentation(const MeshKernel& kernel);
+
+    /// Sets the types to search for as combination of Type flags
+    void SetTypes(int types)
+    {
+        searchTypes = types;
+    }
+    /// Maximum distance of a facet center and maximum normal deviation (in radians)
+    void SetTolerance(float dist, float angle)
+    {
+        distance = dist;
+        deviation = angle;
+    }
+    void SetMinFacets(unsigned long num)
+    {
+        minFacets = num;
+    }
+    /// Number of candidate shapes per iteration
+    void SetCandidates(int num)
+    {
+        candidates = num;
+    }
+    void SetThreads(int num)
+    {
+        threads = num > 0 ? num : 1;
+    }
+    /// Sets the seed of the random number generator
+    void SetSeed(unsigned int num)
+    {
+        seed = num;
+    }
+    std::vector<Primitive> FindPrimitives();
+
+private:
+    const MeshKernel& myKernel;
+    int searchTypes {Plane | Cylinder | Sphere};
+    float distance {0.1F};
+    float deviation {0.2F};
+    unsigned long minFacets {20};
+    int candidates {64};
+    int threads;
+    unsigned int seed {0};
+};
+
 }  // namespace MeshCore
 
 #endif  // MESHCORE_SEGMENTATION_H
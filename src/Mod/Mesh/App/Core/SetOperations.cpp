@@ -34,8 +34,10 @@
 #include "Builder.h"
 #include "Definitions.h"
 #include "Elements.h"
+#include "Evaluation.h"
 #include "Grid.h"
 #include "Iterator.h"
+#include "MeshBoolean.h"
 #include "SetOperations.h"
 #include "Triangulation.h"
 #include "Visitor.h"
@@ -44,6 +46,16 @@
 using namespace Base;
 using namespace MeshCore;
 
+namespace
+{
+// MeshBoolean classifies the patches by ray parity, which is only meaningful for closed
+// meshes that don't intersect themselves
+bool isSuitedForExactBoolean(const MeshKernel& kernel)
+{
+    return MeshEvalSolid(kernel).Evaluate() && MeshEvalSelfIntersection(kernel).Evaluate();
+}
+}  // namespace
+
 
 SetOperations::SetOperations(const MeshKernel& cutMesh1,
                              const MeshKernel& cutMesh2,
@@ -58,6 +70,24 @@ SetOperations::SetOperations(const MeshKernel& cutMesh1,
 {}
 
 void SetOperations::Do()
+{
+    if (!_legacyEngine && isSuitedForExactBoolean(_cutMesh0)
+        && isSuitedForExactBoolean(_cutMesh1)) {
+        MeshBoolean boolean(_cutMesh0,
+                            _cutMesh1,
+                            _resultMesh,
+                            static_cast<MeshBoolean::OperationType>(_operationType));
+        if (boolean.Do()) {
+            return;
+        }
+
+        // degenerate intersections or a failed retriangulation, try the grid based algorithm
+    }
+
+    DoLegacy();
+}
+
+void SetOperations::DoLegacy()
 {
     _minDistanceToPoint = 0.000001f;
     float saveMinMeshDistance = MeshDefinitions::_fMinPointDistance;
@@ -62,7 +62,10 @@ public:
         Outer
     };
 
-    /// Construction
+    /** Construction
+     * \a minDistanceToPoint is kept for compatibility only: MeshBoolean decides exactly and
+     * needs no tolerance, and the grid based algorithm always used a fixed distance of 1e-6.
+     */
     SetOperations(const MeshKernel& cutMesh1,
                   const MeshKernel& cutMesh2,
                   MeshKernel& result,
@@ -75,6 +78,18 @@ public:
      * polyline goes direct to the point
      */
     void Do();
+    /** By default the set operation is computed with MeshBoolean if both meshes are closed
+     * and free of self-intersections. If \a on is true or the input is not suited for
+     * MeshBoolean the former grid based algorithm is used instead.
+     */
+    void SetUseLegacyEngine(bool on)
+    {
+        _legacyEngine = on;
+    }
+
+private:
+    /** The former grid based algorithm */
+    void DoLegacy();
 
 private:
     const MeshKernel& _cutMesh0;  /** Mesh for set operations source 1 */
@@ -82,6 +97,7 @@ private:
     MeshKernel& _resultMesh;      /** Result mesh */
     OperationType _operationType; /** Set Operation Type */
     float _minDistanceToPoint;    /** Minimal distance to facet corner points */
+    bool _legacyEngine {false};   /** Use the grid based algorithm */
 
 private:
     // Helper class cutting edge to its two attached facets
@@ -22,10 +22,17 @@
 
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#endif
+
 #include <Base/Tools.h>
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
 #include "Smoothing.h"
@@ -36,6 +43,7 @@ using namespace MeshCore;
 
 AbstractSmoothing::AbstractSmoothing(MeshKernel& m)
     : kernel(m)
+    , threads(std::max(1, int(std::thread::hardware_concurrency())))
 {}
 
 AbstractSmoothing::~AbstractSmoothing() = default;
@@ -62,6 +70,9 @@ void PlaneFitSmoothing::Smooth(unsigned int iterations)
     for (unsigned int i = 0; i < iterations; i++) {
         Base::Vector3f N, L;
         for (v_it.Begin(); v_it.More(); v_it.Next()) {
+            if (IsFixed(v_it.Position())) {
+                continue;
+            }
             MeshCore::PlaneFit pf;
             pf.AddPoint(*v_it);
             center = *v_it;
@@ -118,6 +129,9 @@ void PlaneFitSmoothing::SmoothPoints(unsigned int iterations,
     for (unsigned int i = 0; i < iterations; i++) {
         Base::Vector3f N, L;
         for (PointIndex it : point_indices) {
+            if (IsFixed(it)) {
+                continue;
+            }
             v_it.Set(it);
             MeshCore::PlaneFit pf;
             pf.AddPoint(*v_it);
@@ -166,98 +180,100 @@ LaplaceSmoothing::LaplaceSmoothing(MeshKernel& m)
     : AbstractSmoothing(m)
 {}
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it,
-                                double stepsize)
+LaplaceSmoothing::Neighbourhood::Neighbourhood(const MeshKernel& kernel)
 {
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_it, v_beg = points.begin(), v_end = points.end();
-
-    PointIndex pos = 0;
-    for (v_it = points.begin(); v_it != v_end; ++v_it, ++pos) {
-        const std::set<PointIndex>& cv = vv_it[pos];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[pos].size()) {
-            // do nothing for border points
-            continue;
+    const MeshFacetArray& facets = kernel.GetFacets();
+    std::size_t numPoints = kernel.CountPoints();
+
+    std::vector<std::pair<PointIndex, PointIndex>> edges;
+    edges.reserve(6 * facets.size());
+    std::vector<std::size_t> numFacets(numPoints, 0);
+    for (const auto& facet : facets) {
+        for (int i = 0; i < 3; i++) {
+            PointIndex p0 = facet._aulPoints[i];
+            PointIndex p1 = facet._aulPoints[(i + 1) % 3];
+            edges.emplace_back(p0, p1);
+            edges.emplace_back(p1, p0);
+            numFacets[p0]++;
         }
+    }
 
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
 
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - v_it->x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - v_it->y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - v_it->z);
-        }
+    offsets.resize(numPoints + 1, 0);
+    points.reserve(edges.size());
+    for (const auto& it : edges) {
+        offsets[it.first + 1]++;
+        points.push_back(it.second);
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
 
-        float x = static_cast<float>(static_cast<double>(v_it->x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>(v_it->y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>(v_it->z) + stepsize * delz);
-        kernel.SetPoint(pos, x, y, z);
+    // the number of neighbour points of a border point differs from its number of facets
+    border.resize(numPoints);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        border[i] = offsets[i + 1] - offsets[i] != numFacets[i];
     }
 }
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it,
+void LaplaceSmoothing::Umbrella(const Neighbourhood& nb,
                                 double stepsize,
-                                const std::vector<PointIndex>& point_indices)
+                                const std::vector<PointIndex>& point_indices,
+                                std::vector<Base::Vector3f>& buffer)
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_beg = points.begin();
-
-    for (PointIndex it : point_indices) {
-        const std::set<PointIndex>& cv = vv_it[it];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[it].size()) {
-            // do nothing for border points
-            continue;
-        }
+    buffer.resize(point_indices.size());
+
+    MeshCore::parallel_for(
+        point_indices.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                PointIndex pos = point_indices[i];
+                const MeshPoint& pnt = points[pos];
+                buffer[i] = pnt;
+
+                std::size_t n_count = nb.offsets[pos + 1] - nb.offsets[pos];
+                if (n_count < 3 || nb.border[pos] || IsFixed(pos)) {
+                    // do nothing for border points
+                    continue;
+                }
 
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
+                double w = 1.0 / double(n_count);
+                double delx = 0.0, dely = 0.0, delz = 0.0;
+                for (std::size_t j = nb.offsets[pos]; j < nb.offsets[pos + 1]; j++) {
+                    const MeshPoint& adj = points[nb.points[j]];
+                    delx += w * static_cast<double>(adj.x - pnt.x);
+                    dely += w * static_cast<double>(adj.y - pnt.y);
+                    delz += w * static_cast<double>(adj.z - pnt.z);
+                }
 
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - (v_beg[it]).x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - (v_beg[it]).y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - (v_beg[it]).z);
-        }
+                buffer[i].Set(static_cast<float>(static_cast<double>(pnt.x) + stepsize * delx),
+                              static_cast<float>(static_cast<double>(pnt.y) + stepsize * dely),
+                              static_cast<float>(static_cast<double>(pnt.z) + stepsize * delz));
+            }
+        },
+        threads);
 
-        float x = static_cast<float>(static_cast<double>((v_beg[it]).x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>((v_beg[it]).y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>((v_beg[it]).z) + stepsize * delz);
-        kernel.SetPoint(it, x, y, z);
+    for (std::size_t i = 0; i < point_indices.size(); i++) {
+        kernel.SetPoint(point_indices[i], buffer[i]);
     }
 }
 
 void LaplaceSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
-
-    for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda);
-    }
+    std::vector<PointIndex> point_indices(kernel.CountPoints());
+    std::iota(point_indices.begin(), point_indices.end(), PointIndex(0));
+    LaplaceSmoothing::SmoothPoints(iterations, point_indices);
 }
 
 void LaplaceSmoothing::SmoothPoints(unsigned int iterations,
                                     const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    Neighbourhood nb(kernel);
+    std::vector<Base::Vector3f> buffer;
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda, point_indices);
+        Umbrella(nb, lambda, point_indices, buffer);
     }
 }
 
@@ -267,28 +283,22 @@ TaubinSmoothing::TaubinSmoothing(MeshKernel& m)
 
 void TaubinSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
-
-    // Theoretically Taubin does not shrink the surface
-    iterations = (iterations + 1) / 2;  // two steps per iteration
-    for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda());
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro));
-    }
+    std::vector<PointIndex> point_indices(kernel.CountPoints());
+    std::iota(point_indices.begin(), point_indices.end(), PointIndex(0));
+    TaubinSmoothing::SmoothPoints(iterations, point_indices);
 }
 
 void TaubinSmoothing::SmoothPoints(unsigned int iterations,
                                    const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    Neighbourhood nb(kernel);
+    std::vector<Base::Vector3f> buffer;
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda(), point_indices);
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro), point_indices);
+        Umbrella(nb, GetLambda(), point_indices, buffer);
+        Umbrella(nb, -(GetLambda() + micro), point_indices, buffer);
     }
 }
 
@@ -351,69 +361,100 @@ void MedianFilterSmoothing::UpdatePoints(const MeshRefFacetToFacets& ff_it,
                                          const MeshRefPointToFacets& vf_it,
                                          const std::vector<PointIndex>& point_indices)
 {
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
     const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
 
-    // Initialize the array with the real normals
-    std::vector<Base::Vector3d> faceNormals;
-    faceNormals.reserve(facets.size());
-    MeshCore::MeshFacetIterator iter(kernel);
-    for (iter.Init(); iter.More(); iter.Next()) {
-        faceNormals.emplace_back(Base::toVector<double>(iter->GetNormal()));
-    }
+    // Initialize the arrays with the real normals, areas and centers
+    std::vector<Base::Vector3d> realNormals(facets.size());
+    std::vector<Base::Vector3d> centers(facets.size());
+    std::vector<double> areas(facets.size());
+    MeshCore::parallel_for(
+        facets.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t pos = begin; pos < end; pos++) {
+                MeshGeomFacet facet = kernel.GetFacet(pos);
+                realNormals[pos] = Base::toVector<double>(facet.GetNormal());
+                centers[pos] = Base::toVector<double>(facet.GetGravityPoint());
+                areas[pos] = facet.Area();
+            }
+        },
+        threads);
 
     // Step 1: determine face normals
-    for (FacetIndex pos = 0; pos < facets.size(); pos++) {
-        iter.Set(pos);
-        Base::Vector3d refNormal = Base::toVector<double>(iter->GetNormal());
-        const std::set<FacetIndex>& cv = ff_it[pos];
-        const MeshCore::MeshFacet& facet = facets[pos];
-
-        std::vector<AngleNormal> anglesWithFaces;
-        for (auto fi : cv) {
-            iter.Set(fi);
-            Base::Vector3d faceNormal = Base::toVector<double>(iter->GetNormal());
-            double angle = refNormal.GetAngle(faceNormal);
-
-            int absWeight = std::abs(weights);
-            if (absWeight > 1 && facet.IsNeighbour(fi)) {
-                if (weights < 0) {
-                    angle = -angle;
+    std::vector<Base::Vector3d> faceNormals(facets.size());
+    MeshCore::parallel_for(
+        facets.size(),
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<AngleNormal> anglesWithFaces;
+            for (FacetIndex pos = begin; pos < end; pos++) {
+                const Base::Vector3d& refNormal = realNormals[pos];
+                const std::set<FacetIndex>& cv = ff_it[pos];
+                const MeshCore::MeshFacet& facet = facets[pos];
+                if (cv.empty()) {
+                    faceNormals[pos] = refNormal;
+                    continue;
                 }
-                for (int i = 0; i < absWeight; i++) {
-                    anglesWithFaces.emplace_back(angle, faceNormal);
+
+                anglesWithFaces.clear();
+                for (auto fi : cv) {
+                    const Base::Vector3d& faceNormal = realNormals[fi];
+                    double angle = refNormal.GetAngle(faceNormal);
+
+                    int absWeight = std::abs(weights);
+                    if (absWeight > 1 && facet.IsNeighbour(fi)) {
+                        if (weights < 0) {
+                            angle = -angle;
+                        }
+                        for (int i = 0; i < absWeight; i++) {
+                            anglesWithFaces.emplace_back(angle, faceNormal);
+                        }
+                    }
+                    else {
+                        anglesWithFaces.emplace_back(angle, faceNormal);
+                    }
                 }
-            }
-            else {
-                anglesWithFaces.emplace_back(angle, faceNormal);
-            }
-        }
 
-        faceNormals[pos] = find_median(anglesWithFaces);
-    }
+                faceNormals[pos] = find_median(anglesWithFaces);
+            }
+        },
+        threads);
 
     // Step 2: move vertices
-    for (auto pos : point_indices) {
-        Base::Vector3d P = Base::toVector<double>(points[pos]);
-        const std::set<FacetIndex>& cv = vf_it[pos];
+    const MeshCore::MeshPointArray& points = kernel.GetPoints();
+    std::vector<Base::Vector3f> buffer(point_indices.size());
+    MeshCore::parallel_for(
+        point_indices.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                PointIndex pos = point_indices[i];
+                buffer[i] = points[pos];
+                if (IsFixed(pos)) {
+                    continue;
+                }
 
-        double totalArea = 0.0;
-        Base::Vector3d totalvT;
-        for (auto it : cv) {
-            iter.Set(it);
+                Base::Vector3d P = Base::toVector<double>(points[pos]);
+                const std::set<FacetIndex>& cv = vf_it[pos];
 
-            double faceArea = iter->Area();
-            totalArea += faceArea;
+                double totalArea = 0.0;
+                Base::Vector3d totalvT;
+                for (auto it : cv) {
+                    double faceArea = areas[it];
+                    totalArea += faceArea;
 
-            Base::Vector3d C = Base::toVector<double>(iter->GetGravityPoint());
+                    Base::Vector3d PC = centers[it] - P;
+                    Base::Vector3d mT = faceNormals[it];
+                    Base::Vector3d vT = (PC * mT) * mT;
+                    totalvT += vT * faceArea;
+                }
 
-            Base::Vector3d PC = C - P;
-            Base::Vector3d mT = faceNormals[it];
-            Base::Vector3d vT = (PC * mT) * mT;
-            totalvT += vT * faceArea;
-        }
+                if (totalArea > 0.0) {
+                    P = P + totalvT / totalArea;
+                    buffer[i] = Base::toVector<float>(P);
+                }
+            }
+        },
+        threads);
 
-        P = P + totalvT / totalArea;
-        kernel.SetPoint(pos, Base::toVector<float>(P));
+    for (std::size_t i = 0; i < point_indices.size(); i++) {
+        kernel.SetPoint(point_indices[i], buffer[i]);
     }
 }
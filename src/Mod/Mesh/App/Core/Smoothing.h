@@ -26,13 +26,14 @@
 #include <cfloat>
 #include <vector>
 
+#include <Base/Vector3D.h>
+
 #include "Definitions.h"
 
 
 namespace MeshCore
 {
 class MeshKernel;
-class MeshRefPointToPoints;
 class MeshRefPointToFacets;
 class MeshRefFacetToFacets;
 
@@ -62,17 +63,37 @@ public:
     AbstractSmoothing& operator=(AbstractSmoothing&&) = delete;
 
     void initialize(Component comp, Continuity cont);
+    /** Points whose flag is set in \a mask are not moved. The mask is indexed by the point
+     * index. An empty mask or a mask shorter than the number of points doesn't fix any
+     * further points. */
+    void SetFixedPoints(const std::vector<bool>& mask)
+    {
+        fixed = mask;
+    }
+    /** Sets the number of threads used to compute the new point positions. */
+    void SetThreads(int num)
+    {
+        threads = num > 0 ? num : 1;
+    }
 
     /** Smooth the triangle mesh. */
     virtual void Smooth(unsigned int) = 0;
     virtual void SmoothPoints(unsigned int, const std::vector<PointIndex>&) = 0;
 
+protected:
+    bool IsFixed(PointIndex index) const
+    {
+        return index < fixed.size() && fixed[index];
+    }
+
 protected:
     // NOLINTBEGIN
     MeshKernel& kernel;
 
     Component component {Normal};
     Continuity continuity {C0};
+    std::vector<bool> fixed;
+    int threads;
     // NOLINTEND
 };
 
@@ -107,11 +128,23 @@ public:
     }
 
 protected:
-    void Umbrella(const MeshRefPointToPoints&, const MeshRefPointToFacets&, double);
-    void Umbrella(const MeshRefPointToPoints&,
-                  const MeshRefPointToFacets&,
+    /** Compact neighbourhood of all points. It is built once per call of Smooth() or
+     * SmoothPoints() and shared by all iterations. */
+    struct Neighbourhood
+    {
+        explicit Neighbourhood(const MeshKernel&);
+        std::vector<std::size_t> offsets;  // neighbours of point i are in [offsets[i], offsets[i+1])
+        std::vector<PointIndex> points;
+        std::vector<bool> border;
+    };
+
+    /** Moves the given points in one Jacobi step. All new positions are computed from the
+     * current positions before any point is changed so that the computation can run in
+     * parallel. */
+    void Umbrella(const Neighbourhood&,
                   double,
-                  const std::vector<PointIndex>&);
+                  const std::vector<PointIndex>&,
+                  std::vector<Base::Vector3f>&);
 
 private:
     double lambda {0.6307};
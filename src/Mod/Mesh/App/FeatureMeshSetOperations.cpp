@@ -39,6 +39,11 @@ SetOperations::SetOperations()
     ADD_PROPERTY(Source1, (nullptr));
     ADD_PROPERTY(Source2, (nullptr));
     ADD_PROPERTY(OperationType, ("union"));
+    ADD_PROPERTY_TYPE(LegacyEngine,
+                      (false),
+                      0,
+                      App::Prop_None,
+                      "Use the former grid based algorithm instead of the exact mesh boolean");
 }
 
 short SetOperations::mustExecute() const
@@ -53,6 +58,9 @@ short SetOperations::mustExecute() const
         if (OperationType.isTouched()) {
             return 1;
         }
+        if (LegacyEngine.isTouched()) {
+            return 1;
+        }
     }
 
     return 0;
@@ -96,6 +104,7 @@ App::DocumentObjectExecReturn* SetOperations::execute()
                                       pcKernel->getKernel(),
                                       type,
                                       1.0e-5f);
+        setOp.SetUseLegacyEngine(LegacyEngine.getValue());
         setOp.Do();
         Mesh.setValuePtr(pcKernel.release());
     }
@@ -24,6 +24,7 @@
 #define FEATURE_MESH_SETOPERATIONS_H
 
 #include <App/PropertyLinks.h>
+#include <App/PropertyStandard.h>
 
 #include "MeshFeature.h"
 
@@ -46,6 +47,7 @@ public:
     App::PropertyLink Source1;
     App::PropertyLink Source2;
     App::PropertyString OperationType;
+    App::PropertyBool LegacyEngine;
 
     /** @name methods override Feature */
     //@{
@@ -2090,40 +2090,30 @@ std::vector<Segment> MeshObject::getSegmentsOfType(MeshObject::GeometryType type
         return segm;
     }
 
-    MeshCore::MeshSegmentAlgorithm finder(this->_kernel);
-    std::shared_ptr<MeshCore::MeshDistanceSurfaceSegment> surf;
+    MeshCore::MeshParallelSegmentAlgorithm::SurfaceFitFactory factory;
     switch (type) {
         case PLANE:
-            surf.reset(
-                new MeshCore::MeshDistanceGenericSurfaceFitSegment(new MeshCore::PlaneSurfaceFit,
-                                                                   this->_kernel,
-                                                                   minFacets,
-                                                                   dev));
+            factory = [] {
+                return std::make_unique<MeshCore::PlaneSurfaceFit>();
+            };
             break;
         case CYLINDER:
-            surf.reset(
-                new MeshCore::MeshDistanceGenericSurfaceFitSegment(new MeshCore::CylinderSurfaceFit,
-                                                                   this->_kernel,
-                                                                   minFacets,
-                                                                   dev));
+            factory = [] {
+                return std::make_unique<MeshCore::CylinderSurfaceFit>();
+            };
             break;
         case SPHERE:
-            surf.reset(
-                new MeshCore::MeshDistanceGenericSurfaceFitSegment(new MeshCore::SphereSurfaceFit,
-                                                                   this->_kernel,
-                                                                   minFacets,
-                                                                   dev));
+            factory = [] {
+                return std::make_unique<MeshCore::SphereSurfaceFit>();
+            };
             break;
         default:
             break;
     }
 
-    if (surf.get()) {
-        std::vector<MeshCore::MeshSurfaceSegmentPtr> surfaces;
-        surfaces.push_back(surf);
-        finder.FindSegments(surfaces);
-
-        const std::vector<MeshCore::MeshSegment>& data = surf->GetSegments();
+    if (factory) {
+        MeshCore::MeshParallelSegmentAlgorithm finder(this->_kernel, factory, minFacets, dev);
+        std::vector<MeshCore::MeshSegment> data = finder.FindSegments();
         for (const auto& it : data) {
             segm.emplace_back(this, it, false);
         }
@@ -747,3 +747,77 @@ class MeshProperty(unittest.TestCase):
         self.assertEqual(len(material2["emissiveColor"]), len1 + len2)
         self.assertEqual(len(material2["shininess"]), len1 + len2)
         self.assertEqual(len(material2["transparency"]), len1 + len2)
+
+
+class MeshFlattening(unittest.TestCase):
+    def setUp(self):
+        try:
+            import flatmesh
+            import numpy
+        except ImportError:
+            self.skipTest("flatmesh is not available")
+
+        # a quarter of a cylinder, each quad of the mesh is planar and so the mesh can be
+        # flattened without any distortion
+        radius = 10.0
+        height = 20.0
+        nu = 24
+        nv = 12
+        points = []
+        for j in range(nv + 1):
+            for i in range(nu + 1):
+                angle = 0.5 * math.pi * i / nu
+                points.append([radius * math.cos(angle), radius * math.sin(angle), height * j / nv])
+        tris = []
+        for j in range(nv):
+            for i in range(nu):
+                p = j * (nu + 1) + i
+                tris.append([p, p + 1, p + nu + 2])
+                tris.append([p, p + nu + 2, p + nu + 1])
+        self.points = numpy.array(points)
+        self.tris = numpy.array(tris)
+
+    def distortion(self, flat):
+        # the largest relative change of the length of an edge
+        result = 0.0
+        for tri in self.tris:
+            for a, b in ((tri[0], tri[1]), (tri[1], tri[2]), (tri[2], tri[0])):
+                length = math.dist(self.points[a], self.points[b])
+                flat_length = math.dist(flat[a][0:2], flat[b][0:2])
+                result = max(result, abs(flat_length / length - 1.0))
+        return result
+
+    def testLscm(self):
+        import flatmesh
+
+        flattener = flatmesh.LscmRelax(self.points, self.tris, [])
+        flattener.lscm()
+        self.assertAlmostEqual(flattener.flat_area, flattener.area, delta=1e-6 * flattener.area)
+        self.assertLess(self.distortion(flattener.flat_vertices), 1e-6)
+
+    def testRelax(self):
+        import flatmesh
+
+        flattener = flatmesh.LscmRelax(self.points, self.tris, [])
+        flattener.lscm()
+        for _ in range(5):
+            flattener.relax(0.95)
+        self.assertAlmostEqual(flattener.flat_area, flattener.area, delta=1e-6 * flattener.area)
+        self.assertLess(self.distortion(flattener.flat_vertices), 1e-6)
+
+    def testFindFlatNodes(self):
+        import flatmesh
+
+        single = flatmesh.FaceUnwrapper(self.points, self.tris)
+        single.threads = 1
+        single.findFlatNodes(5, 0.95)
+        self.assertLess(self.distortion(single.ze_nodes), 1e-6)
+
+        # flattening the faces concurrently gives the same result and keeps their settings
+        unwrappers = [flatmesh.FaceUnwrapper(self.points, self.tris) for _ in range(2)]
+        flatmesh.findFlatNodes(unwrappers, 5, 0.95)
+        for unwrapper in unwrappers:
+            self.assertEqual(unwrapper.threads, 0)
+            for node, expected in zip(unwrapper.ze_nodes, single.ze_nodes):
+                self.assertAlmostEqual(node[0], expected[0], places=9)
+                self.assertAlmostEqual(node[1], expected[1], places=9)
@@ -51,15 +51,22 @@
 #endif
 // STL
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <map>
+#include <numeric>
 #include <queue>
+#include <random>
 #include <set>
 #include <sstream>
 #include <stack>
 #include <string>
+#include <thread>
 #include <vector>
 
 // boost
@@ -69,6 +69,7 @@
 #include <Gui/Flag.h>
 #include <Gui/Selection.h>
 #include <Gui/SoFCDB.h>
+#include <Gui/SoFCLevelOfDetail.h>
 #include <Gui/SoFCOffscreenRenderer.h>
 #include <Gui/SoFCSelection.h>
 #include <Gui/SoFCSelectionAction.h>
@@ -264,7 +265,15 @@ ViewProviderMesh::ViewProviderMesh()
 
     pcShapeGroup = new SoGroup();
     pcShapeGroup->ref();
-    pcHighlight->addChild(pcShapeGroup);
+
+    // the coarse mesh shown while navigating uses a single color
+    auto coarse = new SoIndexedFaceSet();
+    lod = std::make_unique<Gui::LevelOfDetailBuilder>(coarse);
+    auto coarseBinding = new SoMaterialBinding();
+    coarseBinding->value = SoMaterialBinding::OVERALL;
+    lod->getRoot()->insertChild(coarseBinding, 0);
+    pcLevelOfDetail = lod->createNode(pcShapeGroup, true);
+    pcHighlight->addChild(pcLevelOfDetail);
 
     pOpenColor = new SoBaseColor();
     setOpenEdgeColorFrom(ShapeAppearance.getDiffuseColor());
@@ -412,6 +421,29 @@ void ViewProviderMesh::setOpenEdgeColorFrom(const App::Color& c)
     pOpenColor->rgb.setValue(r, g, b);
 }
 
+void ViewProviderMesh::updateLevelOfDetail(const MeshCore::MeshKernel& kernel)
+{
+    const MeshCore::MeshPointArray& rPoints = kernel.GetPoints();
+    const MeshCore::MeshFacetArray& rFacets = kernel.GetFacets();
+
+    std::vector<SbVec3f> points;
+    points.reserve(rPoints.size());
+    for (const auto& it : rPoints) {
+        points.emplace_back(it.x, it.y, it.z);
+    }
+
+    std::vector<int32_t> coordIndex;
+    coordIndex.reserve(4 * rFacets.size());
+    for (const auto& it : rFacets) {
+        coordIndex.push_back(int32_t(it._aulPoints[0]));
+        coordIndex.push_back(int32_t(it._aulPoints[1]));
+        coordIndex.push_back(int32_t(it._aulPoints[2]));
+        coordIndex.push_back(SO_END_FACE_INDEX);
+    }
+
+    lod->update(std::move(points), std::move(coordIndex));
+}
+
 SoShape* ViewProviderMesh::getShapeNode() const
 {
     return nullptr;
@@ -491,7 +523,7 @@ void ViewProviderMesh::attach(App::DocumentObject* pcFeat)
     pcFlatWireRoot->addChild(pShapeHints);
     pcFlatWireRoot->addChild(pcShapeMaterial);
     pcFlatWireRoot->addChild(pcMatBinding);
-    pcFlatWireRoot->addChild(pcShapeGroup);
+    pcFlatWireRoot->addChild(pcLevelOfDetail);
     addDisplayMaskMode(pcFlatWireRoot, "Flat Lines");
 
     if (getColorProperty() || getMaterialProperty()) {
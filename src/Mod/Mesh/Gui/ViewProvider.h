@@ -23,6 +23,7 @@
 #ifndef MESHGUI_VIEWPROVIDERMESH_H
 #define MESHGUI_VIEWPROVIDERMESH_H
 
+#include <memory>
 #include <vector>
 
 #include <Gui/ViewProviderBuilder.h>
@@ -64,6 +65,8 @@ namespace Gui
 {
 class View3DInventorViewer;
 class SoFCSelection;
+class SoFCLevelOfDetail;
+class LevelOfDetailBuilder;
 }  // namespace Gui
 
 
@@ -214,6 +217,8 @@ protected:
     void onChanged(const App::Property* prop) override;
     virtual void showOpenEdges(bool);
     void setOpenEdgeColorFrom(const App::Color& col);
+    /// Starts building the coarse mesh that is shown while navigating
+    void updateLevelOfDetail(const MeshCore::MeshKernel& kernel);
     virtual void
     splitMesh(const MeshCore::MeshKernel& toolMesh, const Base::Vector3f& normal, SbBool inner);
     virtual void
@@ -277,6 +282,8 @@ protected:
     HighlighMode highlightMode;
     Gui::SoFCSelection* pcHighlight {nullptr};
     SoGroup* pcShapeGroup {nullptr};
+    Gui::SoFCLevelOfDetail* pcLevelOfDetail {nullptr};
+    std::unique_ptr<Gui::LevelOfDetailBuilder> lod;
     SoDrawStyle* pcLineStyle {nullptr};
     SoDrawStyle* pcPointStyle {nullptr};
     SoSeparator* pcOpenEdge {nullptr};
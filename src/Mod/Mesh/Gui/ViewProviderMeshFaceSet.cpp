@@ -117,6 +117,7 @@ void ViewProviderMeshFaceSet::updateData(const App::Property* prop)
             builder.createMesh(prop, pcMeshCoord, pcMeshFaces);
             pcMeshFaces->invalidate();
         }
+        updateLevelOfDetail(mesh->getKernel());
 
         if (direct != directRendering) {
             directRendering = direct;
@@ -28,9 +28,11 @@
 
 #include <Base/Console.h>
 #include <Base/Converter.h>
+#include <Base/FileInfo.h>
 #include <Base/GeometryPyCXX.h>
 #include <Base/Interpreter.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
+#include <Base/Stream.h>
 #include <Base/Vector3D.h>
 #include <Base/VectorPy.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
@@ -139,6 +141,15 @@ public:
             "    SegPerEdge (optional, float)\n"
             "    SegPerRadius (optional, float)\n"
         );
+        add_keyword_method("writeSTLFromShape",&Module::writeSTLFromShape,
+            "Write the triangulation of a shape as binary STL file\n"
+            "\n"
+            "    writeSTLFromShape(Shape, FileName, LinearDeflection,\n"
+            "                      AngularDeflection=0.5, Relative=False)\n"
+            "\n"
+            "The faces are meshed and written in parallel without creating\n"
+            "a mesh object first. The vertices are not merged.\n"
+        );
         initialize("This module is the MeshPart module."); // register with Python
     }
 
@@ -640,6 +651,48 @@ private:
 
         throw Py::TypeError("Wrong arguments");
     }
+    Py::Object writeSTLFromShape(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        static const std::array<const char *, 6> kwds_stl{"Shape", "FileName", "LinearDeflection",
+                                                          "AngularDeflection", "Relative", nullptr};
+        PyObject *shape;
+        char* fileName;
+        double lindeflection=0;
+        double angdeflection=0.5;
+        PyObject* relative = Py_False;
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!etd|dO!", kwds_stl,
+                                                 &(Part::TopoShapePy::Type), &shape, "utf-8", &fileName,
+                                                 &lindeflection, &angdeflection,
+                                                 &(PyBool_Type), &relative)) {
+            throw Py::Exception();
+        }
+
+        std::string encodedName = std::string(fileName);
+        PyMem_Free(fileName);
+
+        MeshPart::Mesher mesher(static_cast<Part::TopoShapePy*>(shape)->getTopoShapePtr()->getShape());
+        mesher.setMethod(MeshPart::Mesher::Standard);
+        mesher.setDeflection(lindeflection);
+        mesher.setAngularDeflection(angdeflection);
+        mesher.setRegular(true);
+        mesher.setRelative(Base::asBoolean(relative));
+
+        Base::FileInfo fi(encodedName);
+        Base::ofstream str(fi, std::ios::out | std::ios::binary);
+        if (!str) {
+            throw Py::RuntimeError(std::string("Cannot open file ") + encodedName);
+        }
+
+        {
+            Base::PyGILStateRelease releaser{};
+            mesher.writeStandardSTL(str);
+        }
+
+        if (!str) {
+            throw Py::RuntimeError(std::string("Failed to write file ") + encodedName);
+        }
+        return Py::None();
+    }
 };
 
 PyObject* initModule()
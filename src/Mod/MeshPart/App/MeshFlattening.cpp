@@ -22,8 +22,13 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <map>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <vector>
 
 #include <BRep_Tool.hxx>
@@ -169,11 +174,19 @@ FaceUnwrapper::FaceUnwrapper(const TopoDS_Face& face)
 }
 
 void FaceUnwrapper::findFlatNodes(int steps, double val)
+{
+    findFlatNodesWithThreads(steps, val, this->threads);
+}
+
+void FaceUnwrapper::findFlatNodesWithThreads(int steps, double val, int threads)
 {
     std::vector<long> fixed_pins;  // TODO: INPUT
     lscmrelax::LscmRelax mesh_flattener(this->xyz_nodes.transpose(),
                                         this->tris.transpose(),
                                         fixed_pins);
+    if (threads > 0) {
+        mesh_flattener.threads = threads;
+    }
     mesh_flattener.lscm();
     for (int j = 0; j < steps; j++) {
         mesh_flattener.relax(val);
@@ -181,6 +194,42 @@ void FaceUnwrapper::findFlatNodes(int steps, double val)
     this->ze_nodes = mesh_flattener.flat_vertices.transpose();
 }
 
+void findFlatNodes(const std::vector<FaceUnwrapper*>& unwrappers, int steps, double val)
+{
+    int threads = std::max(1, int(std::thread::hardware_concurrency()));
+    int workers = std::max(1, std::min(threads, int(unwrappers.size())));
+    int faceThreads = std::max(1, threads / workers);
+    std::atomic<std::size_t> next(0);
+    std::exception_ptr error;
+    std::mutex mutex;
+
+    auto work = [&]() {
+        for (std::size_t i = next++; i < unwrappers.size(); i = next++) {
+            try {
+                unwrappers[i]->findFlatNodesWithThreads(steps, val, faceThreads);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int i = 1; i < workers; i++) {
+        pool.emplace_back(work);
+    }
+    work();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
 ColMat<double, 3> FaceUnwrapper::interpolateFlatFace(const TopoDS_Face& face)
 {
     if (this->uv_nodes.size() == 0) {
@@ -60,10 +60,13 @@ public:
 	FaceUnwrapper(const TopoDS_Face & face);
         FaceUnwrapper(ColMat<double, 3> xyz_nodes, ColMat<long, 3> tris);
 	void findFlatNodes(int steps, double val);
+	// like findFlatNodes, but the lscm-relax runs with the given number of threads
+	void findFlatNodesWithThreads(int steps, double val, int threads);
 	ColMat<double, 3> interpolateFlatFace(const TopoDS_Face& face);
         std::vector<ColMat<double, 3>> getFlatBoundaryNodes();
 
 	bool use_nurbs = true;
+	int threads = 0; // number of threads of the lscm-relax, 0: all cores
 	// the mesh
 	ColMat<long, 3> tris;  // input
 	ColMat<long, 1> fixed_nodes; // input
@@ -76,6 +79,9 @@ public:
 	spMat A; // mapping between nurbs(poles) and mesh(vertices) computed with nurbs-basis-functions and uv_mesh
 
 };
+
+// flattens independent faces concurrently, the cores are shared among the faces
+void findFlatNodes(const std::vector<FaceUnwrapper*>& unwrappers, int steps, double val);
 // clang-format on
 
 #endif  // MESHFLATTENING
@@ -169,6 +169,16 @@ boost::python::list getFlatBoundaryNodesPy(FaceUnwrapper& instance)
     return ary;
 }
 
+void findFlatNodesPy(const py::list& unwrappers, int steps, double val)
+{
+    std::vector<FaceUnwrapper*> faces;
+    for (py::ssize_t i = 0; i < py::len(unwrappers); i++) {
+        FaceUnwrapper& face = py::extract<FaceUnwrapper&>(unwrappers[i]);
+        faces.push_back(&face);
+    }
+    findFlatNodes(faces, steps, val);
+}
+
 namespace fm {
 // https://www.boost.org/doc/libs/1_52_0/libs/python/doc/v2/faq.html
 template<typename eigen_type>
@@ -206,7 +216,8 @@ BOOST_PYTHON_MODULE(flatmesh)
         .def_readonly("MATRIX", &lscmrelax::LscmRelax::MATRIX)
         .def_readonly("area", &lscmrelax::LscmRelax::get_area)
         .def_readonly("flat_area", &lscmrelax::LscmRelax::get_flat_area)
-        .def_readonly("flat_vertices_3D", &lscmrelax::LscmRelax::get_flat_vertices_3D);
+        .def_readonly("flat_vertices_3D", &lscmrelax::LscmRelax::get_flat_vertices_3D)
+        .def_readwrite("threads", &lscmrelax::LscmRelax::threads);
 
     py::class_<nurbs::NurbsBase2D>("NurbsBase2D")
         .def(py::init<Eigen::VectorXd, Eigen::VectorXd, Eigen::VectorXd, int, int>())
@@ -245,6 +256,7 @@ BOOST_PYTHON_MODULE(flatmesh)
         .def("findFlatNodes", &FaceUnwrapper::findFlatNodes)
         .def("interpolateFlatFace", &interpolateFlatFacePy)
         .def("getFlatBoundaryNodes", &getFlatBoundaryNodesPy)
+        .def_readwrite("threads", &FaceUnwrapper::threads)
         .add_property("tris", py::make_getter(&FaceUnwrapper::tris, py::return_value_policy<py::return_by_value>()))
         .add_property("nodes", py::make_getter(&FaceUnwrapper::xyz_nodes, py::return_value_policy<py::return_by_value>()))
         .add_property("uv_nodes", py::make_getter(&FaceUnwrapper::uv_nodes, py::return_value_policy<py::return_by_value>()))
@@ -252,6 +264,8 @@ BOOST_PYTHON_MODULE(flatmesh)
         .add_property("ze_poles", py::make_getter(&FaceUnwrapper::ze_poles, py::return_value_policy<py::return_by_value>()))
         .add_property("A", py::make_getter(&FaceUnwrapper::A, py::return_value_policy<py::return_by_value>()));
 
+    py::def("findFlatNodes", &findFlatNodesPy);
+
     fm::eigen_matrix<spMat>::to_python_converter();
     fm::eigen_matrix<ColMat<double, 2>>::to_python_converter();
     fm::eigen_matrix<ColMat<double, 3>>::to_python_converter();
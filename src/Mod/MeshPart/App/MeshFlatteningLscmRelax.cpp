@@ -24,9 +24,12 @@
 #ifndef _PreComp_
 #include <array>
 #include <cmath>
+#include <exception>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <vector>
 #endif
 
@@ -51,6 +54,45 @@ using trip = Eigen::Triplet<double>;
 using spMat = Eigen::SparseMatrix<double>;
 
 
+// calls func(begin, end) for sub-ranges of [0, size) in separate threads,
+// the first exception thrown by func is rethrown once all threads are done
+template<typename Func>
+void parallel_for(long size, int threads, Func func)
+{
+    const long min_chunk = 4096;
+    long chunks = std::min<long>(std::max(threads, 1), (size + min_chunk - 1) / min_chunk);
+    if (chunks <= 1)
+    {
+        func(0, size);
+        return;
+    }
+    std::exception_ptr error;
+    std::mutex mutex;
+    auto work = [&](long begin, long end)
+    {
+        try
+        {
+            func(begin, end);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error)
+                error = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    long chunk = (size + chunks - 1) / chunks;
+    for (long begin = chunk; begin < size; begin += chunk)
+        workers.emplace_back(work, begin, std::min(begin + chunk, size));
+    work(0, chunk);
+    for (auto& worker: workers)
+        worker.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+
 
 ColMat<double, 2> map_to_2D(ColMat<double, 3> points)
 {
@@ -148,64 +190,82 @@ LscmRelax::LscmRelax(
 void LscmRelax::relax(double weight)
 {
     ColMat<double, 3> d_q_l_g = this->q_l_m - this->q_l_g;
-    // for every triangle
-    Eigen::Matrix<double, 3, 6> B;
-    Eigen::Matrix<double, 2, 2> T;
-    Eigen::Matrix<double, 6, 6> K_m;
-    Eigen::Matrix<double, 6, 1> u_m, rhs_m;
-    Eigen::VectorXd rhs(this->vertices.cols() * 2 + 3);
+    const long num_triangles = this->triangles.cols();
+    const long num_vertices = this->flat_vertices.cols();
+    const long size = this->vertices.cols() * 2 + 3;
+    Eigen::VectorXd rhs(size);
     if (this->sol.size() == 0)
-        this->sol.Zero(this->vertices.cols() * 2 + 3);
-    spMat K_g(this->vertices.cols() * 2 + 3, this->vertices.cols() * 2 + 3);
-    std::vector<trip> K_g_triplets;
-    Vector2 v1, v2, v3, v12, v23, v31;
-    long row_pos, col_pos;
-    double A;
+        this->sol.Zero(size);
+    // every triangle writes its 36 entries and its rhs to a fixed position, so the elements
+    // can be computed in parallel and the assembled system doesn't depend on the threads
+    std::vector<trip> K_g_triplets(num_triangles * 36 + num_vertices * 8);
+    ColMat<double, 6> rhs_elements(num_triangles, 6);
 
     rhs.setZero();
 
-    for (long i=0; i<this->triangles.cols(); i++)
+    parallel_for(num_triangles, this->threads, [&](long begin, long end)
     {
-        // 1: construct B-mat in m-system
-        v1 = this->flat_vertices.col(this->triangles(0, i));
-        v2 = this->flat_vertices.col(this->triangles(1, i));
-        v3 = this->flat_vertices.col(this->triangles(2, i));
-        v12 = v2 - v1;
-        v23 = v3 - v2;
-        v31 = v1 - v3;
-        B << -v23.y(),   0,        -v31.y(),   0,        -v12.y(),   0,
-              0,         v23.x(),   0,         v31.x(),   0,         v12.x(),
-             -v23.x(),   v23.y(),  -v31.x(),   v31.y(),  -v12.x(),   v12.y();
-        T << v12.x(), -v12.y(),
-             v12.y(), v12.x();
-        T /= v12.norm();
-        A = std::abs(this->q_l_m(i, 0) * this->q_l_m(i, 2) / 2);
-        B /= A * 2; // (2*area)
-
-        // 2: sigma due dqlg in m-system
-        u_m << Vector2(0, 0), T * Vector2(d_q_l_g(i, 0), 0), T * Vector2(d_q_l_g(i, 1), d_q_l_g(i, 2));
-
-        // 3: rhs_m = B.T * C * B * dqlg_m
-        //    K_m = B.T * C * B
-        rhs_m = B.transpose() * this->C * B * u_m * A;
-        K_m = B.transpose() * this->C * B * A;
-
-        // 5: add to rhs_g, K_g
-        for (int j=0; j < 3; j++)
+        Eigen::Matrix<double, 3, 6> B;
+        Eigen::Matrix<double, 2, 2> T;
+        Eigen::Matrix<double, 6, 6> K_m;
+        Eigen::Matrix<double, 6, 1> u_m, rhs_m;
+        Vector2 v1, v2, v3, v12, v23, v31;
+        long row_pos, col_pos;
+        double A;
+
+        for (long i=begin; i<end; i++)
         {
-            row_pos = this->triangles(j, i);
-            rhs[row_pos * 2]     += rhs_m[j * 2];
-            rhs[row_pos * 2 + 1] += rhs_m[j * 2 +1];
-            for (int k=0; k < 3; k++)
+            // 1: construct B-mat in m-system
+            v1 = this->flat_vertices.col(this->triangles(0, i));
+            v2 = this->flat_vertices.col(this->triangles(1, i));
+            v3 = this->flat_vertices.col(this->triangles(2, i));
+            v12 = v2 - v1;
+            v23 = v3 - v2;
+            v31 = v1 - v3;
+            B << -v23.y(),   0,        -v31.y(),   0,        -v12.y(),   0,
+                  0,         v23.x(),   0,         v31.x(),   0,         v12.x(),
+                 -v23.x(),   v23.y(),  -v31.x(),   v31.y(),  -v12.x(),   v12.y();
+            T << v12.x(), -v12.y(),
+                 v12.y(), v12.x();
+            T /= v12.norm();
+            A = std::abs(this->q_l_m(i, 0) * this->q_l_m(i, 2) / 2);
+            B /= A * 2; // (2*area)
+
+            // 2: sigma due dqlg in m-system
+            u_m << Vector2(0, 0), T * Vector2(d_q_l_g(i, 0), 0), T * Vector2(d_q_l_g(i, 1), d_q_l_g(i, 2));
+
+            // 3: rhs_m = B.T * C * B * dqlg_m
+            //    K_m = B.T * C * B
+            rhs_m = B.transpose() * this->C * B * u_m * A;
+            K_m = B.transpose() * this->C * B * A;
+
+            // 5: add to rhs_g, K_g
+            rhs_elements.row(i) = rhs_m.transpose();
+            trip* triplet = &K_g_triplets[i * 36];
+            for (int j=0; j < 3; j++)
             {
-                col_pos = this->triangles(k, i);
-                K_g_triplets.emplace_back(trip(row_pos * 2,     col_pos * 2,        K_m(j * 2,      k * 2)));
-                K_g_triplets.emplace_back(trip(row_pos * 2 + 1, col_pos * 2,        K_m(j * 2 + 1,  k * 2)));
-                K_g_triplets.emplace_back(trip(row_pos * 2 + 1, col_pos * 2 + 1,    K_m(j * 2 + 1,  k * 2 + 1)));
-                K_g_triplets.emplace_back(trip(row_pos * 2,     col_pos * 2 + 1,    K_m(j * 2,      k * 2 + 1)));
-                // we don't have to fill all because the matrix is symmetric.
+                row_pos = this->triangles(j, i);
+                for (int k=0; k < 3; k++)
+                {
+                    col_pos = this->triangles(k, i);
+                    *triplet++ = trip(row_pos * 2,     col_pos * 2,        K_m(j * 2,      k * 2));
+                    *triplet++ = trip(row_pos * 2 + 1, col_pos * 2,        K_m(j * 2 + 1,  k * 2));
+                    *triplet++ = trip(row_pos * 2 + 1, col_pos * 2 + 1,    K_m(j * 2 + 1,  k * 2 + 1));
+                    *triplet++ = trip(row_pos * 2,     col_pos * 2 + 1,    K_m(j * 2,      k * 2 + 1));
+                    // we don't have to fill all because the matrix is symmetric.
+                }
             }
         }
+    });
+
+    for (long i=0; i<num_triangles; i++)
+    {
+        for (int j=0; j < 3; j++)
+        {
+            long row_pos = this->triangles(j, i);
+            rhs[row_pos * 2]     += rhs_elements(i, j * 2);
+            rhs[row_pos * 2 + 1] += rhs_elements(i, j * 2 + 1);
+        }
     }
     // FIXING SOME PINS:
     // - if there are no pins (or only one pin) selected solve the system without the nullspace solution.
@@ -251,19 +311,20 @@ void LscmRelax::relax(double weight)
     //     K_g_triplets.push_back(trip(i, i, 0.01));
 
     // lagrange multiplier
-    for (long i=0; i < this->flat_vertices.cols() ; i++)
+    trip* triplet = &K_g_triplets[num_triangles * 36];
+    for (long i=0; i < num_vertices ; i++)
     {
         // fixing total ux
-        K_g_triplets.emplace_back(trip(i * 2, this->flat_vertices.cols() * 2, 1));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2, i * 2, 1));
+        *triplet++ = trip(i * 2, num_vertices * 2, 1);
+        *triplet++ = trip(num_vertices * 2, i * 2, 1);
         // fixing total uy
-        K_g_triplets.emplace_back(trip(i * 2 + 1, this->flat_vertices.cols() * 2 + 1, 1));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2 + 1, i * 2 + 1, 1));
+        *triplet++ = trip(i * 2 + 1, num_vertices * 2 + 1, 1);
+        *triplet++ = trip(num_vertices * 2 + 1, i * 2 + 1, 1);
         // fixing ux*y-uy*x
-        K_g_triplets.emplace_back(trip(i * 2, this->flat_vertices.cols() * 2 + 2, - this->flat_vertices(1, i)));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2 + 2, i * 2, - this->flat_vertices(1, i)));
-        K_g_triplets.emplace_back(trip(i * 2 + 1, this->flat_vertices.cols() * 2 + 2, this->flat_vertices(0, i)));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2 + 2, i * 2 + 1, this->flat_vertices(0, i)));
+        *triplet++ = trip(i * 2, num_vertices * 2 + 2, - this->flat_vertices(1, i));
+        *triplet++ = trip(num_vertices * 2 + 2, i * 2, - this->flat_vertices(1, i));
+        *triplet++ = trip(i * 2 + 1, num_vertices * 2 + 2, this->flat_vertices(0, i));
+        *triplet++ = trip(num_vertices * 2 + 2, i * 2 + 1, this->flat_vertices(0, i));
     }
 
     // project out the nullspace solution:
@@ -282,13 +343,58 @@ void LscmRelax::relax(double weight)
     // rhs -= nullspace1.dot(rhs) * nullspace1;
     // rhs -= nullspace2.dot(rhs) * nullspace2;
 
-    K_g.setFromTriplets(K_g_triplets.begin(), K_g_triplets.end());
+    if (!this->K_g_solver || this->K_g.rows() != size || this->K_g_index.size() != K_g_triplets.size())
+    {
+        this->K_g.resize(size, size);
+        this->K_g.setFromTriplets(K_g_triplets.begin(), K_g_triplets.end());
+        // remember where each triplet ends up in the compressed matrix
+        this->K_g_index.resize(K_g_triplets.size());
+        for (std::size_t t=0; t < K_g_triplets.size(); t++)
+        {
+            const auto* first = this->K_g.innerIndexPtr() + this->K_g.outerIndexPtr()[K_g_triplets[t].col()];
+            const auto* last = this->K_g.innerIndexPtr() + this->K_g.outerIndexPtr()[K_g_triplets[t].col() + 1];
+            this->K_g_index[t] = std::lower_bound(first, last, K_g_triplets[t].row()) - this->K_g.innerIndexPtr();
+        }
+        this->K_g_solver = std::make_shared<Eigen::SimplicialLDLT<spMat, Eigen::Lower>>();
+        this->K_g_solver->analyzePattern(this->K_g);
+        this->K_g_solver->factorize(this->K_g);
+        this->sol = this->K_g_solver->solve(-rhs);
+    }
+    else
+    {
+        // same pattern as in the previous step, only the values have to be summed up again
+        double* values = this->K_g.valuePtr();
+        std::fill(values, values + this->K_g.nonZeros(), 0.0);
+        for (std::size_t t=0; t < K_g_triplets.size(); t++)
+            values[this->K_g_index[t]] += K_g_triplets[t].value();
+
+        // the stiffness changes only a little between the steps, so the factorization of a
+        // previous step is used for an iterative refinement and only renewed if it doesn't converge
+        const double tolerance = 1e-10 * rhs.norm();
+        const int max_refinements = 20;
+        Eigen::VectorXd x = this->K_g_solver->solve(-rhs);
+        Eigen::VectorXd residual = -rhs - this->K_g * x;
+        double residual_norm = residual.norm();
+        for (int i=0; i < max_refinements && residual_norm > tolerance; i++)
+        {
+            x += this->K_g_solver->solve(residual);
+            residual = -rhs - this->K_g * x;
+            double norm = residual.norm();
+            if (!(norm < residual_norm * 0.5))
+            {
+                residual_norm = norm;
+                break;
+            }
+            residual_norm = norm;
+        }
+        if (residual_norm > tolerance)
+        {
+            this->K_g_solver->factorize(this->K_g);
+            x = this->K_g_solver->solve(-rhs);
+        }
+        this->sol = x;
+    }
     // rhs +=  K_g * Eigen::VectorXd::Ones(K_g.rows());
-
-    // solve linear system (privately store the value for guess in next step)
-    Eigen::SimplicialLDLT<spMat, Eigen::Lower> solver;
-    solver.compute(K_g);
-    this->sol = solver.solve(-rhs);
     this->set_shift(this->sol.head(this->vertices.cols() * 2) * weight);
     this->set_q_l_m();
 }
@@ -425,31 +531,33 @@ void LscmRelax::edge_relax(double weight)
 void LscmRelax::lscm()
 {
     this->set_q_l_g();
-    std::vector<trip> triple_list;
-    long i;
-    double x21, x31, y31, x32;
+    std::vector<trip> triple_list(this->triangles.cols() * 10);
 
     // 1. create the triplet list (t * 2, v * 2)
-    for(i=0; i<this->triangles.cols(); i++)
+    parallel_for(this->triangles.cols(), this->threads, [&](long begin, long end)
     {
-        x21 = this->q_l_g(i, 0);
-        x31 = this->q_l_g(i, 1);
-        y31 = this->q_l_g(i, 2);
-        x32 = x31 - x21;
-
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(0, i)] * 2, x32));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(0, i)] * 2 + 1, -y31));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(1, i)] * 2, -x31));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(1, i)] * 2 + 1, y31));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(2, i)] * 2, x21));
-
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2, y31));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2 + 1, x32));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2, -y31));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2 + 1, -x31));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(2, i)] * 2 + 1, x21));
-
-    }
+        double x21, x31, y31, x32;
+        for(long i=begin; i<end; i++)
+        {
+            x21 = this->q_l_g(i, 0);
+            x31 = this->q_l_g(i, 1);
+            y31 = this->q_l_g(i, 2);
+            x32 = x31 - x21;
+
+            trip* triplet = &triple_list[i * 10];
+            *triplet++ = trip(2 * i, this->new_order[this->triangles(0, i)] * 2, x32);
+            *triplet++ = trip(2 * i, this->new_order[this->triangles(0, i)] * 2 + 1, -y31);
+            *triplet++ = trip(2 * i, this->new_order[this->triangles(1, i)] * 2, -x31);
+            *triplet++ = trip(2 * i, this->new_order[this->triangles(1, i)] * 2 + 1, y31);
+            *triplet++ = trip(2 * i, this->new_order[this->triangles(2, i)] * 2, x21);
+
+            *triplet++ = trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2, y31);
+            *triplet++ = trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2 + 1, x32);
+            *triplet++ = trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2, -y31);
+            *triplet++ = trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2 + 1, -x31);
+            *triplet++ = trip(2 * i + 1, this->new_order[this->triangles(2, i)] * 2 + 1, x21);
+        }
+    });
     // 2. divide the triplets in matrix(unknown part) and rhs(known part) and reset the position
     std::vector<trip> rhs_triplets;
     std::vector<trip> mat_triplets;
@@ -481,11 +589,22 @@ void LscmRelax::lscm()
     A.setFromTriplets(mat_triplets.begin(), mat_triplets.end());
 
     // 6. solve the system and set the flatted coordinates
+    // the normal equations are solved directly, the least squares cg needs a lot of
+    // iterations for large meshes and is only used if the factorization fails
     // Eigen::SparseQR<spMat, Eigen::COLAMDOrdering<int> > solver;
-    Eigen::LeastSquaresConjugateGradient<spMat > solver;
     Eigen::VectorXd sol(this->vertices.size() * 2);
-    solver.compute(A);
-    sol = solver.solve(-rhs);
+    spMat AtA = A.transpose() * A;
+    Eigen::SimplicialLDLT<spMat> normal_solver(AtA);
+    if (normal_solver.info() == Eigen::Success)
+    {
+        sol = normal_solver.solve(A.transpose() * -rhs);
+    }
+    if (normal_solver.info() != Eigen::Success)
+    {
+        Eigen::LeastSquaresConjugateGradient<spMat > solver;
+        solver.compute(A);
+        sol = solver.solve(-rhs);
+    }
 
     // TODO: create function, is needed also in the fem step
     this->set_position(sol);
@@ -502,18 +621,21 @@ void LscmRelax::set_q_l_g()
     // x1, y1, y2 = 0
     // -> vector<x2, x3, y3>
     this->q_l_g.resize(this->triangles.cols(), 3);
-    for (long i = 0; i < this->triangles.cols(); i++)
+    parallel_for(this->triangles.cols(), this->threads, [this](long begin, long end)
     {
-        Vector3 r1 = this->vertices.col(this->triangles(0, i));
-        Vector3 r2 = this->vertices.col(this->triangles(1, i));
-        Vector3 r3 = this->vertices.col(this->triangles(2, i));
-        Vector3 r21 = r2 - r1;
-        Vector3 r31 = r3 - r1;
-        double r21_norm = r21.norm();
-        r21.normalize();
-        // if triangle is fliped this gives wrong results?
-        this->q_l_g.row(i) << r21_norm, r31.dot(r21), r31.cross(r21).norm();
-    }
+        for (long i = begin; i < end; i++)
+        {
+            Vector3 r1 = this->vertices.col(this->triangles(0, i));
+            Vector3 r2 = this->vertices.col(this->triangles(1, i));
+            Vector3 r3 = this->vertices.col(this->triangles(2, i));
+            Vector3 r21 = r2 - r1;
+            Vector3 r31 = r3 - r1;
+            double r21_norm = r21.norm();
+            r21.normalize();
+            // if triangle is fliped this gives wrong results?
+            this->q_l_g.row(i) << r21_norm, r31.dot(r21), r31.cross(r21).norm();
+        }
+    });
 }
 
 void LscmRelax::set_q_l_m()
@@ -522,18 +644,21 @@ void LscmRelax::set_q_l_m()
     // x1, y1, y2 = 0
     // -> vector<x2, x3, y3>
     this->q_l_m.resize(this->triangles.cols(), 3);
-    for (long i = 0; i < this->triangles.cols(); i++)
+    parallel_for(this->triangles.cols(), this->threads, [this](long begin, long end)
     {
-        Vector2 r1 = this->flat_vertices.col(this->triangles(0, i));
-        Vector2 r2 = this->flat_vertices.col(this->triangles(1, i));
-        Vector2 r3 = this->flat_vertices.col(this->triangles(2, i));
-        Vector2 r21 = r2 - r1;
-        Vector2 r31 = r3 - r1;
-        double r21_norm = r21.norm();
-        r21.normalize();
-        // if triangle is fliped this gives wrong results!
-        this->q_l_m.row(i) << r21_norm, r31.dot(r21), -(r31.x() * r21.y() - r31.y() * r21.x());
-    }
+        for (long i = begin; i < end; i++)
+        {
+            Vector2 r1 = this->flat_vertices.col(this->triangles(0, i));
+            Vector2 r2 = this->flat_vertices.col(this->triangles(1, i));
+            Vector2 r3 = this->flat_vertices.col(this->triangles(2, i));
+            Vector2 r21 = r2 - r1;
+            Vector2 r31 = r3 - r1;
+            double r21_norm = r21.norm();
+            r21.normalize();
+            // if triangle is fliped this gives wrong results!
+            this->q_l_m.row(i) << r21_norm, r31.dot(r21), -(r31.x() * r21.y() - r31.y() * r21.x());
+        }
+    });
 }
 
 void LscmRelax::set_fixed_pins()
@@ -36,10 +36,14 @@
 // 6: K.u=forces ->u
 // 7: x1, y1 += w * u
 
+#include <algorithm>
 #include <memory>
+#include <thread>
 #include <tuple>
 #include <vector>
 
+#include <Eigen/SparseCholesky>
+
 #include "MeshFlattening.h"
 
 
@@ -89,6 +93,12 @@ private:
     std::vector<long> get_fem_fixed_pins();
     Eigen::MatrixXd get_nullspace();
 
+    // the sparsity pattern of the relaxation system only depends on the triangles, so
+    // the matrix structure and the symbolic factorization are kept between the steps
+    spMat K_g;
+    std::vector<Eigen::Index> K_g_index;
+    std::shared_ptr<Eigen::SimplicialLDLT<spMat, Eigen::Lower>> K_g_solver;
+
 public:
     LscmRelax() = default;
     LscmRelax(
@@ -105,6 +115,8 @@ public:
 
     double nue=0.9;
     double elasticity=1.;
+    // number of threads used to assemble the systems
+    int threads=std::max(1, int(std::thread::hardware_concurrency()));
 
     void lscm();
     void relax(double);
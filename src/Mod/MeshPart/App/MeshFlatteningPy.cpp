@@ -116,7 +116,8 @@ PYBIND11_MODULE(flatmesh, m)
         .def_property_readonly("area", &lscmrelax::LscmRelax::get_area)
         .def_property_readonly("flat_area", &lscmrelax::LscmRelax::get_flat_area)
         .def_property_readonly("flat_vertices", [](lscmrelax::LscmRelax& L){return L.flat_vertices.transpose();}, py::return_value_policy::copy)
-        .def_property_readonly("flat_vertices_3D", &lscmrelax::LscmRelax::get_flat_vertices_3D);
+        .def_property_readonly("flat_vertices_3D", &lscmrelax::LscmRelax::get_flat_vertices_3D)
+        .def_readwrite("threads", &lscmrelax::LscmRelax::threads);
 
     py::class_<nurbs::NurbsBase2D>(m, "NurbsBase2D")
         .def(py::init<Eigen::VectorXd, Eigen::VectorXd, Eigen::VectorXd, int, int>())
@@ -152,9 +153,10 @@ PYBIND11_MODULE(flatmesh, m)
     py::class_<FaceUnwrapper>(m, "FaceUnwrapper")
         .def(py::init(&FaceUnwrapper_constructor))
         .def(py::init<ColMat<double, 3>, ColMat<long, 3>>())
-        .def("findFlatNodes", &FaceUnwrapper::findFlatNodes)
+        .def("findFlatNodes", &FaceUnwrapper::findFlatNodes, py::call_guard<py::gil_scoped_release>())
         .def("interpolateFlatFace", &interpolateFlatFacePy)
         .def("getFlatBoundaryNodes", &FaceUnwrapper::getFlatBoundaryNodes)
+        .def_readwrite("threads", &FaceUnwrapper::threads)
         .def_readonly("tris", &FaceUnwrapper::tris)
         .def_readonly("nodes", &FaceUnwrapper::xyz_nodes)
         .def_readonly("uv_nodes", &FaceUnwrapper::uv_nodes)
@@ -162,5 +164,11 @@ PYBIND11_MODULE(flatmesh, m)
         .def_readonly("ze_poles", &FaceUnwrapper::ze_poles)
         .def_readonly("A", &FaceUnwrapper::A);
 
+    m.def("findFlatNodes",
+          [](const std::vector<FaceUnwrapper*>& unwrappers, int steps, double val) {
+              findFlatNodes(unwrappers, steps, val);
+          },
+          "flattens independent faces concurrently",
+          py::call_guard<py::gil_scoped_release>());
 };
 // clang-format on
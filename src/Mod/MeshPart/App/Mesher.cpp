@@ -23,17 +23,29 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <cstring>
+#include <thread>
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangle.hxx>
+#include <Poly_Triangulation.hxx>
 #include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
+#include <gp_Vec.hxx>
 #endif
 
 #include <Base/Console.h>
 #include <Base/Tools.h>
+#include <Mod/Mesh/App/Core/Functional.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
 #include <Mod/Mesh/App/Mesh.h>
 #include <Mod/Part/App/BRepMesh.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Part/App/TopoShape.h>
 
 #include "Mesher.h"
@@ -121,6 +133,25 @@ int MeshingOutput::sync()
 
 // ----------------------------------------------------------------------------
 
+namespace
+{
+
+int numThreads()
+{
+    return std::max(1, int(std::thread::hardware_concurrency()));
+}
+
+std::vector<TopoDS_Face> getFaces(const TopoDS_Shape& shape)
+{
+    std::vector<TopoDS_Face> faces;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        faces.push_back(TopoDS::Face(xp.Current()));
+    }
+    return faces;
+}
+
+}  // namespace
+
 namespace MeshPart
 {
 
@@ -221,12 +252,18 @@ Mesher::Mesher(const TopoDS_Shape& s)
 
 Mesher::~Mesher() = default;
 
-Mesh::MeshObject* Mesher::createStandard() const
+void Mesher::meshStandard() const
 {
     if (!shape.IsNull()) {
         BRepTools::Clean(shape);
-        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
+        // the faces are meshed in parallel
+        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection, true);
     }
+}
+
+Mesh::MeshObject* Mesher::createStandard() const
+{
+    meshStandard();
 
     std::vector<Part::TopoShape::Domain> domains;
     Part::TopoShape(shape).getDomains(domains);
@@ -235,6 +272,76 @@ Mesh::MeshObject* Mesher::createStandard() const
     return brepmesh.create(domains);
 }
 
+void Mesher::writeStandardSTL(std::ostream& out) const
+{
+    meshStandard();
+
+    std::vector<TopoDS_Face> faces = getFaces(shape);
+    uint32_t numFacets = 0;
+    for (const auto& face : faces) {
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) hTria = BRep_Tool::Triangulation(face, loc);
+        if (!hTria.IsNull()) {
+            numFacets += uint32_t(hTria->NbTriangles());
+        }
+    }
+
+    std::string header = MeshCore::MeshOutput::GetSTLHeaderData();
+    header.resize(80, ' ');
+    out.write(header.data(), 80);
+    out.write(reinterpret_cast<const char*>(&numFacets), sizeof(numFacets));
+
+    // The facets of a block of faces are converted in parallel and written in the order of
+    // the faces, so that only the facets of one block are held in memory
+    const std::size_t recordSize = 50;
+    const std::size_t blockSize = 256;
+    std::vector<std::string> records(blockSize);
+    for (std::size_t block = 0; block < faces.size(); block += blockSize) {
+        std::size_t count = std::min(blockSize, faces.size() - block);
+        MeshCore::parallel_for(
+            count,
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    std::vector<gp_Pnt> points;
+                    std::vector<Poly_Triangle> facets;
+                    std::string& buffer = records[i];
+                    buffer.clear();
+                    if (!Part::Tools::getTriangulation(faces[block + i], points, facets)) {
+                        continue;
+                    }
+
+                    buffer.resize(facets.size() * recordSize);
+                    char* data = &buffer[0];
+                    for (const auto& it : facets) {
+                        Standard_Integer N1, N2, N3;
+                        it.Get(N1, N2, N3);
+                        const gp_Pnt& p1 = points[N1];
+                        const gp_Pnt& p2 = points[N2];
+                        const gp_Pnt& p3 = points[N3];
+                        gp_Vec normal = gp_Vec(p1, p2).Crossed(gp_Vec(p1, p3));
+                        if (normal.SquareMagnitude() > 0) {
+                            normal.Normalize();
+                        }
+
+                        float values[12] = {float(normal.X()), float(normal.Y()), float(normal.Z()),
+                                            float(p1.X()),     float(p1.Y()),     float(p1.Z()),
+                                            float(p2.X()),     float(p2.Y()),     float(p2.Z()),
+                                            float(p3.X()),     float(p3.Y()),     float(p3.Z())};
+                        uint16_t attribute = 0;
+                        std::memcpy(data, values, sizeof(values));
+                        std::memcpy(data + sizeof(values), &attribute, sizeof(attribute));
+                        data += recordSize;
+                    }
+                }
+            },
+            numThreads());
+
+        for (std::size_t i = 0; i < count; i++) {
+            out.write(records[i].data(), std::streamsize(records[i].size()));
+        }
+    }
+}
+
 Mesh::MeshObject* Mesher::createMesh() const
 {
     // OCC standard mesher
@@ -212,8 +212,12 @@ public:
 #endif
 
     Mesh::MeshObject* createMesh() const;
+    /// Writes the triangulation of the faces as binary STL without creating a mesh
+    /// (uses the settings of the Standard method)
+    void writeStandardSTL(std::ostream&) const;
 
 private:
+    void meshStandard() const;
     Mesh::MeshObject* createStandard() const;
     Mesh::MeshObject* createFrom(SMESH_Mesh*) const;
 
@@ -79,7 +79,7 @@ class CreateFlatMesh(BaseCommand):
 
 
 class CreateFlatFace(BaseCommand):
-    """create a flat face from a single face
+    """create flat faces from the selected faces
     only full faces are supported right now"""
 
     def GetResources(self):
@@ -95,26 +95,33 @@ class CreateFlatFace(BaseCommand):
         import numpy as np
         import flatmesh
 
-        face = Gui.Selection.getSelectionEx()[0].SubObjects[0]
-        shape = face.toNurbs()
-        face = shape.Faces[0]
-        nurbs = face.Surface
-        nurbs.setUNotPeriodic()
-        nurbs.setVNotPeriodic()
-        bs = nurbs.toBSpline(1, "C0", "C0", 3, 3, 10)
-        face = bs.toShape()
-        face.tessellate(0.01)
-        flattener = flatmesh.FaceUnwrapper(face)
-        flattener.findFlatNodes(5, 0.99)
-        poles = flattener.interpolateFlatFace(face)
-        num_u_poles = len(bs.getPoles())
-        num_v_poles = len(bs.getPoles()[0])
-        i = 0
-        for u in range(num_u_poles):
-            for v in range(num_v_poles):
-                bs.setPole(u + 1, v + 1, App.Vector(poles[i]))
-                i += 1
-        Part.show(bs.toShape())
+        surfaces = []
+        for sel in Gui.Selection.getSelectionEx():
+            for face in sel.SubObjects:
+                if not isinstance(face, Part.Face):
+                    continue
+                shape = face.toNurbs()
+                face = shape.Faces[0]
+                nurbs = face.Surface
+                nurbs.setUNotPeriodic()
+                nurbs.setVNotPeriodic()
+                bs = nurbs.toBSpline(1, "C0", "C0", 3, 3, 10)
+                face = bs.toShape()
+                face.tessellate(0.01)
+                surfaces.append((bs, face, flatmesh.FaceUnwrapper(face)))
+
+        # the faces are independent of each other and are flattened concurrently
+        flatmesh.findFlatNodes([flattener for _, _, flattener in surfaces], 5, 0.99)
+        for bs, face, flattener in surfaces:
+            poles = flattener.interpolateFlatFace(face)
+            num_u_poles = len(bs.getPoles())
+            num_v_poles = len(bs.getPoles()[0])
+            i = 0
+            for u in range(num_u_poles):
+                for v in range(num_v_poles):
+                    bs.setPole(u + 1, v + 1, App.Vector(poles[i]))
+                    i += 1
+            Part.show(bs.toShape())
 
     def IsActive(self):
         assert super(CreateFlatFace, self).IsActive()
@@ -25,6 +25,9 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <future>
+#include <limits>
+#include <thread>
 #include <Precision.hxx>
 #endif
 
@@ -34,37 +37,46 @@
 using namespace Part;
 
 namespace {
-struct MeshVertex
+bool vertexLess(const Base::Vector3d& p, const Base::Vector3d& v)
 {
-    Base::Vector3d p;
-    std::size_t i = 0;
-
-    explicit MeshVertex(const Base::Vector3d& p)
-        : p(p)
-    {
+    if (p.x != v.x) {
+        return p.x < v.x;
     }
-
-    Base::Vector3d toPoint() const
-    {
-        return p;
+    if (p.y != v.y) {
+        return p.y < v.y;
+    }
+    if (p.z != v.z) {
+        return p.z < v.z;
     }
 
-    bool operator < (const MeshVertex &v) const
-    {
-        if (p.x != v.p.x) {
-            return p.x < v.p.x;
-        }
-        if (p.y != v.p.y) {
-            return p.y < v.p.y;
-        }
-        if (p.z != v.p.z) {
-            return p.z < v.p.z;
-        }
+    // points are equal
+    return false;
+}
 
-        // points are equal
-        return false;
+template<class Iter, class Pred>
+void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
+{
+    if (threads < 2 || end - begin < 10000) {
+        std::sort(begin, end, comp);
     }
-};
+    else {
+        Iter mid = begin + (end - begin) / 2;
+        auto future = std::async(std::launch::async,
+                                 parallel_sort<Iter, Pred>,
+                                 begin,
+                                 mid,
+                                 comp,
+                                 threads / 2);
+        parallel_sort(mid, end, comp, threads - threads / 2);
+        future.wait();
+        std::inplace_merge(begin, mid, end, comp);
+    }
+}
+
+int numThreads()
+{
+    return std::max(1, int(std::thread::hardware_concurrency()));
+}
 
 class MergeVertex
 {
@@ -163,6 +175,8 @@ private:
             vertices.push_back(it);
         }
 
+        // the tolerance based comparison is not a strict weak ordering, so the vertices
+        // are not sorted in parallel as merging the sorted halves may separate them
         std::sort(vertices.begin(), vertices.end(), vertexLess);
 
         auto next = vertices.begin();
@@ -258,27 +272,63 @@ void BRepMesh::getFacesFromDomains(const std::vector<Domain>& domains,
     }
     faces.reserve(numFaces);
 
-    std::set<MeshVertex> vertices;
-    auto addVertex = [&vertices](const Base::Vector3d& pnt, uint32_t& pointIndex) {
-        MeshVertex vertex(pnt);
-        vertex.i = vertices.size();
-        auto it = vertices.insert(vertex);
-        pointIndex = it.first->i;
+    // Identical points of all domains are grouped by sorting them instead of inserting
+    // every corner into a shared set, so that the sorting can be done in parallel
+    std::vector<std::size_t> offsets;
+    offsets.reserve(domains.size());
+    std::vector<Base::Vector3d> domainPoints;
+    for (const auto& it : domains) {
+        offsets.push_back(domainPoints.size());
+        domainPoints.insert(domainPoints.end(), it.points.begin(), it.points.end());
+    }
+
+    std::vector<std::size_t> sorted(domainPoints.size());
+    std::generate(sorted.begin(), sorted.end(), Base::iotaGen<std::size_t>(0));
+    parallel_sort(sorted.begin(), sorted.end(),
+                  [&domainPoints](std::size_t p, std::size_t v) {
+                      return vertexLess(domainPoints[p], domainPoints[v]);
+                  },
+                  numThreads());
+
+    // every point refers to the first point of its group
+    std::vector<std::size_t> groups(domainPoints.size());
+    for (auto it = sorted.begin(); it != sorted.end();) {
+        auto next = it;
+        while (next != sorted.end() && !vertexLess(domainPoints[*it], domainPoints[*next])) {
+            groups[*next] = *it;
+            ++next;
+        }
+        it = next;
+    }
+
+    // the points get their index in the order they are used by the facets
+    const uint32_t unused = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> groupIndexes(domainPoints.size(), unused);
+    std::vector<Base::Vector3d> meshPoints;
+    auto addVertex = [&](std::size_t index, uint32_t& pointIndex) {
+        uint32_t& groupIndex = groupIndexes[groups[index]];
+        if (groupIndex == unused) {
+            groupIndex = uint32_t(meshPoints.size());
+            meshPoints.push_back(domainPoints[index]);
+        }
+        pointIndex = groupIndex;
     };
 
-    for (const auto & domain : domains) {
+    for (std::size_t i = 0; i < domains.size(); i++) {
+        const auto& domain = domains[i];
+        std::size_t offset = offsets[i];
         std::size_t numDomainFaces = 0;
         for (const Facet& df : domain.facets) {
             Facet face;
 
             // 1st vertex
-            addVertex(domain.points[df.I1], face.I1);
+            addVertex(offset + df.I1, face.I1);
 
             // 2nd vertex
-            addVertex(domain.points[df.I2], face.I2);
+            addVertex(offset + df.I2, face.I2);
 
             // 3rd vertex
-            addVertex(domain.points[df.I3], face.I3);
+            addVertex(offset + df.I3, face.I3);
 
             // make sure that we don't insert invalid facets
             if (face.I1 != face.I2 &&
@@ -292,11 +342,6 @@ void BRepMesh::getFacesFromDomains(const std::vector<Domain>& domains,
         domainSizes.push_back(numDomainFaces);
     }
 
-    std::vector<Base::Vector3d> meshPoints;
-    meshPoints.resize(vertices.size());
-    for (const auto & vertex : vertices) {
-        meshPoints[vertex.i] = vertex.toPoint();
-    }
     points.swap(meshPoints);
 
     MergeVertex merge(points, faces, Precision::Confusion());
@@ -24,12 +24,14 @@
 #define PART_FACEMAKER_H
 
 #include <BRepBuilderAPI_MakeShape.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_Version.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Wire.hxx>
 #include <QCoreApplication>
 
+#include <exception>
 #include <memory>
 #include <Base/BaseClass.h>
 #include <Mod/Part/PartGlobal.h>
@@ -127,6 +129,29 @@ protected:
     void postBuild();
 
     static void throwNotImplemented();
+
+    /**
+     * @brief parallelFor: runs func(i) for i in [0, count) in parallel. The
+     * first exception thrown by func, in the order of i, is passed on to the
+     * caller once all calls are done.
+     */
+    template<class Func>
+    static void parallelFor(int count, const Func& func)
+    {
+        std::vector<std::exception_ptr> errors(count);
+        OSD_Parallel::For(0, count, [&](int i) {
+            try {
+                func(i);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+        for (const std::exception_ptr& error : errors) {
+            if (error)
+                std::rethrow_exception(error);
+        }
+    }
 };
 
 /**
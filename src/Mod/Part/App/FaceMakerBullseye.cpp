@@ -22,9 +22,12 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <numeric>
+# include <Bnd_Box.hxx>
 # include <BRep_Builder.hxx>
 # include <BRep_Tool.hxx>
 # include <BRepAdaptor_Surface.hxx>
+# include <BRepBndLib.hxx>
 # include <BRepBuilderAPI_Copy.hxx>
 # include <BRepBuilderAPI_MakeFace.hxx>
 # include <BRepClass_FaceClassifier.hxx>
@@ -38,13 +41,36 @@
 # include <QtGlobal>
 #endif
 
+#include <boost_geometry.hpp>
+
 #include "FaceMakerBullseye.h"
-#include "FaceMakerCheese.h"
 #include "TopoShape.h"
 
 
 using namespace Part;
 
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+namespace {
+
+using Point = bg::model::point<double, 3, bg::cs::cartesian>;
+using Box = bg::model::box<Point>;
+
+Box toBox(const Bnd_Box& box)
+{
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    return {Point(xmin, ymin, zmin), Point(xmax, ymax, zmax)};
+}
+
+Point toPoint(const gp_Pnt& p)
+{
+    return {p.X(), p.Y(), p.Z()};
+}
+
+}
+
 TYPESYSTEM_SOURCE(Part::FaceMakerBullseye, Part::FaceMakerPublic)
 
 void FaceMakerBullseye::setPlane(const gp_Pln &plane)
@@ -94,42 +120,85 @@ void FaceMakerBullseye::Build_Essence()
     }
 
     //sort wires by length of diagonal of bounding box.
-    std::vector<TopoDS_Wire> wires = this->myWires;
-    std::stable_sort(wires.begin(), wires.end(), FaceMakerCheese::Wire_Compare());
+    std::vector<Bnd_Box> wireBoxes(myWires.size());
+    for (std::size_t i = 0; i < myWires.size(); ++i) {
+        BRepBndLib::Add(myWires[i], wireBoxes[i]);
+        wireBoxes[i].SetGap(0.0);
+    }
+    std::vector<std::size_t> order(myWires.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&wireBoxes](std::size_t a, std::size_t b) {
+        return wireBoxes[a].SquareExtent() < wireBoxes[b].SquareExtent();
+    });
+
+    int count = static_cast<int>(order.size());
+    std::vector<TopoDS_Wire> wires(count);
+    std::vector<std::pair<Box, int>> boxes;
+    boxes.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        wires[i] = myWires[order[i]];
+        Bnd_Box box = wireBoxes[order[i]];
+        if (!box.IsVoid()) {
+            box.Enlarge(Precision::Confusion());
+            boxes.emplace_back(toBox(box), i);
+        }
+    }
+
+    //make a face of every wire. They are tested for the wires inside of them,
+    //and those of the outer wires get the holes.
+    std::vector< std::unique_ptr<FaceDriller> > faces(count);
+    parallelFor(count, [&](int i) {
+        faces[i] = std::make_unique<FaceDriller>(plane, wires[i]);
+    });
+
+    //find the wire around each wire. It is the smallest of the wires around it,
+    //as these are nested. Wires at even depth start a new face, the others are
+    //holes of the face around them.
+    //Since we are assuming the wires do not intersect, testing if one vertex of wire is in a face is enough.
+    bgi::rtree<std::pair<Box, int>, bgi::linear<16>> tree(boxes);
+    std::vector<int> parents(count, -1);
+    std::vector<int> depths(count, 0);
+    std::vector<int> roots;
+    std::vector< std::vector<int> > holes(count);
+    std::vector<std::pair<Box, int>> found;
 
-    //add wires one by one to current set of faces.
     //We go from last to first, to make it so that outer wires come before inner wires.
-    std::vector< std::unique_ptr<FaceDriller> > faces;
-    for (int i = static_cast<int>(wires.size()) - 1; i >= 0; --i) {
-        TopoDS_Wire& w = wires[i];
-
-        //test if this wire is on any of existing faces (if yes, it's a hole;
-        // if no, it's a beginning of a new face).
-        //Since we are assuming the wires do not intersect, testing if one vertex of wire is in a face is enough.
-        gp_Pnt p = BRep_Tool::Pnt(TopoDS::Vertex(TopExp_Explorer(w, TopAbs_VERTEX).Current()));
-        FaceDriller* foundFace = nullptr;
-        for (std::unique_ptr<FaceDriller>& ff : faces) {
-            if (ff->hitTest(p)) {
-                foundFace = &(*ff);
+    for (int i = count - 1; i >= 0; --i) {
+        gp_Pnt p = BRep_Tool::Pnt(TopoDS::Vertex(TopExp_Explorer(wires[i], TopAbs_VERTEX).Current()));
+
+        found.clear();
+        tree.query(bgi::intersects(toPoint(p)), std::back_inserter(found));
+        std::sort(found.begin(), found.end(), [](const auto& a, const auto& b) {
+            return a.second < b.second;
+        });
+        for (const auto& candidate : found) {
+            int j = candidate.second;
+            if (j > i && faces[j]->hitTest(p)) {
+                parents[i] = j;
+                depths[i] = depths[j] + 1;
                 break;
             }
         }
 
-        if (foundFace) {
-            //wire is on a face.
-            foundFace->addHole(w);
+        if (depths[i] % 2 == 0) {
+            roots.push_back(i);
         }
         else {
-            //wire is not on a face. Start a new face.
-            faces.push_back(std::make_unique<FaceDriller>(
-                                plane, w
-                           ));
+            holes[parents[i]].push_back(i);
         }
     }
 
+    //drill the holes, the faces are independent of each other.
+    parallelFor(static_cast<int>(roots.size()), [&](int k) {
+        FaceDriller& face = *faces[roots[k]];
+        for (int hole : holes[roots[k]]) {
+            face.addHole(*faces[hole]);
+        }
+    });
+
     //and we are done!
-    for (std::unique_ptr<FaceDriller>& ff : faces) {
-        this->myShapesToReturn.push_back(ff->Face());
+    for (int i : roots) {
+        this->myShapesToReturn.push_back(faces[i]->Face());
     }
 }
 
@@ -142,6 +211,7 @@ FaceMakerBullseye::FaceDriller::FaceDriller(const gp_Pln& plane, TopoDS_Wire out
     //Ensure correct orientation of the wire.
     if (getWireDirection(myPlane, outerWire) < 0)
         outerWire.Reverse();
+    this->myOuterWire = outerWire;
 
     myHPlane = new Geom_Plane(this->myPlane);
     BRep_Builder builder;
@@ -175,6 +245,13 @@ void FaceMakerBullseye::FaceDriller::addHole(TopoDS_Wire w)
     builder.Add(this->myFace, w);
 }
 
+void FaceMakerBullseye::FaceDriller::addHole(const FaceDriller& inner)
+{
+    //the outer wire of the other face is CCW, we want CW
+    BRep_Builder builder;
+    builder.Add(this->myFace, TopoDS::Wire(inner.myOuterWire.Reversed()));
+}
+
 int FaceMakerBullseye::FaceDriller::getWireDirection(const gp_Pln& plane, const TopoDS_Wire& wire)
 {
     //make a test face
@@ -82,6 +82,12 @@ protected:
 
         void addHole(TopoDS_Wire w);
 
+        /**
+         * @brief addHole: adds the outer wire of another face as a hole,
+         * without determining its direction again.
+         */
+        void addHole(const FaceDriller& inner);
+
         const TopoDS_Face& Face() const {return myFace;}
     public:
         /**
@@ -94,6 +100,7 @@ protected:
     private:
         gp_Pln myPlane;
         TopoDS_Face myFace;
+        TopoDS_Wire myOuterWire; //oriented CCW
         Handle(Geom_Surface) myHPlane;
     };
 };
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 # include <algorithm>
+# include <numeric>
 # include <Bnd_Box.hxx>
 # include <BRep_Builder.hxx>
 # include <BRep_Tool.hxx>
@@ -45,11 +46,96 @@
 # include <QtGlobal>
 #endif
 
+#include <boost_geometry.hpp>
+
 #include "FaceMakerCheese.h"
 
 
 using namespace Part;
 
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+namespace {
+
+using Point = bg::model::point<double, 3, bg::cs::cartesian>;
+using Box = bg::model::box<Point>;
+
+Bnd_Box getBox(const TopoDS_Wire& wire)
+{
+    Bnd_Box box;
+    if (!wire.IsNull()) {
+        BRepBndLib::Add(wire, box);
+        box.SetGap(0.0);
+    }
+    return box;
+}
+
+Box toBox(Bnd_Box box)
+{
+    //a bit larger, so that the index finds all the boxes that Bnd_Box::IsOut() doesn't reject
+    box.Enlarge(Precision::Confusion());
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    return {Point(xmin, ymin, zmin), Point(xmax, ymax, zmax)};
+}
+
+/**
+ * Tests if other wires are inside of a wire. The face of the wire is made
+ * once, when it is needed for the first time.
+ */
+class WireClassifier
+{
+public:
+    WireClassifier(const TopoDS_Wire& wire, const Bnd_Box& box)
+        : wire(wire)
+        , box(box)
+    {}
+
+    bool isInside(const TopoDS_Wire& other, const Bnd_Box& otherBox)
+    {
+        if (box.IsOut(otherBox))
+            return false;
+
+        double prec = Precision::Confusion();
+
+        if (!class2d) {
+            BRepBuilderAPI_MakeFace mkFace(wire);
+            if (!mkFace.IsDone())
+                Standard_Failure::Raise("Failed to create a face from wire in sketch");
+            TopoDS_Face face = FaceMakerCheese::validateFace(mkFace.Face());
+            BRepAdaptor_Surface adapt(face);
+            class2d = std::make_unique<IntTools_FClass2d>(face, prec);
+            Handle(Geom_Surface) surf = new Geom_Plane(adapt.Plane());
+            surface = new ShapeAnalysis_Surface(surf);
+        }
+
+        TopExp_Explorer xp(other,TopAbs_VERTEX);
+        while (xp.More())  {
+            TopoDS_Vertex v = TopoDS::Vertex(xp.Current());
+            gp_Pnt p = BRep_Tool::Pnt(v);
+            gp_Pnt2d uv = surface->ValueOfUV(p, prec);
+            if (class2d->Perform(uv) == TopAbs_IN)
+                return true;
+            // TODO: We can make a check to see if all points are inside or all outside
+            // because otherwise we have some intersections which is not allowed
+            else
+                return false;
+            //xp.Next();
+        }
+
+        return false;
+    }
+
+private:
+    TopoDS_Wire wire;
+    Bnd_Box box;
+    std::unique_ptr<IntTools_FClass2d> class2d;
+    Handle(ShapeAnalysis_Surface) surface;
+};
+
+}
+
 TYPESYSTEM_SOURCE(Part::FaceMakerCheese, Part::FaceMakerPublic)
 
 
@@ -115,43 +201,7 @@ bool FaceMakerCheese::Wire_Compare::operator() (const TopoDS_Wire& w1, const Top
 
 bool FaceMakerCheese::isInside(const TopoDS_Wire& wire1, const TopoDS_Wire& wire2)
 {
-    Bnd_Box box1;
-    BRepBndLib::Add(wire1, box1);
-    box1.SetGap(0.0);
-
-    Bnd_Box box2;
-    BRepBndLib::Add(wire2, box2);
-    box2.SetGap(0.0);
-
-    if (box1.IsOut(box2))
-        return false;
-
-    double prec = Precision::Confusion();
-
-    BRepBuilderAPI_MakeFace mkFace(wire1);
-    if (!mkFace.IsDone())
-        Standard_Failure::Raise("Failed to create a face from wire in sketch");
-    TopoDS_Face face = validateFace(mkFace.Face());
-    BRepAdaptor_Surface adapt(face);
-    IntTools_FClass2d class2d(face, prec);
-    Handle(Geom_Surface) surf = new Geom_Plane(adapt.Plane());
-    ShapeAnalysis_Surface as(surf);
-
-    TopExp_Explorer xp(wire2,TopAbs_VERTEX);
-    while (xp.More())  {
-        TopoDS_Vertex v = TopoDS::Vertex(xp.Current());
-        gp_Pnt p = BRep_Tool::Pnt(v);
-        gp_Pnt2d uv = as.ValueOfUV(p, prec);
-        if (class2d.Perform(uv) == TopAbs_IN)
-            return true;
-        // TODO: We can make a check to see if all points are inside or all outside
-        // because otherwise we have some intersections which is not allowed
-        else
-            return false;
-        //xp.Next();
-    }
-
-    return false;
+    return WireClassifier(wire1, getBox(wire1)).isInside(wire2, getBox(wire2));
 }
 
 TopoDS_Shape FaceMakerCheese::makeFace(std::list<TopoDS_Wire>& wires)
@@ -193,31 +243,58 @@ TopoDS_Shape FaceMakerCheese::makeFace(const std::vector<TopoDS_Wire>& w)
 
     //FIXME: Need a safe method to sort wire that the outermost one comes last
     // Currently it's done with the diagonal lengths of the bounding boxes
-    std::vector<TopoDS_Wire> wires = w;
-    std::sort(wires.begin(), wires.end(), Wire_Compare());
-    std::list<TopoDS_Wire> wire_list;
-    wire_list.insert(wire_list.begin(), wires.rbegin(), wires.rend());
+    std::vector<Bnd_Box> boxes;
+    boxes.reserve(w.size());
+    for (const TopoDS_Wire& wire : w) {
+        boxes.push_back(getBox(wire));
+    }
+    std::vector<std::size_t> order(w.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&boxes](std::size_t a, std::size_t b) {
+        return boxes[a].SquareExtent() > boxes[b].SquareExtent();
+    });
+
+    // index of the wire boxes, to only test the wires whose boxes overlap
+    std::vector<std::pair<Box, std::size_t>> values;
+    values.reserve(order.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        if (!boxes[order[i]].IsVoid())
+            values.emplace_back(toBox(boxes[order[i]]), i);
+    }
+    bgi::rtree<std::pair<Box, std::size_t>, bgi::linear<16>> tree(values);
 
     // separate the wires into several independent faces
-    std::list< std::list<TopoDS_Wire> > sep_wire_list;
-    while (!wire_list.empty()) {
+    std::vector< std::list<TopoDS_Wire> > sep_wire_list;
+    std::vector<bool> separated(order.size(), false);
+    std::vector<std::pair<Box, std::size_t>> found;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        if (separated[i])
+            continue;
+        separated[i] = true;
+
+        const TopoDS_Wire& wire = w[order[i]];
+        const Bnd_Box& box = boxes[order[i]];
         std::list<TopoDS_Wire> sep_list;
-        TopoDS_Wire wire = wire_list.front();
-        wire_list.pop_front();
         sep_list.push_back(wire);
 
-        std::list<TopoDS_Wire>::iterator it = wire_list.begin();
-        while (it != wire_list.end()) {
-            if (isInside(wire, *it)) {
-                sep_list.push_back(*it);
-                it = wire_list.erase(it);
-            }
-            else {
-                ++it;
+        if (!box.IsVoid()) {
+            found.clear();
+            tree.query(bgi::intersects(toBox(box)), std::back_inserter(found));
+            std::sort(found.begin(), found.end(), [](const auto& a, const auto& b) {
+                return a.second < b.second;
+            });
+
+            WireClassifier classifier(wire, box);
+            for (const auto& it : found) {
+                std::size_t j = it.second;
+                if (!separated[j] && classifier.isInside(w[order[j]], boxes[order[j]])) {
+                    sep_list.push_back(w[order[j]]);
+                    separated[j] = true;
+                }
             }
         }
 
-        sep_wire_list.push_back(sep_list);
+        sep_wire_list.push_back(std::move(sep_list));
     }
 
     if (sep_wire_list.size() == 1) {
@@ -225,13 +302,19 @@ TopoDS_Shape FaceMakerCheese::makeFace(const std::vector<TopoDS_Wire>& w)
         return makeFace(wires);
     }
     else if (sep_wire_list.size() > 1) {
+        // the faces don't share anything, make them in parallel
+        int count = static_cast<int>(sep_wire_list.size());
+        std::vector<TopoDS_Shape> faces(count);
+        parallelFor(count, [&](int i) {
+            faces[i] = makeFace(sep_wire_list[i]);
+        });
+
         TopoDS_Compound comp;
         BRep_Builder builder;
         builder.MakeCompound(comp);
-        for (auto & it : sep_wire_list) {
-            TopoDS_Shape aFace = makeFace(it);
-            if (!aFace.IsNull())
-                builder.Add(comp, aFace);
+        for (const TopoDS_Shape& face : faces) {
+            if (!face.IsNull())
+                builder.Add(comp, face);
         }
 
         return TopoDS_Shape(std::move(comp));
@@ -43,18 +43,24 @@
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <exception>
 
 // STL
 #include <array>
 #include <fcntl.h>
 #include <fstream>
+#include <future>
+#include <limits>
 #include <list>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 // Qt
@@ -70,6 +76,7 @@
 
 // OpenCasCade
 #include "OpenCascadeAll.h"
+#include <OSD_Parallel.hxx>
 
 #elif defined(FC_OS_WIN32)
 #define WIN32_LEAN_AND_MEAN
@@ -21,6 +21,9 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+# include <unordered_map>
+#endif
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -49,18 +52,12 @@ TYPESYSTEM_SOURCE(Part::PropertyGeometryList, App::PropertyLists)
 
 PropertyGeometryList::PropertyGeometryList() = default;
 
-PropertyGeometryList::~PropertyGeometryList()
-{
-    for (auto it : _lValueList) {
-        if (it) delete it;
-    }
-}
+PropertyGeometryList::~PropertyGeometryList() = default;
 
 void PropertyGeometryList::setSize(int newSize)
 {
-    for (unsigned int i = newSize; i < _lValueList.size(); i++)
-        delete _lValueList[i];
     _lValueList.resize(newSize);
+    _lValueShared.resize(newSize);
 }
 
 int PropertyGeometryList::getSize() const
@@ -71,34 +68,77 @@ int PropertyGeometryList::getSize() const
 void PropertyGeometryList::setValue(const Geometry* lValue)
 {
     if (lValue) {
-        aboutToSetValue();
-        Geometry* newVal = lValue->clone();
-        for (auto it : _lValueList)
-            delete it;
-        _lValueList.resize(1);
-        _lValueList[0] = newVal;
-        hasSetValue();
+        std::vector<std::shared_ptr<Geometry>> values;
+        values.emplace_back(lValue->clone());
+        setSharedValues(std::move(values));
     }
 }
 
 void PropertyGeometryList::setValues(const std::vector<Geometry*>& lValue)
 {
-    auto copy = lValue;
-    for(auto &geo : copy) // copy of the individual geometry pointers
-        geo = geo->clone();
-
-    setValues(std::move(copy));
+    setSharedValues(shareValues(lValue, true));
 }
 
 void PropertyGeometryList::setValues(std::vector<Geometry*> &&lValue)
+{
+    setSharedValues(shareValues(lValue, false));
+}
+
+std::vector<std::shared_ptr<Geometry>>
+PropertyGeometryList::shareValues(const std::vector<Geometry*>& lValue, bool copy) const
+{
+    // Mostly the list is passed again with a few geometries replaced, added or removed at
+    // the end, so the position is checked first before the lookup table is built
+    std::unordered_map<const Geometry*, std::size_t> index;
+    std::vector<bool> used(copy ? _lValueList.size() : 0, false);
+    auto findOwn = [&](std::size_t pos, const Geometry* geo) -> std::size_t {
+        if (pos < _lValueList.size() && _lValueList[pos] == geo) {
+            return pos;
+        }
+        if (index.empty()) {
+            index.reserve(_lValueList.size());
+            for (std::size_t i = 0; i < _lValueList.size(); i++) {
+                index.emplace(_lValueList[i], i);
+            }
+        }
+        auto it = index.find(geo);
+        return it != index.end() ? it->second : _lValueList.size();
+    };
+
+    std::vector<std::shared_ptr<Geometry>> values;
+    values.reserve(lValue.size());
+    for (std::size_t i = 0; i < lValue.size(); i++) {
+        Geometry* geo = lValue[i];
+        std::size_t pos = geo ? findOwn(i, geo) : _lValueList.size();
+        if (pos < _lValueList.size() && !(copy && used[pos])) {
+            // a geometry passed twice by the caller gets its own copy, like any other
+            if (copy) {
+                used[pos] = true;
+            }
+            values.push_back(_lValueShared[pos]);
+        }
+        else if (copy && geo) {
+            values.emplace_back(geo->clone());
+        }
+        else {
+            values.emplace_back(geo);
+        }
+    }
+
+    return values;
+}
+
+void PropertyGeometryList::setSharedValues(std::vector<std::shared_ptr<Geometry>>&& values)
 {
     aboutToSetValue();
-    std::set<Geometry*> valueSet(_lValueList.begin(),_lValueList.end());
-    for(auto v : lValue)
-        valueSet.erase(v);
-    _lValueList = std::move(lValue);
-    for(auto v : valueSet)
-        delete v;
+    std::vector<Geometry*> list;
+    list.reserve(values.size());
+    for (const auto& it : values) {
+        list.push_back(it.get());
+    }
+    _lValueList = std::move(list);
+    // the geometries that are neither in the new list nor in a copy are deleted here
+    _lValueShared = std::move(values);
     hasSetValue();
 }
 
@@ -107,11 +147,14 @@ void PropertyGeometryList::set1Value(int idx, std::unique_ptr<Geometry> &&lValue
     if(idx>=(int)_lValueList.size())
         throw Base::IndexError("Index out of bound");
     aboutToSetValue();
-    if(idx < 0)
-        _lValueList.push_back(lValue.release());
+    std::shared_ptr<Geometry> value(lValue.release());
+    if(idx < 0) {
+        _lValueList.push_back(value.get());
+        _lValueShared.push_back(std::move(value));
+    }
     else {
-        delete _lValueList[idx];
-        _lValueList[idx] = lValue.release();
+        _lValueList[idx] = value.get();
+        _lValueShared[idx] = std::move(value);
     }
     hasSetValue();
 }
@@ -245,15 +288,18 @@ void PropertyGeometryList::Restore(Base::XMLReader &reader)
 
 App::Property *PropertyGeometryList::Copy() const
 {
+    // the geometries are shared, only the list itself is copied
     PropertyGeometryList *p = new PropertyGeometryList();
-    p->setValues(_lValueList);
+    p->_lValueList = _lValueList;
+    p->_lValueShared = _lValueShared;
     return p;
 }
 
 void PropertyGeometryList::Paste(const Property &from)
 {
     const PropertyGeometryList& FromList = dynamic_cast<const PropertyGeometryList&>(from);
-    setValues(FromList._lValueList);
+    std::vector<std::shared_ptr<Geometry>> values = FromList._lValueShared;
+    setSharedValues(std::move(values));
 }
 
 unsigned int PropertyGeometryList::getMemSize() const
@@ -23,6 +23,7 @@
 #ifndef APP_PropertyGeometryList_H
 #define APP_PropertyGeometryList_H
 
+#include <memory>
 #include <vector>
 
 #include <App/Property.h>
@@ -59,6 +60,10 @@ public:
     int getSize() const override;
 
     /** Sets the property
+     * The geometries are shared between the copies of the property (e.g. in the undo
+     * history), so they must not be changed once they are in the list. Geometries of
+     * this list that are passed again are kept, all others are copied or, for the
+     * rvalue version, taken over.
      */
     void setValue(const Geometry*);
     void setValues(const std::vector<Geometry*>&);
@@ -89,9 +94,13 @@ public:
 private:
     void trySaveGeometry(Geometry * geom, Base::Writer &writer) const;
     void tryRestoreGeometry(Geometry * geom, Base::XMLReader &reader);
+    std::vector<std::shared_ptr<Geometry>> shareValues(const std::vector<Geometry*>&, bool copy) const;
+    void setSharedValues(std::vector<std::shared_ptr<Geometry>>&&);
 
 private:
     std::vector<Geometry*> _lValueList;
+    /// owns the geometries of _lValueList
+    std::vector<std::shared_ptr<Geometry>> _lValueShared;
 };
 
 } // namespace Part
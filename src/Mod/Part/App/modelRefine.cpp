@@ -24,6 +24,7 @@
 
 #ifndef _PreComp_
 # include <algorithm>
+# include <future>
 # include <iterator>
 # include <Bnd_Box.hxx>
 # include <BRep_Builder.hxx>
@@ -67,6 +68,8 @@
 # include <TopTools_ListOfShape.hxx>
 #endif // _PreComp_
 
+#include <boost_geometry.hpp>
+
 #include <Base/Console.h>
 
 #include "modelRefine.h"
@@ -74,6 +77,9 @@
 
 using namespace ModelRefine;
 
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
 
 void ModelRefine::getFaceEdges(const TopoDS_Face &face, EdgeVectorType &edges)
 {
@@ -85,33 +91,50 @@ void ModelRefine::getFaceEdges(const TopoDS_Face &face, EdgeVectorType &edges)
 void ModelRefine::boundaryEdges(const FaceVectorType &faces, EdgeVectorType &edgesOut)
 {
     //this finds all the boundary edges. Maybe more than one boundary.
-    std::list<TopoDS_Edge> edges;
+    //an edge shared by two faces of the group cancels out. An edge that is
+    //used an odd number of times is a boundary edge, it is kept in the order
+    //and with the orientation of its last use.
+    struct EdgeUse
+    {
+        TopoDS_Edge edge;
+        std::size_t position = 0;
+        bool odd = false;
+    };
+    TopTools_IndexedMapOfShape edgeMap;
+    std::vector<EdgeUse> uses;
+    std::size_t position(0);
     FaceVectorType::const_iterator faceIt;
     for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt)
     {
-        EdgeVectorType faceEdges;
-        EdgeVectorType::iterator faceEdgesIt;
-        getFaceEdges(*faceIt, faceEdges);
-        for (faceEdgesIt = faceEdges.begin(); faceEdgesIt != faceEdges.end(); ++faceEdgesIt)
+        TopExp_Explorer it;
+        for (it.Init(*faceIt, TopAbs_EDGE); it.More(); it.Next())
         {
-            bool foundSignal(false);
-            std::list<TopoDS_Edge>::iterator edgesIt;
-            for (edgesIt = edges.begin(); edgesIt != edges.end(); ++edgesIt)
+            int index = edgeMap.Add(it.Current());
+            if (index > static_cast<int>(uses.size()))
+                uses.resize(index);
+            EdgeUse &use = uses[index - 1];
+            use.odd = !use.odd;
+            if (use.odd)
             {
-                if ((*edgesIt).IsSame(*faceEdgesIt))
-                {
-                    edgesIt = edges.erase(edgesIt);
-                    foundSignal = true;
-                    break;
-                }
+                use.edge = TopoDS::Edge(it.Current());
+                use.position = position++;
             }
-            if (!foundSignal)
-                edges.push_back(*faceEdgesIt);
         }
     }
 
-    edgesOut.reserve(edges.size());
-    std::copy(edges.begin(), edges.end(), back_inserter(edgesOut));
+    std::vector<const EdgeUse*> edges;
+    for (const auto &use : uses)
+    {
+        if (use.odd)
+            edges.push_back(&use);
+    }
+    std::sort(edges.begin(), edges.end(), [](const EdgeUse *a, const EdgeUse *b) {
+        return a->position < b->position;
+    });
+
+    edgesOut.reserve(edgesOut.size() + edges.size());
+    for (const auto &use : edges)
+        edgesOut.push_back(use->edge);
 }
 
 TopoDS_Shell ModelRefine::removeFaces(const TopoDS_Shell &shell, const FaceVectorType &faces)
@@ -183,70 +206,104 @@ const FaceVectorType& FaceTypeSplitter::getTypedFaceVector(const GeomAbs_Surface
 
 FaceAdjacencySplitter::FaceAdjacencySplitter(const TopoDS_Shell &shell)
 {
+    TopTools_IndexedDataMapOfShapeListOfShape edgeToFaceMap;
+    TopExp::MapShapesAndAncestors(shell, TopAbs_EDGE, TopAbs_FACE, edgeToFaceMap);
+
     TopExp_Explorer shellIt;
     for (shellIt.Init(shell, TopAbs_FACE); shellIt.More(); shellIt.Next())
+        faceMap.Add(shellIt.Current());
+
+    //index 0 is unused to match the one based indices of the map.
+    adjacentFaces.resize(faceMap.Extent() + 1);
+    for (int index = 1; index <= faceMap.Extent(); ++index)
     {
-        TopTools_ListOfShape shapeList;
+        std::vector<int> &adjacent = adjacentFaces[index];
         TopExp_Explorer it;
-        for (it.Init(shellIt.Current(), TopAbs_EDGE); it.More(); it.Next())
-            shapeList.Append(it.Current());
-        faceToEdgeMap.Add(shellIt.Current(), shapeList);
+        for (it.Init(faceMap(index), TopAbs_EDGE); it.More(); it.Next())
+        {
+            const TopTools_ListOfShape &faces = edgeToFaceMap.FindFromKey(it.Current());
+            TopTools_ListIteratorOfListOfShape faceIt;
+            for (faceIt.Initialize(faces); faceIt.More(); faceIt.Next())
+            {
+                int other = faceMap.FindIndex(faceIt.Value());
+                if (other != index)
+                    adjacent.push_back(other);
+            }
+        }
     }
-    TopExp::MapShapesAndAncestors(shell, TopAbs_EDGE, TopAbs_FACE, edgeToFaceMap);
+    facesInStamps.resize(adjacentFaces.size(), 0);
+    processedStamps.resize(adjacentFaces.size(), 0);
 }
 
 
 void FaceAdjacencySplitter::split(const FaceVectorType &facesIn)
 {
-    facesInMap.Clear();
-    processedMap.Clear();
     adjacencyArray.clear();
 
+    //a new stamp marks the faces of this call, so the markers of the
+    //previous calls don't have to be cleared.
+    if (++stamp == 0)
+    {
+        std::fill(facesInStamps.begin(), facesInStamps.end(), 0);
+        std::fill(processedStamps.begin(), processedStamps.end(), 0);
+        stamp = 1;
+    }
+
+    std::vector<int> indices;
+    indices.reserve(facesIn.size());
     FaceVectorType::const_iterator it;
     for (it = facesIn.begin(); it != facesIn.end(); ++it)
-        facesInMap.Add(*it);
-    //the reserve call guarantees the vector will never get "pushed back" in the
-    //recursiveFind calls, thus invalidating the iterators. We can be sure of this as any one
-    //matched set can't be bigger than the set passed in. if we have seg faults, we will
-    //want to turn this tempFaces vector back into a std::list ensuring valid iterators
-    //at the expense of std::find speed.
-    FaceVectorType tempFaces;
-    tempFaces.reserve(facesIn.size() + 1);
+    {
+        int index = faceMap.FindIndex(*it);
+        indices.push_back(index);
+        if (index > 0)
+            facesInStamps[index] = stamp;
+    }
 
-    for (it = facesIn.begin(); it != facesIn.end(); ++it)
+    //depth first search with an explicit stack. The faces are collected in the
+    //same order as a recursive search would do.
+    std::vector<std::pair<int, std::size_t>> stack;
+    FaceVectorType tempFaces;
+    for (std::size_t i = 0; i < facesIn.size(); ++i)
     {
+        int index = indices[i];
+        //faces not part of the shell have no neighbours.
+        if (index == 0)
+            continue;
         //skip already processed shapes.
-        if (processedMap.Contains(*it))
+        if (processedStamps[index] == stamp)
             continue;
 
         tempFaces.clear();
-        processedMap.Add(*it);
-        recursiveFind(*it, tempFaces);
-        if (tempFaces.size() > 1)
+        processedStamps[index] = stamp;
+        tempFaces.push_back(facesIn[i]);
+        stack.emplace_back(index, 0);
+        while (!stack.empty())
         {
-            adjacencyArray.push_back(tempFaces);
-        }
-    }
-}
+            const std::vector<int> &adjacent = adjacentFaces[stack.back().first];
+            std::size_t &next = stack.back().second;
+            while (next < adjacent.size())
+            {
+                int other = adjacent[next];
+                if (facesInStamps[other] == stamp && processedStamps[other] != stamp)
+                    break;
+                ++next;
+            }
+            if (next == adjacent.size())
+            {
+                stack.pop_back();
+                continue;
+            }
 
-void FaceAdjacencySplitter::recursiveFind(const TopoDS_Face &face, FaceVectorType &outVector)
-{
-    outVector.push_back(face);
+            int other = adjacent[next++];
+            processedStamps[other] = stamp;
+            tempFaces.push_back(TopoDS::Face(faceMap(other)));
+            stack.emplace_back(other, 0);
+        }
 
-    const TopTools_ListOfShape &edges = faceToEdgeMap.FindFromKey(face);
-    TopTools_ListIteratorOfListOfShape edgeIt;
-    for (edgeIt.Initialize(edges); edgeIt.More(); edgeIt.Next())
-    {
-        const TopTools_ListOfShape &faces = edgeToFaceMap.FindFromKey(edgeIt.Value());
-        TopTools_ListIteratorOfListOfShape faceIt;
-        for (faceIt.Initialize(faces); faceIt.More(); faceIt.Next())
+        if (tempFaces.size() > 1)
         {
-            if (!facesInMap.Contains(faceIt.Value()))
-                continue;
-            if (processedMap.Contains(faceIt.Value()))
-                continue;
-            processedMap.Add(faceIt.Value());
-            recursiveFind(TopoDS::Face(faceIt.Value()), outVector);
+            adjacencyArray.push_back(tempFaces);
         }
     }
 }
@@ -255,26 +312,59 @@ void FaceAdjacencySplitter::recursiveFind(const TopoDS_Face &face, FaceVectorTyp
 
 void FaceEqualitySplitter::split(const FaceVectorType &faces, FaceTypedBase *object)
 {
+    using Point = bg::model::point<double, 3, bg::cs::cartesian>;
+    using Box = bg::model::box<Point>;
+    using Value = std::pair<Point, std::size_t>;
+
+    //the groups are indexed by the key point of their first face. A face is
+    //only compared with the groups whose key point is within its tolerance and
+    //with the groups without a key point. The candidates are tested in the order
+    //the groups were created, so the result is the same as comparing with all groups.
     std::vector<FaceVectorType> tempVector;
-    tempVector.reserve(faces.size());
+    bgi::rtree<Value, bgi::linear<16>> keyedGroups;
+    std::vector<std::size_t> unkeyedGroups;
+    std::vector<std::size_t> candidates;
     FaceVectorType::const_iterator faceIt;
     for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt)
     {
+        gp_Pnt key;
+        double tolerance(0.0);
+        bool hasKey = object->getKeyPoint(*faceIt, key, tolerance);
+
+        candidates.clear();
+        if (hasKey)
+        {
+            Box box(Point(key.X() - tolerance, key.Y() - tolerance, key.Z() - tolerance),
+                    Point(key.X() + tolerance, key.Y() + tolerance, key.Z() + tolerance));
+            for (auto it = keyedGroups.qbegin(bgi::intersects(box)); it != keyedGroups.qend(); ++it)
+                candidates.push_back(it->second);
+            candidates.insert(candidates.end(), unkeyedGroups.begin(), unkeyedGroups.end());
+            std::sort(candidates.begin(), candidates.end());
+        }
+        else
+        {
+            candidates.resize(tempVector.size());
+            for (std::size_t index = 0; index < candidates.size(); ++index)
+                candidates[index] = index;
+        }
+
         bool foundMatch(false);
-        std::vector<FaceVectorType>::iterator tempIt;
-        for (tempIt = tempVector.begin(); tempIt != tempVector.end(); ++tempIt)
+        for (std::size_t index : candidates)
         {
-            if (object->isEqual((*tempIt).front(), *faceIt))
+            if (object->isEqual(tempVector[index].front(), *faceIt))
             {
-                (*tempIt).push_back(*faceIt);
+                tempVector[index].push_back(*faceIt);
                 foundMatch = true;
                 break;
             }
         }
         if (!foundMatch)
         {
+            if (hasKey)
+                keyedGroups.insert(Value(Point(key.X(), key.Y(), key.Z()), tempVector.size()));
+            else
+                unkeyedGroups.push_back(tempVector.size());
             FaceVectorType another;
-            another.reserve(faces.size());
             another.push_back(*faceIt);
             tempVector.push_back(another);
         }
@@ -297,6 +387,11 @@ GeomAbs_SurfaceType FaceTypedBase::getFaceType(const TopoDS_Face &faceIn)
     return surfaceTest.GetType();
 }
 
+bool FaceTypedBase::getKeyPoint(const TopoDS_Face &/*face*/, gp_Pnt &/*point*/, double &/*tolerance*/) const
+{
+    return false;
+}
+
 void FaceTypedBase::boundarySplit(const FaceVectorType &facesIn, std::vector<EdgeVectorType> &boundariesOut) const
 {
     EdgeVectorType bEdges;
@@ -381,6 +476,23 @@ bool FaceTypedPlane::isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &face
             planeOne.Distance(planeTwo.Position().Location()) < Precision::Confusion());
 }
 
+bool FaceTypedPlane::getKeyPoint(const TopoDS_Face &face, gp_Pnt &point, double &tolerance) const
+{
+    Handle(Geom_Plane) planeSurface = getGeomPlane(face);
+    if (planeSurface.IsNull())
+        return false;
+
+    //the point of the plane closest to the origin doesn't depend on the
+    //orientation of the normal. The tolerance covers the angular deviation
+    //that isEqual accepts at the distance of the plane location.
+    gp_Pln plane(planeSurface->Pln());
+    gp_XYZ normal = plane.Position().Direction().XYZ();
+    gp_XYZ location = plane.Location().XYZ();
+    point.SetXYZ(normal * normal.Dot(location));
+    tolerance = 4.0 * Precision::Confusion() * (1.0 + location.Modulus());
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedPlane::getType() const
 {
     return GeomAbs_Plane;
@@ -477,6 +589,21 @@ bool FaceTypedCylinder::isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &f
     return true;
 }
 
+bool FaceTypedCylinder::getKeyPoint(const TopoDS_Face &face, gp_Pnt &point, double &tolerance) const
+{
+    Handle(Geom_CylindricalSurface) surface = getGeomCylinder(face);
+    if (surface.IsNull())
+        return false;
+
+    //the point of the axis closest to the origin.
+    gp_Ax1 axis = surface->Cylinder().Axis();
+    gp_XYZ direction = axis.Direction().XYZ();
+    gp_XYZ location = axis.Location().XYZ();
+    point.SetXYZ(location - direction * direction.Dot(location));
+    tolerance = 4.0 * (Precision::Confusion() + Precision::Angular() * (1.0 + location.Modulus()));
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedCylinder::getType() const
 {
     return GeomAbs_Cylinder;
@@ -955,6 +1082,18 @@ bool FaceTypedBSpline::isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &fa
   return false;
 }
 
+bool FaceTypedBSpline::getKeyPoint(const TopoDS_Face &face, gp_Pnt &point, double &tolerance) const
+{
+    Handle(Geom_BSplineSurface) surface = Handle(Geom_BSplineSurface)::DownCast(BRep_Tool::Surface(face));
+    if (surface.IsNull())
+        return false;
+
+    //equal surfaces have all poles within the confusion tolerance.
+    point = surface->Pole(1, 1);
+    tolerance = 2.0 * Precision::Confusion();
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedBSpline::getType() const
 {
     return GeomAbs_BSplineSurface;
@@ -1048,13 +1187,27 @@ bool FaceUniter::process()
     ModelRefine::FaceVectorType facesToRemove;
     ModelRefine::FaceVectorType facesToSew;
 
+    //the surface types are independent, so the faces of each type are grouped
+    //by their surfaces in parallel. Building the new faces stays sequential as
+    //fixing a face can change the tolerances of the edges shared with other faces.
+    std::vector<std::future<ModelRefine::FaceEqualitySplitter>> equalitySplits;
+    for(typeIt = typeObjects.begin(); typeIt != typeObjects.end(); ++typeIt)
+    {
+        FaceTypedBase *object = *typeIt;
+        const ModelRefine::FaceVectorType &typedFaces = splitter.getTypedFaceVector(object->getType());
+        equalitySplits.push_back(std::async(std::launch::async, [object, &typedFaces]() {
+            ModelRefine::FaceEqualitySplitter equalitySplitter;
+            equalitySplitter.split(typedFaces, object);
+            return equalitySplitter;
+        }));
+    }
+
     ModelRefine::FaceAdjacencySplitter adjacencySplitter(workShell);
 
-    for(typeIt = typeObjects.begin(); typeIt != typeObjects.end(); ++typeIt)
+    for(std::size_t typeIndex = 0; typeIndex < typeObjects.size(); ++typeIndex)
     {
-        ModelRefine::FaceVectorType typedFaces = splitter.getTypedFaceVector((*typeIt)->getType());
-        ModelRefine::FaceEqualitySplitter equalitySplitter;
-        equalitySplitter.split(typedFaces, *typeIt);
+        typeIt = typeObjects.begin() + typeIndex;
+        ModelRefine::FaceEqualitySplitter equalitySplitter = equalitySplits[typeIndex].get();
         for (std::size_t indexEquality(0); indexEquality < equalitySplitter.getGroupCount(); ++indexEquality)
         {
             adjacencySplitter.split(equalitySplitter.getGroup(indexEquality));
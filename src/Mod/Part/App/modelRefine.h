@@ -33,9 +33,11 @@
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shell.hxx>
+#include <gp_Pnt.hxx>
 
 #include <TopTools_DataMapOfShapeListOfShape.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
 
@@ -63,6 +65,12 @@ namespace ModelRefine
         virtual bool isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &faceTwo) const = 0;
         virtual GeomAbs_SurfaceType getType() const = 0;
         virtual TopoDS_Face buildFace(const FaceVectorType &faces) const = 0;
+        /*!
+         * A point that only depends on the underlying surface, so that faces that are
+         * equal have key points closer than the returned tolerance. Returns false if
+         * the face has no such point, it is then compared with all other faces.
+         */
+        virtual bool getKeyPoint(const TopoDS_Face &face, gp_Pnt &point, double &tolerance) const;
 
         static GeomAbs_SurfaceType getFaceType(const TopoDS_Face &faceIn);
 
@@ -79,9 +87,10 @@ namespace ModelRefine
         bool isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &faceTwo) const override;
         GeomAbs_SurfaceType getType() const override;
         TopoDS_Face buildFace(const FaceVectorType &faces) const override;
-        friend FaceTypedPlane& getPlaneObject();
+        bool getKeyPoint(const TopoDS_Face &face, gp_Pnt &point, double &tolerance) const override;
+        friend PartExport FaceTypedPlane& getPlaneObject();
     };
-    FaceTypedPlane& getPlaneObject();
+    PartExport FaceTypedPlane& getPlaneObject();
 
     class FaceTypedCylinder : public FaceTypedBase
     {
@@ -91,12 +100,13 @@ namespace ModelRefine
         bool isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &faceTwo) const override;
         GeomAbs_SurfaceType getType() const override;
         TopoDS_Face buildFace(const FaceVectorType &faces) const override;
-        friend FaceTypedCylinder& getCylinderObject();
+        bool getKeyPoint(const TopoDS_Face &face, gp_Pnt &point, double &tolerance) const override;
+        friend PartExport FaceTypedCylinder& getCylinderObject();
 
     protected:
         void boundarySplit(const FaceVectorType &facesIn, std::vector<EdgeVectorType> &boundariesOut) const override;
     };
-    FaceTypedCylinder& getCylinderObject();
+    PartExport FaceTypedCylinder& getCylinderObject();
 
     class FaceTypedBSpline : public FaceTypedBase
     {
@@ -106,9 +116,10 @@ namespace ModelRefine
         bool isEqual(const TopoDS_Face &faceOne, const TopoDS_Face &faceTwo) const override;
         GeomAbs_SurfaceType getType() const override;
         TopoDS_Face buildFace(const FaceVectorType &faces) const override;
-        friend FaceTypedBSpline& getBSplineObject();
+        bool getKeyPoint(const TopoDS_Face &face, gp_Pnt &point, double &tolerance) const override;
+        friend PartExport FaceTypedBSpline& getBSplineObject();
     };
-    FaceTypedBSpline& getBSplineObject();
+    PartExport FaceTypedBSpline& getBSplineObject();
 
     class FaceTypeSplitter
     {
@@ -135,16 +146,17 @@ namespace ModelRefine
 
     private:
         FaceAdjacencySplitter() = default;
-        void recursiveFind(const TopoDS_Face &face, FaceVectorType &outVector);
         std::vector<FaceVectorType> adjacencyArray;
-        TopTools_MapOfShape processedMap;
-        TopTools_MapOfShape facesInMap;
 
-        TopTools_IndexedDataMapOfShapeListOfShape faceToEdgeMap;
-        TopTools_IndexedDataMapOfShapeListOfShape edgeToFaceMap;
+        //the adjacency of the shell is built once and used for all groups.
+        TopTools_IndexedMapOfShape faceMap;
+        std::vector<std::vector<int>> adjacentFaces;
+        std::vector<unsigned> facesInStamps;
+        std::vector<unsigned> processedStamps;
+        unsigned stamp = 0;
     };
 
-    class FaceEqualitySplitter
+    class PartExport FaceEqualitySplitter
     {
     public:
         FaceEqualitySplitter() = default;
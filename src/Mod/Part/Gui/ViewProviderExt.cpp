@@ -79,6 +79,7 @@
 
 #include <Gui/BitmapFactory.h>
 #include <Gui/Control.h>
+#include <Gui/SoFCLevelOfDetail.h>
 #include <Gui/SoFCSelectionAction.h>
 #include <Gui/SoFCUnifiedSelection.h>
 #include <Gui/ViewParams.h>
@@ -212,6 +213,9 @@ ViewProviderPartExt::ViewProviderPartExt()
     nodeset = new SoBrepPointSet();
     nodeset->ref();
 
+    auto coarse = new SoBrepFaceSet();
+    lod = std::make_unique<Gui::LevelOfDetailBuilder>(coarse, &coarse->partIndex);
+
     pcFaceBind = new SoMaterialBinding();
     pcFaceBind->ref();
 
@@ -431,7 +435,7 @@ void ViewProviderPartExt::attach(App::DocumentObject *pcFeat)
     wireframe->addChild(pcLineBind);
     wireframe->addChild(pcLineMaterial);
     wireframe->addChild(pcLineStyle);
-    wireframe->addChild(lineset);
+    wireframe->addChild(lod->createNode(lineset, false));
 
     // normal viewing with edges and points
     pcNormalRoot->addChild(pcPointsRoot);
@@ -449,7 +453,7 @@ void ViewProviderPartExt::attach(App::DocumentObject *pcFeat)
     pcFlatRoot->addChild(pcFaceStyle);
     pcFlatRoot->addChild(norm);
     pcFlatRoot->addChild(normb);
-    pcFlatRoot->addChild(faceset);
+    pcFlatRoot->addChild(lod->createNode(faceset, true));
 
     // edges and points
     pcWireframeRoot->addChild(wireframe);
@@ -459,7 +463,7 @@ void ViewProviderPartExt::attach(App::DocumentObject *pcFeat)
     pcPointsRoot->addChild(pcPointBind);
     pcPointsRoot->addChild(pcPointMaterial);
     pcPointsRoot->addChild(pcPointStyle);
-    pcPointsRoot->addChild(nodeset);
+    pcPointsRoot->addChild(lod->createNode(nodeset, false));
 
     // Move 'coords' before the switch
     pcRoot->insertChild(coords,pcRoot->findChild(pcModeSwitch));
@@ -940,6 +944,7 @@ void ViewProviderPartExt::updateVisual()
         faceset ->partIndex  .setNum(0);
         lineset ->coordIndex .setNum(0);
         nodeset ->startIndex .setValue(0);
+        lod->clear();
         VisualTouched = false;
         return;
     }
@@ -1294,6 +1299,13 @@ void ViewProviderPartExt::updateVisual()
         faceset ->coordIndex  .finishEditing();
         faceset ->partIndex   .finishEditing();
         lineset ->coordIndex  .finishEditing();
+
+        const SbVec3f* points = coords->point.getValues(0);
+        const int32_t* faces = faceset->coordIndex.getValues(0);
+        const int32_t* parts = faceset->partIndex.getValues(0);
+        lod->update(std::vector<SbVec3f>(points, points + coords->point.getNum()),
+                    std::vector<int32_t>(faces, faces + faceset->coordIndex.getNum()),
+                    std::vector<int32_t>(parts, parts + faceset->partIndex.getNum()));
     }
     catch (const Standard_Failure& e) {
         FC_ERR("Cannot compute Inventor representation for the shape of "
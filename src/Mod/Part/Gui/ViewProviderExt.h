@@ -24,6 +24,7 @@
 #define PARTGUI_VIEWPROVIDERPARTEXT_H
 
 #include <map>
+#include <memory>
 
 #include <App/PropertyUnits.h>
 #include <Gui/ViewProviderGeometryObject.h>
@@ -54,6 +55,10 @@ class SoNormalBinding;
 class SoMaterialBinding;
 class SoIndexedLineSet;
 
+namespace Gui {
+class LevelOfDetailBuilder;
+}
+
 namespace PartGui {
 
 class SoBrepFaceSet;
@@ -189,6 +194,8 @@ protected:
 
 private:
     Gui::ViewProviderFaceTexture texture;
+    // coarse faces shown while navigating
+    std::unique_ptr<Gui::LevelOfDetailBuilder> lod;
     // settings stuff
     int forceUpdateCount;
     static App::PropertyFloatConstraint::Constraints sizeRange;
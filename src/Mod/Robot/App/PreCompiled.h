@@ -39,8 +39,15 @@
 #ifdef _PreComp_
 
 // STL
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <memory>
 #include <sstream>
+#include <thread>
+#include <vector>
+
+#include <Eigen/SVD>
 
 // kdl_cp
 #include "kdl_cp/chain.hpp"
@@ -48,6 +55,7 @@
 #include "kdl_cp/chainiksolverpos_nr.hpp"
 #include "kdl_cp/chainiksolverpos_nr_jl.hpp"
 #include "kdl_cp/chainiksolvervel_pinv.hpp"
+#include "kdl_cp/chainjnttojacsolver.hpp"
 #include "kdl_cp/frames_io.hpp"
 #include "kdl_cp/path_line.hpp"
 #include "kdl_cp/path_roundedcomposite.hpp"
@@ -77,6 +77,29 @@ public:
     bool calcTcp();
     Base::Placement getTcp();
 
+    /// the kinematic chain as used by the solvers
+    const KDL::Chain& getKinematic() const
+    {
+        return Kinematic;
+    }
+    /// the actual joint values in radian
+    const KDL::JntArray& getJoints() const
+    {
+        return Actual;
+    }
+    const KDL::JntArray& getMinJoints() const
+    {
+        return Min;
+    }
+    const KDL::JntArray& getMaxJoints() const
+    {
+        return Max;
+    }
+    double getRotDir(int Axis) const
+    {
+        return RotDir[Axis];
+    }
+
     // void setKinematik(const std::vector<std::vector<float> > &KinTable);
 
 
@@ -22,12 +22,16 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <cstring>
 #include <sstream>
 #endif
 
 #include <Base/MatrixPy.h>
 #include <Base/PlacementPy.h>
 
+#include "TrajectoryPy.h"
+#include "TrajectorySolver.h"
+
 // clang-format off
 // inclusion of the generated files (generated out of Robot6AxisPy.xml)
 #include "Robot6AxisPy.h"
@@ -77,6 +81,67 @@ PyObject* Robot6AxisPy::check(PyObject* /*args*/)
     return nullptr;
 }
 
+PyObject* Robot6AxisPy::solveTrajectory(PyObject* args)
+{
+    PyObject* pcTrac = nullptr;
+    double sampleTime = 0.0;
+    PyObject* pcTool = nullptr;
+    const char* method = "Automatic";
+    if (!PyArg_ParseTuple(args,
+                          "O!|dO!s",
+                          &(TrajectoryPy::Type),
+                          &pcTrac,
+                          &sampleTime,
+                          &(Base::PlacementPy::Type),
+                          &pcTool,
+                          &method)) {
+        return nullptr;
+    }
+
+    TrajectorySolver solver(*getRobot6AxisPtr());
+    solver.setSampleTime(sampleTime);
+    if (pcTool) {
+        solver.setTool(*static_cast<Base::PlacementPy*>(pcTool)->getPlacementPtr());
+    }
+    if (strcmp(method, "Numeric") == 0) {
+        solver.setMethod(TrajectorySolver::Numeric);
+    }
+    else if (strcmp(method, "ClosedForm") == 0) {
+        if (!solver.hasClosedForm()) {
+            PyErr_SetString(PyExc_ValueError, "Robot has no spherical wrist");
+            return nullptr;
+        }
+        solver.setMethod(TrajectorySolver::ClosedForm);
+    }
+    else if (strcmp(method, "Automatic") != 0) {
+        PyErr_SetString(PyExc_ValueError, "Method must be 'Automatic', 'Numeric' or 'ClosedForm'");
+        return nullptr;
+    }
+
+    std::vector<IKResult> results;
+    Py_BEGIN_ALLOW_THREADS
+    results = solver.solve(*static_cast<TrajectoryPy*>(pcTrac)->getTrajectoryPtr());
+    Py_END_ALLOW_THREADS
+
+    Py::List list;
+    for (const auto& it : results) {
+        Py::Dict dict;
+        dict.setItem("Waypoint", Py::Long(it.waypoint));
+        dict.setItem("Time", Py::Float(it.time));
+        dict.setItem("Reachable", Py::Boolean(it.reachable));
+        dict.setItem("WithinLimits", Py::Boolean(it.withinLimits));
+        dict.setItem("Singular", Py::Boolean(it.singular));
+        dict.setItem("Manipulability", Py::Float(it.manipulability));
+        Py::Tuple axis(6);
+        for (int i = 0; i < 6; i++) {
+            axis.setItem(i, Py::Float(it.axis[i]));
+        }
+        dict.setItem("Axis", axis);
+        list.append(dict);
+    }
+    return Py::new_reference_to(list);
+}
+
 
 Py::Float Robot6AxisPy::getAxis1() const
 {
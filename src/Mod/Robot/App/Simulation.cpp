@@ -21,8 +21,12 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#endif
 
 #include "Simulation.h"
+#include "TrajectorySolver.h"
 
 
 using namespace Robot;
@@ -61,9 +65,71 @@ void Simulation::step(double tick)
 void Simulation::setToWaypoint(unsigned int)
 {}
 
+void Simulation::precompute(double tick)
+{
+    precomputedAxis.clear();
+    if (tick <= 0.0) {
+        return;
+    }
+
+    TrajectorySolver solver(Rob);
+    solver.setSampleTime(tick);
+    solver.setTool(Tool);
+    for (const auto& it : solver.solve(Trac)) {
+        if (it.waypoint >= 0) {
+            continue;
+        }
+        if (!it.reachable) {
+            // fall back to solving tick by tick
+            precomputedAxis.clear();
+            return;
+        }
+        precomputedAxis.push_back({it.axis[0],
+                                   it.axis[1],
+                                   it.axis[2],
+                                   it.axis[3],
+                                   it.axis[4],
+                                   it.axis[5]});
+    }
+    precomputedTick = tick;
+    precomputedTool = Tool;
+}
+
+bool Simulation::getPrecomputed(double t, double axis[6]) const
+{
+    if (precomputedAxis.empty() || !(Tool == precomputedTool)) {
+        return false;
+    }
+
+    // interpolate linearly between the neighbouring samples
+    double pos = std::max(t, 0.0) / precomputedTick;
+    auto index = static_cast<std::size_t>(pos);
+    if (index + 1 >= precomputedAxis.size()) {
+        const auto& last = precomputedAxis.back();
+        std::copy(last.begin(), last.end(), axis);
+        return true;
+    }
+    double f = pos - static_cast<double>(index);
+    const auto& a1 = precomputedAxis[index];
+    const auto& a2 = precomputedAxis[index + 1];
+    for (int i = 0; i < 6; i++) {
+        axis[i] = a1[i] + f * (a2[i] - a1[i]);
+    }
+    return true;
+}
+
 void Simulation::setToTime(float t)
 {
     Pos = t;
+    double precomputed[6];
+    if (getPrecomputed(Pos, precomputed)) {
+        for (int i = 0; i < 6; i++) {
+            Rob.setAxis(i, precomputed[i]);
+            Axis[i] = precomputed[i];
+        }
+        return;
+    }
+
     Base::Placement NeededPos = Trac.getPosition(Pos);
     NeededPos = NeededPos * Tool.inverse();
     Rob.setTo(NeededPos);
@@ -23,6 +23,9 @@
 #ifndef _Simulation_h_
 #define _Simulation_h_
 
+#include <array>
+#include <vector>
+
 #include <Base/Placement.h>
 
 #include "Robot6Axis.h"
@@ -63,6 +66,8 @@ public:
     void step(double tick);
     void setToWaypoint(unsigned int n);
     void setToTime(float t);
+    /// solves the axes of the whole trajectory every \a tick seconds in advance
+    void precompute(double tick);
     // apply the start axis angles and set to time 0. Restores the exact start position
     void reset();
 
@@ -73,6 +78,14 @@ public:
     Trajectory Trac;
     Robot6Axis& Rob;
     Base::Placement Tool;
+
+private:
+    bool getPrecomputed(double t, double axis[6]) const;
+
+    // axes solved by precompute()
+    double precomputedTick {0.0};
+    Base::Placement precomputedTool;
+    std::vector<std::array<double, 6>> precomputedAxis;
 };
 
 
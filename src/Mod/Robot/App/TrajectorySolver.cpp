@@ -0,0 +1,440 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <Eigen/SVD>
+
+#include "kdl_cp/chainfksolverpos_recursive.hpp"
+#include "kdl_cp/chainiksolverpos_nr_jl.hpp"
+#include "kdl_cp/chainiksolvervel_pinv.hpp"
+#include "kdl_cp/chainjnttojacsolver.hpp"
+#endif
+
+#include "RobotAlgos.h"
+#include "Trajectory.h"
+#include "TrajectorySolver.h"
+
+
+using namespace Robot;
+
+namespace
+{
+const double Epsilon = 1e-9;
+
+double normalizeAngle(double angle)
+{
+    return std::atan2(std::sin(angle), std::cos(angle));
+}
+
+// Moves the angle by multiples of 2 pi as close to the seed as the limits allow
+double closestAngle(double angle, double seed, double lower, double upper)
+{
+    angle = seed + normalizeAngle(angle - seed);
+    double best = angle;
+    double bestDist = -1.0;
+    for (int k = -2; k <= 2; k++) {
+        double value = angle + 2.0 * M_PI * k;
+        if (value < lower - Epsilon || value > upper + Epsilon) {
+            continue;
+        }
+        double dist = std::fabs(value - seed);
+        if (bestDist < 0.0 || dist < bestDist) {
+            best = value;
+            bestDist = dist;
+        }
+    }
+    return best;
+}
+
+bool isSameFrame(const KDL::Frame& f1, const KDL::Frame& f2, double tolerance)
+{
+    return KDL::Equal(f1.p, f2.p, tolerance) && KDL::Equal(f1.M, f2.M, 1e-6);
+}
+
+bool isSameSolution(const KDL::JntArray& j1, const KDL::JntArray& j2)
+{
+    if (j1.rows() != j2.rows() || j1.rows() == 0) {
+        return false;
+    }
+    for (unsigned int i = 0; i < j1.rows(); i++) {
+        if (std::fabs(j1(i) - j2(i)) > 1e-8) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+TrajectorySolver::TrajectorySolver(const Robot6Axis& robot)
+    : robot(robot)
+    , chain(robot.getKinematic())
+    , seed(robot.getJoints())
+    , lower(chain.getNrOfJoints())
+    , upper(chain.getNrOfJoints())
+{
+    threads = std::max<int>(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    for (unsigned int i = 0; i < chain.getNrOfJoints(); i++) {
+        lower(i) = std::min(robot.getMinJoints()(i), robot.getMaxJoints()(i));
+        upper(i) = std::max(robot.getMinJoints()(i), robot.getMaxJoints()(i));
+    }
+
+    // a segment can be solved in closed form if it is a revolute joint about z followed by
+    // a Denavit-Hartenberg frame
+    closedForm = chain.getNrOfSegments() == 6 && chain.getNrOfJoints() == 6;
+    for (unsigned int i = 0; i < chain.getNrOfSegments(); i++) {
+        const KDL::Segment& segment = chain.getSegment(i);
+        const KDL::Frame& tip = segment.getFrameToTip();
+        reach += tip.p.Norm();
+        if (!closedForm) {
+            continue;
+        }
+
+        const KDL::Rotation& rot = tip.M;
+        DHParameter& param = dh[i];
+        param.theta = std::atan2(rot(1, 0), rot(0, 0));
+        param.alpha = std::atan2(rot(2, 1), rot(2, 2));
+        param.a = tip.p.x() * std::cos(param.theta) + tip.p.y() * std::sin(param.theta);
+        param.d = tip.p.z();
+        KDL::Frame frame = KDL::Frame::DH(param.a, param.alpha, param.d, param.theta);
+        if (segment.getJoint().getType() != KDL::Joint::RotZ || !isSameFrame(frame, tip, 1e-6)) {
+            closedForm = false;
+        }
+    }
+
+    // offset shoulder, planar arm and a spherical wrist
+    if (closedForm) {
+        auto isZero = [](double value) {
+            return std::fabs(value) < 1e-6;
+        };
+        closedForm = isZero(std::cos(dh[0].alpha)) && isZero(std::sin(dh[1].alpha))
+            && std::cos(dh[1].alpha) > 0.0 && isZero(dh[3].a) && isZero(dh[4].a)
+            && isZero(dh[4].d) && isZero(std::cos(dh[3].alpha)) && isZero(std::cos(dh[4].alpha))
+            && !isZero(dh[1].a);
+    }
+}
+
+bool TrajectorySolver::isWithinLimits(const KDL::JntArray& joints) const
+{
+    for (unsigned int i = 0; i < joints.rows(); i++) {
+        if (joints(i) < lower(i) - Epsilon || joints(i) > upper(i) + Epsilon) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double TrajectorySolver::getManipulability(const KDL::JntArray& joints) const
+{
+    KDL::ChainJntToJacSolver solver(chain);
+    KDL::Jacobian jac(chain.getNrOfJoints());
+    if (solver.JntToJac(joints, jac) < 0) {
+        return 0.0;
+    }
+
+    // make the translational rows dimensionless
+    Eigen::MatrixXd mat = jac.data;
+    if (reach > 0.0) {
+        mat.topRows(3) /= reach;
+    }
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd(mat);
+    const auto& values = svd.singularValues();
+    if (values.size() == 0 || values(0) <= 0.0) {
+        return 0.0;
+    }
+    return values(values.size() - 1) / values(0);
+}
+
+bool TrajectorySolver::solveClosedForm(const KDL::Frame& flange,
+                                       const KDL::JntArray& seed,
+                                       KDL::JntArray& joints,
+                                       bool& withinLimits) const
+{
+    // every segment is RotZ(q + theta) * TransZ(d) * TransX(a) * RotX(alpha)
+    const DHParameter& dh1 = dh[0];
+    const DHParameter& dh2 = dh[1];
+    const DHParameter& dh3 = dh[2];
+    const DHParameter& dh4 = dh[3];
+    const DHParameter& dh5 = dh[4];
+    const DHParameter& dh6 = dh[5];
+
+    // the wrist center is independent of the axes 4 to 6
+    KDL::Rotation toFlange = flange.M * KDL::Rotation::RotX(-dh6.alpha);
+    KDL::Vector wrist = flange.p - toFlange * KDL::Vector(dh6.a, 0.0, dh6.d);
+
+    // arm: the wrist center relative to the second axis in the plane of the arm
+    double s1 = std::sin(dh1.alpha);
+    double s3 = std::sin(dh3.alpha);
+    double c3 = std::cos(dh3.alpha);
+    double offset = dh2.d + dh3.d + dh4.d * c3;
+    double vx = dh3.a;
+    double vy = -dh4.d * s3;
+    double length = std::hypot(vx, vy);
+    double beta = std::atan2(vy, vx);
+    double radius2 = wrist.x() * wrist.x() + wrist.y() * wrist.y() - offset * offset;
+    if (radius2 < 0.0) {
+        return false;
+    }
+
+    struct Candidate
+    {
+        KDL::JntArray joints;
+        bool withinLimits;
+        double distance;
+    };
+    std::vector<Candidate> candidates;
+    KDL::ChainFkSolverPos_recursive fksolver(chain);
+
+    for (int shoulder : {1, -1}) {
+        double u = shoulder * std::sqrt(radius2);
+        double phi1 = std::atan2(wrist.y(), wrist.x()) - std::atan2(-s1 * offset, u);
+        double x1 = u - dh1.a;
+        double y1 = (wrist.z() - dh1.d) / s1;
+
+        double cosine = (x1 * x1 + y1 * y1 - dh2.a * dh2.a - length * length)
+            / (2.0 * dh2.a * length);
+        if (std::fabs(cosine) > 1.0 + 1e-9) {
+            continue;
+        }
+        cosine = std::clamp(cosine, -1.0, 1.0);
+
+        for (int elbow : {1, -1}) {
+            double phi3 = elbow * std::acos(cosine) - beta;
+            double wx = dh2.a + std::cos(phi3) * vx - std::sin(phi3) * vy;
+            double wy = std::sin(phi3) * vx + std::cos(phi3) * vy;
+            double phi2 = std::atan2(y1, x1) - std::atan2(wy, wx);
+
+            // wrist: the remaining rotation is RotZ(phi4) RotX(a4) RotZ(phi5) RotX(a5) RotZ(phi6)
+            KDL::Rotation arm = KDL::Rotation::RotZ(phi1) * KDL::Rotation::RotX(dh1.alpha)
+                * KDL::Rotation::RotZ(phi2) * KDL::Rotation::RotX(dh2.alpha)
+                * KDL::Rotation::RotZ(phi3) * KDL::Rotation::RotX(dh3.alpha);
+            KDL::Rotation rest = arm.Inverse() * toFlange;
+            KDL::Vector axis = rest.UnitZ();
+
+            double s4 = std::sin(dh4.alpha);
+            double c4 = std::cos(dh4.alpha);
+            double s5 = std::sin(dh5.alpha);
+            double c5 = std::cos(dh5.alpha);
+            double cos5 = std::clamp((c4 * c5 - axis.z()) / (s4 * s5), -1.0, 1.0);
+
+            for (int flip : {1, -1}) {
+                double phi5 = flip * std::acos(cos5);
+                double a = s5 * std::sin(phi5);
+                double b = -c4 * s5 * std::cos(phi5) - s4 * c5;
+                double phi4 = seed(3) + dh4.theta;
+                if (a * a + b * b > 1e-12) {
+                    phi4 = std::atan2(axis.y(), axis.x()) - std::atan2(b, a);
+                }
+                KDL::Rotation wristRot = KDL::Rotation::RotZ(phi4)
+                    * KDL::Rotation::RotX(dh4.alpha) * KDL::Rotation::RotZ(phi5)
+                    * KDL::Rotation::RotX(dh5.alpha);
+                KDL::Rotation last = wristRot.Inverse() * rest;
+                double phi6 = std::atan2(last(1, 0), last(0, 0));
+
+                Candidate candidate;
+                candidate.joints.resize(6);
+                double phi[6] = {phi1, phi2, phi3, phi4, phi5, phi6};
+                for (int i = 0; i < 6; i++) {
+                    candidate.joints(i) =
+                        closestAngle(phi[i] - dh[i].theta, seed(i), lower(i), upper(i));
+                }
+
+                // drop candidates that don't reach the target because of rounding errors
+                KDL::Frame check;
+                if (fksolver.JntToCart(candidate.joints, check) < 0
+                    || !isSameFrame(check, flange, 1e-6 * std::max(1.0, reach))) {
+                    continue;
+                }
+
+                candidate.withinLimits = isWithinLimits(candidate.joints);
+                candidate.distance = 0.0;
+                for (int i = 0; i < 6; i++) {
+                    candidate.distance += std::fabs(candidate.joints(i) - seed(i));
+                }
+                candidates.push_back(candidate);
+            }
+        }
+    }
+
+    if (candidates.empty()) {
+        return false;
+    }
+
+    // prefer solutions within the limits and then the one closest to the seed
+    auto best = std::min_element(candidates.begin(),
+                                 candidates.end(),
+                                 [](const Candidate& c1, const Candidate& c2) {
+                                     if (c1.withinLimits != c2.withinLimits) {
+                                         return c1.withinLimits;
+                                     }
+                                     return c1.distance < c2.distance;
+                                 });
+    joints = best->joints;
+    withinLimits = best->withinLimits;
+    return true;
+}
+
+void TrajectorySolver::solveBlock(std::vector<IKResult>& results,
+                                  std::vector<KDL::JntArray>& solutions,
+                                  std::size_t begin,
+                                  std::size_t end,
+                                  KDL::JntArray last,
+                                  bool resolve) const
+{
+    // the solvers are created once per block and every target starts from the last solution
+    KDL::ChainFkSolverPos_recursive fksolver(chain);
+    KDL::ChainIkSolverVel_pinv iksolverv(chain);
+    KDL::ChainIkSolverPos_NR_JL iksolver(chain, lower, upper, fksolver, iksolverv, 100, 1e-6);
+
+    bool useClosedForm = closedForm && method != Numeric;
+    KDL::JntArray joints(chain.getNrOfJoints());
+    Base::Placement toolInv = tool.inverse();
+
+    for (std::size_t i = begin; i < end; i++) {
+        IKResult& result = results[i];
+        KDL::Frame flange = toFrame(result.target * toolInv);
+
+        bool solved = false;
+        bool withinLimits = false;
+        if (useClosedForm) {
+            solved = solveClosedForm(flange, last, joints, withinLimits);
+        }
+        else if (method != ClosedForm) {
+            solved = iksolver.CartToJnt(last, flange, joints) >= 0;
+            withinLimits = solved && isWithinLimits(joints);
+        }
+
+        result.reachable = solved;
+        result.withinLimits = withinLimits;
+        if (!solved) {
+            solutions[i] = KDL::JntArray();
+            continue;
+        }
+
+        result.manipulability = getManipulability(joints);
+        result.singular = result.manipulability < singularity;
+        for (int j = 0; j < 6; j++) {
+            result.axis[j] = robot.getRotDir(j) * joints(j) * (180.0 / M_PI);
+        }
+        last = joints;
+
+        // once a target has the same solution as before the remaining ones do as well
+        bool same = resolve && isSameSolution(solutions[i], joints);
+        solutions[i] = joints;
+        if (same) {
+            break;
+        }
+    }
+}
+
+std::vector<IKResult> TrajectorySolver::solve(const std::vector<Base::Placement>& targets) const
+{
+    std::vector<IKResult> results(targets.size());
+    for (std::size_t i = 0; i < targets.size(); i++) {
+        results[i].time = static_cast<double>(i);
+        results[i].target = targets[i];
+    }
+
+    // the joints of the reachable targets, empty for all others
+    std::vector<KDL::JntArray> solutions(results.size());
+
+    // consecutive blocks so that the seeds stay close to the targets
+    std::size_t numThreads = std::min<std::size_t>(threads, results.size());
+    if (numThreads <= 1) {
+        solveBlock(results, solutions, 0, results.size(), seed, false);
+        return results;
+    }
+
+    std::vector<std::thread> workers;
+    std::size_t blockSize = (results.size() + numThreads - 1) / numThreads;
+    for (std::size_t begin = 0; begin < results.size(); begin += blockSize) {
+        std::size_t end = std::min(begin + blockSize, results.size());
+        workers.emplace_back(&TrajectorySolver::solveBlock,
+                             this,
+                             std::ref(results),
+                             std::ref(solutions),
+                             begin,
+                             end,
+                             seed,
+                             false);
+    }
+    for (auto& it : workers) {
+        it.join();
+    }
+
+    // The blocks were started from the seed instead of the last solution of their predecessor
+    // which may select another configuration of the robot. Their heads are solved again in
+    // order until the solutions agree with the ones of the parallel pass so that the result
+    // is the same as with a single thread.
+    auto lastSolution = [&](std::size_t index) {
+        for (std::size_t i = index; i > 0; i--) {
+            if (solutions[i - 1].rows() > 0) {
+                return solutions[i - 1];
+            }
+        }
+        return seed;
+    };
+    for (std::size_t begin = blockSize; begin < results.size(); begin += blockSize) {
+        std::size_t end = std::min(begin + blockSize, results.size());
+        solveBlock(results, solutions, begin, end, lastSolution(begin), true);
+    }
+
+    return results;
+}
+
+std::vector<IKResult> TrajectorySolver::solve(const Trajectory& trac) const
+{
+    std::vector<Base::Placement> targets;
+    for (const auto& it : trac.getWaypoints()) {
+        targets.push_back(it->EndPos);
+    }
+    std::size_t numWaypoints = targets.size();
+
+    std::vector<double> times;
+    double duration = trac.getDuration();
+    if (sampleTime > 0.0 && duration > 0.0) {
+        for (double time = 0.0; time < duration; time += sampleTime) {
+            times.push_back(time);
+        }
+        times.push_back(duration);
+    }
+    for (double time : times) {
+        targets.push_back(trac.getPosition(time));
+    }
+
+    std::vector<IKResult> results = solve(targets);
+    for (std::size_t i = 0; i < results.size(); i++) {
+        if (i < numWaypoints) {
+            results[i].time = -1.0;
+            results[i].waypoint = static_cast<int>(i);
+        }
+        else {
+            results[i].time = times[i - numWaypoints];
+        }
+    }
+    return results;
+}
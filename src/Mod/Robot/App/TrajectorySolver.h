@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef ROBOT_TRAJECTORYSOLVER_H
+#define ROBOT_TRAJECTORYSOLVER_H
+
+#include <array>
+#include <vector>
+
+#include <Base/Placement.h>
+
+#include "Robot6Axis.h"
+
+
+namespace Robot
+{
+class Trajectory;
+
+/// Inverse kinematics result for one target of a trajectory
+struct IKResult
+{
+    double time = 0.0;            // time on the trajectory (s), -1 for waypoints
+    int waypoint = -1;            // index of the waypoint, -1 for interpolated samples
+    Base::Placement target;       // target of the tool center point
+    bool reachable = false;       // a joint solution reaching the target was found
+    bool withinLimits = false;    // the solution respects the soft ends of all axes
+    bool singular = false;        // the solution is close to a singularity
+    double manipulability = 0.0;  // inverse condition number of the Jacobian (0..1)
+    double axis[6] {};            // axis values in degree as in Robot6Axis::getAxis()
+};
+
+/** Solves the inverse kinematics of a whole trajectory at once.
+ * The targets are split into consecutive blocks that are solved in parallel, each target
+ * is seeded with the solution of its predecessor. The blocks are started from the seed and
+ * their heads are solved again in order afterwards, so the result does not depend on the
+ * number of threads. Robots with a spherical wrist are solved in closed form, all others
+ * with a Newton-Raphson solver that is set up once per block.
+ */
+class RobotExport TrajectorySolver
+{
+public:
+    enum Method
+    {
+        Automatic,   // closed form if the robot has a spherical wrist, numeric otherwise
+        Numeric,     // Newton-Raphson with joint limits
+        ClosedForm,  // closed form only, fails for robots without a spherical wrist
+    };
+
+    explicit TrajectorySolver(const Robot6Axis& robot);
+
+    void setMethod(Method method)
+    {
+        this->method = method;
+    }
+    /// Sets the number of threads to use. Default is the number of hardware threads.
+    void setThreads(int num)
+    {
+        threads = num > 0 ? num : 1;
+    }
+    /// Time (s) between the interpolated samples of a trajectory, 0 solves the waypoints only
+    void setSampleTime(double time)
+    {
+        sampleTime = time;
+    }
+    /// The tool that is mounted to the flange of the robot
+    void setTool(const Base::Placement& tool)
+    {
+        this->tool = tool;
+    }
+    /// Results with a manipulability below \a value are marked as singular
+    void setSingularityThreshold(double value)
+    {
+        singularity = value;
+    }
+    /// Returns true if the robot has a spherical wrist and can be solved in closed form
+    bool hasClosedForm() const
+    {
+        return closedForm;
+    }
+
+    /// Solves the targets in the given order
+    std::vector<IKResult> solve(const std::vector<Base::Placement>& targets) const;
+    /// Solves the waypoints of the trajectory followed by the interpolated samples
+    std::vector<IKResult> solve(const Trajectory& trac) const;
+
+private:
+    struct DHParameter
+    {
+        double a = 0.0;
+        double alpha = 0.0;
+        double d = 0.0;
+        double theta = 0.0;
+    };
+
+    void solveBlock(std::vector<IKResult>& results,
+                    std::vector<KDL::JntArray>& solutions,
+                    std::size_t begin,
+                    std::size_t end,
+                    KDL::JntArray last,
+                    bool resolve) const;
+    bool solveClosedForm(const KDL::Frame& flange,
+                         const KDL::JntArray& seed,
+                         KDL::JntArray& joints,
+                         bool& withinLimits) const;
+    bool isWithinLimits(const KDL::JntArray& joints) const;
+    double getManipulability(const KDL::JntArray& joints) const;
+
+private:
+    const Robot6Axis& robot;
+    KDL::Chain chain;
+    KDL::JntArray seed;
+    KDL::JntArray lower;
+    KDL::JntArray upper;
+    std::array<DHParameter, 6> dh;
+    double reach = 0.0;
+    bool closedForm = false;
+
+    Method method = Automatic;
+    int threads;
+    double sampleTime = 0.0;
+    double singularity = 1e-3;
+    Base::Placement tool;
+};
+
+}  // namespace Robot
+
+
+#endif  // ROBOT_TRAJECTORYSOLVER_H
@@ -53,6 +53,8 @@ TaskTrajectory::TaskTrajectory(Robot::RobotObject* pcRobotObject,
 
     // set Tool
     sim.Tool = pcRobotObject->Tool.getValue();
+    // the timer advances the simulation by 0.1 s
+    sim.precompute(0.1);
 
     ui->trajectoryTable->setSortingEnabled(false);
 
@@ -446,12 +446,9 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
 
     if (err == 0 && updateGeoAfterSolving) {
         // set the newly solved geometry
+        // the property takes over the extracted geometries
         std::vector<Part::Geometry*> geomlist = solvedSketch.extractGeometry();
-        Geometry.setValues(geomlist);
-        for (std::vector<Part::Geometry*>::iterator it = geomlist.begin(); it != geomlist.end();
-             ++it)
-            if (*it)
-                delete *it;
+        Geometry.setValues(std::move(geomlist));
     }
     else if (err < 0) {
         // if solver failed, invalid constraints were likely added before solving
@@ -1013,13 +1010,8 @@ int SketchObject::movePoint(int GeoId, PointPos PosId, const Base::Vector3d& toP
 
     if (lastSolverStatus == 0) {
         std::vector<Part::Geometry*> geomlist = solvedSketch.extractGeometry();
-        Geometry.setValues(geomlist);
+        Geometry.setValues(std::move(geomlist));
         // Constraints.acceptGeometry(getCompleteGeometry());
-        for (std::vector<Part::Geometry*>::iterator it = geomlist.begin(); it != geomlist.end();
-             ++it) {
-            if (*it)
-                delete *it;
-        }
     }
 
     solvedSketch.resetInitMove();// reset solver point moving mechanism
@@ -1526,40 +1518,53 @@ int SketchObject::setConstruction(int GeoId, bool on)
     return 0;
 }
 
-void SketchObject::addGeometryState(const Constraint* cstr) const
+void SketchObject::addGeometryState(const Constraint* cstr)
 {
-    const std::vector<Part::Geometry*>& vals = getInternalGeometry();
-
     Sketcher::InternalType::InternalType constraintInternalAlignment = InternalType::None;
     bool constraintBlockedState = false;
 
     if (getInternalTypeState(cstr, constraintInternalAlignment)) {
-        auto gf = GeometryFacade::getFacade(vals[cstr->First]);
-        gf->setInternalType(constraintInternalAlignment);
+        auto gf = getGeometryFacade(cstr->First);
+        setGeometryState(cstr->First, constraintInternalAlignment, gf->getBlocked());
     }
     else if (getBlockedState(cstr, constraintBlockedState)) {
-        auto gf = GeometryFacade::getFacade(vals[cstr->First]);
-        gf->setBlocked(constraintBlockedState);
+        auto gf = getGeometryFacade(cstr->First);
+        setGeometryState(cstr->First, gf->getInternalType(), constraintBlockedState);
     }
 }
 
-void SketchObject::removeGeometryState(const Constraint* cstr) const
+void SketchObject::removeGeometryState(const Constraint* cstr)
 {
-    const std::vector<Part::Geometry*>& vals = getInternalGeometry();
-
     // Assign correct Internal Geometry Type (see SketchGeometryExtension)
     if (cstr->Type == InternalAlignment) {
-        auto gf = GeometryFacade::getFacade(vals[cstr->First]);
-        gf->setInternalType(InternalType::None);
+        auto gf = getGeometryFacade(cstr->First);
+        setGeometryState(cstr->First, InternalType::None, gf->getBlocked());
     }
 
     // Assign Blocked geometry mode (see SketchGeometryExtension)
     if (cstr->Type == Block) {
-        auto gf = GeometryFacade::getFacade(vals[cstr->First]);
-        gf->setBlocked(false);
+        auto gf = getGeometryFacade(cstr->First);
+        setGeometryState(cstr->First, gf->getInternalType(), false);
     }
 }
 
+void SketchObject::setGeometryState(int GeoId,
+                                    Sketcher::InternalType::InternalType internaltype,
+                                    bool blocked)
+{
+    auto gf = getGeometryFacade(GeoId);
+    if (gf->getInternalType() == internaltype && gf->getBlocked() == blocked)
+        return;
+
+    // the geometries of the list are shared with the undo history, so the state is set on a
+    // copy that replaces the geometry
+    std::unique_ptr<Part::Geometry> geo(getInternalGeometry()[GeoId]->clone());
+    auto gft = GeometryFacade::getFacade(geo.get());
+    gft->setInternalType(internaltype);
+    gft->setBlocked(blocked);
+    this->Geometry.set1Value(GeoId, std::move(geo));
+}
+
 // ConstraintList is used only to make copies.
 int SketchObject::addConstraints(const std::vector<Constraint*>& ConstraintList)
 {
@@ -3181,7 +3186,13 @@ int SketchObject::trim(int GeoId, const Base::Vector3d& point)
             auto* tc = static_cast<const Part::GeomConic*>(geo);
             if (tc->isReversed()) {
                 // reversing does not change the curve as seen by the sketcher.
-                const_cast<Part::GeomConic*>(tc)->reverse();
+                // The geometries of the list are shared with the undo history, so the
+                // reversed curve replaces the original one instead of changing it.
+                std::unique_ptr<Part::GeomConic> reversed(
+                    static_cast<Part::GeomConic*>(tc->clone()));
+                reversed->reverse();
+                Geometry.set1Value(GeoId, std::move(reversed));
+                geo = getGeometry(GeoId);
             }
         }
 
@@ -8918,8 +8929,13 @@ void SketchObject::synchroniseGeometryState()
 {
     const std::vector<Part::Geometry*>& vals = getInternalGeometry();
 
+    // the geometries of the list are shared with the undo history, so the geometries whose
+    // state differs from the constraints are replaced by copies with the correct state
+    std::vector<Part::Geometry*> newVals(vals);
+    bool changed = false;
+
     for (size_t i = 0; i < vals.size(); i++) {
-        auto gf = GeometryFacade::getFacade(vals[i]);
+        auto gf = getGeometryFacade(int(i));
 
         auto facadeInternalAlignment = gf->getInternalType();
         auto facadeBlockedState = gf->getBlocked();
@@ -8934,12 +8950,19 @@ void SketchObject::synchroniseGeometryState()
             }
         }
 
-        if (constraintInternalAlignment != facadeInternalAlignment)
-            gf->setInternalType(constraintInternalAlignment);
-
-        if (constraintBlockedState != facadeBlockedState)
-            gf->setBlocked(constraintBlockedState);
+        if (constraintInternalAlignment != facadeInternalAlignment
+            || constraintBlockedState != facadeBlockedState) {
+            newVals[i] = vals[i]->clone();
+            auto gft = GeometryFacade::getFacade(newVals[i]);
+            gft->setInternalType(constraintInternalAlignment);
+            gft->setBlocked(constraintBlockedState);
+            changed = true;
+        }
     }
+
+    // the property keeps the unchanged geometries and takes over the copies
+    if (changed)
+        Geometry.setValues(std::move(newVals));
 }
 
 bool SketchObject::getInternalTypeState(
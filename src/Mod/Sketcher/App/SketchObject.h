@@ -911,8 +911,14 @@ private:
     // 3. Functionality removing constraints (of the relevant type) calls removeGeometryState to
     // remove the status
     // 4. Save mechanism will ensure persistence.
-    void addGeometryState(const Constraint* cstr) const;
-    void removeGeometryState(const Constraint* cstr) const;
+    //
+    // The geometries are shared with the undo history, so the state is never changed in place,
+    // the geometry is replaced by a copy with the new state.
+    void addGeometryState(const Constraint* cstr);
+    void removeGeometryState(const Constraint* cstr);
+    void setGeometryState(int GeoId,
+                          Sketcher::InternalType::InternalType internaltype,
+                          bool blocked);
 
     SketchAnalysis* analyser;
 
@@ -24,6 +24,8 @@
 #define SKETCHERGUI_EditModeCoinManagerParameters_H
 
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include <QString>
@@ -546,6 +548,25 @@ struct CoinMapping
     std::map<Sketcher::GeoElementId, MultiFieldId> GeoElementId2SetId;
 };
 
+/** @brief Struct for keeping the coin coordinates of a curve until the curve changes
+ *
+ * Only the curves whose geometry differs from the copy kept here are converted again when
+ * the edit mode nodes are updated, e.g. only the moved curves while dragging.
+ */
+struct ConvertedGeometry
+{
+    std::unique_ptr<Part::Geometry> geometry;
+    int curvedEdgeCountSegments = 0;
+    std::vector<Base::Vector3d> points;
+    std::vector<Base::Vector3d> coords;
+    unsigned int numVertices = 0;
+    double combRepresentationScale = 0;
+    bool used = false;
+};
+
+/// The converted curves by GeoId
+using ConvertedGeometryCache = std::unordered_map<int, ConvertedGeometry>;
+
 }  // namespace SketcherGui
 
 #endif  // SKETCHERGUI_EditModeCoinManagerParameters_H
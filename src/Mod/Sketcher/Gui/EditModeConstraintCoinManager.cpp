@@ -24,7 +24,11 @@
 #ifndef _PreComp_
 #include <QPainter>
 #include <QRegularExpression>
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <queue>
+#include <unordered_map>
 
 #include <Inventor/SbImage.h>
 #include <Inventor/SbVec3f.h>
@@ -1915,6 +1919,7 @@ void EditModeConstraintCoinManager::rebuildConstraintNodes(const GeoListFacade&
     Gui::coinRemoveAllChildren(editModeScenegraphNodes.constrGroup);
 
     vConstrType.clear();
+    drawnConstrIcons.clear();
 
     // Get sketch normal
     Base::Vector3d RN(0, 0, 1);
@@ -2540,62 +2545,117 @@ void EditModeConstraintCoinManager::combineConstraintIcons(IconQueue iconQueue)
     // getScaleFactor gives us a ratio of pixels per some kind of real units
     float maxDistSquared = pow(ViewProviderSketchCoinAttorney::getScaleFactor(viewProvider), 2);
 
-    // There's room for optimisation here; we could reuse the combined icons...
     combinedConstrBoxes.clear();
 
-    while (!iconQueue.empty()) {
-        // A group starts with an item popped off the back of our initial queue
-        IconQueue thisGroup;
-        thisGroup.push_back(iconQueue.back());
-        constrIconQueueItem init = iconQueue.back();
-        iconQueue.pop_back();
-
-        // we group only icons not being Symmetry icons, because we want those on the line
-        // and only icons that are visible
-        if (init.type != QString::fromLatin1("Constraint_Symmetric") && init.visible) {
-
-            IconQueue::iterator i = iconQueue.begin();
-
-
-            while (i != iconQueue.end()) {
-                if ((*i).visible) {
-                    bool addedToGroup = false;
-
-                    for (IconQueue::iterator j = thisGroup.begin(); j != thisGroup.end(); ++j) {
-                        float distSquared = pow(i->position[0] - j->position[0], 2)
-                            + pow(i->position[1] - j->position[1], 2);
-                        if (distSquared <= maxDistSquared
-                            && (*i).type != QString::fromLatin1("Constraint_Symmetric")) {
-                            // Found an icon in iconQueue that's close enough to
-                            // a member of thisGroup, so move it into thisGroup
-                            thisGroup.push_back(*i);
-                            i = iconQueue.erase(i);
-                            addedToGroup = true;
-                            break;
-                        }
-                    }
+    // we group only icons not being Symmetry icons, because we want those on the line
+    // and only icons that are visible
+    auto isGrouped = [](const constrIconQueueItem& icon) {
+        return icon.visible && icon.type != QString::fromLatin1("Constraint_Symmetric");
+    };
 
-                    if (addedToGroup) {
-                        if (i == iconQueue.end()) {
-                            // We just got the last icon out of iconQueue
-                            break;
-                        }
-                        else {
-                            // Start looking through the iconQueue again, in case
-                            // we have an icon that's now close enough to thisGroup
-                            i = iconQueue.begin();
-                        }
+    // The grouped icons are sorted into a grid of cells as large as the grouping distance,
+    // so that only the icons of the neighbouring cells need to be checked. The cells are
+    // made a bit larger so that rounding can't put close icons two cells apart.
+    double cellSize = std::sqrt(static_cast<double>(maxDistSquared)) * 1.001;
+    if (!(cellSize > 0) || std::isinf(cellSize)) {
+        cellSize = std::numeric_limits<double>::infinity();
+    }
+
+    auto getCell = [cellSize](float coord) {
+        constexpr double limit = 1 << 30;
+        double cell = std::floor(coord / cellSize);
+        if (cell > -limit && cell < limit) {
+            return static_cast<int32_t>(cell);
+        }
+        return static_cast<int32_t>(cell > 0 ? limit : -limit);
+    };
+
+    auto getKey = [](int32_t x, int32_t y) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32)
+            | static_cast<uint32_t>(y);
+    };
+
+    std::unordered_map<uint64_t, std::vector<std::size_t>> grid;
+    for (std::size_t k = 0; k < iconQueue.size(); ++k) {
+        if (isGrouped(iconQueue[k])) {
+            const SbVec3f& pos = iconQueue[k].position;
+            grid[getKey(getCell(pos[0]), getCell(pos[1]))].push_back(k);
+        }
+    }
+
+    // taken: the icon is in a group or in closeIcons, removed: the icon is in a group
+    std::vector<bool> taken(iconQueue.size(), false);
+    std::vector<bool> removed(iconQueue.size(), false);
+    // the icons from here on are all in a group
+    std::size_t end = iconQueue.size();
+
+    // The icons close to the group, the one first in the queue is added first
+    std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<>> closeIcons;
+
+    auto findCloseIcons = [&](std::size_t member) {
+        const SbVec3f& pos = iconQueue[member].position;
+        int32_t cellX = getCell(pos[0]);
+        int32_t cellY = getCell(pos[1]);
+        for (int32_t x = cellX - 1; x <= cellX + 1; ++x) {
+            for (int32_t y = cellY - 1; y <= cellY + 1; ++y) {
+                auto cell = grid.find(getKey(x, y));
+                if (cell == grid.end()) {
+                    continue;
+                }
+                for (std::size_t k : cell->second) {
+                    if (taken[k]) {
+                        continue;
                     }
-                    else {
-                        ++i;
+                    const SbVec3f& other = iconQueue[k].position;
+                    float distSquared = pow(other[0] - pos[0], 2) + pow(other[1] - pos[1], 2);
+                    if (distSquared <= maxDistSquared) {
+                        taken[k] = true;
+                        closeIcons.push(k);
                     }
                 }
-                else {  // if !visible we skip it
-                    i++;
+            }
+        }
+    };
+
+    for (std::size_t init = iconQueue.size(); init-- > 0;) {
+        if (taken[init]) {
+            continue;
+        }
+
+        // A group starts with the last icon of our initial queue not drawn yet
+        IconQueue thisGroup;
+        thisGroup.push_back(iconQueue[init]);
+        taken[init] = true;
+        removed[init] = true;
+
+        if (isGrouped(iconQueue[init])) {
+            findCloseIcons(init);
+            while (!closeIcons.empty()) {
+                std::size_t k = closeIcons.top();
+                closeIcons.pop();
+                thisGroup.push_back(iconQueue[k]);
+                removed[k] = true;
+
+                while (end > 0 && removed[end - 1]) {
+                    --end;
+                }
+                // As before, the group is complete once the last icon of the queue has joined
+                if (k >= end) {
+                    while (!closeIcons.empty()) {
+                        taken[closeIcons.top()] = false;
+                        closeIcons.pop();
+                    }
+                    break;
                 }
+
+                findCloseIcons(k);
             }
         }
 
+        while (end > 0 && removed[end - 1]) {
+            --end;
+        }
+
         if (thisGroup.size() == 1) {
             drawTypicalConstraintIcon(thisGroup[0]);
         }
@@ -2607,14 +2667,28 @@ void EditModeConstraintCoinManager::combineConstraintIcons(IconQueue iconQueue)
 
 void EditModeConstraintCoinManager::drawMergedConstraintIcons(IconQueue iconQueue)
 {
+    QString key;
     for (IconQueue::iterator i = iconQueue.begin(); i != iconQueue.end(); ++i) {
-        clearCoinImage(i->destination);
+        key += constrIconKey(*i, constrColor(i->constraintId));
+        if (i != iconQueue.begin()) {
+            auto drawn = drawnConstrIcons.find(i->destination);
+            if (drawn != drawnConstrIcons.end()) {
+                clearCoinImage(i->destination);
+                drawnConstrIcons.erase(drawn);
+            }
+        }
     }
 
     QImage compositeIcon;
     SoImage* thisDest = iconQueue[0].destination;
     SoInfo* thisInfo = iconQueue[0].infoPtr;
 
+    DrawnConstraintIcon& drawnIcon = drawnConstrIcons[thisDest];
+    if (drawnIcon.key == key) {
+        combinedConstrBoxes[drawnIcon.idString] = drawnIcon.boundingBoxes;
+        return;
+    }
+
     // Tracks all constraint IDs that are combined into this icon
     QString idString;
     int lastVPad = 0;
@@ -2744,6 +2818,22 @@ void EditModeConstraintCoinManager::drawMergedConstraintIcons(IconQueue iconQueu
     combinedConstrBoxes[idString] = boundingBoxes;
     thisInfo->string.setValue(idString.toLatin1().data());
     sendConstraintIconToCoin(compositeIcon, thisDest);
+
+    drawnIcon.key = key;
+    drawnIcon.idString = idString;
+    drawnIcon.boundingBoxes = std::move(boundingBoxes);
+}
+
+QString EditModeConstraintCoinManager::constrIconKey(const constrIconQueueItem& i,
+                                                     const QColor& color) const
+{
+    return QString::fromLatin1("%1 %2 %3 %4 %5 %6\n")
+        .arg(i.type,
+             color.name(),
+             QString::number(i.iconRotation, 'g', 17),
+             QString::number(drawingParameters.constraintIconSize),
+             QString::number(i.constraintId),
+             i.label);
 }
 
 
@@ -2851,6 +2941,13 @@ void EditModeConstraintCoinManager::drawTypicalConstraintIcon(const constrIconQu
 {
     QColor color = constrColor(i.constraintId);
 
+    // the icon is only rendered again if it has changed
+    DrawnConstraintIcon& drawnIcon = drawnConstrIcons[i.destination];
+    QString key = constrIconKey(i, color);
+    if (drawnIcon.key == key) {
+        return;
+    }
+
     QImage image = renderConstrIcon(i.type,
                                     color,
                                     QStringList(i.label),
@@ -2859,6 +2956,10 @@ void EditModeConstraintCoinManager::drawTypicalConstraintIcon(const constrIconQu
 
     i.infoPtr->string.setValue(QString::number(i.constraintId).toLatin1().data());
     sendConstraintIconToCoin(image, i.destination);
+
+    drawnIcon.key = key;
+    drawnIcon.idString.clear();
+    drawnIcon.boundingBoxes.clear();
 }
 
 QString EditModeConstraintCoinManager::iconTypeFromConstraint(Constraint* constraint)
@@ -191,6 +191,18 @@ private:
 
     std::map<QString, ConstrIconBBVec> combinedConstrBoxes;
 
+    /// The icon last sent to an image, so that an unchanged icon is not rendered again
+    struct DrawnConstraintIcon
+    {
+        /// Everything the rendered icon depends on, see constrIconKey()
+        QString key;
+        /// The constraint IDs stored in the SoInfo of the icon
+        QString idString;
+        ConstrIconBBVec boundingBoxes;
+    };
+
+    std::map<SoImage*, DrawnConstraintIcon> drawnConstrIcons;
+
 
     /// Internal type used for drawing constraint icons
     struct constrIconQueueItem
@@ -224,6 +236,9 @@ private:
 
     void combineConstraintIcons(IconQueue iconQueue);
 
+    /// Returns a string identifying the rendering of the icon in the given color
+    QString constrIconKey(const constrIconQueueItem& i, const QColor& color) const;
+
     /// Renders an icon for a single constraint and sends it to Coin
     void drawTypicalConstraintIcon(const constrIconQueueItem& i);
 
@@ -39,12 +39,14 @@ EditModeGeometryCoinConverter::EditModeGeometryCoinConverter(
     GeometryLayerNodes& geometrylayernodes,
     DrawingParameters& drawingparameters,
     GeometryLayerParameters& geometryLayerParams,
-    CoinMapping& coinMap)
+    CoinMapping& coinMap,
+    ConvertedGeometryCache& convertedGeometries)
     : viewProvider(vp)
     , geometryLayerNodes(geometrylayernodes)
     , drawingParameters(drawingparameters)
     , geometryLayerParameters(geometryLayerParams)
     , coinMapping(coinMap)
+    , convertedGeometries(convertedGeometries)
 {}
 
 void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geolistfacade)
@@ -269,42 +271,94 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geoli
         }
     }
 
+    // drop the curves that are gone
+    for (auto it = convertedGeometries.begin(); it != convertedGeometries.end();) {
+        if (it->second.used) {
+            it->second.used = false;
+            ++it;
+        }
+        else {
+            it = convertedGeometries.erase(it);
+        }
+    }
+
     // Coin Nodes Editing
     int vOrFactor = ViewProviderSketchCoinAttorney::getViewOrientationFactor(viewProvider);
     double linez = vOrFactor * drawingParameters.zLowLines;  // NOLINT
     double pointz = vOrFactor * drawingParameters.zLowPoints;
 
+    // Fields whose values don't change are not touched, so that the nodes of the layers
+    // that haven't changed don't need to be rendered again
+    auto isSame = [](const SoMFVec3f& field, const std::vector<Base::Vector3d>& values, double z) {
+        if (field.getNum() != static_cast<int>(values.size())) {
+            return false;
+        }
+        const SbVec3f* verts = field.getValues(0);
+        for (std::size_t i = 0; i < values.size(); i++) {
+            if (verts[i] != SbVec3f(values[i].x, values[i].y, z)) {  // NOLINT
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto isSameIndex = [](const SoMFInt32& field, const std::vector<unsigned int>& values) {
+        if (field.getNum() != static_cast<int>(values.size())) {
+            return false;
+        }
+        const int32_t* index = field.getValues(0);
+        for (std::size_t i = 0; i < values.size(); i++) {
+            if (index[i] != static_cast<int32_t>(values[i])) {
+                return false;
+            }
+        }
+        return true;
+    };
+
     for (auto l = 0; l < geometryLayerParameters.getCoinLayerCount(); l++) {
-        geometryLayerNodes.PointsCoordinate[l]->point.setNum(Points[l].size());
-        geometryLayerNodes.PointsMaterials[l]->diffuseColor.setNum(Points[l].size());
-        SbVec3f* pverts = geometryLayerNodes.PointsCoordinate[l]->point.startEditing();
+        if (geometryLayerNodes.PointsMaterials[l]->diffuseColor.getNum()
+            != static_cast<int>(Points[l].size())) {
+            geometryLayerNodes.PointsMaterials[l]->diffuseColor.setNum(Points[l].size());
+        }
+
+        if (!isSame(geometryLayerNodes.PointsCoordinate[l]->point, Points[l], pointz)) {
+            geometryLayerNodes.PointsCoordinate[l]->point.setNum(Points[l].size());
+            SbVec3f* pverts = geometryLayerNodes.PointsCoordinate[l]->point.startEditing();
 
-        int i = 0;  // setting up the point set
-        for (auto& point : Points[l]) {
-            pverts[i++].setValue(point.x, point.y, pointz);
+            int i = 0;  // setting up the point set
+            for (auto& point : Points[l]) {
+                pverts[i++].setValue(point.x, point.y, pointz);
+            }
+            geometryLayerNodes.PointsCoordinate[l]->point.finishEditing();
         }
-        geometryLayerNodes.PointsCoordinate[l]->point.finishEditing();
 
         for (auto t = 0; t < geometryLayerParameters.getSubLayerCount(); t++) {
-            geometryLayerNodes.CurvesCoordinate[l][t]->point.setNum(Coords[l][t].size());
-            geometryLayerNodes.CurveSet[l][t]->numVertices.setNum(Index[l][t].size());
-            geometryLayerNodes.CurvesMaterials[l][t]->diffuseColor.setNum(Index[l][t].size());
+            if (geometryLayerNodes.CurvesMaterials[l][t]->diffuseColor.getNum()
+                != static_cast<int>(Index[l][t].size())) {
+                geometryLayerNodes.CurvesMaterials[l][t]->diffuseColor.setNum(Index[l][t].size());
+            }
 
-            SbVec3f* verts = geometryLayerNodes.CurvesCoordinate[l][t]->point.startEditing();
-            int32_t* index = geometryLayerNodes.CurveSet[l][t]->numVertices.startEditing();
+            if (!isSame(geometryLayerNodes.CurvesCoordinate[l][t]->point, Coords[l][t], linez)) {
+                geometryLayerNodes.CurvesCoordinate[l][t]->point.setNum(Coords[l][t].size());
+                SbVec3f* verts = geometryLayerNodes.CurvesCoordinate[l][t]->point.startEditing();
 
-            i = 0;  // setting up the line set
-            for (auto& coord : Coords[l][t]) {
-                verts[i++].setValue(coord.x, coord.y, linez);  // NOLINT
+                int i = 0;  // setting up the line set
+                for (auto& coord : Coords[l][t]) {
+                    verts[i++].setValue(coord.x, coord.y, linez);  // NOLINT
+                }
+                geometryLayerNodes.CurvesCoordinate[l][t]->point.finishEditing();
             }
 
-            i = 0;  // setting up the indexes of the line set
-            for (auto it : Index[l][t]) {
-                index[i++] = it;
-            }
+            if (!isSameIndex(geometryLayerNodes.CurveSet[l][t]->numVertices, Index[l][t])) {
+                geometryLayerNodes.CurveSet[l][t]->numVertices.setNum(Index[l][t].size());
+                int32_t* index = geometryLayerNodes.CurveSet[l][t]->numVertices.startEditing();
 
-            geometryLayerNodes.CurvesCoordinate[l][t]->point.finishEditing();
-            geometryLayerNodes.CurveSet[l][t]->numVertices.finishEditing();
+                int i = 0;  // setting up the indexes of the line set
+                for (auto it : Index[l][t]) {
+                    index[i++] = it;
+                }
+                geometryLayerNodes.CurveSet[l][t]->numVertices.finishEditing();
+            }
         }
     }
 }
@@ -331,6 +385,44 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
         }
     };
 
+    // Points and lines are cheaper to convert than to compare, only curves are cached
+    constexpr bool cached = curvemode == CurveMode::ClosedCurve || curvemode == CurveMode::OpenCurve;
+    ConvertedGeometry* converted = nullptr;
+    std::size_t pointsStart = Points[coinLayer].size();
+    std::size_t coordsStart = Coords[coinLayer][subLayer].size();
+    double geoCombRepScale = 0;
+
+    if constexpr (cached) {
+        converted = &convertedGeometries[geoid];
+        converted->used = true;
+        auto isSame = [geo](const Part::Geometry* cachedGeo) {
+            if (!cachedGeo || cachedGeo->getTypeId() != geo->getTypeId()
+                || !cachedGeo->isSame(*geo, 0, 0)) {
+                return false;
+            }
+            if constexpr (std::is_same<GeoType, Part::GeomBSplineCurve>::value) {
+                // the knot multiplicities are not compared by isSame()
+                return static_cast<const GeoType*>(cachedGeo)->getMultiplicities()
+                    == geo->getMultiplicities();
+            }
+            return true;
+        };
+        if (converted->curvedEdgeCountSegments == drawingParameters.curvedEdgeCountSegments
+            && isSame(converted->geometry.get())) {
+            for (const auto& pnt : converted->points) {
+                addPoint(Points[coinLayer], pnt);
+            }
+            for (const auto& pnt : converted->coords) {
+                addPoint(Coords[coinLayer][subLayer], pnt);
+            }
+            Index[coinLayer][subLayer].push_back(converted->numVertices);
+            if (converted->combRepresentationScale > combrepscale) {
+                combrepscale = converted->combRepresentationScale;
+            }
+            return;
+        }
+    }
+
     // Points
     if constexpr (pointmode == PointsMode::InsertSingle) {
         addPoint(Points[coinLayer], geo->getPoint());
@@ -459,8 +551,19 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeometryFacade* geom
             if (temprepscale > combrepscale) {
                 combrepscale = temprepscale;
             }
+            geoCombRepScale = temprepscale;
         }
     }
+
+    if constexpr (cached) {
+        converted->geometry.reset(geo->clone());
+        converted->curvedEdgeCountSegments = drawingParameters.curvedEdgeCountSegments;
+        converted->points.assign(Points[coinLayer].begin() + pointsStart, Points[coinLayer].end());
+        converted->coords.assign(Coords[coinLayer][subLayer].begin() + coordsStart,
+                                 Coords[coinLayer][subLayer].end());
+        converted->numVertices = Index[coinLayer][subLayer].back();
+        converted->combRepresentationScale = geoCombRepScale;
+    }
 }
 
 float EditModeGeometryCoinConverter::getBoundingBoxMaxMagnitude()
@@ -25,6 +25,7 @@
 
 #include <vector>
 
+#include "EditModeCoinManagerParameters.h"
 #include "ViewProviderSketch.h"
 
 
@@ -108,12 +109,16 @@ public:
      * the geometry
      *
      * @param drawingparameters: Parameters for drawing the overlay information
+     *
+     * @param convertedGeometries: The curves of the last conversion, which are
+     * reused for the curves that have not changed
      */
     EditModeGeometryCoinConverter(ViewProviderSketch& vp,
                                   GeometryLayerNodes& geometrylayernodes,
                                   DrawingParameters& drawingparameters,
                                   GeometryLayerParameters& geometryLayerParams,
-                                  CoinMapping& coinMap);
+                                  CoinMapping& coinMap,
+                                  ConvertedGeometryCache& convertedGeometries);
 
     /**
      * converts the geometry defined by GeometryLayer into the coin nodes.
@@ -177,6 +182,7 @@ private:
     GeometryLayerParameters& geometryLayerParameters;
     // Mappings coin geoId
     CoinMapping& coinMapping;
+    ConvertedGeometryCache& convertedGeometries;
 
     // measurements
     float boundingBoxMaxMagnitude = 100;
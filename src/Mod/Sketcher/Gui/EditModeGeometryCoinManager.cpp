@@ -105,7 +105,8 @@ void EditModeGeometryCoinManager::processGeometry(const GeoListFacade& geolistfa
                                          geometrylayernodes,
                                          drawingParameters,
                                          geometryLayerParameters,
-                                         coinMapping);
+                                         coinMapping,
+                                         convertedGeometries);
 
     gcconv.convert(geolistfacade);
 
@@ -122,6 +122,8 @@ private:
     EditModeScenegraphNodes& editModeScenegraphNodes;
 
     CoinMapping& coinMapping;
+
+    ConvertedGeometryCache convertedGeometries;
 };
 
 
@@ -40,8 +40,11 @@
 #include <algorithm>
 #include <bitset>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
+#include <queue>
+#include <unordered_map>
 #include <vector>
 
 // Boost
@@ -27,8 +27,6 @@
 # include <sstream>
 
 #include <Bnd_Box.hxx>
-#include <BRep_Builder.hxx>
-#include <BRepAlgoAPI_Common.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
@@ -37,13 +35,12 @@
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
 #include <Precision.hxx>
-#include <TopExp.hxx>
+#include <Standard_Failure.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
-#include <TopoDS_Compound.hxx>
-#include <TopTools_IndexedMapOfShape.hxx>
+#include <QtConcurrentMap>
 #endif
 
 #include <App/Application.h>
@@ -60,6 +57,7 @@
 #include "Geometry.h"
 #include "GeometryObject.h"
 #include "HatchLine.h"
+#include "HatchScanline.h"
 #include "Preferences.h"
 
 
@@ -247,6 +245,57 @@ std::vector<LineSet>  DrawGeomHatch::getTrimmedLines(int i)   //get the trimmed
                            PatternRotation.getValue(), PatternOffset.getValue());
 }
 
+//! get the trimmed hatch lines for several faces. The faces are extracted from the
+//! source view first, then the lines are trimmed to the faces in parallel. A face
+//! that fails is reported and gets no lines, the other faces keep theirs.
+std::vector<std::vector<LineSet>> DrawGeomHatch::getTrimmedLines(const std::vector<int>& faces)
+{
+    std::vector<std::vector<LineSet>> result(faces.size());
+    if (m_lineSets.empty()) {
+        makeLineSets();
+    }
+
+    DrawViewPart* source = getSourceView();
+    if (!source ||
+        !source->hasGeometry()) {
+        return result;
+    }
+
+    std::vector<TopoDS_Face> topoFaces;
+    topoFaces.reserve(faces.size());
+    for (int iface : faces) {
+        topoFaces.push_back(extractFace(source, iface));
+    }
+
+    double scale = ScalePattern.getValue();
+    double hatchRotation = PatternRotation.getValue();
+    Base::Vector3d hatchOffset = PatternOffset.getValue();
+    std::vector<std::string> errors(faces.size());
+    std::vector<std::size_t> indexes(faces.size());
+    for (std::size_t i = 0; i < indexes.size(); i++) {
+        indexes[i] = i;
+    }
+    QtConcurrent::blockingMap(indexes, [&](std::size_t i) {
+        try {
+            result[i] = getTrimmedLines(source, m_lineSets, topoFaces[i], scale, hatchRotation, hatchOffset);
+        }
+        catch (const Base::Exception& e) {
+            errors[i] = e.what();
+        }
+        catch (const Standard_Failure& e) {
+            errors[i] = e.GetMessageString();
+        }
+    });
+
+    for (std::size_t i = 0; i < errors.size(); i++) {
+        if (!errors[i].empty()) {
+            Base::Console().Error("DGH::getTrimmedLines - %s face %d: %s\n",
+                                  getFullName().c_str(), faces[i], errors[i].c_str());
+        }
+    }
+    return result;
+}
+
 /* static */
 std::vector<LineSet>  DrawGeomHatch::getTrimmedLinesSection(DrawViewSection* source,
                                                             std::vector<LineSet> lineSets,
@@ -266,8 +315,8 @@ std::vector<LineSet>  DrawGeomHatch::getTrimmedLinesSection(DrawViewSection* sou
     Base::Vector3d stdZ(0.0, 0.0, 1.0);
     Base::Vector3d offset = stdZ * p.Distance(fc) * dir;
 
-    //f may be above or below paper plane and must be moved so Common operation in
-    //getTrimmedLines succeeds
+    //f may be above or below paper plane and must be moved onto it before the
+    //hatch lines are trimmed in getTrimmedLines
     TopoDS_Shape moved = ShapeUtils::moveShape(f,
                                               offset);
     TopoDS_Face fMoved = TopoDS::Face(ShapeUtils::invertGeometry(moved));
@@ -312,72 +361,52 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
         return result;
     }
 
-    TopoDS_Face face = f;
+    if (f.IsNull()) {
+        return result;
+    }
 
-    Bnd_Box bBox;
-    BRepBndLib::AddOptimal(face, bBox);
-    bBox.SetGap(0.0);
+    //the outline of the face is sampled once and shared by all the line sets
+    HatchScanline scanline(f);
+    double hatchRotationRad = hatchRotation * M_PI / 180.0;
+    Base::Vector3d stdZ(0.0, 0.0, 1.0);
 
     for (auto& ls: lineSets) {
         PATLineSpec hl = ls.getPATLineSpec();
-        std::vector<TopoDS_Edge> candidates = DrawGeomHatch::makeEdgeOverlay(hl, bBox, scale);   //completely cover face bbox with lines
-
-        //make Compound for this linespec
-        BRep_Builder builder;
-        TopoDS_Compound gridComp;
-        builder.MakeCompound(gridComp);
-        for (auto& c: candidates) {
-           builder.Add(gridComp, c);
-        }
-
-        TopoDS_Shape grid = gridComp;
-        if (hatchRotation != 0.0) {
-            double hatchRotationRad = hatchRotation * M_PI / 180.0;
-            gp_Ax1 gridAxis(gp_Pnt(0.0, 0.0, 0.0), gp_Vec(gp::OZ().Direction()));
-            gp_Trsf xGridRotate;
-            xGridRotate.SetRotation(gridAxis, hatchRotationRad);
-            BRepBuilderAPI_Transform mkTransRotate(grid, xGridRotate, true);
-            grid = mkTransRotate.Shape();
+        //same direction of the lines as the overlay from makeEdgeOverlay: left to right or,
+        //if oblique or vertical, upwards
+        double angle = hl.getAngle();
+        if (angle > 90.0) {
+            angle = -(180.0 - angle);
+        } else if (angle < -90.0) {
+            angle = (180 + angle);
         }
-        gp_Trsf xGridTranslate;
-        xGridTranslate.SetTranslation(DrawUtil::togp_Vec(hatchOffset));
-        BRepBuilderAPI_Transform mkTransTranslate(grid, xGridTranslate, true);
-        grid = mkTransTranslate.Shape();
-
-        //Common(Compound, Face)
-        BRepAlgoAPI_Common mkCommon(face, grid);
-        if (!mkCommon.IsDone() ||
-            mkCommon.Shape().IsNull()) {
-            return result;
+        double angleRad = angle * M_PI / 180.0;
+        Base::Vector3d direction(cos(angleRad), sin(angleRad), 0.0);
+        if (angle < 0.0) {
+            direction = -direction;
         }
-        TopoDS_Shape common = mkCommon.Shape();
-
-        //save the boundingBox of hatch pattern
-        Bnd_Box overlayBox;
-        overlayBox.SetGap(0.0);
-        BRepBndLib::AddOptimal(common, overlayBox);
-        ls.setBBox(overlayBox);
+        direction = DrawUtil::vecRotate(direction, hatchRotationRad, stdZ);
+        Base::Vector3d origin = DrawUtil::vecRotate(hl.getOrigin(), hatchRotationRad, stdZ) + hatchOffset;
+        double interval = fabs(hl.getInterval()) * scale;
 
-        //get resulting edges
         std::vector<TopoDS_Edge> resultEdges;
-        TopTools_IndexedMapOfShape mapOfEdges;
-        TopExp::MapShapes(common, TopAbs_EDGE, mapOfEdges);
-        for ( int i = 1 ; i <= mapOfEdges.Extent() ; i++ ) {           //remember, TopExp makes no promises about the order it finds edges
-            const TopoDS_Edge& edge = TopoDS::Edge(mapOfEdges(i));
-            if (edge.IsNull()) {
-                continue;
-            }
-            resultEdges.push_back(edge);
-        }
-
         std::vector<TechDraw::BaseGeomPtr> resultGeoms;
-        for (auto& e: resultEdges) {
-            TechDraw::BaseGeomPtr base = BaseGeom::baseFactory(e);
+        Bnd_Box overlayBox;
+        overlayBox.SetGap(0.0);
+        for (auto& piece : scanline.trim(direction, origin, interval)) {
+            TopoDS_Edge edge = makeLine(piece.first, piece.second);
+            TechDraw::BaseGeomPtr base = BaseGeom::baseFactory(edge);
             if (!base) {
                 throw Base::ValueError("DGH::getTrimmedLines - baseFactory failed");
             }
+            overlayBox.Add(gp_Pnt(piece.first.x, piece.first.y, 0.0));
+            overlayBox.Add(gp_Pnt(piece.second.x, piece.second.y, 0.0));
+            resultEdges.push_back(edge);
             resultGeoms.push_back(base);
         }
+
+        //save the boundingBox of hatch pattern
+        ls.setBBox(overlayBox);
         ls.setEdges(resultEdges);
         ls.setGeoms(resultGeoms);
         result.push_back(ls);
@@ -53,6 +53,7 @@
 #include "DrawUtil.h"
 #include "Geometry.h"
 #include "GeometryObject.h"
+#include "PlanarArrangement.h"
 #include "ShapeUtils.h"
 
 
@@ -163,6 +164,53 @@ bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, b
     return false;
 }
 
+//find the end points of edges that lie on another edge. HLR does not provide all edge
+//intersections for edge end points, so these edges need to be split.
+//The end points are matched against the edge boxes with a sweep, only the candidates
+//inside a box are measured with isOnEdge.
+std::vector<splitPoint> DrawProjectSplit::getSplitPoints(const std::vector<TopoDS_Edge>& edges)
+{
+    std::vector<splitPoint> splits;
+    std::vector<Bnd_Box> boxes(edges.size());
+    std::vector<Base::Vector3d> points;
+    std::vector<int> pointEdges;
+    std::vector<TopoDS_Vertex> pointVertexes;
+    for (std::size_t iEdge = 0; iEdge < edges.size(); iEdge++) {
+        const TopoDS_Edge& e = edges[iEdge];
+        if (DrawUtil::isZeroEdge(e)) {
+            continue;                   //skip zero length edges. shouldn't happen ;)
+        }
+        Bnd_Box& box = boxes[iEdge];
+        BRepBndLib::AddOptimal(e, box);
+        box.SetGap(0.1);
+        if (box.IsVoid()) {
+            continue;
+        }
+        for (auto& v : {TopExp::FirstVertex(e), TopExp::LastVertex(e)}) {
+            gp_Pnt pnt = BRep_Tool::Pnt(v);
+            points.emplace_back(pnt.X(), pnt.Y(), pnt.Z());
+            pointEdges.push_back(iEdge);
+            pointVertexes.push_back(v);
+        }
+    }
+
+    for (auto& candidate : PlanarArrangement::pointsInBoxes(boxes, points)) {
+        int iEdge = candidate.first;
+        std::size_t iPoint = candidate.second;
+        if (pointEdges[iPoint] == iEdge) {
+            continue;
+        }
+        double param = -1;
+        if (isOnEdge(edges[iEdge], pointVertexes[iPoint], param, false)) {
+            splitPoint s;
+            s.i = iEdge;
+            s.v = points[iPoint];
+            s.param = param;
+            splits.push_back(s);
+        }
+    }
+    return splits;
+}
 
 std::vector<TopoDS_Edge> DrawProjectSplit::splitEdges(std::vector<TopoDS_Edge> edges, std::vector<splitPoint> splits)
 {
@@ -592,13 +640,27 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
     std::vector<TopoDS_Edge> overlapEdges;
     std::vector<bool> skipThisEdge(inEdges.size(), false);
     int edgeCount = inEdges.size();
+
+    //only edges with intersecting boxes can overlap. The pairs are found with a sweep
+    //and visited in the same order as a check of all pairs would do.
+    std::vector<Bnd_Box> boxes(inEdges.size());
+    for (int iEdge = 0; iEdge < edgeCount; iEdge++) {
+        BRepBndLib::Add(inEdges.at(iEdge), boxes[iEdge]);
+        boxes[iEdge].SetGap(0.1);           //generous
+    }
+    std::vector<std::pair<std::size_t, std::size_t>> candidates = PlanarArrangement::overlappingBoxes(boxes);
+    auto candidate = candidates.begin();
+
     int ie0 = 0;
     for (; ie0 < edgeCount; ie0++) {
         if (skipThisEdge.at(ie0)) {
             continue;
         }
-        int ie1 = ie0 + 1;
-        for (; ie1 < edgeCount; ie1++) {
+        while (candidate != candidates.end() && (int)candidate->first < ie0) {
+            ++candidate;
+        }
+        for (; candidate != candidates.end() && (int)candidate->first == ie0; ++candidate) {
+            int ie1 = candidate->second;
             if (skipThisEdge.at(ie1)) {
                 continue;
             }
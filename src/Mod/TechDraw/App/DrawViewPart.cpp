@@ -358,6 +358,15 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         go->projectShapeWithPolygonAlgo(shape, viewAxis);
     }
     else {
+        //mark the hlr as pending before painting the preview, getPreviewGeometryObject
+        //only hands it out while we are waiting for the exact result
+        waitingForHlr(true);
+
+        //show the polygon approximation until the exact result is available
+        if (Preferences::coarseFirst()) {
+            showCoarseGeometry(shape, viewAxis);
+        }
+
         //projectShape (the HLR process) runs in a separate thread since it can take a long time
         //note that &m_hlrWatcher in the third parameter is not strictly required, but using the
         //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
@@ -371,17 +380,49 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
         m_hlrFuture = QtConcurrent::run(std::move(lambda));
         m_hlrWatcher.setFuture(m_hlrFuture);
-        waitingForHlr(true);
     }
     return go;
 }
 
+//! paint a quick polygon approximation of shape until the exact geometry from the hlr
+//! thread is available. The approximation is kept apart from geometryObject, so dimensions,
+//! references and face extraction only ever see exact geometry.
+void DrawViewPart::showCoarseGeometry(const TopoDS_Shape& shape, const gp_Ax2& viewAxis)
+{
+    TechDraw::GeometryObjectPtr coarse(
+        std::make_shared<TechDraw::GeometryObject>(getNameInDocument(), this));
+    coarse->isPerspective(Perspective.getValue());
+    coarse->setFocus(Focus.getValue());
+    coarse->usePolygonHLR(true);
+    try {
+        coarse->projectShapeWithPolygonAlgo(shape, viewAxis);
+    }
+    catch (const Base::Exception& e) {
+        //not fatal, the exact geometry is still on its way
+        Base::Console().Log("DVP::showCoarseGeometry - %s - %s\n", getNameInDocument(), e.what());
+        return;
+    }
+
+    m_previewGeometryObject = coarse;
+    requestPaint();
+}
+
+//! the coarse geometry to paint while the hlr thread runs, nullptr otherwise
+TechDraw::GeometryObjectPtr DrawViewPart::getPreviewGeometryObject() const
+{
+    if (!waitingForHlr()) {
+        return nullptr;
+    }
+    return m_previewGeometryObject;
+}
+
 //! continue processing after hlr thread completes
 void DrawViewPart::onHlrFinished()
 {
     //    Base::Console().Message("DVP::onHlrFinished() - %s\n", getNameInDocument());
 
     //now that the new GeometryObject is fully populated, we can replace the old one
+    m_previewGeometryObject = nullptr;
     if (m_tempGeometryObject) {
         geometryObject = m_tempGeometryObject;//replace with new
         m_tempGeometryObject = nullptr;       //superfluous?
@@ -599,60 +640,7 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {//*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            continue;                   //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();//***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;//skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {//bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner), v1, param, false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner), v2, param, false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        }//inner loop
-    }    //outer loop
+    std::vector<splitPoint> splits = DrawProjectSplit::getSplitPoints(nonZero);
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(),
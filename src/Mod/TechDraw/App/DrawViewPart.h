@@ -133,6 +133,7 @@ public:
 
     bool hasGeometry() const;
     TechDraw::GeometryObjectPtr getGeometryObject() const { return geometryObject; }
+    TechDraw::GeometryObjectPtr getPreviewGeometryObject() const;
 
     TechDraw::VertexPtr getVertex(std::string vertexName) const;
     TechDraw::BaseGeomPtr getEdge(std::string edgeName) const;
@@ -222,6 +223,7 @@ protected:
 
     TechDraw::GeometryObjectPtr geometryObject;
     TechDraw::GeometryObjectPtr m_tempGeometryObject;//holds the new GO until hlr is completed
+    TechDraw::GeometryObjectPtr m_previewGeometryObject;//coarse GO painted until hlr is completed
     Base::BoundBox3d bbox;
 
     void onChanged(const App::Property* prop) override;
@@ -230,6 +232,7 @@ protected:
     virtual TechDraw::GeometryObjectPtr buildGeometryObject(TopoDS_Shape& shape,
                                                             const gp_Ax2& viewAxis);
     virtual TechDraw::GeometryObjectPtr makeGeometryForShape(TopoDS_Shape& shape);//const??
+    void showCoarseGeometry(const TopoDS_Shape& shape, const gp_Ax2& viewAxis);
     void partExec(TopoDS_Shape& shape);
     virtual void addPoints(void);
 
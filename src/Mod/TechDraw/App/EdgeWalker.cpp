@@ -29,6 +29,7 @@
 
 #ifndef _PreComp_
 # include <cmath>
+# include <set>
 # include <sstream>
 # include <BRep_Tool.hxx>
 # include <BRepBuilderAPI_MakeWire.hxx>
@@ -44,6 +45,7 @@
 
 #include "EdgeWalker.h"
 #include "DrawUtil.h"
+#include "PlanarArrangement.h"
 
 
 using namespace TechDraw;
@@ -270,26 +272,16 @@ std::vector<TopoDS_Vertex> EdgeWalker:: makeUniqueVList(std::vector<TopoDS_Edge>
 {
 //    Base::Console().Message("TRACE - EW::makeUniqueVList() - edgesIn: %d\n", edges.size());
     std::vector<TopoDS_Vertex> uniqueVert;
+    //the spatial hash only compares against the vertices near each end point
+    PlanarArrangement arrangement(EWTOLERANCE);
     for(auto& e:edges) {
-        Base::Vector3d v1 = DrawUtil::vertex2Vector(TopExp::FirstVertex(e));
-        Base::Vector3d v2 = DrawUtil::vertex2Vector(TopExp::LastVertex(e));
-        bool addv1 = true;
-        bool addv2 = true;
-        //check if we've already added this vertex
-        for (const auto& v: uniqueVert) {
-            Base::Vector3d v3d = DrawUtil::vertex2Vector(v);
-            if (v3d.IsEqual(v1, EWTOLERANCE)) {
-                addv1 = false;
+        TopoDS_Vertex ends[2] = {TopExp::FirstVertex(e), TopExp::LastVertex(e)};
+        for (auto& v: ends) {
+            //check if we've already added this vertex
+            std::size_t index = arrangement.addVertex(DrawUtil::vertex2Vector(v));
+            if (index == uniqueVert.size()) {
+                uniqueVert.push_back(v);
             }
-            if (v3d.IsEqual(v2, EWTOLERANCE)) {
-                addv2 = false;
-            }
-        }
-        if (addv1) {
-            uniqueVert.push_back(TopExp::FirstVertex(e));
-        }
-        if (addv2) {
-            uniqueVert.push_back(TopExp::LastVertex(e));
         }
     }
 //    Base::Console().Message("EW::makeUniqueVList - verts out: %d\n", uniqueVert.size());
@@ -302,15 +294,16 @@ std::vector<WalkerEdge> EdgeWalker::makeWalkerEdges(std::vector<TopoDS_Edge> edg
 {
 //    Base::Console().Message("TRACE - EW::makeWalkerEdges() - edges: %d  verts: %d\n", edges.size(), verts.size());
     m_saveInEdges = edges;
+    PlanarArrangement arrangement = makeArrangement(verts);
     std::vector<WalkerEdge> walkerEdges;
     for (const auto& e:edges) {
         TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(e);
         TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(e);
-        std::size_t vertex1Index = findUniqueVert(edgeVertex1, verts);
+        std::size_t vertex1Index = arrangement.findVertex(DrawUtil::vertex2Vector(edgeVertex1));
         if (vertex1Index == SIZE_MAX) {
             continue;
         }
-        std::size_t vertex2Index = findUniqueVert(edgeVertex2, verts);
+        std::size_t vertex2Index = arrangement.findVertex(DrawUtil::vertex2Vector(edgeVertex2));
         if (vertex2Index == SIZE_MAX) {
             continue;
         }
@@ -341,6 +334,16 @@ size_t EdgeWalker::findUniqueVert(TopoDS_Vertex vx, std::vector<TopoDS_Vertex> &
     return SIZE_MAX;
 }
 
+//! index the vertices in a spatial hash, keeping their indices in verts
+PlanarArrangement EdgeWalker::makeArrangement(const std::vector<TopoDS_Vertex>& verts)
+{
+    PlanarArrangement arrangement(EWTOLERANCE);
+    for (auto& v : verts) {
+        arrangement.insertVertex(DrawUtil::vertex2Vector(v));
+    }
+    return arrangement;
+}
+
 std::vector<TopoDS_Wire> EdgeWalker::sortStrip(std::vector<TopoDS_Wire> fw, bool includeBiggest)
 {
     std::vector<TopoDS_Wire> closedWires;                  //all the wires should be closed, but anomalies happen
@@ -389,34 +392,34 @@ std::vector<embedItem> EdgeWalker::makeEmbedding(const std::vector<TopoDS_Edge>
 //                            edges.size(), uniqueVList.size());
     std::vector<embedItem> result;
 
-    std::size_t iVert = 0;
-    //make an embedItem for each vertex in uniqueVList
-    //for each vertex v
-    //  find all the edges that have v as first or last vertex
-    for (auto& v: uniqueVList) {
-        TopoDS_Vertex cv = v;               //v is const but we need non-const for vertexEqual
-        std::size_t iEdge = 0;
-        std::vector<incidenceItem> iiList;
-        for (auto& e: edges) {
-            double angle = 0;
-            TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(e);
-            TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(e);
-            if (DrawUtil::vertexEqual(cv, edgeVertex1)) {
-                angle = DrawUtil::incidenceAngleAtVertex(e,v,EWTOLERANCE);
-                incidenceItem ii(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
-                iiList.push_back(ii);
-            } else if (DrawUtil::vertexEqual(cv, edgeVertex2)) {
-                angle = DrawUtil::incidenceAngleAtVertex(e,v,EWTOLERANCE);
-                incidenceItem ii(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
-                iiList.push_back(ii);
+    //find the vertices at the ends of each edge in the spatial hash instead of
+    //comparing every vertex with every edge
+    PlanarArrangement arrangement = makeArrangement(uniqueVList);
+    std::vector<std::vector<incidenceItem>> iiLists(uniqueVList.size());
+    std::size_t iEdge = 0;
+    for (auto& e: edges) {
+        std::size_t iVert1 = arrangement.findVertex(DrawUtil::vertex2Vector(TopExp::FirstVertex(e)));
+        std::size_t iVert2 = arrangement.findVertex(DrawUtil::vertex2Vector(TopExp::LastVertex(e)));
+        for (std::size_t iVert : {iVert1, iVert2}) {
+            if (iVert == SIZE_MAX || iEdge >= m_saveWalkerEdges.size()) {
+                continue;
+            }
+            double angle = DrawUtil::incidenceAngleAtVertex(e, uniqueVList[iVert], EWTOLERANCE);
+            incidenceItem ii(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
+            iiLists[iVert].push_back(ii);
+            if (iVert2 == iVert1) {
+                break;      //closed edge, only 1 incidence
             }
-            iEdge++;
-       }
+        }
+        iEdge++;
+    }
+
+    //make an embedItem for each vertex in uniqueVList
+    for (std::size_t iVert = 0; iVert < uniqueVList.size(); iVert++) {
        //sort incidenceList by angle
-       iiList = embedItem::sortIncidenceList(iiList,  false);
+       std::vector<incidenceItem> iiList = embedItem::sortIncidenceList(iiLists[iVert],  false);
        embedItem embed(iVert, iiList);
        result.push_back(embed);
-       iVert++;
     }
     return result;
 }
@@ -512,18 +515,18 @@ ewWireList ewWireList::removeDuplicateWires()
     if (wires.empty()) {
         return result;
     }
-    result.push_back(*(wires.begin()));                //save the first ewWire
-    std::vector<ewWire>::iterator iWire = (wires.begin()) + 1;    //starting with second
-    for (; iWire != wires.end(); iWire++) {
-        bool addToResult = true;
-        for (auto& w:result.wires) {
-            if ((*iWire).isEqual(w))  {             //already in result?
-                addToResult = false;
-                break;
-            }
+    //wires are equal if they have the same set of edge indices, so the sorted
+    //indices are a key to find the duplicates without comparing all pairs
+    std::set<std::vector<std::size_t>> seen;
+    for (auto& w : wires) {
+        std::vector<std::size_t> key;
+        key.reserve(w.wedges.size());
+        for (auto& we : w.wedges) {
+            key.push_back(we.idx);
         }
-        if (addToResult) {
-            result.push_back((*iWire));
+        std::sort(key.begin(), key.end());
+        if (seen.insert(key).second) {             //not yet in result?
+            result.push_back(w);
         }
     }
     return result;
@@ -45,6 +45,8 @@
 namespace TechDraw {
 //using namespace boost;
 
+class PlanarArrangement;
+
 using graph =
     boost::adjacency_list
         < boost::vecS,
@@ -179,6 +181,7 @@ public:
 
 protected:
     bool prepare();
+    static PlanarArrangement makeArrangement(const std::vector<TopoDS_Vertex>& verts);
     static bool wireCompare(const TopoDS_Wire& w1, const TopoDS_Wire& w2);
     std::vector<TechDraw::WalkerEdge> m_saveWalkerEdges;
     std::vector<TopoDS_Edge> m_saveInEdges;
@@ -311,8 +311,8 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
 
     try {
         // HLRBRep_PolyAlgo will fail if the whole input shape has not been meshed.
-        // meshing the faces is not sufficient.
-        BRepMesh_IncrementalMesh(inCopy, 0.10);
+        // meshing the faces is not sufficient. The faces are meshed in parallel.
+        BRepMesh_IncrementalMesh(inCopy, 0.10, Standard_False, 0.5, Standard_True);
 
         brep_hlrPoly = new HLRBRep_PolyAlgo();
         brep_hlrPoly->Load(inCopy);
@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <cmath>
+# include <limits>
+# include <BRep_Tool.hxx>
+# include <BRepAdaptor_Curve.hxx>
+# include <GCPnts_TangentialDeflection.hxx>
+# include <Precision.hxx>
+# include <TopExp.hxx>
+# include <TopExp_Explorer.hxx>
+# include <TopoDS.hxx>
+# include <TopoDS_Edge.hxx>
+# include <TopoDS_Vertex.hxx>
+#endif
+
+#include "HatchScanline.h"
+
+
+using namespace TechDraw;
+
+namespace {
+//sampling of curved boundary edges. The samples only need to separate the crossings
+//of one hatch line, the crossing points themselves are found on the exact curve.
+constexpr double angularDeflection = 0.1;
+constexpr double curvatureDeflection = 0.001;
+//crossings closer than this to the exact curve are not refined further
+constexpr double crossingTolerance = 1.0e-10;
+constexpr int maxRefinements = 50;
+}
+
+HatchScanline::HatchScanline(const TopoDS_Face& face)
+{
+    if (face.IsNull()) {
+        return;
+    }
+    TopExp_Explorer expl(face, TopAbs_EDGE);
+    for (; expl.More(); expl.Next()) {
+        addEdge(TopoDS::Edge(expl.Current()));
+    }
+}
+
+//! sample the edge into outline segments. The end points are taken from the edge's
+//! vertexes so that the segments of adjacent edges share their end points exactly and
+//! every boundary loop is closed, whatever the order and orientation of the edges.
+void HatchScanline::addEdge(const TopoDS_Edge& edge)
+{
+    if (BRep_Tool::Degenerated(edge)) {
+        return;
+    }
+    BRepAdaptor_Curve adapt(edge);
+    double first = adapt.FirstParameter();
+    double last = adapt.LastParameter();
+
+    std::vector<double> params;
+    int curve = -1;
+    if (adapt.GetType() == GeomAbs_Line) {
+        params = {first, last};
+    } else {
+        GCPnts_TangentialDeflection sampler(adapt, first, last, angularDeflection, curvatureDeflection, 3);
+        for (int i = 1; i <= sampler.NbPoints(); i++) {
+            params.push_back(sampler.Parameter(i));
+        }
+        double f, l;
+        Handle(Geom_Curve) geomCurve = BRep_Tool::Curve(edge, f, l);
+        if (!geomCurve.IsNull()) {
+            curve = m_curves.size();
+            m_curves.push_back(geomCurve);
+        }
+    }
+    if (params.size() < 2) {
+        return;
+    }
+
+    std::vector<Sample> samples;
+    for (double param : params) {
+        gp_Pnt pnt = adapt.Value(param);
+        samples.push_back({pnt.X(), pnt.Y(), param});
+    }
+    TopoDS_Vertex v1 = TopExp::FirstVertex(edge);
+    TopoDS_Vertex v2 = TopExp::LastVertex(edge);
+    if (!v1.IsNull()) {
+        gp_Pnt pnt = BRep_Tool::Pnt(v1);
+        samples.front().x = pnt.X();
+        samples.front().y = pnt.Y();
+    }
+    if (!v2.IsNull()) {
+        gp_Pnt pnt = BRep_Tool::Pnt(v2);
+        samples.back().x = pnt.X();
+        samples.back().y = pnt.Y();
+    }
+
+    for (std::size_t i = 1; i < samples.size(); i++) {
+        m_segments.push_back({samples[i - 1], samples[i], curve});
+    }
+}
+
+//! the point where the line {p : normal * p = level} crosses segment. The ends of the
+//! segment are on different sides of the line.
+Base::Vector3d HatchScanline::crossing(const Segment& segment, const Base::Vector3d& normal, double level) const
+{
+    double levelStart = normal.x * segment.start.x + normal.y * segment.start.y - level;
+    double levelEnd = normal.x * segment.end.x + normal.y * segment.end.y - level;
+    double ratio = levelStart / (levelStart - levelEnd);
+    Base::Vector3d linear(segment.start.x + ratio * (segment.end.x - segment.start.x),
+                          segment.start.y + ratio * (segment.end.y - segment.start.y),
+                          0.0);
+    if (segment.curve < 0) {
+        return linear;
+    }
+
+    //regula falsi (Illinois variant) on the exact curve, bracketed by the segment's params
+    const Handle(Geom_Curve)& curve = m_curves.at(segment.curve);
+    double ua = segment.start.param;
+    double ub = segment.end.param;
+    gp_Pnt pnt = curve->Value(ua);
+    double fa = normal.x * pnt.X() + normal.y * pnt.Y() - level;
+    pnt = curve->Value(ub);
+    double fb = normal.x * pnt.X() + normal.y * pnt.Y() - level;
+    if ((fa < 0.0 && fb < 0.0) || (fa > 0.0 && fb > 0.0)) {
+        //the ends were moved onto the vertexes and the curve does not bracket the level
+        return linear;
+    }
+    if (fa == fb) {
+        return linear;
+    }
+
+    int side = 0;
+    for (int i = 0; i < maxRefinements; i++) {
+        double u = (ua * fb - ub * fa) / (fb - fa);
+        pnt = curve->Value(u);
+        double fu = normal.x * pnt.X() + normal.y * pnt.Y() - level;
+        if (std::fabs(fu) < crossingTolerance) {
+            break;
+        }
+        if ((fu < 0.0) == (fb < 0.0)) {
+            ub = u;
+            fb = fu;
+            if (side == -1) {
+                fa /= 2.0;
+            }
+            side = -1;
+        } else {
+            ua = u;
+            fa = fu;
+            if (side == 1) {
+                fb /= 2.0;
+            }
+            side = 1;
+        }
+        if (fb == fa) {
+            break;
+        }
+    }
+    return Base::Vector3d(pnt.X(), pnt.Y(), 0.0);
+}
+
+std::vector<std::pair<Base::Vector3d, Base::Vector3d>> HatchScanline::trim(Base::Vector3d direction,
+                                                                          const Base::Vector3d& point,
+                                                                          double spacing) const
+{
+    std::vector<std::pair<Base::Vector3d, Base::Vector3d>> result;
+    direction.z = 0.0;
+    if (m_segments.empty() ||
+        spacing < Precision::Confusion() ||
+        direction.Length() < Precision::Confusion()) {
+        return result;
+    }
+    direction.Normalize();
+    Base::Vector3d ortho(-direction.y, direction.x, 0.0);
+    double base = ortho.x * point.x + ortho.y * point.y;       //level of line 0
+
+    double low = std::numeric_limits<double>::max();
+    double high = -std::numeric_limits<double>::max();
+    for (auto& segment : m_segments) {
+        double levelStart = ortho.x * segment.start.x + ortho.y * segment.start.y;
+        double levelEnd = ortho.x * segment.end.x + ortho.y * segment.end.y;
+        low = std::min({low, levelStart, levelEnd});
+        high = std::max({high, levelStart, levelEnd});
+    }
+    //one extra line on each side absorbs rounding of the line index
+    long firstLine = (long)std::floor((low - base) / spacing) - 1;
+    long lastLine = (long)std::ceil((high - base) / spacing) + 1;
+
+    //crossings of each line, as distance along direction. A segment crosses a line if the
+    //line's level is in [lower, upper) of the segment's end levels, so a line through a
+    //vertex is counted once and loops always give an even number of crossings.
+    std::vector<std::vector<double>> crossings(lastLine - firstLine + 1);
+    for (auto& segment : m_segments) {
+        double levelStart = ortho.x * segment.start.x + ortho.y * segment.start.y;
+        double levelEnd = ortho.x * segment.end.x + ortho.y * segment.end.y;
+        double lower = std::min(levelStart, levelEnd);
+        double upper = std::max(levelStart, levelEnd);
+        if (lower == upper) {
+            continue;
+        }
+        long line = std::max(firstLine, (long)std::floor((lower - base) / spacing));
+        for (; line <= lastLine; line++) {
+            double level = base + line * spacing;
+            if (level < lower) {
+                continue;
+            }
+            if (level >= upper) {
+                break;
+            }
+            Base::Vector3d pnt = crossing(segment, ortho, level);
+            crossings[line - firstLine].push_back(direction.x * pnt.x + direction.y * pnt.y);
+        }
+    }
+
+    for (std::size_t i = 0; i < crossings.size(); i++) {
+        std::vector<double>& along = crossings[i];
+        if (along.size() < 2) {
+            continue;
+        }
+        std::sort(along.begin(), along.end());
+        Base::Vector3d linePoint = point + ((firstLine + (long)i) * spacing) * ortho;
+        linePoint.z = 0.0;
+        double lineStart = direction.x * linePoint.x + direction.y * linePoint.y;
+        for (std::size_t j = 0; j + 1 < along.size(); j += 2) {
+            if (along[j + 1] - along[j] < Precision::Confusion()) {
+                continue;
+            }
+            result.emplace_back(linePoint + (along[j] - lineStart) * direction,
+                                linePoint + (along[j + 1] - lineStart) * direction);
+        }
+    }
+    return result;
+}
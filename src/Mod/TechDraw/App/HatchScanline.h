@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef TECHDRAW_HATCHSCANLINE_H
+#define TECHDRAW_HATCHSCANLINE_H
+
+#include <utility>
+#include <vector>
+
+#include <Geom_Curve.hxx>
+#include <TopoDS_Face.hxx>
+
+#include <Base/Vector3D.h>
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+
+class TopoDS_Edge;
+
+namespace TechDraw
+{
+
+//! trims families of parallel hatch lines to the outline of a planar face without a
+//! boolean operation. The boundary edges are sampled once into closed polygons. For
+//! each line of a family the crossings with the polygon segments are collected in a
+//! single pass over the segments, sorted along the line and paired inside/outside by
+//! the even-odd rule. Crossings on curved edges are refined on the exact curve.
+class TechDrawExport HatchScanline
+{
+public:
+    //! the face is expected in the XY plane
+    explicit HatchScanline(const TopoDS_Face& face);
+    ~HatchScanline() = default;
+
+    bool isEmpty() const { return m_segments.empty(); }
+
+    //! the pieces inside the face of the lines point + k * spacing * ortho + t * direction,
+    //! where ortho is direction rotated by 90 degrees. The pieces are oriented along direction.
+    std::vector<std::pair<Base::Vector3d, Base::Vector3d>> trim(Base::Vector3d direction,
+                                                               const Base::Vector3d& point,
+                                                               double spacing) const;
+
+private:
+    struct Sample
+    {
+        double x;
+        double y;
+        double param;
+    };
+    //! a segment of the sampled outline. curve is the index into m_curves or -1 if the
+    //! segment is exact (on a line)
+    struct Segment
+    {
+        Sample start;
+        Sample end;
+        int curve;
+    };
+
+    void addEdge(const TopoDS_Edge& edge);
+    Base::Vector3d crossing(const Segment& segment, const Base::Vector3d& normal, double level) const;
+
+    std::vector<Segment> m_segments;
+    std::vector<Handle(Geom_Curve)> m_curves;
+};
+
+}  //end namespace TechDraw
+
+#endif  //TECHDRAW_HATCHSCANLINE_H
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <cmath>
+# include <gp_Pnt.hxx>
+#endif
+
+#include "PlanarArrangement.h"
+
+
+using namespace TechDraw;
+
+PlanarArrangement::PlanarArrangement(double tolerance)
+    : m_tolerance(tolerance > 0.0 ? tolerance : EWTOLERANCE)
+{
+}
+
+std::size_t PlanarArrangement::CellHash::operator()(const CellKey& key) const
+{
+    uint64_t h = static_cast<uint64_t>(key.x) * 73856093ULL;
+    h ^= static_cast<uint64_t>(key.y) * 19349663ULL;
+    h ^= static_cast<uint64_t>(key.z) * 83492791ULL;
+    return static_cast<std::size_t>(h);
+}
+
+PlanarArrangement::CellKey PlanarArrangement::cellOf(const Base::Vector3d& point) const
+{
+    return CellKey {static_cast<int64_t>(std::floor(point.x / m_tolerance)),
+                    static_cast<int64_t>(std::floor(point.y / m_tolerance)),
+                    static_cast<int64_t>(std::floor(point.z / m_tolerance))};
+}
+
+std::size_t PlanarArrangement::addVertex(const Base::Vector3d& point)
+{
+    std::size_t index = findVertex(point);
+    if (index != SIZE_MAX) {
+        return index;
+    }
+    return insertVertex(point);
+}
+
+std::size_t PlanarArrangement::insertVertex(const Base::Vector3d& point)
+{
+    std::size_t index = m_vertexes.size();
+    m_vertexes.push_back(point);
+    m_cells[cellOf(point)].push_back(index);
+    return index;
+}
+
+//! the first vertex in insertion order is returned, as a linear search would do
+std::size_t PlanarArrangement::findVertex(const Base::Vector3d& point) const
+{
+    std::size_t result = SIZE_MAX;
+    CellKey center = cellOf(point);
+    for (int64_t dx = -1; dx <= 1; dx++) {
+        for (int64_t dy = -1; dy <= 1; dy++) {
+            for (int64_t dz = -1; dz <= 1; dz++) {
+                auto it = m_cells.find(CellKey {center.x + dx, center.y + dy, center.z + dz});
+                if (it == m_cells.end()) {
+                    continue;
+                }
+                for (std::size_t index : it->second) {
+                    if (index < result && m_vertexes[index].IsEqual(point, m_tolerance)) {
+                        result = index;
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<std::pair<std::size_t, std::size_t>>
+PlanarArrangement::overlappingBoxes(const std::vector<Bnd_Box>& boxes)
+{
+    std::vector<std::pair<std::size_t, std::size_t>> result;
+    std::vector<std::size_t> order;
+    std::vector<double> xMin(boxes.size());
+    std::vector<double> xMax(boxes.size());
+    for (std::size_t i = 0; i < boxes.size(); i++) {
+        if (boxes[i].IsVoid()) {
+            continue;
+        }
+        double yMin, zMin, yMax, zMax;
+        boxes[i].Get(xMin[i], yMin, zMin, xMax[i], yMax, zMax);
+        order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&xMin](std::size_t a, std::size_t b) {
+        return xMin[a] < xMin[b];
+    });
+
+    std::vector<std::size_t> active;
+    for (std::size_t i : order) {
+        for (std::size_t a = 0; a < active.size();) {
+            std::size_t j = active[a];
+            if (xMax[j] < xMin[i]) {
+                //passed by the sweep
+                active[a] = active.back();
+                active.pop_back();
+                continue;
+            }
+            if (!boxes[i].IsOut(boxes[j])) {
+                result.emplace_back(std::min(i, j), std::max(i, j));
+            }
+            a++;
+        }
+        active.push_back(i);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<std::pair<std::size_t, std::size_t>>
+PlanarArrangement::pointsInBoxes(const std::vector<Bnd_Box>& boxes,
+                                 const std::vector<Base::Vector3d>& points)
+{
+    std::vector<std::pair<std::size_t, std::size_t>> result;
+    std::vector<std::size_t> order(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&points](std::size_t a, std::size_t b) {
+        return points[a].x < points[b].x;
+    });
+
+    for (std::size_t iBox = 0; iBox < boxes.size(); iBox++) {
+        const Bnd_Box& box = boxes[iBox];
+        if (box.IsVoid()) {
+            continue;
+        }
+        double xMin, yMin, zMin, xMax, yMax, zMax;
+        box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        auto it = std::lower_bound(order.begin(), order.end(), xMin, [&points](std::size_t a, double x) {
+            return points[a].x < x;
+        });
+        for (; it != order.end() && points[*it].x <= xMax; ++it) {
+            const Base::Vector3d& p = points[*it];
+            if (!box.IsOut(gp_Pnt(p.x, p.y, p.z))) {
+                result.emplace_back(iBox, *it);
+            }
+        }
+    }
+    return result;
+}
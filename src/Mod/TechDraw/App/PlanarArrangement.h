@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef TECHDRAW_PLANARARRANGEMENT_H
+#define TECHDRAW_PLANARARRANGEMENT_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Bnd_Box.hxx>
+
+#include <Base/Vector3D.h>
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+#include "DrawUtil.h"
+
+
+namespace TechDraw
+{
+
+//! spatial indexes used to build the planar graph of projected edges for face detection.
+//! Vertexes are snapped with a hash grid whose cell size is the snap tolerance, so a
+//! lookup only compares against the vertexes in the 27 neighbouring cells. Edge bounding
+//! boxes are matched against each other and against vertexes with a sweep along x.
+class TechDrawExport PlanarArrangement
+{
+public:
+    explicit PlanarArrangement(double tolerance = EWTOLERANCE);
+    ~PlanarArrangement() = default;
+
+    //! index of the first vertex within tolerance of point, the point is added if there is none
+    std::size_t addVertex(const Base::Vector3d& point);
+    //! add point as a new vertex even if there is another one within tolerance
+    std::size_t insertVertex(const Base::Vector3d& point);
+    //! index of the first vertex within tolerance of point or SIZE_MAX
+    std::size_t findVertex(const Base::Vector3d& point) const;
+    const std::vector<Base::Vector3d>& getVertexes() const { return m_vertexes; }
+
+    //! pairs (i, j) with i < j of boxes that are not out of each other, sorted by i then j
+    static std::vector<std::pair<std::size_t, std::size_t>> overlappingBoxes(const std::vector<Bnd_Box>& boxes);
+    //! pairs (box index, point index) of points that are not out of the boxes
+    static std::vector<std::pair<std::size_t, std::size_t>> pointsInBoxes(const std::vector<Bnd_Box>& boxes,
+                                                                          const std::vector<Base::Vector3d>& points);
+
+private:
+    struct CellKey
+    {
+        int64_t x;
+        int64_t y;
+        int64_t z;
+        bool operator==(const CellKey& other) const
+        {
+            return x == other.x && y == other.y && z == other.z;
+        }
+    };
+    struct CellHash
+    {
+        std::size_t operator()(const CellKey& key) const;
+    };
+
+    CellKey cellOf(const Base::Vector3d& point) const;
+
+    double m_tolerance;
+    std::vector<Base::Vector3d> m_vertexes;
+    std::unordered_map<CellKey, std::vector<std::size_t>, CellHash> m_cells;
+};
+
+}  //end namespace TechDraw
+
+#endif  //TECHDRAW_PLANARARRANGEMENT_H
@@ -61,6 +61,7 @@
 #include <QLocale>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QtConcurrentMap>
 #include <QtConcurrentRun>
 
 // OpenCasCade
@@ -599,3 +599,9 @@ bool Preferences::alwaysShowLabel()
 {
     return getPreferenceGroup("General")->GetBool("AlwaysShowLabel", false);
 }
+
+//! true if a polygon approximation should be shown while the exact hidden lines are calculated
+bool Preferences::coarseFirst()
+{
+    return getPreferenceGroup("General")->GetBool("CoarseFirst", false);
+}
@@ -138,6 +138,8 @@ public:
 
     static bool useCameraDirection();
     static bool alwaysShowLabel();
+
+    static bool coarseFirst();
 };
 
 
@@ -27,6 +27,7 @@
 #ifndef _PreComp_
 # include <sstream>
 # include <BRepLib.hxx>
+# include <BRep_Builder.hxx>
 # include <BRepMesh_IncrementalMesh.hxx>
 # include <HLRAlgo_Projector.hxx>
 # include <HLRBRep_Algo.hxx>
@@ -36,6 +37,7 @@
 # include <gp_Pnt.hxx>
 # include <TopExp_Explorer.hxx>
 # include <TopoDS.hxx>
+# include <TopoDS_Compound.hxx>
 # include <TopoDS_Shape.hxx>
 #endif
 
@@ -64,7 +66,7 @@ namespace TechDraw {
 }
 
 ProjectionAlgos::ProjectionAlgos(const TopoDS_Shape &Input, const Base::Vector3d &Dir)
-  : Input(Input), Direction(Dir)
+  : Input(Input), Direction(Dir), tessellatedTolerance(-1.0), tessellatedType(-1)
 {
     execute();
 }
@@ -76,6 +78,9 @@ ProjectionAlgos::~ProjectionAlgos()
 
 void ProjectionAlgos::execute()
 {
+    tessellatedTolerance = -1.0;
+    tessellatedType = -1;
+
     Handle( HLRBRep_Algo ) brep_hlr = new HLRBRep_Algo;
     brep_hlr->Add(Input);
 
@@ -100,6 +105,30 @@ void ProjectionAlgos::execute()
     HI = build3dCurves(shapes.IsoLineHCompound());// isoparamtriques   invisibly
 }
 
+void ProjectionAlgos::tessellate(ExtractionType type, double tolerance)
+{
+    if (tolerance == tessellatedTolerance && type == tessellatedType)
+        return;
+
+    // the outputs share their vertices, so they are meshed together instead of one
+    // after the other, and the edges are discretized in parallel
+    BRep_Builder builder;
+    TopoDS_Compound comp;
+    builder.MakeCompound(comp);
+    bool hidden = (type & WithHidden);
+    bool smooth = (type & WithSmooth);
+    for (const TopoDS_Shape* shape : {&V, &VO, smooth ? &V1 : nullptr,
+                                      hidden ? &H : nullptr, hidden ? &HO : nullptr,
+                                      hidden && smooth ? &H1 : nullptr}) {
+        if (shape && !shape->IsNull())
+            builder.Add(comp, *shape);
+    }
+    BRepMesh_IncrementalMesh(comp, tolerance, Standard_False, 0.5, Standard_True);
+
+    tessellatedTolerance = tolerance;
+    tessellatedType = type;
+}
+
 string ProjectionAlgos::getSVG(ExtractionType type,
                                double tolerance,
                                XmlAttributes V_style,
@@ -111,6 +140,7 @@ string ProjectionAlgos::getSVG(ExtractionType type,
 {
     stringstream result;
     SVGOutput output;
+    tessellate(type, tolerance);
 
     if (!H.IsNull() && (type & WithHidden)) {
         H_style.insert({"stroke", "rgb(0, 0, 0)"});
@@ -120,7 +150,6 @@ string ProjectionAlgos::getSVG(ExtractionType type,
         H_style.insert({"stroke-dasharray", "0.2, 0.1)"});
         H_style.insert({"fill", "none"});
         H_style.insert({"transform", "scale(1, -1)"});
-        BRepMesh_IncrementalMesh(H, tolerance);
         result  << "<g";
         for (const auto& attribute : H_style)
             result << "   " << attribute.first << "=\""
@@ -137,7 +166,6 @@ string ProjectionAlgos::getSVG(ExtractionType type,
         H0_style.insert({"stroke-dasharray", "0.02, 0.1)"});
         H0_style.insert({"fill", "none"});
         H0_style.insert({"transform", "scale(1, -1)"});
-        BRepMesh_IncrementalMesh(HO, tolerance);
         result  << "<g";
         for (const auto& attribute : H0_style)
             result << "   " << attribute.first << "=\""
@@ -153,7 +181,6 @@ string ProjectionAlgos::getSVG(ExtractionType type,
         V0_style.insert({"stroke-linejoin", "miter"});
         V0_style.insert({"fill", "none"});
         V0_style.insert({"transform", "scale(1, -1)"});
-        BRepMesh_IncrementalMesh(VO, tolerance);
         result  << "<g";
         for (const auto& attribute : V0_style)
             result << "   " << attribute.first << "=\""
@@ -169,7 +196,6 @@ string ProjectionAlgos::getSVG(ExtractionType type,
         V_style.insert({"stroke-linejoin", "miter"});
         V_style.insert({"fill", "none"});
         V_style.insert({"transform", "scale(1, -1)"});
-        BRepMesh_IncrementalMesh(V, tolerance);
         result  << "<g";
         for (const auto& attribute : V_style)
             result << "   " << attribute.first << "=\""
@@ -185,7 +211,6 @@ string ProjectionAlgos::getSVG(ExtractionType type,
         V1_style.insert({"stroke-linejoin", "miter"});
         V1_style.insert({"fill", "none"});
         V1_style.insert({"transform", "scale(1, -1)"});
-        BRepMesh_IncrementalMesh(V1, tolerance);
         result  << "<g";
         for (const auto& attribute : V1_style)
             result << "   " << attribute.first << "=\""
@@ -202,7 +227,6 @@ string ProjectionAlgos::getSVG(ExtractionType type,
         H1_style.insert({"stroke-dasharray", "0.09, 0.05)"});
         H1_style.insert({"fill", "none"});
         H1_style.insert({"transform", "scale(1, -1)"});
-        BRepMesh_IncrementalMesh(H1, tolerance);
         result  << "<g";
         for (const auto& attribute : H1_style)
             result << "   " << attribute.first << "=\""
@@ -220,35 +244,30 @@ string ProjectionAlgos::getDXF(ExtractionType type, double /*scale*/, double tol
 {
     stringstream result;
     DXFOutput output;
+    tessellate(type, tolerance);
 
     if (!H.IsNull() && (type & WithHidden)) {
         //float width = 0.15f/scale;
-        BRepMesh_IncrementalMesh(H, tolerance);
         result  << output.exportEdges(H);
     }
     if (!HO.IsNull() && (type & WithHidden)) {
         //float width = 0.15f/scale;
-        BRepMesh_IncrementalMesh(HO, tolerance);
         result  << output.exportEdges(HO);
     }
     if (!VO.IsNull()) {
         //float width = 0.35f/scale;
-        BRepMesh_IncrementalMesh(VO, tolerance);
         result  << output.exportEdges(VO);
     }
     if (!V.IsNull()) {
         //float width = 0.35f/scale;
-        BRepMesh_IncrementalMesh(V, tolerance);
         result  << output.exportEdges(V);
     }
     if (!V1.IsNull() && (type & WithSmooth)) {
         //float width = 0.35f/scale;
-        BRepMesh_IncrementalMesh(V1, tolerance);
         result  << output.exportEdges(V1);
     }
     if (!H1.IsNull() && (type & WithSmooth) && (type & WithHidden)) {
         //float width = 0.15f/scale;
-        BRepMesh_IncrementalMesh(H1, tolerance);
         result  << output.exportEdges(H1);
     }
 
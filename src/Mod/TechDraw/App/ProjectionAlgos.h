@@ -82,6 +82,13 @@ public:
     TopoDS_Shape HN;// contour edges invisibly
     TopoDS_Shape HO;// contours apparents invisibly
     TopoDS_Shape HI;// isoparamtriques   invisibly
+
+private:
+    /// mesh all the outputs used by type in a single parallel pass
+    void tessellate(ExtractionType type, double tolerance);
+
+    double tessellatedTolerance;
+    int tessellatedType;
 };
 
 } //namespace TechDraw
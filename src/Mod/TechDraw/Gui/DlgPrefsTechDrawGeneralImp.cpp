@@ -79,6 +79,7 @@ void DlgPrefsTechDrawGeneralImp::saveSettings()
 
     ui->cb_useCameraDirection->onSave();
     ui->cb_alwaysShowLabel->onSave();
+    ui->cb_coarseFirst->onSave();
 }
 
 void DlgPrefsTechDrawGeneralImp::loadSettings()
@@ -124,6 +125,7 @@ void DlgPrefsTechDrawGeneralImp::loadSettings()
 
     ui->cb_useCameraDirection->onRestore();
     ui->cb_alwaysShowLabel->onRestore();
+    ui->cb_coarseFirst->onRestore();
 }
 
 /**
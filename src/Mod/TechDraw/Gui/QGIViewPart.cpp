@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <map>
 
 #include <QPainterPath>
 #include <QKeyEvent>
@@ -44,6 +45,7 @@
 #include <Mod/TechDraw/App/DrawViewPart.h>
 #include <Mod/TechDraw/App/DrawViewSection.h>
 #include <Mod/TechDraw/App/Geometry.h>
+#include <Mod/TechDraw/App/GeometryObject.h>
 #include <Mod/TechDraw/App/DrawBrokenView.h>
 
 #include "DrawGuiUtil.h"
@@ -234,7 +236,8 @@ void QGIViewPart::drawViewPart()
     if (!viewPart)
         return;
     //    Base::Console().Message("QGIVP::DVP() - %s / %s\n", viewPart->getNameInDocument(), viewPart->Label.getValue());
-    if (!viewPart->hasGeometry()) {
+    TechDraw::GeometryObjectPtr preview = viewPart->getPreviewGeometryObject();
+    if (!preview && !viewPart->hasGeometry()) {
         removePrimitives();//clean the slate
         removeDecorations();
         return;
@@ -248,6 +251,11 @@ void QGIViewPart::drawViewPart()
     removePrimitives();//clean the slate
     removeDecorations();
 
+    if (preview) {
+        drawPreviewEdges(preview);
+        return;
+    }
+
     if (viewPart->handleFaces() && !viewPart->CoarseView.getValue()) {
         drawAllFaces();
     }
@@ -272,6 +280,23 @@ void QGIViewPart::drawAllFaces(void)
     std::vector<TechDraw::DrawHatch*> regularHatches = dvp->getHatches();
     std::vector<TechDraw::DrawGeomHatch*> geomHatches = dvp->getGeomHatches();
     const std::vector<TechDraw::FacePtr>& faceGeoms = dvp->getFaceGeometry();
+
+    // trim the geometric hatches of all the faces up front, each hatch does its faces in parallel
+    std::map<TechDraw::DrawGeomHatch*, std::vector<int>> geomHatchFaces;
+    for (int i = 0; i < (int)faceGeoms.size(); i++) {
+        TechDraw::DrawGeomHatch* fGeom = faceIsGeomHatched(i, geomHatches);
+        if (fGeom) {
+            geomHatchFaces[fGeom].push_back(i);
+        }
+    }
+    std::map<int, std::vector<LineSet>> geomHatchLines;
+    for (auto& hatchFaces : geomHatchFaces) {
+        std::vector<std::vector<LineSet>> lineSets = hatchFaces.first->getTrimmedLines(hatchFaces.second);
+        for (std::size_t i = 0; i < lineSets.size(); i++) {
+            geomHatchLines[hatchFaces.second[i]] = lineSets[i];
+        }
+    }
+
     int iFace(0);
     for (auto& face : faceGeoms) {
         QGIFace* newFace = drawFace(face, iFace);
@@ -286,7 +311,7 @@ void QGIViewPart::drawAllFaces(void)
             // geometric hatch (from PAT hatch specification)
             newFace->isHatched(true);
             newFace->setFillMode(QGIFace::GeomHatchFill);
-            std::vector<LineSet> lineSets = fGeom->getTrimmedLines(iFace);
+            std::vector<LineSet> lineSets = geomHatchLines[iFace];
             if (!lineSets.empty()) {
                 // this face has geometric hatch lines
                 newFace->clearLineSets();
@@ -429,6 +454,41 @@ void QGIViewPart::drawAllEdges()
     }
 }
 
+//! draw the coarse geometry shown until the exact geometry is available. It has no faces or
+//! vertices and its edges can't be selected, as they don't match the edges of the view.
+void QGIViewPart::drawPreviewEdges(const TechDraw::GeometryObjectPtr& preview)
+{
+    // vp already validated
+    auto vp = static_cast<ViewProviderViewPart*>(getViewProvider(getViewObject()));
+
+    const TechDraw::BaseGeomPtrVector& geoms = preview->getEdgeGeometry();
+    for (int iEdge = 0; iEdge < (int)geoms.size(); iEdge++) {
+        const TechDraw::BaseGeomPtr& geom = geoms[iEdge];
+        if (!showThisEdge(geom)) {
+            continue;
+        }
+
+        QGIEdge* item = new QGIEdge(iEdge);
+        addToGroup(item);
+        item->setFlag(QGraphicsItem::ItemIsSelectable, false);
+        item->setAcceptHoverEvents(false);
+        item->setPath(drawPainterPath(geom));
+        item->setNormalColor(PreferencesGui::getAccessibleQColor(PreferencesGui::normalQColor()));
+        if (!geom->getHlrVisible()) {
+            item->setLinePen(m_dashedLineGenerator->getLinePen(Preferences::HiddenLineStyle(),
+                                                               vp->LineWidth.getValue()));
+            item->setWidth(Rez::guiX(vp->HiddenWidth.getValue()));
+        }
+        else {
+            item->setLinePen(m_dashedLineGenerator->getLinePen(1, vp->LineWidth.getValue()));
+            item->setWidth(Rez::guiX(vp->LineWidth.getValue()));
+        }
+        item->setPos(0.0, 0.0);
+        item->setZValue(ZVALUE::EDGE);
+        item->setPrettyNormal();
+    }
+}
+
 void QGIViewPart::drawAllVertexes()
 {
     // dvp and vp already validated
@@ -47,6 +47,8 @@ class DrawGeomHatch;
 class DrawViewDetail;
 class DrawView;
 class LineGenerator;
+class GeometryObject;
+using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
 }
 
 namespace TechDrawGui
@@ -80,6 +82,7 @@ public:
 
     virtual void drawAllFaces();
     virtual void drawAllEdges();
+    void drawPreviewEdges(const TechDraw::GeometryObjectPtr& preview);
     virtual void drawAllVertexes();
 
     bool showThisEdge(TechDraw::BaseGeomPtr geom);
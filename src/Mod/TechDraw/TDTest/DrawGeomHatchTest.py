@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+
+import FreeCAD
+import Part
+import TechDraw
+import unittest
+
+
+class DrawGeomHatchTest(unittest.TestCase):
+    def setUp(self):
+        """Makes a face with a rectangular and two circular holes"""
+        self.patFile = FreeCAD.getResourceDir() + "Mod/TechDraw/PAT/FCPAT.pat"
+
+        outer = Part.makePolygon(
+            [
+                FreeCAD.Vector(3, 2, 0),
+                FreeCAD.Vector(103, 2, 0),
+                FreeCAD.Vector(103, 62, 0),
+                FreeCAD.Vector(3, 62, 0),
+                FreeCAD.Vector(3, 2, 0),
+            ]
+        )
+        square = Part.makePolygon(
+            [
+                FreeCAD.Vector(61, 33, 0),
+                FreeCAD.Vector(79, 33, 0),
+                FreeCAD.Vector(79, 47, 0),
+                FreeCAD.Vector(61, 47, 0),
+                FreeCAD.Vector(61, 33, 0),
+            ]
+        )
+        circle1 = Part.Wire(Part.makeCircle(6.5, FreeCAD.Vector(20, 22, 0)))
+        circle2 = Part.Wire(Part.makeCircle(6.5, FreeCAD.Vector(30, 45, 0)))
+        self.face = Part.Face([outer, square, circle1, circle2], "Part::FaceMakerBullseye")
+        self.assertEqual(len(self.face.Wires), 4)
+
+    def overlay(self, vertical):
+        """Trims lines 5mm apart with a boolean common, as the hatch used to be made"""
+        box = self.face.BoundBox
+        lines = []
+        for step in range(1, 25):
+            pos = step * 5.0
+            if vertical and box.XMin < pos < box.XMax:
+                lines.append(
+                    Part.makeLine(
+                        FreeCAD.Vector(pos, box.YMin - 1, 0), FreeCAD.Vector(pos, box.YMax + 1, 0)
+                    )
+                )
+            elif not vertical and box.YMin < pos < box.YMax:
+                lines.append(
+                    Part.makeLine(
+                        FreeCAD.Vector(box.XMin - 1, pos, 0), FreeCAD.Vector(box.XMax + 1, pos, 0)
+                    )
+                )
+        return self.face.common(Part.Compound(lines))
+
+    def compareWithCommon(self, patName, vertical):
+        hatch = TechDraw.makeGeomHatch(self.face, 1.0, patName, self.patFile)
+        reference = self.overlay(vertical)
+        print("{}: {} edges, common: {}".format(patName, len(hatch.Edges), len(reference.Edges)))
+        self.assertEqual(len(hatch.Edges), len(reference.Edges))
+        self.assertAlmostEqual(hatch.Length, reference.Length, places=3)
+
+    def testHorizontalHatchMatchesCommon(self):
+        """Tests if horizontal hatch lines are cut at the holes like a boolean common"""
+        self.compareWithCommon("Horizontal5", False)
+
+    def testVerticalHatchMatchesCommon(self):
+        """Tests if vertical hatch lines are cut at the holes like a boolean common"""
+        self.compareWithCommon("Vertical5", True)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+
+import struct
+
+import FreeCAD
+import Part
+import TechDraw
+import unittest
+
+
+class ProjectionAlgosTest(unittest.TestCase):
+    def setUp(self):
+        """Makes a tilted cylinder and torus, so the projection has curved hidden lines"""
+        cylinder = Part.makeCylinder(5, 20)
+        cylinder.rotate(FreeCAD.Vector(0, 0, 0), FreeCAD.Vector(1, 0, 0), 45)
+        torus = Part.makeTorus(10, 3, FreeCAD.Vector(30, 0, 0))
+        torus.rotate(FreeCAD.Vector(30, 0, 0), FreeCAD.Vector(1, 0, 0), 30)
+        self.shape = Part.makeCompound([cylinder, torus])
+        # projectToSVG and projectToDXF use a float tolerance
+        self.tolerance = struct.unpack("f", struct.pack("f", 0.1))[0]
+
+    def referenceOutputs(self):
+        """Projects the shape and meshes each output on its own, as the exports used to do"""
+        algo = Part.HLRBRep.Algo()
+        algo.add(self.shape)
+        algo.setProjector(
+            Origin=FreeCAD.Vector(0, 0, 0),
+            ZDir=FreeCAD.Vector(0, 0, 1),
+            XDir=FreeCAD.Vector(1, 0, 0),
+        )
+        algo.update()
+        algo.hide()
+        hlr = Part.HLRBRep.HLRToShape(algo)
+        outputs = {
+            "H": hlr.hCompound(),
+            "HO": hlr.outLineHCompound(),
+            "VO": hlr.outLineVCompound(),
+            "V": hlr.vCompound(),
+        }
+        for name, shape in list(outputs.items()):
+            if shape.isNull():
+                del outputs[name]
+                continue
+            shape = TechDraw.build3dCurves(shape)
+            # writeInventor meshes the shape with the same parameters as the old exports
+            shape.writeInventor(Mode=1, Deviation=self.tolerance)
+            outputs[name] = shape
+        return outputs
+
+    def checkSVG(self, svg, outputs, names):
+        position = 0
+        for name in names:
+            if name not in outputs:
+                continue
+            edges = TechDraw.exportSVGEdges(outputs[name])
+            found = svg.find(edges, position)
+            self.assertGreaterEqual(found, 0, "{} edges differ".format(name))
+            position = found + len(edges)
+
+    def testSVGMatchesSeparateMeshing(self):
+        """Tests if the SVG edges are the same as when each output was meshed on its own"""
+        outputs = self.referenceOutputs()
+        self.assertIn("H", outputs)
+        self.assertIn("V", outputs)
+        self.checkSVG(TechDraw.projectToSVG(self.shape), outputs, ["VO", "V"])
+        hidden = TechDraw.projectToSVG(self.shape, FreeCAD.Vector(0, 0, 1), "ShowHiddenLines")
+        self.checkSVG(hidden, outputs, ["H", "HO", "VO", "V"])
+
+    def testDXFVisibleLinesUnchanged(self):
+        """Tests if meshing the hidden lines along with the visible ones keeps the visible ones"""
+        plain = TechDraw.projectToDXF(self.shape)
+        hidden = TechDraw.projectToDXF(self.shape, FreeCAD.Vector(0, 0, 1), "ShowHiddenLines")
+        self.assertTrue(plain)
+        self.assertGreater(len(hidden), len(plain))
+        self.assertTrue(hidden.endswith(plain))
+        self.assertEqual(TechDraw.projectToDXF(self.shape), plain)
+
+
+if __name__ == "__main__":
+    unittest.main()
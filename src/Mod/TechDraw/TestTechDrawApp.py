@@ -21,10 +21,12 @@
 # **************************************************************************
 
 #tests that do not require Gui
+from TDTest.DrawGeomHatchTest import DrawGeomHatchTest  # noqa: F401
 from TDTest.DrawHatchTest import DrawHatchTest  # noqa: F401
 from TDTest.DrawViewAnnotationTest import DrawViewAnnotationTest  # noqa: F401
 from TDTest.DrawViewBalloonTest import DrawViewBalloonTest  # noqa: F401
 from TDTest.DrawViewImageTest import DrawViewImageTest  # noqa: F401
 from TDTest.DrawViewSymbolTest import DrawViewSymbolTest  # noqa: F401
 from TDTest.DrawProjectionGroupTest import DrawProjectionGroupTest  # noqa: F401
+from TDTest.ProjectionAlgosTest import ProjectionAlgosTest  # noqa: F401
 
@@ -0,0 +1,138 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *   Copyright (c) 2024 The FreeCAD Project Association AISBL             *
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# **************************************************************************/
+
+import FreeCAD
+import json
+import os
+import socket
+import tempfile
+import threading
+import unittest
+
+from freecad import worker
+
+
+class TestWorkerProtocol(unittest.TestCase):
+    def setUp(self):
+        self.worker = worker.Worker()
+
+    def serve(self, requests):
+        replies = []
+        lines = [json.dumps(r) if isinstance(r, dict) else r for r in requests]
+        self.worker.serve(lines, lambda text: replies.append(json.loads(text)))
+        return replies
+
+    def testCommands(self):
+        self.assertEqual(self.worker.handle({"id": 1, "command": "ping"}), {"id": 1, "ok": True})
+        status = self.worker.handle({"id": 2, "command": "status"})
+        self.assertTrue(status["ok"])
+        self.assertEqual(status["result"]["pid"], os.getpid())
+        self.assertFalse(self.worker.handle({"command": "unknown"})["ok"])
+
+    def testInvalidRequests(self):
+        self.assertFalse(self.worker.handle([1, 2])["ok"])
+        self.assertFalse(self.worker.handle({"id": 1})["ok"])
+        replies = self.serve(["{not json", "", '{"id": 3, "command": "ping"}'])
+        self.assertEqual(len(replies), 2)
+        self.assertFalse(replies[0]["ok"])
+        self.assertIsNone(replies[0]["id"])
+        self.assertEqual(replies[1], {"id": 3, "ok": True})
+
+    def testScript(self):
+        reply = self.worker.handle(
+            {"id": 1, "script": "print('hello')\nresult = args['a'] + 1", "args": {"a": 41}}
+        )
+        self.assertTrue(reply["ok"])
+        self.assertEqual(reply["result"], 42)
+        self.assertEqual(reply["output"], "hello\n")
+        self.assertGreaterEqual(reply["time"], 0.0)
+
+        # results that cannot be sent as JSON are sent as their representation
+        reply = self.worker.handle({"script": "result = {1, 2}"})
+        self.assertEqual(reply["result"], repr({1, 2}))
+
+    def testFailingScript(self):
+        reply = self.worker.handle({"script": "raise RuntimeError('job failed')"})
+        self.assertFalse(reply["ok"])
+        self.assertEqual(reply["error"], "job failed")
+        self.assertIn("RuntimeError", reply["traceback"])
+
+        self.assertTrue(self.worker.handle({"script": "import sys\nsys.exit(0)"})["ok"])
+        self.assertFalse(self.worker.handle({"script": "import sys\nsys.exit(3)"})["ok"])
+        self.assertEqual(self.worker.failed, 2)
+
+    def testDocumentsClosed(self):
+        documents = set(FreeCAD.listDocuments())
+        reply = self.worker.handle({"script": "import FreeCAD\nFreeCAD.newDocument('WorkerJob')"})
+        self.assertTrue(reply["ok"])
+        self.assertEqual(set(FreeCAD.listDocuments()), documents)
+
+    def testShutdown(self):
+        replies = self.serve([{"id": 1, "command": "shutdown"}, {"id": 2, "command": "ping"}])
+        self.assertEqual(len(replies), 1)
+        self.assertFalse(self.worker.running)
+
+
+class TestWorkerSocket(unittest.TestCase):
+    def setUp(self):
+        self.tempdir = tempfile.TemporaryDirectory()
+
+    def tearDown(self):
+        self.tempdir.cleanup()
+
+    def testRemoteAddress(self):
+        with self.assertRaises(ValueError):
+            worker._serveSocket(worker.Worker(), "0.0.0.0:0")
+
+    def testExistingFile(self):
+        address = os.path.join(self.tempdir.name, "worker.txt")
+        with open(address, "w") as f:
+            f.write("keep")
+        with self.assertRaises(FileExistsError):
+            worker._serveSocket(worker.Worker(), address)
+        self.assertTrue(os.path.isfile(address))
+
+    @unittest.skipUnless(hasattr(socket, "AF_UNIX"), "no local sockets")
+    def testLocalSocket(self):
+        address = os.path.join(self.tempdir.name, "worker.sock")
+        server = threading.Thread(target=worker._serveSocket, args=(worker.Worker(), address))
+        server.start()
+        try:
+            for _ in range(100):
+                if os.path.exists(address):
+                    break
+                threading.Event().wait(0.05)
+            client = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+            client.settimeout(10)
+            client.connect(address)
+            with client, client.makefile("w", encoding="utf-8") as requests:
+                requests.write('{"id": 1, "command": "ping"}\n{"id": 2, "command": "shutdown"}\n')
+                requests.flush()
+                # the worker closes the connection on shutdown
+                with client.makefile("r", encoding="utf-8") as stream:
+                    replies = [json.loads(line) for line in stream]
+        finally:
+            server.join(10)
+        self.assertEqual(replies, [{"id": 1, "ok": True}, {"id": 2, "ok": True}])
+        self.assertFalse(server.is_alive())
+        self.assertFalse(os.path.exists(address))
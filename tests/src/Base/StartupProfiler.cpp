@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include "Base/StartupProfiler.h"
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <sstream>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace fs = boost::filesystem;
+using Base::StartupProfiler;
+
+// The profiler records a single start-up, so these tests run in their order and the
+// second one finishes the recording
+
+TEST(StartupProfiler, phasesAreNested)
+{
+    ASSERT_FALSE(StartupProfiler::isFinished());
+    const auto& events = StartupProfiler::getEvents();
+    std::size_t first = events.size();
+
+    {
+        StartupProfiler::Phase outer("outer");
+        StartupProfiler::begin("inner", "module");
+        StartupProfiler::end();
+    }
+
+    ASSERT_EQ(events.size(), first + 2);
+    const auto& outer = events[first];
+    const auto& inner = events[first + 1];
+    EXPECT_EQ(outer.name, "outer");
+    EXPECT_EQ(outer.category, "phase");
+    EXPECT_EQ(inner.name, "inner");
+    EXPECT_EQ(inner.category, "module");
+    EXPECT_EQ(inner.depth, outer.depth + 1);
+    EXPECT_GE(inner.start, outer.start);
+    EXPECT_LE(inner.start + inner.duration, outer.start + outer.duration);
+}
+
+TEST(StartupProfiler, finishClosesPhasesAndWritesTrace)
+{
+    ASSERT_FALSE(StartupProfiler::isFinished());
+    fs::path traceFile = fs::temp_directory_path() / "unit_test_StartupProfiler.json";
+    StartupProfiler::setOutputFile(traceFile.string());
+
+    const auto& events = StartupProfiler::getEvents();
+    std::size_t open = events.size();
+    StartupProfiler::begin("open");
+    StartupProfiler::finish();
+    EXPECT_TRUE(StartupProfiler::isFinished());
+
+    // the total is put in front of the phases
+    ASSERT_EQ(events.size(), open + 2);
+    EXPECT_EQ(events.front().name, "Startup");
+    EXPECT_EQ(events.front().depth, -1);
+    EXPECT_EQ(events[open + 1].name, "open");
+    EXPECT_GE(events.front().duration, events[open + 1].start + events[open + 1].duration);
+
+    // nothing is recorded after the start-up
+    StartupProfiler::begin("late");
+    StartupProfiler::end();
+    EXPECT_EQ(events.size(), open + 2);
+
+    std::ifstream str(traceFile.string());
+    std::stringstream trace;
+    trace << str.rdbuf();
+    str.close();
+    fs::remove(traceFile);
+    EXPECT_EQ(trace.str().rfind("{\"traceEvents\":[", 0), 0);
+    EXPECT_NE(trace.str().find("{\"name\":\"open\",\"cat\":\"phase\",\"ph\":\"X\""),
+              std::string::npos);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
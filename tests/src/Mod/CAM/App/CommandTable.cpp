@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <Mod/CAM/App/CommandTable.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class CommandTableTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        parse("(start)\nG0 Z5\nN10 G1 X1.5 Y-2.25 F100\nG2 X3 Y0 I0.75 J1.125\n"
+                           "G81 X1 Y1 Z-2 R1 Q0.5\nM3 S1000\n");
+    }
+
+    void parse(const std::string& gcode)
+    {
+        std::istringstream str(gcode);
+        Path::GCodeParser parser(table);
+        parser.parse(str);
+        parser.finish();
+    }
+
+    Path::CommandTable table;
+};
+
+TEST_F(CommandTableTest, writeGCodeMatchesCommand)
+{
+    ASSERT_EQ(table.size(), 6U);
+    for (unsigned int i = 0; i < table.size(); i++) {
+        Path::Command cmd = table.get(i);
+        for (bool padzero : {true, false}) {
+            for (int precision : {0, 3, 6}) {
+                std::stringstream str;
+                table.writeGCode(str, i, precision, padzero);
+                EXPECT_EQ(str.str(), cmd.toGCode(precision, padzero)) << i;
+            }
+        }
+    }
+}
+
+TEST_F(CommandTableTest, columnarAccessors)
+{
+    EXPECT_EQ(table.getName(0), "(start)");
+    EXPECT_EQ(table.getName(2), "G1");
+
+    int keyX = table.findKey("X");
+    int keyI = table.findKey("I");
+    ASSERT_GE(keyX, 0);
+    ASSERT_GE(keyI, 0);
+    EXPECT_EQ(table.findKey("W"), -1);
+
+    EXPECT_FALSE(table.has(1, keyX));
+    EXPECT_DOUBLE_EQ(table.getParam(1, keyX, 7.0), 7.0);
+    EXPECT_DOUBLE_EQ(table.getParam(2, keyX), 1.5);
+    EXPECT_DOUBLE_EQ(table.getParam(3, keyI), 0.75);
+    // an unknown key is never present
+    EXPECT_FALSE(table.has(2, -1));
+    EXPECT_DOUBLE_EQ(table.getParam(2, -1, 3.0), 3.0);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
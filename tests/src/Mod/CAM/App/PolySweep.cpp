@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <Mod/CAM/libarea/PolySweep.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using namespace ClipperLib;
+
+class PolySweepTest: public ::testing::Test
+{
+protected:
+    static Path rect(cInt x, cInt y, cInt w, cInt h)
+    {
+        return {IntPoint(x, y), IntPoint(x + w, y), IntPoint(x + w, y + h), IntPoint(x, y + h)};
+    }
+
+    static Path star(cInt cx, cInt cy, double r, int points)
+    {
+        // a self intersecting star polygon
+        Path path;
+        for (int i = 0; i < points; i++) {
+            double a = 2 * M_PI * (i * 2 % points) / points;
+            path.emplace_back(cx + cInt(std::lround(r * std::cos(a))),
+                              cy + cInt(std::lround(r * std::sin(a))));
+        }
+        return path;
+    }
+
+    static Path randomPath(std::mt19937& gen, int size, cInt range)
+    {
+        std::uniform_int_distribution<cInt> coord(0, range);
+        Path path;
+        for (int i = 0; i < size; i++) {
+            path.emplace_back(coord(gen), coord(gen));
+        }
+        return path;
+    }
+
+    static double area(const Paths& paths)
+    {
+        double sum = 0;
+        for (const Path& path : paths) {
+            sum += Area(path);
+        }
+        return sum;
+    }
+
+    static double perimeter(const Paths& paths)
+    {
+        double length = 0;
+        for (const Path& path : paths) {
+            for (std::size_t i = 0, j = path.size() - 1; i < path.size(); j = i++) {
+                length += std::hypot(double(path[i].X - path[j].X), double(path[i].Y - path[j].Y));
+            }
+        }
+        return length;
+    }
+
+    // both engines round the intersections to the grid, so the boundaries of the
+    // results may be up to \a rounding grid units apart
+    static void expectSameArea(const Paths& sweep, const Paths& clipper, double rounding)
+    {
+        double tolerance = rounding * (perimeter(sweep) + perimeter(clipper));
+        EXPECT_NEAR(area(sweep), area(clipper), tolerance);
+
+        // the symmetric difference of both results is only the rounding
+        Paths difference;
+        Clipper xorClipper;
+        xorClipper.AddPaths(sweep, ptSubject, true);
+        xorClipper.AddPaths(clipper, ptClip, true);
+        xorClipper.Execute(ctXor, difference, pftNonZero, pftNonZero);
+        EXPECT_LE(std::fabs(area(difference)), tolerance);
+    }
+
+    static void compare(ClipType clipType, const Paths& subject, const Paths& clip,
+                        PolyFillType fillType, double rounding)
+    {
+        Paths sweep;
+        PolySweep::Execute(clipType, subject, clip, sweep, fillType, fillType);
+
+        Paths clipper;
+        Clipper c;
+        c.StrictlySimple(true);
+        c.AddPaths(subject, ptSubject, true);
+        c.AddPaths(clip, ptClip, true);
+        c.Execute(clipType, clipper, fillType, fillType);
+
+        expectSameArea(sweep, clipper, rounding);
+
+        // outer polygons are counter clockwise, holes clockwise, no polygon is degenerated
+        for (const Path& path : sweep) {
+            EXPECT_GE(path.size(), 3U);
+            EXPECT_NE(Area(path), 0.0);
+        }
+    }
+
+    static void compareAll(const Paths& subject, const Paths& clip, double rounding)
+    {
+        for (ClipType clipType : {ctIntersection, ctUnion, ctDifference, ctXor}) {
+            for (PolyFillType fillType : {pftEvenOdd, pftNonZero, pftPositive, pftNegative}) {
+                SCOPED_TRACE(testing::Message() << "clip type " << clipType << ", fill type "
+                                                << fillType);
+                compare(clipType, subject, clip, fillType, rounding);
+            }
+        }
+    }
+};
+
+TEST_F(PolySweepTest, randomPolygons)
+{
+    std::mt19937 gen(42);
+    for (int run = 0; run < 20; run++) {
+        SCOPED_TRACE(testing::Message() << "run " << run);
+        Paths subject {randomPath(gen, 12, 1000), randomPath(gen, 7, 1000)};
+        Paths clip {randomPath(gen, 10, 1000)};
+        compareAll(subject, clip, 0.25);
+    }
+}
+
+TEST_F(PolySweepTest, randomPolygonsLargeCoordinates)
+{
+    std::mt19937 gen(7);
+    for (int run = 0; run < 10; run++) {
+        SCOPED_TRACE(testing::Message() << "run " << run);
+        Paths subject {randomPath(gen, 15, cInt(1) << 40)};
+        Paths clip {randomPath(gen, 15, cInt(1) << 40)};
+        compareAll(subject, clip, 0.25);
+    }
+}
+
+TEST_F(PolySweepTest, sharedEdges)
+{
+    // collinear overlapping edges and a polygon sharing a whole edge
+    Paths subject {rect(0, 0, 100, 100), rect(100, 0, 100, 100)};
+    Paths clip {rect(50, 0, 100, 100), rect(50, 100, 20, 50)};
+    compareAll(subject, clip, 0);
+}
+
+TEST_F(PolySweepTest, touchingVertices)
+{
+    Paths subject {rect(0, 0, 100, 100), rect(100, 100, 100, 100)};
+    Paths clip {rect(100, 0, 100, 100)};
+    compareAll(subject, clip, 0);
+
+    // the polygons touching in a vertex are separated
+    Paths solution;
+    PolySweep::Execute(ctUnion, subject, Paths(), solution);
+    ASSERT_EQ(solution.size(), 2U);
+    for (const Path& path : solution) {
+        EXPECT_TRUE(Orientation(path));
+    }
+}
+
+TEST_F(PolySweepTest, duplicatesAndSpikes)
+{
+    Path spike {IntPoint(0, 0),
+                IntPoint(100, 0),
+                IntPoint(100, 50),
+                IntPoint(200, 50),
+                IntPoint(100, 50),
+                IntPoint(100, 100),
+                IntPoint(0, 100),
+                IntPoint(0, 100)};
+    Paths subject {spike, rect(0, 0, 100, 100)};
+    Paths clip {rect(0, 0, 100, 100), rect(20, 20, 10, 10), Path {IntPoint(5, 5), IntPoint(6, 6)}};
+    compareAll(subject, clip, 0);
+}
+
+TEST_F(PolySweepTest, selfIntersecting)
+{
+    Paths subject {star(0, 0, 1000, 5), star(300, 200, 700, 7)};
+    Paths clip {star(100, -50, 900, 9), rect(-200, -200, 400, 400)};
+    compareAll(subject, clip, 0.25);
+}
+
+TEST_F(PolySweepTest, holes)
+{
+    Path hole = rect(25, 25, 50, 50);
+    ReversePath(hole);
+    Paths subject {rect(0, 0, 100, 100), hole};
+    Paths clip {rect(50, -10, 10, 120)};
+    compareAll(subject, clip, 0);
+
+    Paths solution;
+    PolySweep::Execute(ctUnion, subject, Paths(), solution, pftNonZero, pftNonZero);
+    ASSERT_EQ(solution.size(), 2U);
+    EXPECT_DOUBLE_EQ(area(solution), 100.0 * 100.0 - 50.0 * 50.0);
+}
+
+TEST_F(PolySweepTest, offsetMatchesClipper)
+{
+    std::mt19937 gen(3);
+    for (JoinType joinType : {jtRound, jtSquare, jtMiter}) {
+        for (double delta : {-40.0, 25.0}) {
+            SCOPED_TRACE(testing::Message() << "join type " << joinType << ", delta " << delta);
+            Paths paths {randomPath(gen, 8, 1000), rect(100, 100, 300, 200)};
+            std::vector<EndType> endTypes {etClosedPolygon, etClosedPolygon};
+
+            Paths sweep;
+            PolySweep::Offset(paths, joinType, endTypes, delta, sweep);
+
+            ClipperOffset offset;
+            offset.AddPaths(paths, joinType, etClosedPolygon);
+            Paths clipper;
+            offset.Execute(clipper, delta);
+
+            expectSameArea(sweep, clipper, 0.25);
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
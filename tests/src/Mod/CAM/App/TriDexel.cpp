@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include <Base/Exception.h>
+#include <Mod/CAM/PathSimulator/App/TriDexel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class TriDexelTest: public ::testing::Test
+{
+protected:
+    static std::shared_ptr<cDexelTool> flatTool(float radius)
+    {
+        toolShapePoint tip;
+        tip.radiusPos = 0;
+        tip.heightPos = 0;
+        toolShapePoint edge;
+        edge.radiusPos = radius;
+        edge.heightPos = 0;
+        return std::make_shared<cDexelTool>(std::vector<toolShapePoint> {tip, edge}, radius, 20);
+    }
+
+    // a 10 mm cube with rays every 0.5 mm, the rays are at 0.25, 0.75, ...
+    static std::unique_ptr<cDexelStock> makeStock(int threads)
+    {
+        auto stock = std::make_unique<cDexelStock>(0, 0, 0, 10, 10, 10, 0.5F);
+        stock->SetThreads(threads);
+        stock->SetTool(flatTool(1));
+        return stock;
+    }
+
+    // a 2 mm deep slot along X through the middle of the stock
+    static std::vector<cDexelMoveResult> cutSlot(cDexelStock& stock)
+    {
+        stock.AddLinearMove(Point3D(-2, 5, 20), Point3D(-2, 5, 8), true);
+        stock.AddLinearMove(Point3D(-2, 5, 8), Point3D(12, 5, 8), false, 100);
+        stock.AddLinearMove(Point3D(12, 5, 8), Point3D(12, 5, 20), true);
+        return stock.Simulate();
+    }
+};
+
+TEST_F(TriDexelTest, rejectsNonPositiveResolution)
+{
+    EXPECT_THROW(cDexelStock(0, 0, 0, 10, 10, 10, 0), Base::ValueError);
+    EXPECT_THROW(cDexelStock(0, 0, 0, 10, 10, 10, -0.5F), Base::ValueError);
+}
+
+TEST_F(TriDexelTest, slotRemovesVolume)
+{
+    auto stock = makeStock(1);
+    EXPECT_NEAR(stock->GetVolume(), 1000.0, 1e-3);
+
+    auto results = cutSlot(*stock);
+    ASSERT_EQ(results.size(), 3U);
+
+    // four rows of 20 rays lose 2 mm each
+    EXPECT_NEAR(results[0].volume, 0.0, 1e-6);
+    EXPECT_NEAR(results[1].volume, 40.0, 1e-3);
+    EXPECT_NEAR(results[2].volume, 0.0, 1e-6);
+    EXPECT_NEAR(results[1].rate, 40.0 * 100 / 14, 1e-3);
+    EXPECT_FALSE(results[0].rapidCollision);
+    EXPECT_FALSE(results[2].rapidCollision);
+    EXPECT_NEAR(stock->GetVolume(), 960.0, 1e-3);
+}
+
+TEST_F(TriDexelTest, slotLowersHeights)
+{
+    auto stock = makeStock(1);
+    cutSlot(*stock);
+
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            // the rays at y = 4.25 ... 5.75 are inside the tool radius
+            float top = j >= 8 && j <= 11 ? 8.0F : 10.0F;
+            const auto& ray = stock->GetZDexel(i, j);
+            ASSERT_EQ(ray.size(), 2U) << i << ", " << j;
+            EXPECT_FLOAT_EQ(ray[0], 0.0F);
+            EXPECT_FLOAT_EQ(ray[1], top) << i << ", " << j;
+        }
+    }
+}
+
+TEST_F(TriDexelTest, rapidIntoStockCollides)
+{
+    auto stock = makeStock(1);
+    stock->AddLinearMove(Point3D(5, 5, 20), Point3D(5, 5, 9), true);
+    auto results = stock->Simulate();
+    ASSERT_EQ(results.size(), 1U);
+    EXPECT_TRUE(results[0].rapidCollision);
+    EXPECT_GT(results[0].volume, 0.0);
+}
+
+TEST_F(TriDexelTest, threadsGiveSameResult)
+{
+    auto serial = makeStock(1);
+    auto parallel = makeStock(4);
+    auto serialResults = cutSlot(*serial);
+    auto parallelResults = cutSlot(*parallel);
+
+    ASSERT_EQ(serialResults.size(), parallelResults.size());
+    for (std::size_t k = 0; k < serialResults.size(); k++) {
+        EXPECT_NEAR(serialResults[k].volume, parallelResults[k].volume, 1e-6);
+    }
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            EXPECT_EQ(serial->GetZDexel(i, j), parallel->GetZDexel(i, j));
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
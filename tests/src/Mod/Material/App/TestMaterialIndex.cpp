@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2024 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <Mod/Material/App/PreCompiled.h>
+#ifndef _PreComp_
+#endif
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QString>
+
+#include <Mod/Material/App/MaterialIndex.h>
+
+// clang-format off
+
+class TestMaterialIndex : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _libPath = QDir::tempPath() + QString::fromStdString("/TestMaterialIndex");
+        QDir libDir(_libPath);
+        libDir.removeRecursively(); // Clear old run data
+        libDir.mkpath(_libPath + QString::fromStdString("/Metals"));
+
+        _cardPath = _libPath + QString::fromStdString("/Metals/Steel.FCMat");
+        writeCard(QByteArray("General:\n  UUID: \"1\"\n"));
+        _indexFile = _libPath + QString::fromStdString("/Cache/library.index");
+    }
+
+    void TearDown() override {
+        QDir(_libPath).removeRecursively();
+    }
+
+    void writeCard(const QByteArray& data) {
+        QFile card(_cardPath);
+        card.open(QIODevice::WriteOnly);
+        card.write(data);
+        card.close();
+    }
+
+    static Materials::MaterialIndexEntry makeEntry() {
+        Materials::MaterialIndexEntry entry;
+        entry.uuid = QString::fromStdString("d8ce3f1e-7e6b-4ab1-8e8f-6c0b5c6d0e21");
+        entry.name = QString::fromStdString("Steel");
+        entry.parentUuid = QString::fromStdString("7f9fd73b-50c9-41d8-b7b2-575a030c1eeb");
+        entry.author = QString::fromStdString("Author");
+        entry.physicalModels << QString::fromStdString("f6f9e48c-b116-4e82-ad7f-3659a9219c50");
+        entry.appearanceModels << QString::fromStdString("f006c7e4-35b7-43d5-bbf9-c5d572309e6e");
+        return entry;
+    }
+
+    QString _libPath;
+    QString _cardPath;
+    QString _indexFile;
+};
+
+TEST_F(TestMaterialIndex, TestRoundTrip)
+{
+    Materials::MaterialIndex index(_libPath, _indexFile);
+    EXPECT_FALSE(index.read());
+
+    index.insert(QFileInfo(_cardPath), makeEntry());
+    EXPECT_EQ(index.size(), 1);
+    ASSERT_TRUE(index.write());
+
+    Materials::MaterialIndex restored(_libPath, _indexFile);
+    ASSERT_TRUE(restored.read());
+    EXPECT_EQ(restored.size(), 1);
+
+    auto entry = restored.find(QFileInfo(_cardPath));
+    ASSERT_NE(entry, nullptr);
+    auto expected = makeEntry();
+    EXPECT_EQ(entry->path, QString::fromStdString("Metals/Steel.FCMat"));
+    EXPECT_EQ(entry->uuid, expected.uuid);
+    EXPECT_EQ(entry->name, expected.name);
+    EXPECT_EQ(entry->parentUuid, expected.parentUuid);
+    EXPECT_EQ(entry->author, expected.author);
+    EXPECT_EQ(entry->physicalModels, expected.physicalModels);
+    EXPECT_EQ(entry->appearanceModels, expected.appearanceModels);
+}
+
+TEST_F(TestMaterialIndex, TestModifiedCard)
+{
+    Materials::MaterialIndex index(_libPath, _indexFile);
+    index.insert(QFileInfo(_cardPath), makeEntry());
+    ASSERT_NE(index.find(QFileInfo(_cardPath)), nullptr);
+
+    writeCard(QByteArray("General:\n  UUID: \"2\"\n  Author: \"Someone\"\n"));
+    EXPECT_EQ(index.find(QFileInfo(_cardPath)), nullptr);
+
+    QString otherCard = _libPath + QString::fromStdString("/Metals/Iron.FCMat");
+    EXPECT_EQ(index.find(QFileInfo(otherCard)), nullptr);
+}
+
+TEST_F(TestMaterialIndex, TestInvalidIndex)
+{
+    Materials::MaterialIndex index(_libPath, _indexFile);
+    index.insert(QFileInfo(_cardPath), makeEntry());
+    ASSERT_TRUE(index.write());
+
+    // The index belongs to a different library
+    Materials::MaterialIndex other(_libPath + QString::fromStdString("/Metals"), _indexFile);
+    EXPECT_FALSE(other.read());
+    EXPECT_EQ(other.size(), 0);
+
+    // A truncated index is rejected
+    QFile file(_indexFile);
+    ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+    file.resize(file.size() - 4);
+    file.close();
+    Materials::MaterialIndex truncated(_libPath, _indexFile);
+    EXPECT_FALSE(truncated.read());
+    EXPECT_EQ(truncated.size(), 0);
+}
+
+// clang-format on
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshBoolean.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/SetOperations.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshBooleanTest: public ::testing::Test
+{
+protected:
+    static MeshCore::MeshKernel MakeBox(const Base::Vector3f& min, const Base::Vector3f& max)
+    {
+        Base::Vector3f p[8] = {Base::Vector3f(min.x, min.y, min.z),
+                               Base::Vector3f(max.x, min.y, min.z),
+                               Base::Vector3f(max.x, max.y, min.z),
+                               Base::Vector3f(min.x, max.y, min.z),
+                               Base::Vector3f(min.x, min.y, max.z),
+                               Base::Vector3f(max.x, min.y, max.z),
+                               Base::Vector3f(max.x, max.y, max.z),
+                               Base::Vector3f(min.x, max.y, max.z)};
+        int facets[12][3] = {{0, 2, 1},
+                             {0, 3, 2},
+                             {4, 5, 6},
+                             {4, 6, 7},
+                             {0, 1, 5},
+                             {0, 5, 4},
+                             {1, 2, 6},
+                             {1, 6, 5},
+                             {2, 3, 7},
+                             {2, 7, 6},
+                             {3, 0, 4},
+                             {3, 4, 7}};
+        std::vector<MeshCore::MeshGeomFacet> geom;
+        for (const auto& it : facets) {
+            geom.emplace_back(p[it[0]], p[it[1]], p[it[2]]);
+        }
+        MeshCore::MeshKernel kernel;
+        kernel = geom;
+        return kernel;
+    }
+
+    static MeshCore::MeshKernel Run(const MeshCore::MeshKernel& mesh1,
+                                    const MeshCore::MeshKernel& mesh2,
+                                    MeshCore::MeshBoolean::OperationType type)
+    {
+        MeshCore::MeshKernel result;
+        MeshCore::MeshBoolean boolean(mesh1, mesh2, result, type);
+        EXPECT_TRUE(boolean.Do());
+        return result;
+    }
+
+    static MeshCore::MeshKernel RunSetOperations(const MeshCore::MeshKernel& mesh1,
+                                                 const MeshCore::MeshKernel& mesh2,
+                                                 bool legacy)
+    {
+        MeshCore::MeshKernel result;
+        MeshCore::SetOperations setOp(mesh1, mesh2, result, MeshCore::SetOperations::Union);
+        setOp.SetUseLegacyEngine(legacy);
+        setOp.Do();
+        return result;
+    }
+
+    static void ExpectSameMesh(const MeshCore::MeshKernel& mesh1,
+                               const MeshCore::MeshKernel& mesh2)
+    {
+        ASSERT_EQ(mesh1.CountFacets(), mesh2.CountFacets());
+        ASSERT_EQ(mesh1.CountPoints(), mesh2.CountPoints());
+        for (MeshCore::PointIndex i = 0; i < mesh1.CountPoints(); i++) {
+            EXPECT_EQ(mesh1.GetPoint(i), mesh2.GetPoint(i));
+        }
+    }
+};
+
+TEST_F(MeshBooleanTest, testUnionOfDisjointBoxes)
+{
+    auto box1 = MakeBox(Base::Vector3f(0, 0, 0), Base::Vector3f(1, 1, 1));
+    auto box2 = MakeBox(Base::Vector3f(2, 0, 0), Base::Vector3f(3, 1, 1));
+    auto result = Run(box1, box2, MeshCore::MeshBoolean::Union);
+    EXPECT_EQ(result.CountFacets(), 24);
+    EXPECT_NEAR(result.GetVolume(), 2.0F, 1e-5F);
+}
+
+TEST_F(MeshBooleanTest, testUnionOfNestedBoxes)
+{
+    auto box1 = MakeBox(Base::Vector3f(0, 0, 0), Base::Vector3f(3, 3, 3));
+    auto box2 = MakeBox(Base::Vector3f(1, 1, 1), Base::Vector3f(2, 2, 2));
+    auto result = Run(box1, box2, MeshCore::MeshBoolean::Union);
+    EXPECT_EQ(result.CountFacets(), 12);
+    EXPECT_NEAR(result.GetVolume(), 27.0F, 1e-4F);
+}
+
+TEST_F(MeshBooleanTest, testOverlappingBoxes)
+{
+    auto box1 = MakeBox(Base::Vector3f(0, 0, 0), Base::Vector3f(2, 2, 2));
+    auto box2 = MakeBox(Base::Vector3f(1, 1, 1), Base::Vector3f(3.1F, 3.2F, 3.3F));
+    float vol2 = 2.1F * 2.2F * 2.3F;
+
+    auto result = Run(box1, box2, MeshCore::MeshBoolean::Union);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_NEAR(result.GetVolume(), 8.0F + vol2 - 1.0F, 1e-4F);
+
+    result = Run(box1, box2, MeshCore::MeshBoolean::Intersect);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_NEAR(result.GetVolume(), 1.0F, 1e-4F);
+
+    result = Run(box1, box2, MeshCore::MeshBoolean::Difference);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_NEAR(result.GetVolume(), 7.0F, 1e-4F);
+}
+
+TEST_F(MeshBooleanTest, testNearlyCoplanarBoxes)
+{
+    auto box1 = MakeBox(Base::Vector3f(0, 0, 0), Base::Vector3f(2, 2, 2));
+    auto box2 = MakeBox(Base::Vector3f(1, 1, 1), Base::Vector3f(3, 3, 2.0000002F));
+
+    auto result = Run(box1, box2, MeshCore::MeshBoolean::Difference);
+    EXPECT_FALSE(result.HasOpenEdges());
+    EXPECT_NEAR(result.GetVolume(), 7.0F, 1e-4F);
+}
+
+TEST_F(MeshBooleanTest, testOpenMeshUsesGridAlgorithm)
+{
+    // the ray parity classification is meaningless for an open mesh
+    auto box1 = MakeBox(Base::Vector3f(0, 0, 0), Base::Vector3f(2, 2, 2));
+    box1.DeleteFacets({2, 3});
+    auto box2 = MakeBox(Base::Vector3f(1, 1, 1), Base::Vector3f(3.1F, 3.2F, 3.3F));
+    ASSERT_TRUE(box1.HasOpenEdges());
+
+    ExpectSameMesh(RunSetOperations(box1, box2, false), RunSetOperations(box1, box2, true));
+}
+
+TEST_F(MeshBooleanTest, testSelfIntersectingMeshUsesGridAlgorithm)
+{
+    auto box1 = MakeBox(Base::Vector3f(0, 0, 0), Base::Vector3f(2, 2, 2));
+    box1.Merge(MakeBox(Base::Vector3f(1, 1, 1), Base::Vector3f(3, 3, 3)));
+    auto box2 = MakeBox(Base::Vector3f(0.5F, 0.5F, 0.5F), Base::Vector3f(1.5F, 4, 1.5F));
+
+    ExpectSameMesh(RunSetOperations(box1, box2, false), RunSetOperations(box1, box2, true));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Segmentation.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SegmentationTest: public ::testing::Test
+{
+protected:
+    // Two perpendicular planar grids sharing the edge along the y axis
+    static MeshCore::MeshKernel MakeFold(int size)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                float x0 = float(i);
+                float x1 = float(i + 1);
+                float y0 = float(j);
+                float y1 = float(j + 1);
+                // plane z = 0
+                facets.emplace_back(Base::Vector3f(x0, y0, 0),
+                                    Base::Vector3f(x1, y0, 0),
+                                    Base::Vector3f(x1, y1, 0));
+                facets.emplace_back(Base::Vector3f(x0, y0, 0),
+                                    Base::Vector3f(x1, y1, 0),
+                                    Base::Vector3f(x0, y1, 0));
+                // plane x = 0
+                facets.emplace_back(Base::Vector3f(0, y0, x0),
+                                    Base::Vector3f(0, y1, x1),
+                                    Base::Vector3f(0, y0, x1));
+                facets.emplace_back(Base::Vector3f(0, y0, x0),
+                                    Base::Vector3f(0, y1, x0),
+                                    Base::Vector3f(0, y1, x1));
+            }
+        }
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    // Open cylinder around the z axis
+    static MeshCore::MeshKernel MakeCylinder(float radius, float height, int segments, int rings)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        auto point = [=](int i, int j) {
+            float angle = 2.0F * float(M_PI) * float(i) / float(segments);
+            return Base::Vector3f(radius * std::cos(angle),
+                                  radius * std::sin(angle),
+                                  height * float(j) / float(rings));
+        };
+        for (int i = 0; i < segments; i++) {
+            for (int j = 0; j < rings; j++) {
+                facets.emplace_back(point(i, j), point(i + 1, j), point(i + 1, j + 1));
+                facets.emplace_back(point(i, j), point(i + 1, j + 1), point(i, j + 1));
+            }
+        }
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+};
+
+TEST_F(SegmentationTest, testIncrementalPlaneFit)
+{
+    MeshCore::IncrementalPlaneFit fit;
+    EXPECT_EQ(fit.Fit(), FLOAT_MAX);
+    fit.AddPoint(Base::Vector3f(1000, 1000, 5));
+    fit.AddPoint(Base::Vector3f(1001, 1000, 5));
+    fit.AddPoint(Base::Vector3f(1000, 1001, 5));
+    fit.AddPoint(Base::Vector3f(1001, 1001, 5));
+    EXPECT_FALSE(fit.Done());
+    EXPECT_FLOAT_EQ(fit.Fit(), 0.0F);
+    EXPECT_TRUE(fit.Done());
+    EXPECT_FLOAT_EQ(std::fabs(fit.GetNormal().z), 1.0F);
+    EXPECT_FLOAT_EQ(fit.GetBase().z, 5.0F);
+    EXPECT_FLOAT_EQ(std::fabs(fit.GetDistanceToPlane(Base::Vector3f(0, 0, 7))), 2.0F);
+}
+
+TEST_F(SegmentationTest, testIncrementalPlaneFitDegenerated)
+{
+    MeshCore::IncrementalPlaneFit fit;
+    fit.AddPoint(Base::Vector3f(0, 0, 0));
+    fit.AddPoint(Base::Vector3f(1, 0, 1));
+    fit.AddPoint(Base::Vector3f(0, 1, 1));
+    EXPECT_FLOAT_EQ(fit.Fit(), 0.0F);
+    EXPECT_TRUE(fit.IsValid());
+
+    // collinear points don't define a plane and the previous plane must not be kept
+    fit.Clear();
+    EXPECT_FALSE(fit.IsValid());
+    EXPECT_TRUE(fit.GetNormal().IsNull());
+    fit.AddPoint(Base::Vector3f(0, 0, 0));
+    fit.AddPoint(Base::Vector3f(1, 0, 0));
+    fit.AddPoint(Base::Vector3f(2, 0, 0));
+    EXPECT_EQ(fit.Fit(), FLOAT_MAX);
+    EXPECT_FALSE(fit.IsValid());
+}
+
+TEST_F(SegmentationTest, testPlaneSurfaceFitDegeneratedSeed)
+{
+    // a needle triangle must not accept any other triangle
+    MeshCore::MeshGeomFacet needle(Base::Vector3f(0, 0, 0),
+                                   Base::Vector3f(1, 0, 0),
+                                   Base::Vector3f(2, 0, 0));
+    MeshCore::PlaneSurfaceFit fit;
+    fit.Initialize(needle);
+    fit.Fit();
+    EXPECT_EQ(fit.GetDistanceToSurface(Base::Vector3f(0, 0, 5)), FLOAT_MAX);
+
+    // a regular seed triangle defines the plane
+    MeshCore::MeshGeomFacet seed(Base::Vector3f(0, 0, 1),
+                                 Base::Vector3f(1, 0, 1),
+                                 Base::Vector3f(0, 1, 1));
+    fit.Initialize(seed);
+    fit.Fit();
+    EXPECT_FLOAT_EQ(std::fabs(fit.GetDistanceToSurface(Base::Vector3f(3, 4, 5))), 4.0F);
+}
+
+TEST_F(SegmentationTest, testParallelPlanarSegments)
+{
+    auto kernel = MakeFold(10);
+    auto factory = [] {
+        return std::make_unique<MeshCore::PlaneSurfaceFit>();
+    };
+
+    MeshCore::MeshParallelSegmentAlgorithm finder(kernel, factory, 10, 0.01F);
+    finder.SetThreads(1);
+    finder.SetSeedsPerRound(16);
+    auto segments = finder.FindSegments();
+    ASSERT_EQ(segments.size(), 2);
+    EXPECT_EQ(segments[0].size() + segments[1].size(), kernel.CountFacets());
+
+    MeshCore::MeshParallelSegmentAlgorithm parallel(kernel, factory, 10, 0.01F);
+    parallel.SetThreads(4);
+    parallel.SetSeedsPerRound(16);
+    EXPECT_EQ(parallel.FindSegments(), segments);
+}
+
+TEST_F(SegmentationTest, testRansacPlanes)
+{
+    auto kernel = MakeFold(10);
+    MeshCore::MeshRansacSegmentation ransac(kernel);
+    ransac.SetTypes(MeshCore::MeshRansacSegmentation::Plane);
+    ransac.SetTolerance(0.01F, 0.1F);
+    ransac.SetMinFacets(10);
+    auto primitives = ransac.FindPrimitives();
+    ASSERT_EQ(primitives.size(), 2);
+    EXPECT_EQ(primitives[0].segment.size(), 200);
+    EXPECT_EQ(primitives[1].segment.size(), 200);
+}
+
+TEST_F(SegmentationTest, testRansacCylinder)
+{
+    auto kernel = MakeCylinder(2.0F, 5.0F, 64, 10);
+    MeshCore::MeshRansacSegmentation ransac(kernel);
+    ransac.SetTolerance(0.05F, 0.2F);
+    ransac.SetMinFacets(100);
+    auto primitives = ransac.FindPrimitives();
+    ASSERT_EQ(primitives.size(), 1);
+    const auto& cylinder = primitives.front();
+    EXPECT_EQ(cylinder.type, MeshCore::MeshRansacSegmentation::Cylinder);
+    EXPECT_EQ(cylinder.segment.size(), kernel.CountFacets());
+    ASSERT_EQ(cylinder.parameters.size(), 7);
+    EXPECT_NEAR(std::fabs(cylinder.parameters[5]), 1.0F, 1e-3F);
+    EXPECT_NEAR(cylinder.parameters[6], 2.0F, 0.05F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Smoothing.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SmoothingTest: public ::testing::Test
+{
+protected:
+    // A noisy height field over a regular grid of size x size points
+    static MeshCore::MeshKernel MakeGrid(int size)
+    {
+        auto height = [](int i, int j) {
+            return ((i * 7 + j * 13) % 5) * 0.1F;
+        };
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i + 1 < size; i++) {
+            for (int j = 0; j + 1 < size; j++) {
+                Base::Vector3f p0(float(i), float(j), height(i, j));
+                Base::Vector3f p1(float(i + 1), float(j), height(i + 1, j));
+                Base::Vector3f p2(float(i + 1), float(j + 1), height(i + 1, j + 1));
+                Base::Vector3f p3(float(i), float(j + 1), height(i, j + 1));
+                facets.emplace_back(p0, p1, p2);
+                facets.emplace_back(p0, p2, p3);
+            }
+        }
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    static float Roughness(const MeshCore::MeshKernel& kernel)
+    {
+        float sum = 0.0F;
+        for (const auto& it : kernel.GetPoints()) {
+            sum += std::fabs(it.z - 0.2F);
+        }
+        return sum;
+    }
+};
+
+TEST_F(SmoothingTest, testLaplaceReducesNoise)
+{
+    auto kernel = MakeGrid(10);
+    float before = Roughness(kernel);
+    MeshCore::LaplaceSmoothing smooth(kernel);
+    smooth.Smooth(5);
+    EXPECT_LT(Roughness(kernel), before);
+}
+
+TEST_F(SmoothingTest, testBorderPointsAreKept)
+{
+    auto kernel = MakeGrid(10);
+    auto points = kernel.GetPoints();
+    MeshCore::TaubinSmoothing smooth(kernel);
+    smooth.Smooth(10);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        const auto& p = points[i];
+        if (p.x == 0.0F || p.y == 0.0F || p.x == 9.0F || p.y == 9.0F) {
+            EXPECT_EQ(kernel.GetPoint(i), p);
+        }
+    }
+}
+
+TEST_F(SmoothingTest, testFixedPointsAreKept)
+{
+    auto kernel = MakeGrid(10);
+    auto points = kernel.GetPoints();
+    std::vector<bool> mask(points.size(), false);
+    for (std::size_t i = 0; i < mask.size(); i += 3) {
+        mask[i] = true;
+    }
+
+    MeshCore::LaplaceSmoothing laplace(kernel);
+    laplace.SetFixedPoints(mask);
+    laplace.Smooth(5);
+    MeshCore::MedianFilterSmoothing median(kernel);
+    median.SetFixedPoints(mask);
+    median.Smooth(5);
+
+    for (std::size_t i = 0; i < mask.size(); i += 3) {
+        EXPECT_EQ(kernel.GetPoint(i), points[i]);
+    }
+}
+
+TEST_F(SmoothingTest, testThreadsGiveSameResult)
+{
+    auto kernel1 = MakeGrid(20);
+    auto kernel2 = kernel1;
+
+    MeshCore::TaubinSmoothing smooth1(kernel1);
+    smooth1.SetThreads(1);
+    smooth1.Smooth(10);
+    MeshCore::TaubinSmoothing smooth2(kernel2);
+    smooth2.SetThreads(4);
+    smooth2.Smooth(10);
+
+    for (std::size_t i = 0; i < kernel1.CountPoints(); i++) {
+        EXPECT_EQ(kernel1.GetPoint(i), kernel2.GetPoint(i));
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -128,6 +128,55 @@ protected:
         domains.push_back(domain2);
         return domains;
     }
+
+    // every square of a grid is a domain of two triangles, so that all inner points are
+    // shared by four domains. It is large enough for the welding to sort in parallel.
+    std::vector<Part::BRepMesh::Domain> getGridDomains(int size, double eps) const
+    {
+        std::vector<Part::BRepMesh::Domain> domains;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                // the points of every other domain are slightly moved
+                double offset = (i + j) % 2 == 0 ? 0.0 : eps;
+                Part::BRepMesh::Domain domain;
+                domain.points.emplace_back(i + offset, j + offset, offset);
+                domain.points.emplace_back(i + 1 + offset, j + offset, offset);
+                domain.points.emplace_back(i + 1 + offset, j + 1 + offset, offset);
+                domain.points.emplace_back(i + offset, j + 1 + offset, offset);
+
+                Part::BRepMesh::Facet f1;
+                f1.I1 = 0;
+                f1.I2 = 1;
+                f1.I3 = 2;
+                domain.facets.emplace_back(f1);
+                Part::BRepMesh::Facet f2;
+                f2.I1 = 0;
+                f2.I2 = 2;
+                f2.I3 = 3;
+                domain.facets.emplace_back(f2);
+                domains.push_back(domain);
+            }
+        }
+        return domains;
+    }
+
+    void checkGrid(const std::vector<Part::BRepMesh::Domain>& domains,
+                   const std::vector<Base::Vector3d>& points,
+                   const std::vector<Part::BRepMesh::Facet>& faces) const
+    {
+        // the facets keep their order and refer to the welded points
+        ASSERT_EQ(faces.size(), 2 * domains.size());
+        for (std::size_t i = 0; i < domains.size(); i++) {
+            const auto& domain = domains[i];
+            for (std::size_t j = 0; j < 2; j++) {
+                const auto& df = domain.facets[j];
+                const auto& face = faces[2 * i + j];
+                EXPECT_LT(Base::Distance(points[face.I1], domain.points[df.I1]), 1e-9);
+                EXPECT_LT(Base::Distance(points[face.I2], domain.points[df.I2]), 1e-9);
+                EXPECT_LT(Base::Distance(points[face.I3], domain.points[df.I3]), 1e-9);
+            }
+        }
+    }
 };
 
 TEST_F(BRepMeshTest, testNoDomains)
@@ -173,4 +222,36 @@ TEST_F(BRepMeshTest, testUnconnectedDomains)
     EXPECT_EQ(points.size(), 6);
     EXPECT_EQ(faces.size(), 4);
 }
+
+TEST_F(BRepMeshTest, testSharedPoints)
+{
+    const int size = 80;
+    auto domains = getGridDomains(size, 0.0);
+    std::vector<Base::Vector3d> points;
+    std::vector<Part::BRepMesh::Facet> faces;
+    Part::BRepMesh brepMesh;
+    brepMesh.getFacesFromDomains(domains, points, faces);
+
+    EXPECT_EQ(points.size(), (size + 1) * (size + 1));
+    checkGrid(domains, points, faces);
+
+    // the points are numbered in the order they are used
+    EXPECT_EQ(faces[0].I1, 0);
+    EXPECT_EQ(faces[0].I2, 1);
+    EXPECT_EQ(faces[0].I3, 2);
+    EXPECT_EQ(faces[1].I3, 3);
+}
+
+TEST_F(BRepMeshTest, testNearDuplicatedPoints)
+{
+    const int size = 80;
+    auto domains = getGridDomains(size, 1.0e-10);
+    std::vector<Base::Vector3d> points;
+    std::vector<Part::BRepMesh::Facet> faces;
+    Part::BRepMesh brepMesh;
+    brepMesh.getFacesFromDomains(domains, points, faces);
+
+    EXPECT_EQ(points.size(), (size + 1) * (size + 1));
+    checkGrid(domains, points, faces);
+}
 // NOLINTEND
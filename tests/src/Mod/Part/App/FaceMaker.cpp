@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+#include "Mod/Part/App/FaceMakerBullseye.h"
+#include "Mod/Part/App/FaceMakerCheese.h"
+
+#include "PartTestHelpers.h"
+
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using namespace Part;
+using namespace PartTestHelpers;
+
+class FaceMakerTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    static TopoDS_Wire square(double centerX, double centerY, double halfSize)
+    {
+        BRepBuilderAPI_MakePolygon polygon;
+        polygon.Add(gp_Pnt(centerX - halfSize, centerY - halfSize, 0.0));
+        polygon.Add(gp_Pnt(centerX + halfSize, centerY - halfSize, 0.0));
+        polygon.Add(gp_Pnt(centerX + halfSize, centerY + halfSize, 0.0));
+        polygon.Add(gp_Pnt(centerX - halfSize, centerY + halfSize, 0.0));
+        polygon.Close();
+        return polygon.Wire();
+    }
+
+    static TopoDS_Wire diamond(double centerX, double centerY, double halfSize)
+    {
+        BRepBuilderAPI_MakePolygon polygon;
+        polygon.Add(gp_Pnt(centerX, centerY - halfSize, 0.0));
+        polygon.Add(gp_Pnt(centerX + halfSize, centerY, 0.0));
+        polygon.Add(gp_Pnt(centerX, centerY + halfSize, 0.0));
+        polygon.Add(gp_Pnt(centerX - halfSize, centerY, 0.0));
+        polygon.Close();
+        return polygon.Wire();
+    }
+
+    static TopoDS_Shape build(FaceMaker& maker, const std::vector<TopoDS_Wire>& wires)
+    {
+        for (const auto& wire : wires) {
+            maker.addWire(wire);
+        }
+        maker.Build();
+        return maker.Shape();
+    }
+
+    static int countFaces(const TopoDS_Shape& shape)
+    {
+        TopTools_IndexedMapOfShape faces;
+        TopExp::MapShapes(shape, TopAbs_FACE, faces);
+        return faces.Extent();
+    }
+
+    static int countHoles(const TopoDS_Shape& shape)
+    {
+        TopTools_IndexedMapOfShape faces;
+        TopExp::MapShapes(shape, TopAbs_FACE, faces);
+        int holes = 0;
+        for (int i = 1; i <= faces.Extent(); ++i) {
+            TopTools_IndexedMapOfShape wires;
+            TopExp::MapShapes(faces(i), TopAbs_WIRE, wires);
+            holes += wires.Extent() - 1;
+        }
+        return holes;
+    }
+
+    // Three separate squares, each with two holes side by side
+    static std::vector<TopoDS_Wire> disjointGroups()
+    {
+        std::vector<TopoDS_Wire> wires;
+        for (int group = 0; group < 3; ++group) {
+            double offset = group * 100.0;
+            wires.push_back(square(offset, 0.0, 10.0));
+            wires.push_back(square(offset - 5.0, 0.0, 2.0));
+            wires.push_back(square(offset + 5.0, 0.0, 2.0));
+        }
+        return wires;
+    }
+
+    // A diamond and small squares in the corners of its bounding box, outside of it, plus a
+    // square whose bounding box touches the one of the diamond
+    static std::vector<TopoDS_Wire> touchingBoundingBoxes()
+    {
+        return {diamond(5.0, 5.0, 5.0),
+                square(0.75, 0.75, 0.75),
+                square(9.25, 0.75, 0.75),
+                square(0.75, 9.25, 0.75),
+                square(9.25, 9.25, 0.75),
+                square(12.0, 8.0, 2.0)};
+    }
+};
+
+TEST_F(FaceMakerTest, bullseyeNestedWires)
+{
+    // Arrange
+    FaceMakerBullseye maker;
+    std::vector<TopoDS_Wire> wires {square(0.0, 0.0, 10.0),
+                                    square(0.0, 0.0, 8.0),
+                                    square(0.0, 0.0, 6.0),
+                                    square(0.0, 0.0, 4.0),
+                                    square(0.0, 0.0, 2.0)};
+
+    // Act
+    TopoDS_Shape shape = build(maker, wires);
+
+    // Assert
+    EXPECT_EQ(countFaces(shape), 3);
+    EXPECT_EQ(countHoles(shape), 2);
+    EXPECT_NEAR(getArea(shape), (400.0 - 256.0) + (144.0 - 64.0) + 16.0, 1e-6);
+}
+
+TEST_F(FaceMakerTest, bullseyeDisjointGroups)
+{
+    // Arrange
+    FaceMakerBullseye maker;
+
+    // Act
+    TopoDS_Shape shape = build(maker, disjointGroups());
+
+    // Assert
+    EXPECT_EQ(countFaces(shape), 3);
+    EXPECT_EQ(countHoles(shape), 6);
+    EXPECT_NEAR(getArea(shape), 3 * (400.0 - 2 * 16.0), 1e-6);
+}
+
+TEST_F(FaceMakerTest, bullseyeTouchingBoundingBoxes)
+{
+    // Arrange
+    FaceMakerBullseye maker;
+
+    // Act
+    TopoDS_Shape shape = build(maker, touchingBoundingBoxes());
+
+    // Assert
+    EXPECT_EQ(countFaces(shape), 6);
+    EXPECT_EQ(countHoles(shape), 0);
+    EXPECT_NEAR(getArea(shape), 50.0 + 4 * 2.25 + 16.0, 1e-6);
+}
+
+TEST_F(FaceMakerTest, cheeseDisjointGroups)
+{
+    // Arrange
+    FaceMakerCheese maker;
+
+    // Act
+    TopoDS_Shape shape = build(maker, disjointGroups());
+
+    // Assert
+    EXPECT_EQ(countFaces(shape), 3);
+    EXPECT_EQ(countHoles(shape), 6);
+    EXPECT_NEAR(getArea(shape), 3 * (400.0 - 2 * 16.0), 1e-6);
+}
+
+TEST_F(FaceMakerTest, cheeseTouchingBoundingBoxes)
+{
+    // Arrange
+    FaceMakerCheese maker;
+
+    // Act
+    TopoDS_Shape shape = build(maker, touchingBoundingBoxes());
+
+    // Assert
+    EXPECT_EQ(countFaces(shape), 6);
+    EXPECT_EQ(countHoles(shape), 0);
+    EXPECT_NEAR(getArea(shape), 50.0 + 4 * 2.25 + 16.0, 1e-6);
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -4,8 +4,107 @@
 
 #include <src/App/InitApplication.h>
 
+#include <algorithm>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepBuilderAPI_Transform.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Trsf.hxx>
+#include <Mod/Part/App/modelRefine.h>
+
 #include "PartTestHelpers.h"
 
+namespace
+{
+
+// A rotation around a skew axis and a translation far from the origin, so that the planes and
+// axes of the shapes are not aligned with the coordinate axes
+gp_Trsf farFromOrigin()
+{
+    gp_Trsf rotation;
+    rotation.SetRotation(gp_Ax1(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(1.0, 2.0, 3.0)), 0.7);
+    gp_Trsf translation;
+    translation.SetTranslation(gp_Vec(1.0e5, -2.0e5, 3.0e5));
+    return translation * rotation;
+}
+
+TopoDS_Shape transformed(const TopoDS_Shape& shape)
+{
+    return BRepBuilderAPI_Transform(shape, farFromOrigin(), true).Shape();
+}
+
+TopoDS_Shape fuse(const TopoDS_Shape& base, const TopoDS_Shape& tool)
+{
+    BRepAlgoAPI_Fuse mkFuse(base, tool);
+    mkFuse.Build();
+    return mkFuse.Shape();
+}
+
+ModelRefine::FaceVectorType getFaces(const TopoDS_Shape& shape, GeomAbs_SurfaceType type)
+{
+    ModelRefine::FaceVectorType faces;
+    for (TopExp_Explorer it(shape, TopAbs_FACE); it.More(); it.Next()) {
+        TopoDS_Face face = TopoDS::Face(it.Current());
+        if (BRepAdaptor_Surface(face).GetType() == type) {
+            faces.push_back(face);
+        }
+    }
+    return faces;
+}
+
+// The grouping of FaceEqualitySplitter before the key points: every face is compared with the
+// first face of all groups in the order they were created
+std::vector<ModelRefine::FaceVectorType> groupAll(const ModelRefine::FaceVectorType& faces,
+                                                  const ModelRefine::FaceTypedBase& object)
+{
+    std::vector<ModelRefine::FaceVectorType> groups;
+    for (const auto& face : faces) {
+        auto it = std::find_if(groups.begin(), groups.end(), [&](const auto& group) {
+            return object.isEqual(group.front(), face);
+        });
+        if (it != groups.end()) {
+            it->push_back(face);
+        }
+        else {
+            groups.push_back({face});
+        }
+    }
+    groups.erase(std::remove_if(groups.begin(),
+                                groups.end(),
+                                [](const auto& group) {
+                                    return group.size() < 2;
+                                }),
+                 groups.end());
+    return groups;
+}
+
+testing::AssertionResult sameGroups(const std::vector<ModelRefine::FaceVectorType>& expected,
+                                    const ModelRefine::FaceEqualitySplitter& splitter)
+{
+    if (expected.size() != splitter.getGroupCount()) {
+        return testing::AssertionFailure()
+            << expected.size() << " groups expected, " << splitter.getGroupCount() << " found";
+    }
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        const auto& group = splitter.getGroup(i);
+        if (group.size() != expected[i].size()
+            || !std::equal(group.begin(),
+                           group.end(),
+                           expected[i].begin(),
+                           [](const TopoDS_Face& f1, const TopoDS_Face& f2) {
+                               return f1.IsSame(f2);
+                           })) {
+            return testing::AssertionFailure() << "group " << i << " differs";
+        }
+    }
+    return testing::AssertionSuccess();
+}
+
+}  // namespace
+
 class FeaturePartMakeElementRefineTest: public ::testing::Test,
                                         public PartTestHelpers::PartTestHelperClass
 {
@@ -51,3 +150,84 @@ TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineBoxes)
     // TODO: Refine doesn't work on compounds, so we're going to need a binary operation or the
     // like, and those don't exist yet.  Once they do, this test can be expanded
 }
+
+TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineCoplanarFarFromOrigin)
+{
+    // Arrange
+    TopoDS_Shape box1 = transformed(BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 0.0), 1.0, 2.0, 3.0));
+    TopoDS_Shape box2 = transformed(BRepPrimAPI_MakeBox(gp_Pnt(1.0, 0.0, 0.0), 1.0, 2.0, 3.0));
+    // Act
+    Part::TopoShape ts(fuse(box1, box2));
+    Part::TopoShape refined = ts.makeElementRefine();
+    // Assert
+    EXPECT_NEAR(PartTestHelpers::getVolume(refined.getShape()), 12.0, 1e-6);
+    EXPECT_EQ(ts.countSubElements("Face"), 10);
+    EXPECT_EQ(refined.countSubElements("Face"), 6);
+    EXPECT_EQ(refined.countSubElements("Edge"), 12);
+}
+
+TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineCoaxialCylinders)
+{
+    // Arrange
+    gp_Dir dir(0.0, 0.0, 1.0);
+    TopoDS_Shape lower =
+        transformed(BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(0.0, 0.0, 0.0), dir), 1.0, 1.0));
+    TopoDS_Shape upper =
+        transformed(BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(0.0, 0.0, 1.0), dir), 1.0, 1.0));
+    TopoDS_Shape wider =
+        transformed(BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(0.0, 0.0, 2.0), dir), 2.0, 1.0));
+    // Act
+    Part::TopoShape ts(fuse(fuse(lower, upper), wider));
+    Part::TopoShape refined = ts.makeElementRefine();
+    // Assert
+    double volume = PartTestHelpers::getVolume(ts.getShape());
+    EXPECT_NEAR(PartTestHelpers::getVolume(refined.getShape()), volume, 1e-6);
+    // The lateral faces of the same radius are joined, the coaxial one of the wider
+    // cylinder stays separate: lateral, bottom, annulus, wide lateral, top
+    EXPECT_EQ(refined.countSubElements("Face"), 5);
+    EXPECT_EQ(getFaces(refined.getShape(), GeomAbs_Cylinder).size(), 2);
+}
+
+TEST_F(FeaturePartMakeElementRefineTest, equalityGroupsInPreviousOrder)
+{
+    // Arrange
+    // boxes on a grid, so that faces of different boxes are coplanar
+    std::vector<TopoDS_Shape> shapes;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            for (int k = 0; k < 2; k++) {
+                gp_Pnt corner(1.5 * i, 1.5 * j, 2.0 * k);
+                shapes.push_back(transformed(BRepPrimAPI_MakeBox(corner, 1.0, 1.0, 1.0)));
+            }
+        }
+    }
+    // coaxial cylinders of two radii next to parallel ones
+    for (int i = 0; i < 3; i++) {
+        for (int k = 0; k < 3; k++) {
+            gp_Ax2 axis(gp_Pnt(10.0 + 5.0 * i, 0.0, 2.0 * k), gp_Dir(0.0, 0.0, 1.0));
+            shapes.push_back(transformed(BRepPrimAPI_MakeCylinder(axis, 1.0 + k % 2, 1.0)));
+        }
+    }
+    TopoDS_Compound compound;
+    BRep_Builder builder;
+    builder.MakeCompound(compound);
+    for (const auto& shape : shapes) {
+        builder.Add(compound, shape);
+    }
+    ModelRefine::FaceVectorType planes = getFaces(compound, GeomAbs_Plane);
+    ModelRefine::FaceVectorType cylinders = getFaces(compound, GeomAbs_Cylinder);
+    // Act
+    ModelRefine::FaceEqualitySplitter planeSplitter;
+    planeSplitter.split(planes, &ModelRefine::getPlaneObject());
+    ModelRefine::FaceEqualitySplitter cylinderSplitter;
+    cylinderSplitter.split(cylinders, &ModelRefine::getCylinderObject());
+    // Assert
+    EXPECT_TRUE(sameGroups(groupAll(planes, ModelRefine::getPlaneObject()), planeSplitter));
+    EXPECT_TRUE(
+        sameGroups(groupAll(cylinders, ModelRefine::getCylinderObject()), cylinderSplitter));
+    // 8 x and 8 y planes of the boxes, 4 z planes of the boxes that the caps of the
+    // cylinders share and 2 z planes with caps only
+    EXPECT_EQ(planeSplitter.getGroupCount(), 8 + 8 + 4 + 2);
+    // the cylinders of radius 1 are coaxial per column, those of radius 2 stand alone
+    EXPECT_EQ(cylinderSplitter.getGroupCount(), 3);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <Mod/Robot/App/TrajectorySolver.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class TrajectorySolverTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a path through the work space that also turns the wrist
+        Robot::Robot6Axis path;
+        for (int i = 0; i < 240; i++) {
+            double t = static_cast<double>(i) / 240.0;
+            path.setAxis(0, -120.0 + 240.0 * t);
+            path.setAxis(1, -90.0 + 40.0 * std::sin(2.0 * M_PI * t));
+            path.setAxis(2, 60.0 * std::cos(2.0 * M_PI * t));
+            path.setAxis(3, -300.0 + 600.0 * t);
+            path.setAxis(4, 110.0 * std::sin(4.0 * M_PI * t));
+            path.setAxis(5, 300.0 * std::cos(2.0 * M_PI * t));
+            targets.push_back(path.getTcp());
+        }
+        // a target out of reach in the middle of a block
+        targets[100].setPosition(Base::Vector3d(1e5, 0, 0));
+    }
+
+    std::vector<Robot::IKResult> solve(Robot::TrajectorySolver::Method method, int threads) const
+    {
+        Robot::Robot6Axis robot;
+        Robot::TrajectorySolver solver(robot);
+        solver.setMethod(method);
+        solver.setThreads(threads);
+        return solver.solve(targets);
+    }
+
+    void compare(const std::vector<Robot::IKResult>& res1,
+                 const std::vector<Robot::IKResult>& res2) const
+    {
+        ASSERT_EQ(res1.size(), res2.size());
+        for (std::size_t i = 0; i < res1.size(); i++) {
+            EXPECT_EQ(res1[i].reachable, res2[i].reachable) << "target " << i;
+            EXPECT_EQ(res1[i].withinLimits, res2[i].withinLimits) << "target " << i;
+            for (int j = 0; j < 6; j++) {
+                EXPECT_NEAR(res1[i].axis[j], res2[i].axis[j], 1e-5) << "target " << i;
+            }
+        }
+    }
+
+    std::vector<Base::Placement> targets;
+};
+
+TEST_F(TrajectorySolverTest, testClosedForm)
+{
+    Robot::Robot6Axis robot;
+    Robot::TrajectorySolver solver(robot);
+    EXPECT_TRUE(solver.hasClosedForm());
+}
+
+TEST_F(TrajectorySolverTest, testReachable)
+{
+    auto results = solve(Robot::TrajectorySolver::Automatic, 1);
+    for (std::size_t i = 0; i < results.size(); i++) {
+        EXPECT_EQ(results[i].reachable, i != 100) << "target " << i;
+    }
+}
+
+TEST_F(TrajectorySolverTest, testThreadsClosedForm)
+{
+    auto serial = solve(Robot::TrajectorySolver::Automatic, 1);
+    for (int threads : {2, 3, 7, 16}) {
+        compare(serial, solve(Robot::TrajectorySolver::Automatic, threads));
+    }
+}
+
+TEST_F(TrajectorySolverTest, testThreadsNumeric)
+{
+    auto serial = solve(Robot::TrajectorySolver::Numeric, 1);
+    for (int threads : {2, 5, 7}) {
+        compare(serial, solve(Robot::TrajectorySolver::Numeric, threads));
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
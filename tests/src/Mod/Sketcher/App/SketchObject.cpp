@@ -8,7 +8,10 @@
 #include <App/Document.h>
 #include <App/Expression.h>
 #include <App/ObjectIdentifier.h>
+#include <Mod/Part/App/Geometry.h>
+#include <Mod/Part/App/PropertyGeometryList.h>
 #include <Mod/Sketcher/App/GeoEnum.h>
+#include <Mod/Sketcher/App/GeometryFacade.h>
 #include <Mod/Sketcher/App/SketchObject.h>
 #include <src/App/InitApplication.h>
 
@@ -292,3 +295,85 @@ TEST_F(SketchObjectTest, testGetElementName)
     EXPECT_STREQ(reverse_export_name.second.c_str(), "Vertex1");
 #endif
 }
+
+TEST_F(SketchObjectTest, testAddGeometryUndo)
+{
+    // Arrange
+    auto doc = getObject()->getDocument();
+    doc->setUndoMode(1);
+    Part::GeomLineSegment line;
+    line.setPoints(Base::Vector3d(0.0, 0.0, 0.0), Base::Vector3d(1.0, 0.0, 0.0));
+    doc->openTransaction("Add first line");
+    getObject()->addGeometry(&line);
+    doc->commitTransaction();
+    const Part::Geometry* first = getObject()->getGeometry(0);
+
+    // Act
+    doc->openTransaction("Add second line");
+    getObject()->addGeometry(&line);
+    doc->commitTransaction();
+    const Part::Geometry* kept = getObject()->getGeometry(0);
+    doc->undo();
+
+    // Assert
+    EXPECT_EQ(kept, first);
+    ASSERT_EQ(getObject()->Geometry.getSize(), 1);
+    // the undo history shares the geometry instead of holding a copy
+    EXPECT_EQ(getObject()->getGeometry(0), first);
+}
+
+TEST_F(SketchObjectTest, testGeometryStateNotChangedInPlace)
+{
+    // Arrange
+    auto doc = getObject()->getDocument();
+    doc->setUndoMode(1);
+    Part::GeomLineSegment line;
+    line.setPoints(Base::Vector3d(0.0, 0.0, 0.0), Base::Vector3d(1.0, 0.0, 0.0));
+    doc->openTransaction("Add line");
+    getObject()->addGeometry(&line);
+    doc->commitTransaction();
+    std::unique_ptr<App::Property> copy(getObject()->Geometry.Copy());
+    auto snapshot = static_cast<Part::PropertyGeometryList*>(copy.get());
+    Sketcher::Constraint block;
+    block.Type = Sketcher::Block;
+    block.First = 0;
+    block.FirstPos = Sketcher::PointPos::none;
+
+    // Act
+    doc->openTransaction("Block line");
+    getObject()->addConstraint(&block);
+    doc->commitTransaction();
+
+    // Assert
+    EXPECT_TRUE(getObject()->getGeometryFacade(0)->getBlocked());
+    EXPECT_NE(getObject()->getGeometry(0), snapshot->getValues()[0]);
+    EXPECT_FALSE(Sketcher::GeometryFacade::getFacade(snapshot->getValues()[0])->getBlocked());
+
+    // Act
+    doc->undo();
+
+    // Assert
+    EXPECT_EQ(getObject()->Constraints.getSize(), 0);
+    EXPECT_FALSE(getObject()->getGeometryFacade(0)->getBlocked());
+    EXPECT_EQ(getObject()->getGeometry(0), snapshot->getValues()[0]);
+}
+
+TEST_F(SketchObjectTest, testSetGeometryValuesDuplicated)
+{
+    // Arrange
+    Part::GeomLineSegment line;
+    line.setPoints(Base::Vector3d(0.0, 0.0, 0.0), Base::Vector3d(1.0, 0.0, 0.0));
+    getObject()->addGeometry(&line);
+    Part::Geometry* first = getObject()->Geometry.getValues()[0];
+
+    // Act
+    getObject()->Geometry.setValues(std::vector<Part::Geometry*> {first, first});
+
+    // Assert
+    const std::vector<Part::Geometry*>& values = getObject()->Geometry.getValues();
+    ASSERT_EQ(values.size(), 2);
+    // the geometry of the list is kept, the duplicate gets its own copy
+    EXPECT_EQ(values[0], first);
+    EXPECT_NE(values[1], first);
+    EXPECT_EQ(values[1]->getTag(), first->getTag());
+}